@@ -14,7 +14,9 @@
 #include "util.h"
 #include <assert.h>
 #include <ctype.h>
+#include <limits.h>
 #include <inttypes.h>
+#include <math.h>
 #include <string.h>
 #include <time.h>
 
@@ -113,37 +115,6 @@ static inline double   unpack754_64(uint64_t i) { return unpack754(i, 64, 11); }
 
 static const bool swap_motorola = true;
 
-static unsigned fix_start_bit(bool motorola, unsigned start, unsigned siglen)
-{
-	if (motorola)
-		start = (8 * (7 - (start / 8))) + (start % 8) - (siglen - 1);
-	return start;
-}
-
-static const char *determine_unsigned_type(unsigned length)
-{
-	const char *type = "uint64_t";
-	if (length <= 32)
-		type = "uint32_t";
-	if (length <= 16)
-		type = "uint16_t";
-	if (length <= 8)
-		type = "uint8_t";
-	return type;
-}
-
-static const char *determine_signed_type(unsigned length)
-{
-	const char *type = "int64_t";
-	if (length <= 32)
-		type = "int32_t";
-	if (length <= 16)
-		type = "int16_t";
-	if (length <= 8)
-		type = "int8_t";
-	return type;
-}
-
 static const char *determine_type(unsigned length, bool is_signed, bool is_floating)
 {
 	if (is_floating)
@@ -167,22 +138,465 @@ static int comment(signal_t *sig, FILE *o, const char *indent)
 			sig->offset) < 0 ? - 1 : 0;
 }
 
-static int signal2deserializer(signal_t *sig, const char *msg_name, FILE *o, const char *indent)
+/* The bytes a signal occupies within the 'i' (Intel) or 'm' (Motorola,
+ * byte reversed) word, returns the number of bytes in the window. Byte 'k'
+ * of 'i' is byte 'k' of the CAN frame, byte 'k' of 'm' is byte '7 - k'. */
+static unsigned signal_byte_window(signal_t *sig, unsigned *first, unsigned *shift)
+{
+	assert(sig);
+	assert(first);
+	assert(shift);
+	const bool motorola  = (sig->endianess == endianess_motorola_e);
+	const unsigned start = fix_start_bit(motorola, sig->start_bit, sig->bit_length);
+	*first = start / 8;
+	*shift = start % 8;
+	return ((start + sig->bit_length - 1) / 8) - *first + 1;
+}
+
+/* Signals that are not extracted from the 64-bit 'm' and 'i' words; on a
+ * 32-bit target that is any signal that itself fits in 32-bits, otherwise
+ * it is any signal whose byte window fits in a 'uint32_t'. */
+static bool signal_uses_byte_window(signal_t *sig, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(copts);
+	unsigned first = 0, shift = 0;
+	if (copts->target_32bit)
+		return sig->bit_length <= 32;
+	if (!copts->use_byte_window)
+		return false;
+	return signal_byte_window(sig, &first, &shift) <= 4; /* must fit in 'uint32_t w' */
+}
+
+/* Print byte 'byte' (zero is the first byte on the wire) of the frame, which
+ * is either held in 'data' or in its two halves 'lo' and 'hi' */
+static int frame_byte(FILE *o, unsigned byte, dbc2c_options_t *copts)
+{
+	assert(o);
+	assert(copts);
+	assert(byte < 8);
+	if (copts->target_32bit) {
+		const char *half = byte < 4 ? "lo" : "hi";
+		if (byte % 4)
+			return fprintf(o, "(uint8_t)(%s >> %u)", half, (byte % 4) * 8);
+		return fprintf(o, "(uint8_t)%s", half);
+	}
+	if (byte)
+		return fprintf(o, "(uint8_t)(data >> %u)", byte * 8);
+	return fprintf(o, "(uint8_t)data");
+}
+
+static bool signal_uses_half(signal_t *sig, bool high)
+{
+	assert(sig);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	unsigned first = 0, shift = 0;
+	const unsigned bytes = signal_byte_window(sig, &first, &shift);
+	for (unsigned j = 0; j < bytes; j++) {
+		const unsigned byte = motorola ? 7 - (first + j) : first + j;
+		if ((byte >= 4) == high)
+			return true;
+	}
+	return false;
+}
+
+/* Assemble only the bytes a signal spans into the narrowest type that holds
+ * them, instead of shifting the full (and possibly byte reversed) 64-bit word.
+ * On a 32-bit target a signal may span five bytes, the fifth is or'ed in
+ * after the shift. */
+static int signal2window(signal_t *sig, FILE *o, const char *indent, uint64_t mask, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(o);
+	assert(indent);
+	assert(copts);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	unsigned first = 0, shift = 0;
+	const unsigned bytes = signal_byte_window(sig, &first, &shift);
+	const unsigned assembled = bytes > 4 ? 4 : bytes;
+	const char *type = determine_unsigned_type(assembled * 8);
+	assert(bytes <= 5 && sig->bit_length <= 32);
+
+	if (copts->target_32bit && !motorola) {
+		const unsigned start = first * 8 + shift;
+		if (start + sig->bit_length <= 32)
+			return fprintf(o, "%sw = (lo >> %u) & 0x%"PRIx64";\n", indent, start, mask) < 0 ? -1 : 0;
+		if (start >= 32)
+			return fprintf(o, "%sw = (hi >> %u) & 0x%"PRIx64";\n", indent, start - 32, mask) < 0 ? -1 : 0;
+		return fprintf(o, "%sw = ((lo >> %u) | (hi << %u)) & 0x%"PRIx64";\n", indent, start, 32 - start, mask) < 0 ? -1 : 0;
+	}
+
+	if (fprintf(o, "%sw = ", indent) < 0)
+		return -1;
+	if (bytes > 4 && fputc('(', o) < 0)
+		return -1;
+	if (shift && fputc('(', o) < 0)
+		return -1;
+	if (assembled > 1 && fprintf(o, "(%s)(", type) < 0)
+		return -1;
+	for (unsigned j = 0; j < assembled; j++) {
+		const unsigned byte = motorola ? 7 - (first + j) : first + j;
+		if (j && fputs(" | ", o) < 0)
+			return -1;
+		if (assembled > 1 && fprintf(o, j ? "((%s)" : "(%s)", type) < 0)
+			return -1;
+		if (frame_byte(o, byte, copts) < 0)
+			return -1;
+		if (j && fprintf(o, " << %u)", j * 8) < 0)
+			return -1;
+	}
+	if (assembled > 1 && fputc(')', o) < 0)
+		return -1;
+	if (shift && fprintf(o, " >> %u)", shift) < 0)
+		return -1;
+	if (bytes > 4) {
+		if (fputs(" | ((uint32_t)", o) < 0)
+			return -1;
+		if (frame_byte(o, motorola ? 7 - (first + 4) : first + 4, copts) < 0)
+			return -1;
+		if (fprintf(o, " << %u))", 32 - shift) < 0)
+			return -1;
+	}
+	return fprintf(o, " & 0x%"PRIx64";\n", mask) < 0 ? -1 : 0;
+}
+
+/* Messages longer than eight bytes (CAN-FD) are packed into and unpacked
+ * from a byte array instead of a 'uint64_t', returns zero for messages that
+ * use a 'uint64_t' */
+static unsigned msg_fd_length(const can_msg_t *msg)
+{
+	assert(msg);
+	return msg->dlc > 8 ? msg->dlc : 0;
+}
+
+/* Signals in CAN-FD frames are accessed a word at a time; this finds the
+ * eight byte word at 'base' that holds a signal, placed so that it does not
+ * run off the end of the frame, and the shift of the least significant bit
+ * of the signal within it. Signals over 57 bits long may span nine bytes,
+ * 'extra' is then set to the byte not in the word, otherwise it is -1. */
+static int fd_signal_word(signal_t *sig, unsigned fd_length, unsigned *base, unsigned *shift, int *extra)
+{
+	assert(sig);
+	assert(base);
+	assert(shift);
+	assert(extra);
+	assert(fd_length >= 8);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	unsigned first = 0, last = 0, lsb = 0;
+	if (motorola) {
+		const unsigned msb = 8 * (sig->start_bit / 8) + 7 - (sig->start_bit % 8);
+		first = msb / 8;
+		last  = (msb + sig->bit_length - 1) / 8;
+		lsb   = 7 - ((msb + sig->bit_length - 1) % 8);
+	} else {
+		first = sig->start_bit / 8;
+		last  = (sig->start_bit + sig->bit_length - 1) / 8;
+		lsb   = sig->start_bit % 8;
+	}
+	if (last >= fd_length)
+		return -1;
+	if (last - first < 8) {
+		*base  = first < fd_length - 8 ? first : fd_length - 8;
+		*shift = 8 * (motorola ? 7 - (last - *base) : first - *base) + lsb;
+		*extra = -1;
+		return 0;
+	}
+	*base  = motorola ? first + 1 : first;
+	*shift = lsb;
+	*extra = motorola ? (int)first : (int)last;
+	return 0;
+}
+
+static int signal2deserializer_fd(signal_t *sig, FILE *o, const char *indent, uint64_t mask, unsigned fd_length)
+{
+	assert(sig);
+	assert(o);
+	assert(indent);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	unsigned base = 0, shift = 0;
+	int extra = -1;
+	if (fd_signal_word(sig, fd_length, &base, &shift, &extra) < 0) {
+		warning("signal %s does not fit in a message of %u bytes (fix the dbc file)", sig->name, fd_length);
+		return -1;
+	}
+	if (fprintf(o, "%sx = (dbcc_load_%s64(data + %u)", indent, motorola ? "be" : "le", base) < 0)
+		return -1;
+	if (shift && fprintf(o, " >> %u", shift) < 0)
+		return -1;
+	if (extra >= 0 && fprintf(o, " | ((uint64_t)data[%d] << %u)", extra, 64 - shift) < 0)
+		return -1;
+	return fprintf(o, ") & 0x%"PRIx64";\n", mask) < 0 ? -1 : 0;
+}
+
+static int signal2serializer_fd(signal_t *sig, FILE *o, const char *indent, unsigned fd_length)
+{
+	assert(sig);
+	assert(o);
+	assert(indent);
+	const char *endianess = (sig->endianess == endianess_motorola_e) ? "be" : "le";
+	unsigned base = 0, shift = 0;
+	int extra = -1;
+	if (fd_signal_word(sig, fd_length, &base, &shift, &extra) < 0) {
+		warning("signal %s does not fit in a message of %u bytes (fix the dbc file)", sig->name, fd_length);
+		return -1;
+	}
+	if (fprintf(o, "%sdbcc_store_%s64(data + %u, dbcc_load_%s64(data + %u) | ", indent, endianess, base, endianess, base) < 0)
+		return -1;
+	if (fprintf(o, shift ? "(x << %u));\n" : "x);\n", shift) < 0)
+		return -1;
+	if (extra >= 0 && fprintf(o, "%sdata[%d] |= x >> %u;\n", indent, extra, 64 - shift) < 0)
+		return -1;
+	return 0;
+}
+
+static const char *signal_member(char *buf, size_t length, can_msg_t *msg, signal_t *sig, dbc2c_options_t *copts);
+
+/* How the structure of a message is reached through 'o', as a prefix for
+ * its members */
+static const char *msg_object(char *buf, size_t length, const char *msg_name)
+{
+	assert(buf);
+	assert(msg_name && *msg_name);
+	snprintf(buf, length, "o->%s.", msg_name);
+	return buf;
+}
+
+static size_t signal_name_rank(const can_msg_t *msg, const signal_t *sig);
+
+/* A member of the structure of a message holding a signal, read only if
+ * 'qualifier' is "const ". The codec functions shared by messages with the
+ * same layout (see 'share-codecs') are generated with an empty message name,
+ * they are given the structure of any of them as bytes and 'layout', the
+ * offsets of its members, in the order of the names of the signals. */
+static const char *signal_access(char *buf, size_t length, can_msg_t *msg, const char *msg_name, signal_t *sig, const char *qualifier, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(msg);
+	assert(msg_name);
+	assert(sig);
+	assert(qualifier);
+	assert(copts);
+	char member[MAX_NAME_LENGTH * 2], object[MAX_NAME_LENGTH + 8];
+	if (!*msg_name)
+		snprintf(buf, length, "(*(%s%s *)(o + layout[%zu]))", qualifier, determine_type(sig->bit_length, sig->is_signed, sig->is_floating), signal_name_rank(msg, sig));
+	else
+		snprintf(buf, length, "%s%s", msg_object(object, sizeof object, msg_name), signal_member(member, sizeof member, msg, sig, copts));
+	return buf;
+}
+
+static const char *signal_lvalue(char *buf, size_t length, can_msg_t *msg, const char *msg_name, signal_t *sig, dbc2c_options_t *copts)
+{
+	return signal_access(buf, length, msg, msg_name, sig, "", copts);
+}
+
+/* In lazy decode mode a message holds only its raw payload, each signal is
+ * extracted from it when read (with 'get_<msg>_<signal>') and inserted into
+ * it when written (with 'set_<msg>_<signal>'). CAN-FD messages longer than
+ * eight bytes are always unpacked in full. */
+static bool msg_is_lazy(const can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->lazy_decode && !msg_fd_length(msg);
+}
+
+/* With 'use-seqlock' each message has a sequence number in the object which
+ * unpacking makes odd while it writes to the message, and the decode and
+ * snapshot functions retry until they read the same even number before and
+ * after reading the message. */
+static bool msg_has_sequence(const can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->use_seqlock && copts->generate_unpack;
+}
+
+/* The multiplexor of a message, if it only uses simple multiplexing; the
+ * multiplexor of a signal using extended multiplexing (SG_MUL_VAL_) is not
+ * necessarily the multiplexor of the message */
+static signal_t *msg_simple_multiplexor(can_msg_t *msg)
+{
+	assert(msg);
+	signal_t *multiplexor = NULL;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		if (sig->mul_num)
+			return NULL;
+		if (sig->is_multiplexor)
+			multiplexor = sig;
+	}
+	return multiplexor;
+}
+
+/* With 'use-mux-unions' the signals of a message for each value of its
+ * multiplexor are in a structure of their own, 'm<value>', in a union
+ * called 'mux', so only the signals for one value are stored at a time. */
+static bool msg_has_union(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	if (!copts->use_mux_unions || msg_is_lazy(msg, copts) || !msg_simple_multiplexor(msg))
+		return false;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (msg->sigs[i]->is_multiplexed)
+			return true;
+	return false;
+}
+
+/* The member of the message structure a signal is stored in */
+static const char *signal_member(char *buf, size_t length, can_msg_t *msg, signal_t *sig, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(msg);
+	assert(sig);
+	assert(copts);
+	if (sig->is_multiplexed && msg_has_union(msg, copts))
+		snprintf(buf, length, "mux.m%u.%s", sig->switchval, sig->name);
+	else
+		snprintf(buf, length, "%s", sig->name);
+	return buf;
+}
+
+/* Clear the union of the signals for each multiplexor value of a message,
+ * whose offset and size follow those of the signals in the 'layout' of the
+ * shared codec functions */
+static int msg_clear_mux(can_msg_t *msg, const char *msgname, FILE *o, const char *indent)
+{
+	assert(msg);
+	assert(msgname);
+	assert(o);
+	assert(indent);
+	char object[MAX_NAME_LENGTH + 8];
+	if (!*msgname)
+		return fprintf(o, "%smemset(o + layout[%zu], 0, layout[%zu]);\n", indent, msg->signal_count, msg->signal_count + 1);
+	msg_object(object, sizeof object, msgname);
+	return fprintf(o, "%smemset(&%smux, 0, sizeof (%smux));\n", indent, object, object);
+}
+
+/* Select the structure in the union of a message for the multiplexor value
+ * of a signal, clearing it if another was selected */
+static int signal2select(can_msg_t *msg, signal_t *sig, const char *msgname, FILE *o, dbc2c_options_t *copts)
 {
+	assert(msg);
 	assert(sig);
+	assert(msgname);
+	assert(o);
+	assert(copts);
+	signal_t *multiplexor = msg_simple_multiplexor(msg);
+	char selector[MAX_NAME_LENGTH * 3];
+	if (!sig->is_multiplexed || !msg_has_union(msg, copts))
+		return 0;
+	signal_lvalue(selector, sizeof selector, msg, msgname, multiplexor, copts);
+	fprintf(o, "\tif (%s != %u) {\n", selector, sig->switchval);
+	msg_clear_mux(msg, msgname, o, "\t\t");
+	fprintf(o, "\t\t%s = %u;\n", selector, sig->switchval);
+	return fputs("\t}\n", o);
+}
+
+/* The 'CAN_INDEX_*' macro giving the index of a message, in order of ID,
+ * which is its bit in the flag bitmaps of the object with 'use-bitmaps' */
+static const char *msg_index_name(char *buf, size_t length, const can_msg_t *msg)
+{
+	assert(buf);
+	assert(msg);
+	snprintf(buf, length, "CAN_INDEX_%s", msg->name);
+	for (size_t i = 0; buf[i]; i++)
+		buf[i] = toupper(buf[i]);
+	return buf;
+}
+
+/* Test the 'rx' or 'tx' flag of a message */
+static const char *msg_flag(char *buf, size_t length, const can_msg_t *msg, const char *name, const char *flag, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(msg);
+	assert(name);
+	assert(flag);
+	assert(copts);
+	char index[MAX_NAME_LENGTH + 16];
+	if (copts->use_bitmaps)
+		snprintf(buf, length, "dbcc_flag(o->%s_flags, %s)", flag, msg_index_name(index, sizeof index, msg));
+	else
+		snprintf(buf, length, "o->%s_%s", name, flag);
+	return buf;
+}
+
+/* Set the 'rx' or 'tx' flag of a message, which once set stays set, so
+ * the atomic update of a bitmap is only done once */
+static int msg_set_flag(const can_msg_t *msg, FILE *c, const char *name, const char *flag, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(flag);
+	assert(copts);
+	char index[MAX_NAME_LENGTH + 16];
+	if (!copts->use_bitmaps)
+		return fprintf(c, "\to->%s_%s = 1;\n", name, flag);
+	msg_index_name(index, sizeof index, msg);
+	fprintf(c, "\tif (!dbcc_flag(o->%s_flags, %s))\n", flag, index);
+	return fprintf(c, "\t\tdbcc_flag_set(o->%s_flags, %s);\n", flag, index);
+}
+
+/* The wire value of a signal, whether stored or lazily decoded */
+static const char *signal_rvalue(char *buf, size_t length, can_msg_t *msg, const char *msg_name, signal_t *sig, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(msg);
 	assert(msg_name);
+	assert(sig);
+	assert(copts);
+	if (msg_is_lazy(msg, copts))
+		snprintf(buf, length, "get_%s_%s(o->%s.raw)", msg_name, sig->name, msg_name);
+	else
+		signal_access(buf, length, msg, msg_name, sig, "const ", copts);
+	return buf;
+}
+
+/* Declare the word a single signal is unpacked from, or packed into if
+ * 'word' is NULL */
+static int signal_word_declaration(signal_t *sig, FILE *o, const char *indent, const char *word)
+{
+	assert(sig);
+	assert(o);
+	assert(indent);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	if (fprintf(o, "%sregister uint64_t x;\n", indent) < 0)
+		return -1;
+	if (!word)
+		return fprintf(o, "%sregister uint64_t %c = 0;\n", indent, motorola ? 'm' : 'i') < 0 ? -1 : 0;
+	if (motorola)
+		return fprintf(o, "%sregister uint64_t m = %s(%s);\n", indent, swap_motorola ? "reverse_byte_order" : "", word) < 0 ? -1 : 0;
+	return fprintf(o, "%sregister uint64_t i = %s(%s);\n", indent, swap_motorola ? "" : "reverse_byte_order", word) < 0 ? -1 : 0;
+}
+
+/* Unpack a signal into 'dest', any lvalue of the signals type, usually the
+ * signal in the message structure (see 'signal_lvalue') */
+static int signal2deserializer(signal_t *sig, const char *dest, FILE *o, const char *indent, dbc2c_options_t *copts, unsigned fd_length)
+{
+	assert(sig);
+	assert(dest);
 	assert(o);
+	assert(copts);
 	const bool motorola   = (sig->endianess == endianess_motorola_e);
 	const unsigned start  = fix_start_bit(motorola, sig->start_bit, sig->bit_length);
 	const unsigned length = sig->bit_length;
 	const uint64_t mask = length == 64 ?
 		0xFFFFFFFFFFFFFFFFuLL :
 		(1uLL << length) - 1uLL;
+	const bool window = !fd_length && signal_uses_byte_window(sig, copts);
+	const char x = window ? 'w' : 'x';
 
 	if (comment(sig, o, indent) < 0)
 		return -1;
 
-	if (start) {
+	if (fd_length) {
+		if (signal2deserializer_fd(sig, o, indent, mask, fd_length) < 0)
+			return -1;
+	} else if (window) {
+		if (signal2window(sig, o, indent, mask, copts) < 0)
+			return -1;
+	} else if (start) {
 		if (fprintf(o, "%sx = (%c >> %d) & 0x%"PRIx64";\n", indent, motorola ? 'm' : 'i', start, mask) < 0)
 			return -1;
 	} else {
@@ -192,13 +606,13 @@ static int signal2deserializer(signal_t *sig, const char *msg_name, FILE *o, con
 
 	if (sig->is_floating) {
 		assert(length == 32 || length == 64);
-		if (fprintf(o, "%so->%s.%s = unpack754_%d(x);\n", indent, msg_name, sig->name, length) < 0)
+		if (fprintf(o, "%s%s = unpack754_%d(%c);\n", indent, dest, length, x) < 0)
 			return -1;
 		return 0;
 	}
 
 	if (sig->is_signed) {
-		const uint64_t top = (1uL << (length - 1));
+		const uint64_t top = (1uLL << (length - 1));
 		uint64_t negative = ~mask;
 		if (length <= 32)
 			negative &= 0xFFFFFFFF;
@@ -206,20 +620,72 @@ static int signal2deserializer(signal_t *sig, const char *msg_name, FILE *o, con
 			negative &= 0xFFFF;
 		if (length <= 8)
 			negative &= 0xFF;
-		if (negative)
+		if (negative && window) { /* 'w' is a 'uint32_t', and so are its constants */
+			assert(length <= 32);
+			if (fprintf(o, "%sw = (w & 0x%"PRIx32"u) ? (w | 0x%"PRIx32"u) : w; \n", indent, (uint32_t)top, (uint32_t)negative) < 0)
+				return -1;
+		} else if (negative) {
 			if (fprintf(o, "%sx = (x & 0x%"PRIx64") ? (x | 0x%"PRIx64") : x; \n", indent, top, negative) < 0)
 				return -1;
+		}
+	}
+
+	return fprintf(o, "%s%s = %c;\n", indent, dest, x) < 0 ? -1 : 0;
+}
+
+/* Insert 'w' into the two 32-bit halves of the frame, Motorola signals
+ * have each byte placed separately */
+static int signal2halves(signal_t *sig, FILE *o, const char *indent)
+{
+	assert(sig);
+	assert(o);
+	assert(indent);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	const unsigned length = sig->bit_length;
+	const unsigned start = fix_start_bit(motorola, sig->start_bit, length);
+	assert(length <= 32);
+
+	if (!motorola) {
+		if (start + length <= 32)
+			return fprintf(o, start ? "%slo |= w << %u;\n" : "%slo |= w;\n", indent, start) < 0 ? -1 : 0;
+		if (start >= 32)
+			return fprintf(o, start > 32 ? "%shi |= w << %u;\n" : "%shi |= w;\n", indent, start - 32) < 0 ? -1 : 0;
+		return fprintf(o, "%slo |= w << %u;\n%shi |= w >> %u;\n", indent, start, indent, 32 - start) < 0 ? -1 : 0;
 	}
 
-	return fprintf(o, "%so->%s.%s = x;\n", indent, msg_name, sig->name) < 0 ? -1 : 0;
+	for (unsigned k = start / 8; k <= (start + length - 1) / 8; k++) {
+		const unsigned lsb = start > k * 8 ? start : k * 8;
+		const unsigned msb = start + length < (k + 1) * 8 ? start + length : (k + 1) * 8;
+		const unsigned byte = 7 - k;
+		const unsigned down = lsb - start;
+		const unsigned up = (byte % 4) * 8 + (lsb - k * 8);
+		const uint64_t piece = (1uLL << (msb - lsb)) - 1uLL;
+		const bool whole = down + (msb - lsb) >= length; /* no bits above this piece */
+		const bool masked = !whole && up + (msb - lsb) < 32;
+		if (fprintf(o, "%s%s |= %s", indent, byte < 4 ? "lo" : "hi", masked ? "(" : "") < 0)
+			return -1;
+		if (fprintf(o, down ? "(w >> %u)" : "w", down) < 0)
+			return -1;
+		if (masked && fprintf(o, " & 0x%"PRIx64")", piece) < 0)
+			return -1;
+		if (up && fprintf(o, " << %u", up) < 0)
+			return -1;
+		if (fputs(";\n", o) < 0)
+			return -1;
+	}
+	return 0;
 }
 
-static int signal2serializer(signal_t *sig, const char *msg_name, FILE *o, const char *indent)
+/* Pack a signal from 'src', the inverse of 'signal2deserializer' */
+static int signal2serializer(signal_t *sig, const char *src, FILE *o, const char *indent, dbc2c_options_t *copts, unsigned fd_length)
 {
 	assert(sig);
 	assert(o);
+	assert(copts);
 	bool motorola = (sig->endianess == endianess_motorola_e);
 	int start = fix_start_bit(motorola, sig->start_bit, sig->bit_length);
+	const bool halves = !fd_length && copts->target_32bit && sig->bit_length <= 32;
+	const char x = halves ? 'w' : 'x';
 
 	uint64_t mask = sig->bit_length == 64 ?
 		0xFFFFFFFFFFFFFFFFuLL :
@@ -230,12 +696,16 @@ static int signal2serializer(signal_t *sig, const char *msg_name, FILE *o, const
 
 	if (sig->is_floating) {
 		assert(sig->bit_length == 32 || sig->bit_length == 64);
-		if (fprintf(o, "%sx = pack754_%u(o->%s.%s) & 0x%"PRIx64";\n", indent, sig->bit_length, msg_name, sig->name, mask) < 0)
+		if (fprintf(o, "%s%c = pack754_%u(%s) & 0x%"PRIx64";\n", indent, x, sig->bit_length, src, mask) < 0)
 			return -1;
 	} else {
-		if (fprintf(o, "%sx = ((%s)(o->%s.%s)) & 0x%"PRIx64";\n", indent, determine_unsigned_type(sig->bit_length), msg_name, sig->name, mask) < 0)
+		if (fprintf(o, "%s%c = ((%s)(%s)) & 0x%"PRIx64";\n", indent, x, determine_unsigned_type(sig->bit_length), src, mask) < 0)
 			return -1;
 	}
+	if (fd_length)
+		return signal2serializer_fd(sig, o, indent, fd_length);
+	if (halves)
+		return signal2halves(sig, o, indent);
 	if (start)
 		if (fprintf(o, "%sx <<= %u; \n", indent, start) < 0)
 			return -1;
@@ -244,19 +714,23 @@ static int signal2serializer(signal_t *sig, const char *msg_name, FILE *o, const
 	return 0;
 }
 
-static int signal2print(signal_t *sig, unsigned id, const char *msg_name, FILE *o)
+static int signal2print(can_msg_t *msg, signal_t *sig, const char *msg_name, FILE *o, dbc2c_options_t *copts)
 {
-	UNUSED(id);
+	char value[MAX_NAME_LENGTH * 3];
+	signal_rvalue(value, sizeof value, msg, msg_name, sig, copts);
+	if (sig->is_multiplexed && msg_has_union(msg, copts)) /* only the selected signals are stored */
+		fprintf(o, "\tif (o->%s.%s == %u)\n\t", msg_name, msg_simple_multiplexor(msg)->name, sig->switchval);
 	/*super lazy*/
 	if (sig->is_floating)
-		return fprintf(o, "\tr = print_helper(r, fprintf(output, \"%s = (wire: %%g)\\n\", (double)(o->%s.%s)));\n", sig->name, msg_name, sig->name);
-	return fprintf(o, "\tr = print_helper(r, fprintf(output, \"%s = (wire: %%.0f)\\n\", (double)(o->%s.%s)));\n", sig->name, msg_name, sig->name);
+		return fprintf(o, "\tr = print_helper(r, fprintf(output, \"%s = (wire: %%g)\\n\", (double)(%s)));\n", sig->name, value);
+	return fprintf(o, "\tr = print_helper(r, fprintf(output, \"%s = (wire: %%.0f)\\n\", (double)(%s)));\n", sig->name, value);
 }
 
-static int signal2type(signal_t *sig, FILE *o)
+static int signal2type(signal_t *sig, FILE *o, const char *indent)
 {
 	assert(sig);
 	assert(o);
+	assert(indent);
 	const unsigned length = sig->bit_length;
 	const char *type = determine_type(length, sig->is_signed, sig->is_floating);
 
@@ -273,14 +747,14 @@ static int signal2type(signal_t *sig, FILE *o)
 	}
 
 	if (sig->comment) {
-		fprintf(o, "\t/* %s: %s */\n", sig->name, sig->comment);
-		return fprintf(o, "\t/* scaling %.1f, offset %.1f, units %s%s */\n\t%s %s;\n",
-				sig->scaling, sig->offset, sig->units[0] ? sig->units : "none",
+		fprintf(o, "%s/* %s: %s */\n", indent, sig->name, sig->comment);
+		return fprintf(o, "%s/* scaling %.1f, offset %.1f, units %s%s */\n%s%s %s;\n",
+				indent, sig->scaling, sig->offset, sig->units[0] ? sig->units : "none",
 				sig->is_floating ? ", floating" : "",
-				type, sig->name);
+				indent, type, sig->name);
 	} else {
-		return fprintf(o, "\t%s %s; /* scaling %.1f, offset %.1f, units %s%s */\n",
-				type, sig->name, sig->scaling, sig->offset, sig->units[0] ? sig->units : "none",
+		return fprintf(o, "%s%s %s; /* scaling %.1f, offset %.1f, units %s%s */\n",
+				indent, type, sig->name, sig->scaling, sig->offset, sig->units[0] ? sig->units : "none",
 				sig->is_floating ? ", floating" : "");
 	}
 }
@@ -315,117 +789,668 @@ static int64_t signed_min(signal_t *sig)
 	return ~signed_max(sig);
 }
 
-static int signal2scaling_encode(const char *msgname, unsigned id, signal_t *sig, FILE *o, bool header, const char *god, dbc2c_options_t *copts)
+/* Work out which of the minimum and maximum of a signal need checking, a
+ * check is not needed when the type of the signal cannot exceed it */
+static bool signal_range_checks(signal_t *sig, bool *gmin, bool *gmax)
 {
-	assert(msgname);
 	assert(sig);
-	assert(o);
-	assert(copts);
-	const char *type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
-	if (sig->scaling != 1.0 || sig->offset != 0.0)
-		type = "dbcc_double_t";
-	if (copts->use_id_in_name)
-		fprintf(o, "int encode_can_0x%03x_%s(can_obj_%s_t *o, %s in)", id, sig->name, god, copts->use_doubles_for_encoding ? "dbcc_double_t" : type);
-	else if (copts->version >= 2)
-		fprintf(o, "int encode_%s_%s(can_obj_%s_t *o, %s in)", msgname, sig->name, god, copts->use_doubles_for_encoding ? "dbcc_double_t" : type);
-	else
-		fprintf(o, "int encode_can_%s(can_obj_%s_t *o, %s in)", sig->name, god, copts->use_doubles_for_encoding ? "dbcc_double_t" : type);
-
-	if (header)
-		return fputs(";\n", o);
-	fputs(" {\n", o);
-	if (copts->generate_asserts) {
-		fputs("\tassert(o);\n", o);
+	assert(gmin);
+	assert(gmax);
+	*gmin = false;
+	*gmax = false;
+	if (!signal_are_min_max_valid(sig))
+		return false;
+	if (sig->is_signed) { /**@warning comparison may fail because of limits of double size */
+		*gmin = sig->minimum > signed_min(sig);
+		*gmax = sig->maximum < signed_max(sig);
+	} else {
+		*gmin = sig->minimum > 0.0;
+		*gmax = sig->maximum < unsigned_max(sig);
+	}
+	if (sig->is_floating) {
+		*gmax = true;
+		*gmax = true;
 	}
-	if (signal_are_min_max_valid(sig)) {
-		bool gmax = true;
-		bool gmin = true;
+	return true;
+}
 
-		if (sig->is_signed) {
-			gmin = sig->minimum > signed_min(sig);
-			gmax = sig->maximum < signed_max(sig);
-		} else {
-			gmin = sig->minimum > 0.0;
-			gmax = sig->maximum < unsigned_max(sig);
-		}
-		if (sig->is_floating) {
-			gmax = true;
-			gmax = true;
-		}
+#define FIXED_Q (16)
+
+/* A fixed point signal is decoded as 'physical << FIXED_Q = raw * n / d +
+ * offset', with 'n' and 'd' exact if the scaling is a multiple of a power of
+ * two or of ten. The result is only made fixed point if one unit of the raw
+ * value is at least one unit of the fixed point value, so every raw value
+ * survives an encode after a decode, and if it cannot overflow. */
+typedef struct {
+	int64_t n, d, offset;
+} fixed_scaling_t;
 
-		if (gmin || gmax)
-			fprintf(o, "\to->%s.%s = 0;\n", msgname, sig->name); // cast!
-		if (gmin)
-			fprintf(o, "\tif (in < %g)\n\t\treturn -1;\n", sig->minimum);
-		if (gmax)
-			fprintf(o, "\tif (in > %g)\n\t\treturn -1;\n", sig->maximum);
+static bool signal_fixed_point(signal_t *sig, dbc2c_options_t *copts, fixed_scaling_t *f)
+{
+	assert(sig);
+	assert(copts);
+	assert(f);
+	const double q = ldexp(1.0, FIXED_Q);
+	if (!copts->use_fixed_point || sig->is_floating || sig->bit_length > 32)
+		return false;
+	if (sig->scaling == 1.0 && sig->offset == 0.0)
+		return false;
+	if (fabs(sig->scaling) * q < 1.0 || fabs(sig->offset) * q > ldexp(1.0, 46))
+		return false;
+	f->offset = llround(sig->offset * q);
+	if (is_integer(sig->scaling * q) && fabs(sig->scaling) * q < ldexp(1.0, 29)) {
+		f->n = llround(sig->scaling * q);
+		f->d = 1;
+		return true;
+	}
+	double d = 1.0;
+	for (int i = 0; i < 9; i++) {
+		d *= 10.0;
+		const double n = sig->scaling * d;
+		if (fabs(n - nearbyint(n)) > fabs(n) * 1e-12)
+			continue;
+		if (fabs(n) >= ldexp(1.0, 13))
+			return false;
+		f->n = llround(n) << FIXED_Q;
+		f->d = (int64_t)d;
+		return true;
 	}
+	return false;
+}
 
-	if (sig->scaling == 0.0)
-		error("invalid scaling factor (fix your DBC file)");
-	if (sig->offset != 0.0)
-		fprintf(o, "\tin += %g;\n", -1.0 * sig->offset);
-	if (sig->scaling != 1.0)
-		fprintf(o, "\tin *= %g;\n", 1.0 / sig->scaling);
-	fprintf(o, "\to->%s.%s = in;\n", msgname, sig->name); // cast!
-	return fputs("\treturn 0;\n}\n\n", o);
+static int fixed_constant(FILE *o, double x)
+{
+	return fprintf(o, "INT64_C(%"PRId64")", (int64_t)llround(ldexp(x, FIXED_Q)));
 }
 
-static int signal2scaling_decode(const char *msgname, unsigned id, signal_t *sig, FILE *o, bool header, const char *god, dbc2c_options_t *copts)
+/* Check the range of 'value', a fixed point physical value, returning -1
+ * if it is out of range, and convert it to the raw value of a signal */
+static int signal2fixed_raw(signal_t *sig, const char *value, FILE *o, const char *indent, fixed_scaling_t *f)
+{
+	assert(sig);
+	assert(value);
+	assert(o);
+	assert(indent);
+	assert(f);
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if (gmin) {
+		fprintf(o, "%sif (%s < ", indent, value);
+		fixed_constant(o, sig->minimum);
+		fprintf(o, ")\n%s\treturn -1;\n", indent);
+	}
+	if (gmax) {
+		fprintf(o, "%sif (%s > ", indent, value);
+		fixed_constant(o, sig->maximum);
+		fprintf(o, ")\n%s\treturn -1;\n", indent);
+	}
+	if (f->offset)
+		fprintf(o, "%s%s -= INT64_C(%"PRId64");\n", indent, value, f->offset);
+	if (f->n < 0)
+		fprintf(o, "%s%s = -%s;\n", indent, value, value);
+	if (f->d != 1)
+		fprintf(o, "%s%s = dbcc_fixed_divide(%s * INT64_C(%"PRId64"), INT64_C(%"PRId64"));\n", indent, value, value, f->d, f->n < 0 ? -f->n : f->n);
+	else if (f->n != 1 && f->n != -1)
+		fprintf(o, "%s%s = dbcc_fixed_divide(%s, INT64_C(%"PRId64"));\n", indent, value, value, f->n < 0 ? -f->n : f->n);
+	return 0;
+}
+
+static int signal2fixed_encode(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, fixed_scaling_t *f, dbc2c_options_t *copts)
 {
 	assert(msgname);
+	assert(msg);
 	assert(sig);
 	assert(o);
+	assert(f);
 	assert(copts);
-	const char *type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
-	if (sig->scaling != 1.0 || sig->offset != 0.0)
-		type = "dbcc_double_t";
-	if (copts->use_id_in_name)
-		fprintf(o, "int decode_can_0x%03x_%s(const can_obj_%s_t *o, %s *out)", id, sig->name, god, copts->use_doubles_for_encoding ? "dbcc_double_t" : type);
-	else if (copts->version >= 2)
-		fprintf(o, "int decode_%s_%s(const can_obj_%s_t *o, %s *out)", msgname, sig->name, god, copts->use_doubles_for_encoding ? "dbcc_double_t" : type);
+	const bool lazy = msg_is_lazy(msg, copts);
+	char lvalue[MAX_NAME_LENGTH * 3];
+	signal_lvalue(lvalue, sizeof lvalue, msg, msgname, sig, copts);
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if ((gmin || gmax) && lazy)
+		fprintf(o, "\to->%s.raw = set_%s_%s(o->%s.raw, 0);\n", msgname, msgname, sig->name, msgname);
+	else if (gmin || gmax)
+		fprintf(o, "\t%s = 0;\n", lvalue);
+	signal2fixed_raw(sig, "in", o, "\t", f);
+	if (lazy)
+		fprintf(o, "\to->%s.raw = set_%s_%s(o->%s.raw, in);\n", msgname, msgname, sig->name, msgname);
 	else
-		fprintf(o, "int decode_can_%s(const can_obj_%s_t *o, %s *out)", sig->name, god, copts->use_doubles_for_encoding ? "dbcc_double_t" : type);
-	if (header)
-		return fputs(";\n", o);
+		fprintf(o, "\t%s = in;\n", lvalue);
+	return fputs("\treturn 0;\n}\n\n", o);
+}
+
+static int signal2fixed_decode(const char *value, signal_t *sig, FILE *o, fixed_scaling_t *f)
+{
+	assert(value);
+	assert(sig);
+	assert(o);
+	assert(f);
+	if (f->d != 1)
+		fprintf(o, "\tdbcc_fixed_t rval = dbcc_fixed_divide((dbcc_fixed_t)(%s) * INT64_C(%"PRId64"), INT64_C(%"PRId64"));\n", value, f->n, f->d);
+	else if (f->n != 1)
+		fprintf(o, "\tdbcc_fixed_t rval = (dbcc_fixed_t)(%s) * INT64_C(%"PRId64");\n", value, f->n);
+	else
+		fprintf(o, "\tdbcc_fixed_t rval = (dbcc_fixed_t)(%s);\n", value);
+	if (f->offset)
+		fprintf(o, "\trval += INT64_C(%"PRId64");\n", f->offset);
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if (gmin || gmax) {
+		fputs(gmin && gmax ? "\tif ((rval < " : gmin ? "\tif (rval < " : "\tif (rval > ", o);
+		fixed_constant(o, gmin ? sig->minimum : sig->maximum);
+		if (gmin && gmax) {
+			fputs(") || (rval > ", o);
+			fixed_constant(o, sig->maximum);
+			fputs(")", o);
+		}
+		fputs(") {\n\t\t*out = 0;\n\t\treturn -1;\n\t}\n", o);
+	}
+	fputs("\t*out = rval;\n", o);
+	fputs("\treturn 0;\n", o);
+	return fputs("}\n\n", o);
+}
+
+static bool msg_has_subscriptions(can_msg_t *msg, dbc2c_options_t *copts);
+
+/* With 'use-tables' a message is packed and unpacked by a generic
+ * interpreter walking a table of its signals, apart from messages needing
+ * code the interpreter does not have. Signals that are not multiplexed come
+ * first in the table, so the multiplexor is unpacked before the signals it
+ * selects. Multiplexed signals without a multiplexor are never unpacked,
+ * so are left out. */
+static int signal_table_index(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	const bool multiplexed = msg_simple_multiplexor(msg) != NULL;
+	int index = 0;
+	for (int pass = 0; pass < 2; pass++)
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *s = msg->sigs[i];
+			if (s->is_multiplexed != (pass == 1) || (pass == 1 && !multiplexed))
+				continue;
+			if (s == sig)
+				return index;
+			index++;
+		}
+	return sig ? -1 : index;
+}
+
+static bool msg_uses_tables(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	if (!copts->use_tables || msg_fd_length(msg) || msg_is_lazy(msg, copts) || msg_has_subscriptions(msg, copts))
+		return false;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		const bool motorola = sig->endianess == endianess_motorola_e;
+		if (sig->mul_num || fix_start_bit(motorola, sig->start_bit, sig->bit_length) > 64u - sig->bit_length)
+			return false;
+	}
+	return signal_table_index(msg, NULL) > 0;
+}
+
+static signal_t *msg_table_signal(can_msg_t *msg, int index)
+{
+	assert(msg);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (signal_table_index(msg, msg->sigs[i]) == index)
+			return msg->sigs[i];
+	return NULL;
+}
+
+/* With 'share-codecs' messages whose signals are laid out the same, which
+ * differ only in their names and ID, are packed, unpacked, encoded and
+ * decoded by functions generated once, for the first of them. They take the
+ * structure of any of the messages, with a table of the offsets of its
+ * members, and the functions of each message call them with its own. The
+ * 'codec' of each of these messages points to the first one. */
+static bool signal_same_codec(const signal_t *a, const signal_t *b)
+{
+	assert(a);
+	assert(b);
+	return a->start_bit == b->start_bit
+		&& a->bit_length == b->bit_length
+		&& a->endianess == b->endianess
+		&& a->is_signed == b->is_signed
+		&& a->is_floating == b->is_floating
+		&& a->sigval == b->sigval
+		&& a->scaling == b->scaling
+		&& a->offset == b->offset
+		&& a->minimum == b->minimum
+		&& a->maximum == b->maximum
+		&& a->is_multiplexor == b->is_multiplexor
+		&& a->is_multiplexed == b->is_multiplexed
+		&& (!a->is_multiplexed || a->switchval == b->switchval);
+}
+
+/* Messages with their own kind of codec, or extended multiplexing, which
+ * makes signals depend on each other, always have their own functions */
+static bool msg_can_share_codec(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	if (!copts->share_codecs || !msg->signal_count || msg_fd_length(msg) || msg_is_lazy(msg, copts))
+		return false;
+	if (msg_uses_tables(msg, copts) || msg_has_subscriptions(msg, copts))
+		return false;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (msg->sigs[i]->mul_num)
+			return false;
+	return true;
+}
+
+/* The position of a signal in the order of the names of the signals of its
+ * message, which unlike 'msg->sigs' is not reordered as code is generated */
+static size_t signal_name_rank(const can_msg_t *msg, const signal_t *sig)
+{
+	assert(msg);
+	assert(sig);
+	size_t rank = 0;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (strcmp(msg->sigs[i]->name, sig->name) < 0)
+			rank++;
+	return rank;
+}
+
+/* Match each signal of 'a', in the order of their names, to the first one
+ * of 'b' by name laid out the same that is not matched yet, storing it in
+ * 'map' (which has room for all of them) if it is not NULL. Do they all
+ * match? */
+static bool msg_match_codec(const can_msg_t *a, const can_msg_t *b, signal_t **map)
+{
+	assert(a);
+	assert(b);
+	if (a->dlc != b->dlc || a->signal_count != b->signal_count)
+		return false;
+	bool *used = allocate(b->signal_count * sizeof *used), matched = true;
+	for (size_t rank = 0; matched && rank < a->signal_count; rank++) {
+		signal_t *sig = NULL;
+		size_t found = b->signal_count;
+		for (size_t i = 0; i < a->signal_count && !sig; i++)
+			if (signal_name_rank(a, a->sigs[i]) == rank)
+				sig = a->sigs[i];
+		assert(sig);
+		for (size_t j = 0; j < b->signal_count; j++) {
+			if (used[j] || !signal_same_codec(sig, b->sigs[j]))
+				continue;
+			if (found == b->signal_count || strcmp(b->sigs[j]->name, b->sigs[found]->name) < 0)
+				found = j;
+		}
+		matched = found < b->signal_count;
+		if (matched) {
+			used[found] = true;
+			if (map)
+				map[rank] = b->sigs[found];
+		}
+	}
+	free(used);
+	return matched;
+}
+
+/* The signal of the first of the messages sharing a codec that 'sig' of
+ * 'msg' takes the place of */
+static signal_t *signal_codec(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	assert(msg->codec);
+	assert(sig);
+	signal_t **map = allocate(msg->signal_count * sizeof *map), *r = NULL;
+	msg_match_codec(msg->codec, msg, map);
+	for (size_t rank = 0; rank < msg->signal_count; rank++)
+		if (map[rank] == sig)
+			for (size_t i = 0; i < msg->codec->signal_count; i++)
+				if (signal_name_rank(msg->codec, msg->codec->sigs[i]) == rank)
+					r = msg->codec->sigs[i];
+	free(map);
+	assert(r);
+	return r;
+}
+
+/* Find the messages sharing a codec, in order of ID */
+static void dbc_share_codecs(dbc_t *dbc, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(copts);
+	for (size_t i = 0; i < dbc->message_count; i++)
+		dbc->messages[i]->codec = NULL;
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *first = dbc->messages[i];
+		if (first->codec || !msg_can_share_codec(first, copts))
+			continue;
+		for (size_t j = i + 1; j < dbc->message_count; j++) {
+			can_msg_t *msg = dbc->messages[j];
+			if (msg->codec || !msg_can_share_codec(msg, copts) || !msg_match_codec(first, msg, NULL))
+				continue;
+			msg->codec = first;
+			first->codec = first;
+		}
+	}
+}
+
+static void make_name(char *newname, size_t maxlen, const char *name, unsigned id, dbc2c_options_t *copts);
+
+/* The name of the message whose codec a message uses */
+static const char *msg_codec_name(char *buf, size_t length, const can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(msg);
+	assert(msg->codec);
+	assert(copts);
+	assert(length >= MAX_NAME_LENGTH);
+	make_name(buf, length, msg->codec->name, msg->codec->id, copts);
+	return buf;
+}
+
+/* With 'use-tables' messages whose signals are laid out the same in the
+ * frame and in the order of the members of their structures, which need
+ * not be scaled the same, have the same table, which is generated once,
+ * for the first of them. Structures with members of the same types have
+ * the same offsets. */
+static bool signal_same_table(const signal_t *a, const signal_t *b)
+{
+	assert(a);
+	assert(b);
+	return a->start_bit == b->start_bit
+		&& a->bit_length == b->bit_length
+		&& a->endianess == b->endianess
+		&& a->is_signed == b->is_signed
+		&& a->is_floating == b->is_floating
+		&& a->is_multiplexor == b->is_multiplexor
+		&& a->is_multiplexed == b->is_multiplexed
+		&& (!a->is_multiplexed || a->switchval == b->switchval);
+}
+
+static bool msg_same_table(can_msg_t *a, can_msg_t *b)
+{
+	assert(a);
+	assert(b);
+	if (a->signal_count != b->signal_count || !msg_simple_multiplexor(a) != !msg_simple_multiplexor(b))
+		return false;
+	for (size_t i = 0; i < a->signal_count; i++)
+		if (!signal_same_table(a->sigs[i], b->sigs[i]))
+			return false;
+	return true;
+}
+
+/* Find the messages sharing a table, in order of ID, before the signals
+ * are reordered as code is generated */
+static void dbc_share_tables(dbc_t *dbc, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(copts);
+	for (size_t i = 0; i < dbc->message_count; i++)
+		dbc->messages[i]->table = NULL;
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *first = dbc->messages[i];
+		if (first->table || !msg_uses_tables(first, copts))
+			continue;
+		first->table = first;
+		for (size_t j = i + 1; j < dbc->message_count; j++) {
+			can_msg_t *msg = dbc->messages[j];
+			if (!msg->table && msg_uses_tables(msg, copts) && msg_same_table(first, msg))
+				msg->table = first;
+		}
+	}
+}
+
+/* The name of the message whose tables a message uses */
+static const char *msg_table_name(char *buf, size_t length, const can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(msg);
+	assert(msg->table);
+	assert(copts);
+	assert(length >= MAX_NAME_LENGTH);
+	make_name(buf, length, msg->table->name, msg->table->id, copts);
+	return buf;
+}
+
+/* With 'header-only' the functions that would be in the C file with external
+ * linkage are 'static inline' in the header instead */
+static int linkage(FILE *o, dbc2c_options_t *copts)
+{
+	assert(o);
+	assert(copts);
+	return copts->header_only ? fputs("static inline ", o) : 0;
+}
+
+/* Check the range of 'value', a physical value, returning -1 if it is out
+ * of range, and convert it to the raw value of a signal */
+static int signal2scaling_raw(signal_t *sig, const char *value, FILE *o, const char *indent)
+{
+	assert(sig);
+	assert(value);
+	assert(o);
+	assert(indent);
+	char constant[64];
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if (gmin)
+		fprintf(o, "%sif (%s < %s)\n%s\treturn -1;\n", indent, value, double_constant(constant, sizeof constant, sig->minimum), indent);
+	if (gmax)
+		fprintf(o, "%sif (%s > %s)\n%s\treturn -1;\n", indent, value, double_constant(constant, sizeof constant, sig->maximum), indent);
+	if (sig->scaling == 0.0)
+		error("invalid scaling factor (fix your DBC file)");
+	if (sig->offset != 0.0)
+		fprintf(o, "%s%s += %s;\n", indent, value, double_constant(constant, sizeof constant, -1.0 * sig->offset));
+	if (sig->scaling != 1.0)
+		fprintf(o, "%s%s *= %s;\n", indent, value, double_constant(constant, sizeof constant, 1.0 / sig->scaling));
+	return 0;
+}
+
+static int signal2scaling_encode_body(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, dbc2c_options_t *copts)
+{
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(copts);
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	const bool use_fixed = signal_fixed_point(sig, copts, &fixed);
+	const bool lazy = msg_is_lazy(msg, copts);
+	if (sig->is_multiplexor && msg_has_union(msg, copts)) {
+		/* the signals stored for the old value are not valid for a new one */
+		char selector[MAX_NAME_LENGTH * 3];
+		signal_rvalue(selector, sizeof selector, msg, msgname, sig, copts);
+		fprintf(o, "\tif (%s != (%s)in)\n", selector, determine_type(sig->bit_length, sig->is_signed, sig->is_floating));
+		msg_clear_mux(msg, msgname, o, "\t\t");
+	}
+	signal2select(msg, sig, msgname, o, copts);
+	if (use_fixed)
+		return signal2fixed_encode(msgname, msg, sig, o, &fixed, copts);
+	char lvalue[MAX_NAME_LENGTH * 3];
+	signal_lvalue(lvalue, sizeof lvalue, msg, msgname, sig, copts);
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if ((gmin || gmax) && lazy)
+		fprintf(o, "\to->%s.raw = set_%s_%s(o->%s.raw, 0);\n", msgname, msgname, sig->name, msgname);
+	else if (gmin || gmax)
+		fprintf(o, "\t%s = 0;\n", lvalue); // cast!
+	signal2scaling_raw(sig, "in", o, "\t");
+	if (lazy)
+		fprintf(o, "\to->%s.raw = set_%s_%s(o->%s.raw, in);\n", msgname, msgname, sig->name, msgname);
+	else
+		fprintf(o, "\t%s = in;\n", lvalue); // cast!
+	return fputs("\treturn 0;\n}\n\n", o);
+}
+
+static int signal2scaling_encode(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, bool header, const char *god, dbc2c_options_t *copts)
+{
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(copts);
+	const char *type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	const bool use_fixed = signal_fixed_point(sig, copts, &fixed);
+	if (sig->scaling != 1.0 || sig->offset != 0.0)
+		type = "dbcc_double_t";
+	if (copts->use_doubles_for_encoding)
+		type = "dbcc_double_t";
+	if (use_fixed)
+		type = "dbcc_fixed_t";
+	linkage(o, copts);
+	if (copts->use_id_in_name)
+		fprintf(o, "int encode_can_0x%03lx_%s(can_obj_%s_t *o, %s in)", msg->id, sig->name, god, type);
+	else if (copts->version >= 2)
+		fprintf(o, "int encode_%s_%s(can_obj_%s_t *o, %s in)", msgname, sig->name, god, type);
+	else
+		fprintf(o, "int encode_can_%s(can_obj_%s_t *o, %s in)", sig->name, god, type);
+
+	if (header)
+		return fputs(";\n", o);
+	fputs(" {\n", o);
+	if (copts->generate_asserts) {
+		fputs("\tassert(o);\n", o);
+	}
+	if (msg->codec) {
+		char codec[MAX_NAME_LENGTH];
+		fprintf(o, "\treturn encode_shared_%s_%s((unsigned char *)&o->%s, %s_layout, in);\n", msg_codec_name(codec, sizeof codec, msg, copts), signal_codec(msg, sig)->name, msgname, msgname);
+		return fputs("}\n\n", o);
+	}
+	return signal2scaling_encode_body(msgname, msg, sig, o, copts);
+}
+
+/* The type a signal is decoded to in 'type', returning the type the decode
+ * function writes out */
+static const char *signal_decode_type(signal_t *sig, const char **type, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(type);
+	assert(copts);
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	*type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
+	if (sig->scaling != 1.0 || sig->offset != 0.0)
+		*type = "dbcc_double_t";
+	if (signal_fixed_point(sig, copts, &fixed))
+		return *type = "dbcc_fixed_t";
+	return copts->use_doubles_for_encoding ? "dbcc_double_t" : *type;
+}
+
+/* The name of the decode or encode function, after 'prefix', of a signal */
+static const char *signal_function_name(char *buf, size_t length, const char *prefix, const char *msgname, can_msg_t *msg, signal_t *sig, dbc2c_options_t *copts)
+{
+	assert(buf);
+	assert(prefix);
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(copts);
+	if (copts->use_id_in_name)
+		snprintf(buf, length, "%s_can_0x%03lx_%s", prefix, msg->id, sig->name);
+	else if (copts->version >= 2)
+		snprintf(buf, length, "%s_%s_%s", prefix, msgname, sig->name);
+	else
+		snprintf(buf, length, "%s_can_%s", prefix, sig->name);
+	return buf;
+}
+
+static int signal2decode_name(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, bool unlocked, const char *god, dbc2c_options_t *copts)
+{
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(god);
+	assert(copts);
+	const char *type = NULL;
+	const char *out_type = signal_decode_type(sig, &type, copts);
+	const char *suffix = unlocked ? "_unlocked" : "";
+	if (unlocked && !copts->header_only)
+		fputs("static ", o);
+	else
+		linkage(o, copts);
+	if (copts->use_id_in_name)
+		return fprintf(o, "int decode_can_0x%03lx_%s%s(const can_obj_%s_t *o, %s *out)", msg->id, sig->name, suffix, god, out_type);
+	if (copts->version >= 2)
+		return fprintf(o, "int decode_%s_%s%s(const can_obj_%s_t *o, %s *out)", msgname, sig->name, suffix, god, out_type);
+	return fprintf(o, "int decode_can_%s%s(const can_obj_%s_t *o, %s *out)", sig->name, suffix, god, out_type);
+}
+
+/* Call the decode function of a signal until the message it reads has not
+ * been unpacked into while it was reading it */
+static int signal2decode_retry(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, const char *god, dbc2c_options_t *copts)
+{
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(copts);
+	char function[MAX_NAME_LENGTH * 2];
+	signal2decode_name(msgname, msg, sig, o, false, god, copts);
 	fputs(" {\n", o);
+	if (copts->generate_asserts)
+		fputs("\tassert(o);\n", o);
+	fputs("\tdbcc_sequence_t s;\n", o);
+	fputs("\tint r;\n", o);
+	fputs("\tdo {\n", o);
+	fprintf(o, "\t\ts = dbcc_read_begin(&o->%s_sequence);\n", msgname);
+	fprintf(o, "\t\tr = %s_unlocked(o, out);\n", signal_function_name(function, sizeof function, "decode", msgname, msg, sig, copts));
+	fprintf(o, "\t} while (dbcc_read_retry(&o->%s_sequence, s));\n", msgname);
+	return fputs("\treturn r;\n}\n\n", o);
+}
+
+static signal_t *signal_extended_multiplexor(can_msg_t *msg, signal_t *sig);
+static bool lazy_mux_selected(can_msg_t *msg, signal_t *sig, FILE *c, const char *name, const char *raw);
+
+static int signal2scaling_decode_body(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, const char *type, fixed_scaling_t *fixed, dbc2c_options_t *copts)
+{
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(type);
+	assert(copts);
 	if (copts->generate_asserts) {
 		fputs("\tassert(o);\n", o);
 		fputs("\tassert(out);\n", o);
 	}
-	fprintf(o, "\t%s rval = (%s)(o->%s.%s);\n", type, type, msgname, sig->name);
+	const bool lazy = msg_is_lazy(msg, copts);
+	signal_t *multiplexor = msg_simple_multiplexor(msg);
+	char value[MAX_NAME_LENGTH * 3];
+	if ((lazy || msg_has_union(msg, copts)) && sig->is_multiplexed && multiplexor) {
+		/* the signal is only present for one value of the multiplexor */
+		char selector[MAX_NAME_LENGTH * 3];
+		fprintf(o, "\tif (%s != %u) {\n", signal_rvalue(selector, sizeof selector, msg, msgname, multiplexor, copts), sig->switchval);
+		fprintf(o, "\t\t*out = (%s)0;\n", type);
+		fputs("\t\treturn -1;\n\t}\n", o);
+	}
+	if (lazy && sig->is_multiplexed && !multiplexor && signal_extended_multiplexor(msg, sig)) {
+		/* or for the values of the extended multiplexors above it */
+		char raw[MAX_NAME_LENGTH + 8];
+		snprintf(raw, sizeof raw, "o->%s.raw", msgname);
+		fputs("\tif (!(", o);
+		lazy_mux_selected(msg, sig, o, msgname, raw);
+		fputs(")) {\n", o);
+		fprintf(o, "\t\t*out = (%s)0;\n", type);
+		fputs("\t\treturn -1;\n\t}\n", o);
+	}
+	signal_rvalue(value, sizeof value, msg, msgname, sig, copts);
+	if (fixed)
+		return signal2fixed_decode(value, sig, o, fixed);
+	fprintf(o, "\t%s rval = (%s)(%s);\n", type, type, value);
 	if (sig->scaling == 0.0)
 		error("invalid scaling factor (fix your DBC file)");
+	char constant[64], limit[64];
 	if (sig->scaling != 1.0)
-		fprintf(o, "\trval *= %g;\n", sig->scaling);
+		fprintf(o, "\trval *= %s;\n", double_constant(constant, sizeof constant, sig->scaling));
 	if (sig->offset != 0.0)
-		fprintf(o, "\trval += %g;\n", sig->offset);
-	if (signal_are_min_max_valid(sig)) {
-		bool gmax = true;
-		bool gmin = true;
-
-		if (sig->is_signed) { /**@warning comparison may fail because of limits of double size */
-			gmin = sig->minimum > signed_min(sig);
-			gmax = sig->maximum < signed_max(sig);
-		} else {
-			gmin = sig->minimum > 0.0;
-			gmax = sig->maximum < unsigned_max(sig);
-		}
-		if (sig->is_floating) {
-			gmax = true;
-			gmax = true;
-		}
-
+		fprintf(o, "\trval += %s;\n", double_constant(constant, sizeof constant, sig->offset));
+	bool gmin = false, gmax = false;
+	if (signal_range_checks(sig, &gmin, &gmax)) {
 		if (!gmax && !gmin) {
 			fputs("\t*out = rval;\n", o);
 			fputs("\treturn 0;\n", o);
 		} else {
 			if (gmin && gmax) {
-				fprintf(o, "\tif ((rval >= %g) && (rval <= %g)) {\n", sig->minimum, sig->maximum);
+				fprintf(o, "\tif ((rval >= %s) && (rval <= %s)) {\n", double_constant(constant, sizeof constant, sig->minimum), double_constant(limit, sizeof limit, sig->maximum));
 			} else if (gmax) {
-				fprintf(o, "\tif (rval <= %g) {\n", sig->maximum);
+				fprintf(o, "\tif (rval <= %s) {\n", double_constant(constant, sizeof constant, sig->maximum));
 			} else if (gmin) {
-				fprintf(o, "\tif (rval >= %g) {\n", sig->minimum);
+				fprintf(o, "\tif (rval >= %s) {\n", double_constant(constant, sizeof constant, sig->minimum));
 			}
 			fputs("\t\t*out = rval;\n", o);
 			fputs("\t\treturn 0;\n", o);
@@ -444,12 +1469,68 @@ static int signal2scaling_decode(const char *msgname, unsigned id, signal_t *sig
 	return fputs("}\n\n", o);
 }
 
-static int signal2scaling(const char *msgname, unsigned id, signal_t *sig, FILE *o, bool decode, bool header, const char *god, dbc2c_options_t *copts)
+static int signal2scaling_decode(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, bool header, const char *god, dbc2c_options_t *copts)
+{
+	assert(msgname);
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(copts);
+	const char *type = NULL;
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	const bool use_fixed = signal_fixed_point(sig, copts, &fixed);
+	const bool unlocked = msg_has_sequence(msg, copts) && !header;
+	signal_decode_type(sig, &type, copts);
+	signal2decode_name(msgname, msg, sig, o, unlocked, god, copts);
+	if (header)
+		return fputs(";\n", o);
+	fputs(" {\n", o);
+	if (msg->codec) {
+		char codec[MAX_NAME_LENGTH];
+		if (copts->generate_asserts) {
+			fputs("\tassert(o);\n", o);
+			fputs("\tassert(out);\n", o);
+		}
+		fprintf(o, "\treturn decode_shared_%s_%s((const unsigned char *)&o->%s, %s_layout, out);\n}\n\n", msg_codec_name(codec, sizeof codec, msg, copts), signal_codec(msg, sig)->name, msgname, msgname);
+	} else if (signal2scaling_decode_body(msgname, msg, sig, o, type, use_fixed ? &fixed : NULL, copts) < 0) {
+		return -1;
+	}
+	if (unlocked) /* the body, followed by the function retrying it */
+		return signal2decode_retry(msgname, msg, sig, o, god, copts);
+	return 0;
+}
+
+/* The encode or decode function of a signal shared by the messages with
+ * the same codec, given the structure of one of them */
+static int signal2shared(can_msg_t *msg, signal_t *sig, FILE *o, bool decode, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(sig);
+	assert(o);
+	assert(copts);
+	const char *type = NULL;
+	const char *value_type = signal_decode_type(sig, &type, copts);
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	const bool use_fixed = signal_fixed_point(sig, copts, &fixed);
+	char codec[MAX_NAME_LENGTH];
+	msg_codec_name(codec, sizeof codec, msg, copts);
+	fputs("static DBCC_NOINLINE ", o);
+	if (decode) {
+		fprintf(o, "int decode_shared_%s_%s(const unsigned char *o, const uint16_t *layout, %s *out) {\n", codec, sig->name, value_type);
+		return signal2scaling_decode_body("", msg, sig, o, type, use_fixed ? &fixed : NULL, copts);
+	}
+	fprintf(o, "int encode_shared_%s_%s(unsigned char *o, const uint16_t *layout, %s in) {\n", codec, sig->name, value_type);
+	if (copts->generate_asserts)
+		fputs("\tassert(o);\n", o);
+	return signal2scaling_encode_body("", msg, sig, o, copts);
+}
+
+static int signal2scaling(const char *msgname, can_msg_t *msg, signal_t *sig, FILE *o, bool decode, bool header, const char *god, dbc2c_options_t *copts)
 {
 	assert(copts);
 	if (decode)
-		return signal2scaling_decode(msgname, id, sig, o, header, god, copts);
-	return signal2scaling_encode(msgname, id, sig, o, header, god, copts);
+		return signal2scaling_decode(msgname, msg, sig, o, header, god, copts);
+	return signal2scaling_encode(msgname, msg, sig, o, header, god, copts);
 }
 
 static int print_function_name(FILE *out, const char *prefix, const char *name, const char *postfix, bool in, char *datatype, bool dlc, const char *god)
@@ -477,56 +1558,363 @@ static void make_name(char *newname, size_t maxlen, const char *name, unsigned i
 		snprintf(newname, maxlen-1, "can_%s", name);
 }
 
-static signal_t *find_multiplexor(can_msg_t *msg) {
+/* Signals are given a bit in the subscription and changed masks of their
+ * message in the order of their names, so that the bits do not depend upon
+ * the order the signals are generated in. Signals past the 64th do not get
+ * a bit. */
+static int signal_bit(can_msg_t *msg, signal_t *sig)
+{
 	assert(msg);
-	signal_t *multiplexor = NULL;
-	for (size_t i = 0; i < msg->signal_count; i++) {
-		signal_t *sig = msg->sigs[i];
-		if (sig->is_multiplexor) {
-			multiplexor = sig;
-		}
-		if (sig->is_multiplexed)
-			continue;
-	}
-	return multiplexor;
+	assert(sig);
+	int bit = 0;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (strcmp(msg->sigs[i]->name, sig->name) < 0)
+			bit++;
+	return bit < 64 ? bit : -1;
 }
 
-static void recursively_process_multiplexed(signal_t *sig, FILE *c, const char *name, bool serialize, size_t indent_level) {
-	char* indent = malloc((indent_level + 1) * sizeof(char));
-	memset(indent, '\t', indent_level);
-	indent[indent_level] = '\0';
+/* Multiplexors are always unpacked, so can not be unsubscribed from */
+static int signal_subscription_bit(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	assert(sig);
+	if (sig->is_multiplexor || sig->mul_num)
+		return -1;
+	return signal_bit(msg, sig);
+}
 
-	if ((serialize ? signal2serializer(sig, name, c, indent) : signal2deserializer(sig, name, c, indent)) < 0) {
-		error("%s failed", serialize ? "serialization" : "deserialization");
-	}
+static bool msg_has_changes(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->generate_changes && copts->generate_unpack && !msg_fd_length(msg) && msg->signal_count;
+}
+
+static bool msg_has_phys(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->generate_phys && (copts->generate_unpack || copts->generate_pack) && msg->signal_count;
+}
+
+static uint64_t msg_change_all(can_msg_t *msg)
+{
+	assert(msg);
+	uint64_t all = 0;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		const int bit = signal_bit(msg, msg->sigs[i]);
+		if (bit >= 0)
+			all |= 1uLL << bit;
+	}
+	return all;
+}
+
+static bool msg_has_subscriptions(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	if (!copts->generate_subscriptions || !copts->generate_unpack || msg_is_lazy(msg, copts))
+		return false;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (signal_subscription_bit(msg, msg->sigs[i]) >= 0)
+			return true;
+	return false;
+}
+
+static const char *signal_subscription_name(char *buf, size_t length, const char *msg_name, signal_t *sig)
+{
+	assert(buf);
+	assert(msg_name);
+	assert(sig);
+	snprintf(buf, length, "%s_SUB_%s", msg_name, sig->name);
+	for (size_t i = 0; buf[i]; i++)
+		buf[i] = toupper(buf[i]);
+	return buf;
+}
+
+/* Unpack a signal, or with subscriptions only if it has been subscribed to */
+static int signal2subscribed(can_msg_t *msg, signal_t *sig, const char *name, FILE *c, const char *indent, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(sig);
+	assert(name);
+	assert(c);
+	assert(indent);
+	assert(copts);
+	char lvalue[MAX_NAME_LENGTH * 2], mask[MAX_NAME_LENGTH * 2], inner[MAX_NAME_LENGTH];
+	signal_lvalue(lvalue, sizeof lvalue, msg, name, sig, copts);
+	if (!msg_has_subscriptions(msg, copts) || signal_subscription_bit(msg, sig) < 0)
+		return signal2deserializer(sig, lvalue, c, indent, copts, msg_fd_length(msg));
+	snprintf(inner, sizeof inner, "%s\t", indent);
+	fprintf(c, "%sif (!(o->%s_unsubscribed & %s)) {\n", indent, name, signal_subscription_name(mask, sizeof mask, name, sig));
+	if (signal2deserializer(sig, lvalue, c, inner, copts, msg_fd_length(msg)) < 0)
+		return -1;
+	return fprintf(c, "%s}\n", indent) < 0 ? -1 : 0;
+}
+
+static signal_t *find_multiplexor(can_msg_t *msg) {
+	assert(msg);
+	signal_t *multiplexor = NULL;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		if (sig->is_multiplexor) {
+			multiplexor = sig;
+		}
+		if (sig->is_multiplexed)
+			continue;
+	}
+	return multiplexor;
+}
+
+/* Up to this many multiplexor values are dispatched with a 'switch', which
+ * the compiler can turn into a jump table, beyond it with a binary search
+ * over the ranges of values. */
+#define MUX_SWITCH_VALUES (64u)
+
+/* A range of values of a multiplexor (SG_MUL_VAL_) that selects the same
+ * signals, 'muxed[i]' being true if it selects 'sig->muxed[i]' */
+typedef struct {
+	unsigned min_value, max_value;
+	bool *muxed;
+} mux_range_t;
+
+static int cmp_boundary(const void *lhs, const void *rhs)
+{
+	assert(lhs);
+	assert(rhs);
+	const unsigned long long l = *(const unsigned long long*)lhs, r = *(const unsigned long long*)rhs;
+	return l < r ? -1 : l > r ? 1 : 0;
+}
+
+/* Split the ranges of the multiplexor 'sig' where any of them starts or
+ * ends, so the ranges returned do not overlap and are sorted, each selects
+ * every signal whose range covers it, and adjacent ranges selecting the same
+ * signals are merged. */
+static mux_range_t *mux_ranges(signal_t *sig, size_t *count)
+{
+	assert(sig);
+	assert(count);
+	const size_t n = sig->mul_num;
+	unsigned long long *boundary = allocate(2 * n * sizeof *boundary);
+	for (size_t i = 0; i < n; i++) {
+		boundary[2 * i] = sig->mux_vals[i]->min_value;
+		boundary[2 * i + 1] = sig->mux_vals[i]->max_value + 1ull;
+	}
+	qsort(boundary, 2 * n, sizeof *boundary, cmp_boundary);
+	mux_range_t *ranges = allocate(2 * n * sizeof *ranges);
+	size_t r = 0;
+	for (size_t b = 0; b + 1 < 2 * n; b++) {
+		if (boundary[b] == boundary[b + 1])
+			continue;
+		const unsigned min = boundary[b], max = boundary[b + 1] - 1ull;
+		bool *muxed = allocate(n * sizeof *muxed), any = false;
+		for (size_t i = 0; i < n; i++)
+			any |= muxed[i] = sig->mux_vals[i]->min_value <= min && max <= sig->mux_vals[i]->max_value;
+		if (!any) {
+			free(muxed);
+			continue;
+		}
+		if (r && ranges[r - 1].max_value + 1ull == min && !memcmp(ranges[r - 1].muxed, muxed, n * sizeof *muxed)) {
+			ranges[r - 1].max_value = max;
+			free(muxed);
+			continue;
+		}
+		ranges[r++] = (mux_range_t) { .min_value = min, .max_value = max, .muxed = muxed, };
+	}
+	free(boundary);
+	*count = r;
+	return ranges;
+}
+
+static void free_mux_ranges(mux_range_t *ranges, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+		free(ranges[i].muxed);
+	free(ranges);
+}
+
+static void recursively_process_multiplexed(can_msg_t *msg, signal_t *sig, FILE *c, const char *name, bool serialize, size_t indent_level, dbc2c_options_t *copts);
+
+/* Does 'range' of the multiplexor 'sig' select the signal 'muxed'? A signal
+ * can be given more than one range. */
+static bool mux_selects(signal_t *sig, mux_range_t *range, signal_t *muxed)
+{
+	assert(sig);
+	assert(range);
+	assert(muxed);
+	for (size_t i = 0; i < sig->mul_num; i++)
+		if (range->muxed[i] && sig->muxed[i] == muxed)
+			return true;
+	return false;
+}
 
+/* Process the signals selected by 'range', other than nested multiplexors,
+ * which 'mux_nested' processes once for all of the ranges selecting them */
+static void mux_range2signals(can_msg_t *msg, signal_t *sig, mux_range_t *range, FILE *c, const char *name, bool serialize, size_t indent_level, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(range);
 	for (size_t i = 0; i < sig->mul_num; i++) {
-		fprintf(c, "%s", indent);
+		bool seen = false;
+		for (size_t j = 0; j < i; j++)
+			seen = seen || (range->muxed[j] && sig->muxed[j] == sig->muxed[i]);
+		if (range->muxed[i] && !seen && !sig->muxed[i]->mul_num)
+			recursively_process_multiplexed(msg, sig->muxed[i], c, name, serialize, indent_level, copts);
+	}
+}
 
-		if (i != 0) {
-			fprintf(c, "} else ");
+/* Process each nested multiplexor of 'sig', and the signals it selects, once
+ * after the dispatch on 'sig', which has already returned an error unless
+ * 'sig' is in one of 'ranges'. So only the bounds between the runs of ranges
+ * selecting the nested multiplexor and those that do not are tested, and
+ * nothing is tested if every range selects it. */
+static void mux_nested(can_msg_t *msg, signal_t *sig, mux_range_t *ranges, size_t count, FILE *c, const char *name, bool serialize, const char *indent, size_t indent_level, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(ranges);
+	assert(indent);
+	char object[MAX_NAME_LENGTH + 8];
+	msg_object(object, sizeof object, name);
+	for (size_t i = 0; i < sig->mul_num; i++) {
+		signal_t *nested = sig->muxed[i];
+		bool seen = false;
+		for (size_t j = 0; j < i; j++)
+			seen = seen || sig->muxed[j] == nested;
+		if (seen || !nested->mul_num)
+			continue;
+		bool everywhere = true;
+		for (size_t r = 0; r < count; r++)
+			everywhere = everywhere && mux_selects(sig, &ranges[r], nested);
+		if (everywhere) {
+			recursively_process_multiplexed(msg, nested, c, name, serialize, indent_level, copts);
+			continue;
 		}
-		mul_val_list_t *mul_val = sig->mux_vals[i];
-		if (mul_val->min_value == mul_val->max_value) {
-			fprintf(c, "if (o->%s.%s == %u) {\n", name, sig->name, mul_val->min_value);
-		} else {
-			fprintf(c, "if (o->%s.%s >= %u && o->%s.%s <= %u) {\n", name, sig->name, mul_val->min_value, name, sig->name, mul_val->max_value);
+		size_t runs = 0;
+		for (size_t r = 0; r < count; r++)
+			runs += mux_selects(sig, &ranges[r], nested) && !(r && mux_selects(sig, &ranges[r - 1], nested));
+		fprintf(c, "%sif (", indent);
+		const char *or = "";
+		for (size_t r = 0; r < count; r++) {
+			if (!mux_selects(sig, &ranges[r], nested))
+				continue;
+			size_t e = r;
+			while (e + 1 < count && mux_selects(sig, &ranges[e + 1], nested))
+				e++;
+			if (r && e + 1 < count)
+				fprintf(c, runs > 1 ? "%s(%s%s >= %u && %s%s <= %u)" : "%s%s%s >= %u && %s%s <= %u", or, object, sig->name, ranges[r].min_value, object, sig->name, ranges[e].max_value);
+			else if (r)
+				fprintf(c, "%s%s%s >= %u", or, object, sig->name, ranges[r].min_value);
+			else
+				fprintf(c, "%s%s%s <= %u", or, object, sig->name, ranges[e].max_value);
+			or = " || ";
+			r = e;
+		}
+		fprintf(c, ") {\n");
+		recursively_process_multiplexed(msg, nested, c, name, serialize, indent_level + 1, copts);
+		fprintf(c, "%s}\n", indent);
+	}
+}
+
+/* Dispatch on the multiplexor 'sig' with a binary search over 'ranges[l..r)',
+ * returning an error for values outside of them. 'sig' is known to be
+ * between 'low' and 'high' (starting with the limits of its width), and
+ * comparisons that this makes always true or false are left out. */
+static void mux_search(can_msg_t *msg, signal_t *sig, mux_range_t *ranges, size_t l, size_t r, unsigned long long low, unsigned long long high, FILE *c, const char *name, bool serialize, size_t indent_level, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(ranges);
+	assert(l <= r);
+	char indent[MAX_NAME_LENGTH] = { 0 }, object[MAX_NAME_LENGTH + 8];
+	for (size_t i = 0; i < indent_level && i < sizeof (indent) - 1; i++)
+		indent[i] = '\t';
+	msg_object(object, sizeof object, name);
+	if (l == r) {
+		fprintf(c, "%sreturn -1;\n", indent);
+		return;
+	}
+	const size_t m = l + (r - l) / 2;
+	bool chained = false;
+	if (ranges[m].min_value > low) {
+		fprintf(c, "%sif (%s%s < %u) {\n", indent, object, sig->name, ranges[m].min_value);
+		mux_search(msg, sig, ranges, l, m, low, ranges[m].min_value - 1ull, c, name, serialize, indent_level + 1, copts);
+		chained = true;
+	}
+	if (ranges[m].max_value < high) {
+		fprintf(c, "%s%sif (%s%s > %u) {\n", indent, chained ? "} else " : "", object, sig->name, ranges[m].max_value);
+		mux_search(msg, sig, ranges, m + 1, r, ranges[m].max_value + 1ull, high, c, name, serialize, indent_level + 1, copts);
+		chained = true;
+	}
+	if (!chained) {
+		mux_range2signals(msg, sig, &ranges[m], c, name, serialize, indent_level, copts);
+		return;
+	}
+	fprintf(c, "%s} else {\n", indent);
+	mux_range2signals(msg, sig, &ranges[m], c, name, serialize, indent_level + 1, copts);
+	fprintf(c, "%s}\n", indent);
+}
+
+/* Dispatch on the multiplexor 'sig' with a 'switch', the values of all the
+ * ranges selecting the same signals sharing a case */
+static void mux_switch(can_msg_t *msg, signal_t *sig, mux_range_t *ranges, size_t count, FILE *c, const char *name, bool serialize, const char *indent, size_t indent_level, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(ranges);
+	assert(indent);
+	bool *done = allocate(count * sizeof *done);
+	char object[MAX_NAME_LENGTH + 8];
+	fprintf(c, "%sswitch (%s%s) {\n", indent, msg_object(object, sizeof object, name), sig->name);
+	for (size_t i = 0; i < count; i++) {
+		if (done[i])
+			continue;
+		for (size_t j = i; j < count; j++) {
+			if (done[j] || memcmp(ranges[i].muxed, ranges[j].muxed, sig->mul_num * sizeof *ranges[i].muxed))
+				continue;
+			done[j] = true;
+			for (unsigned long long v = ranges[j].min_value; v <= ranges[j].max_value; v++)
+				fprintf(c, "%scase %llu:\n", indent, v);
 		}
-		recursively_process_multiplexed(sig->muxed[i], c, name, serialize, indent_level + 1);
+		mux_range2signals(msg, sig, &ranges[i], c, name, serialize, indent_level + 1, copts);
+		fprintf(c, "%s\tbreak;\n", indent);
+	}
+	fprintf(c, "%sdefault:\n%s\treturn -1;\n%s}\n", indent, indent, indent);
+	free(done);
+}
+
+static void recursively_process_multiplexed(can_msg_t *msg, signal_t *sig, FILE *c, const char *name, bool serialize, size_t indent_level, dbc2c_options_t *copts) {
+	char* indent = malloc((indent_level + 1) * sizeof(char));
+	memset(indent, '\t', indent_level);
+	indent[indent_level] = '\0';
+
+	char lvalue[MAX_NAME_LENGTH * 3];
+	(serialize ? signal_rvalue : signal_lvalue)(lvalue, sizeof lvalue, msg, name, sig, copts);
+	if ((serialize ? signal2serializer(sig, lvalue, c, indent, copts, msg_fd_length(msg)) : signal2subscribed(msg, sig, name, c, indent, copts)) < 0) {
+		error("%s failed", serialize ? "serialization" : "deserialization");
 	}
 
-	if(sig->mul_num != 0) {
-		fprintf(c, "%s} else {\n%s\treturn -1;\n%s}\n", indent, indent, indent);
+	if (sig->mul_num) {
+		size_t count = 0;
+		mux_range_t *ranges = mux_ranges(sig, &count);
+		unsigned long long values = 0;
+		for (size_t i = 0; i < count; i++)
+			values += ranges[i].max_value - ranges[i].min_value + 1ull;
+		const unsigned long long top = sig->bit_length >= 32 ? UINT_MAX : (1ull << sig->bit_length) - 1ull;
+		if (!sig->is_floating && values <= MUX_SWITCH_VALUES)
+			mux_switch(msg, sig, ranges, count, c, name, serialize, indent, indent_level, copts);
+		else
+			mux_search(msg, sig, ranges, 0, count, 0, top, c, name, serialize, indent_level, copts);
+		mux_nested(msg, sig, ranges, count, c, name, serialize, indent, indent_level, copts);
+		free_mux_ranges(ranges, count);
 	}
 
 	free(indent);
 }
 
-static signal_t *process_signals_and_find_multiplexer(can_msg_t *msg, FILE *c, const char *name, bool serialize)
+static signal_t *process_signals_and_find_multiplexer(can_msg_t *msg, FILE *c, const char *name, bool serialize, dbc2c_options_t *copts)
 {
 	assert(msg);
 	assert(c);
 	assert(name);
+	assert(copts);
 	signal_t *multiplexor = NULL;
 
 	for (size_t i = 0; i < msg->signal_count; i++) {
@@ -534,14 +1922,16 @@ static signal_t *process_signals_and_find_multiplexer(can_msg_t *msg, FILE *c, c
 		if (sig->is_multiplexed)
 			continue;
 		if (sig->muxed) {
-			recursively_process_multiplexed(sig, c, name, serialize, 1);
+			recursively_process_multiplexed(msg, sig, c, name, serialize, 1, copts);
 			continue;
 		} else if (sig->is_multiplexor) {
 			if (multiplexor)
 				error("multiple multiplexor values detected (only one per CAN msg is allowed) for %s", name);
 			multiplexor = sig;
 		}
-		if ((serialize ? signal2serializer(sig, name, c, "\t") : signal2deserializer(sig, name, c, "\t")) < 0)
+		char lvalue[MAX_NAME_LENGTH * 3];
+		(serialize ? signal_rvalue : signal_lvalue)(lvalue, sizeof lvalue, msg, name, sig, copts);
+		if ((serialize ? signal2serializer(sig, lvalue, c, "\t", copts, msg_fd_length(msg)) : signal2subscribed(msg, sig, name, c, "\t", copts)) < 0)
 			error("%s failed", serialize ? "serialization" : "deserialization");
 	}
 	return multiplexor;
@@ -558,12 +1948,14 @@ static int cmp_signal(const void *lhs, const void *rhs)
 		ret = 1;
 	return ret;
 }
-static int multiplexor_switch(can_msg_t *msg, signal_t *multiplexor, FILE *c, const char *msg_name, bool serialize)
+static int multiplexor_switch(can_msg_t *msg, signal_t *multiplexor, FILE *c, const char *msg_name, bool serialize, dbc2c_options_t *copts)
 {
 	assert(msg);
 	assert(multiplexor);
 	assert(c);
-	fprintf(c, "\tswitch (o->%s.%s) {\n", msg_name, multiplexor->name);
+	assert(copts);
+	char selector[MAX_NAME_LENGTH * 3];
+	fprintf(c, "\tswitch (%s) {\n", signal_rvalue(selector, sizeof selector, msg, msg_name, multiplexor, copts));
 	qsort(msg->sigs, msg->signal_count, sizeof(*msg->sigs), cmp_signal);
 	for (size_t i = 0; i < msg->signal_count; i++) {
 		signal_t *sig = msg->sigs[i];
@@ -574,7 +1966,9 @@ static int multiplexor_switch(can_msg_t *msg, signal_t *multiplexor, FILE *c, co
 		for (; j < msg->signal_count && msg->sigs[i]->switchval == msg->sigs[j]->switchval; j++) {
 			assert(j < msg->signal_count);
 			signal_t* sig = msg->sigs[j];
-			if ((serialize ? signal2serializer(sig, msg_name, c, "\t\t") : signal2deserializer(sig, msg_name, c, "\t\t")) < 0)
+			char lvalue[MAX_NAME_LENGTH * 3];
+			(serialize ? signal_rvalue : signal_lvalue)(lvalue, sizeof lvalue, msg, msg_name, sig, copts);
+			if ((serialize ? signal2serializer(sig, lvalue, c, "\t\t", copts, msg_fd_length(msg)) : signal2subscribed(msg, sig, msg_name, c, "\t\t", copts)) < 0)
 				return -1;
 		}
 		i = j - 1;
@@ -585,6 +1979,50 @@ static int multiplexor_switch(can_msg_t *msg, signal_t *multiplexor, FILE *c, co
 	return 0;
 }
 
+static int signal2table_entry(can_msg_t *msg, signal_t *sig, FILE *c, const char *name, dbc2c_options_t *copts)
+{
+	char member[MAX_NAME_LENGTH * 2];
+	assert(sig);
+	assert(c);
+	assert(name);
+	const bool motorola = sig->endianess == endianess_motorola_e;
+	const unsigned size = sig->bit_length <= 8 ? 1 : sig->bit_length <= 16 ? 2 : sig->bit_length <= 32 ? 4 : 8;
+	char flags[128] = "";
+	if (motorola)
+		strcat(flags, "|DBCC_TABLE_MOTOROLA");
+	if (sig->is_signed)
+		strcat(flags, "|DBCC_TABLE_SIGNED");
+	if (sig->is_floating)
+		strcat(flags, "|DBCC_TABLE_FLOAT");
+	if (sig->is_multiplexor)
+		strcat(flags, "|DBCC_TABLE_MULTIPLEXOR");
+	if (sig->is_multiplexed)
+		strcat(flags, "|DBCC_TABLE_MULTIPLEXED");
+	return fprintf(c, "\t{ %u, offsetof(%s_t, %s), %u, %u, %u, %s },\n",
+		sig->is_multiplexed ? sig->switchval : 0,
+		name, signal_member(member, sizeof member, msg, sig, copts),
+		fix_start_bit(motorola, sig->start_bit, sig->bit_length),
+		sig->bit_length, size, flags[0] ? flags + 1 : "0") < 0 ? -1 : 0;
+}
+
+static int msg2table(can_msg_t *msg, FILE *c, const char *name, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	const int count = signal_table_index(msg, NULL);
+	if (msg_simple_multiplexor(msg)) /* in the same order as 'multiplexor_switch' */
+		qsort(msg->sigs, msg->signal_count, sizeof(*msg->sigs), cmp_signal);
+	if (msg->table != msg)
+		return 0;
+	fprintf(c, "static const dbcc_signal_t %s_signals[%d] = {\n", name, count);
+	for (int j = 0; j < count; j++)
+		if (signal2table_entry(msg, msg_table_signal(msg, j), c, name, copts) < 0)
+			return -1;
+	return fputs("};\n\n", c) < 0 ? -1 : 0;
+}
+
 static int msg_data_type(FILE *c, can_msg_t *msg, bool data, dbc2c_options_t *copts)
 {
 	assert(c);
@@ -601,134 +2039,1758 @@ static int msg_data_type_bitfields(FILE *c, can_msg_t *msg, dbc2c_options_t *cop
 	assert(msg);
 	assert(copts);
 	char name[MAX_NAME_LENGTH] = {0};
+	if (copts->use_bitmaps)
+		return 0;
 	make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
 	fprintf(c, "\tunsigned %s_status : 2;\n", name); /* uninitialized, present, faulty (range/crc/timeout/other) */
 	fprintf(c, "\tunsigned %s_tx : 1;\n", name); /* have we packed this message? */
 	return fprintf(c, "\tunsigned %s_rx : 1;\n", name); /* have we unpacked this message? */
 }
 
-static int msg_data_type_time_stamp(FILE *c, can_msg_t *msg, dbc2c_options_t *copts) {
+static size_t msg_flag_words(dbc_t *dbc)
+{
+	assert(dbc);
+	return dbc->message_count ? (dbc->message_count + 63) / 64 : 1;
+}
+
+/* With 'use-bitmaps' the flags of each message are a bit in words shared by
+ * all messages, instead of bit-fields of their own */
+static int msg_data_type_flags(FILE *c, dbc_t *dbc, dbc2c_options_t *copts) {
+	assert(c);
+	assert(dbc);
+	assert(copts);
+	const size_t words = msg_flag_words(dbc);
+	if (!copts->use_bitmaps)
+		return 0;
+	fprintf(c, "\tuint64_t rx_flags[%zu]; /* bit 'i %% 64' of word 'i / 64' is set once message 'CAN_INDEX_*' i is unpacked */\n", words);
+	fprintf(c, "\tuint64_t updated_flags[%zu]; /* set each time a message is unpacked, cleared by 'poll_messages' */\n", words);
+	fprintf(c, "\tuint64_t error_flags[%zu]; /* set when unpacking a message fails, cleared by 'poll_errors' */\n", words);
+	return fprintf(c, "\tuint64_t tx_flags[%zu]; /* set once a message is packed */\n", words);
+}
+
+static int msg_data_type_subscription(FILE *c, can_msg_t *msg, dbc2c_options_t *copts) {
 	assert(c);
 	assert(msg);
 	assert(copts);
 	char name[MAX_NAME_LENGTH] = {0};
+	if (!msg_has_subscriptions(msg, copts))
+		return 0;
 	make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
-	return fprintf(c, "\tdbcc_time_stamp_t %s_time_stamp_rx;\n", name);
+	return fprintf(c, "\tuint64_t %s_unsubscribed; /* signals not unpacked, so zero unpacks them all */\n", name);
 }
 
-static int msg_pack(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, const char *god, dbc2c_options_t *copts)
+static int msg_data_type_changes(FILE *c, can_msg_t *msg, dbc2c_options_t *copts) {
+	assert(c);
+	assert(msg);
+	assert(copts);
+	char name[MAX_NAME_LENGTH] = {0};
+	if (!msg_has_changes(msg, copts))
+		return 0;
+	make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+	if (!msg_is_lazy(msg, copts)) /* the lazy structure holds the payload */
+		fprintf(c, "\tuint64_t %s_payload; /* last payload unpacked */\n", name);
+	return fprintf(c, "\tuint64_t %s_changed; /* signals changed by the last unpack, see %s_signal_e */\n", name, name);
+}
+
+static int msg_data_type_time_stamp(FILE *c, can_msg_t *msg, bool aligned, dbc2c_options_t *copts) {
+	assert(c);
+	assert(msg);
+	assert(copts);
+	char name[MAX_NAME_LENGTH] = {0};
+	make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+	return fprintf(c, "\tdbcc_time_stamp_t %s_time_stamp_rx%s;\n", name, aligned ? " DBCC_CACHE_ALIGN" : "");
+}
+
+static int msg_data_type_sequence(FILE *c, can_msg_t *msg, dbc2c_options_t *copts) {
+	assert(c);
+	assert(msg);
+	assert(copts);
+	char name[MAX_NAME_LENGTH] = {0};
+	if (!msg_has_sequence(msg, copts))
+		return 0;
+	make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+	return fprintf(c, "\tdbcc_sequence_t %s_sequence; /* odd while being unpacked, 0 if never unpacked */\n", name);
+}
+
+static size_t round_up(size_t x, size_t align)
+{
+	assert(align);
+	return ((x + align - 1) / align) * align;
+}
+
+/* Where the signals of a message end when laid out in order from 0, and
+ * their largest alignment. With 'group' only the signals outside of the
+ * union are counted, or if 'multiplexed' only those in the structure for
+ * the multiplexor 'value'. */
+static size_t msg_signals_size(can_msg_t *msg, bool group, bool multiplexed, unsigned value, size_t *align)
+{
+	assert(msg);
+	assert(align);
+	size_t offset = 0;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		if (group && (sig->is_multiplexed != multiplexed || (multiplexed && sig->switchval != value)))
+			continue;
+		const unsigned length = sig->bit_length;
+		const size_t size = length <= 8 ? 1 : length <= 16 ? 2 : length <= 32 ? 4 : 8;
+		offset = round_up(offset, size) + size;
+		*align = size > *align ? size : *align;
+	}
+	return offset;
+}
+
+static size_t msg_data_size(can_msg_t *msg, size_t *align, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(align);
+	assert(copts);
+	*align = 1;
+	if (msg_is_lazy(msg, copts)) {
+		*align = 8;
+		return 16;
+	}
+	if (!msg_has_union(msg, copts))
+		return round_up(msg_signals_size(msg, false, false, 0, align), *align);
+	size_t size = msg_signals_size(msg, true, false, 0, align), largest = 0, union_align = 1;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		size_t a = 1;
+		if (!msg->sigs[i]->is_multiplexed)
+			continue;
+		const size_t group = msg_signals_size(msg, true, true, msg->sigs[i]->switchval, &a);
+		largest = round_up(group, a) > largest ? round_up(group, a) : largest;
+		union_align = a > union_align ? a : union_align;
+	}
+	*align = union_align > *align ? union_align : *align;
+	return round_up(round_up(size, union_align) + largest, *align);
+}
+
+/* Work out where the members of a message grouped together end in the
+ * object, when they start at 'offset', assuming a 32-bit time stamp (and
+ * sequence number), no more
+ * padding than the alignment of each member needs and that the status
+ * bit-fields only take up the byte they need, as they do with GCC. The
+ * largest alignment of the members is put in 'align'. */
+static size_t msg_layout(can_msg_t *msg, size_t offset, size_t *align, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(align);
+	assert(copts);
+	size_t data_align = 1;
+	const size_t data = msg_data_size(msg, &data_align, copts);
+	*align = data_align > sizeof (unsigned) ? data_align : sizeof (unsigned);
+	offset = round_up(offset, sizeof (uint32_t)) + sizeof (uint32_t); /* time stamp */
+	if (msg_has_sequence(msg, copts))
+		offset += sizeof (uint32_t);
+	if (msg_has_subscriptions(msg, copts))
+		offset = round_up(offset, 8) + 8;
+	if (msg_has_changes(msg, copts))
+		offset = round_up(offset, 8) + (msg_is_lazy(msg, copts) ? 8 : 16);
+	if (msg_has_subscriptions(msg, copts) || msg_has_changes(msg, copts))
+		*align = 8;
+	if (!copts->use_bitmaps)
+		offset = round_up(offset, sizeof (unsigned)) + 1; /* status bits */
+	return round_up(offset, data_align) + round_up(data, data_align);
+}
+
+static bool msg_is_hot(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->group_messages && msg->cycle_time && msg->cycle_time <= copts->hot_cycle_time;
+}
+
+/* Messages sent most often first, then those without a cycle time */
+static int cycle_time_compare_function(const void *a, const void *b)
+{
+	assert(a);
+	assert(b);
+	can_msg_t *ap = *((can_msg_t**)a);
+	can_msg_t *bp = *((can_msg_t**)b);
+	const unsigned at = ap->cycle_time ? ap->cycle_time : UINT_MAX;
+	const unsigned bt = bp->cycle_time ? bp->cycle_time : UINT_MAX;
+	if (at != bt)
+		return at < bt ? -1 : 1;
+	if (ap->id != bp->id)
+		return ap->id < bp->id ? -1 : 1;
+	return 0;
+}
+
+/* Pack the signals of a message into 'data', a 'uint64_t *' */
+static int msg_pack_signals(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, dbc2c_options_t *copts)
 {
 	assert(msg);
 	assert(c);
 	assert(name);
 	assert(copts);
 	const bool message_has_signals = motorola_used || intel_used;
-	print_function_name(c, "pack", name, " {\n", false, "uint64_t", false, god);
-	if (copts->generate_asserts) {
-		fprintf(c, "\tassert(o);\n");
-		fprintf(c, "\tassert(data);\n");
+	bool halves_used = false;
+	if (copts->target_32bit) {
+		motorola_used = false;
+		intel_used = false;
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *sig = msg->sigs[i];
+			if (sig->bit_length <= 32)
+				halves_used = true;
+			else if (sig->endianess == endianess_motorola_e)
+				motorola_used = true;
+			else
+				intel_used = true;
+		}
 	}
-	if (message_has_signals)
+	if (motorola_used || intel_used)
 		fprintf(c, "\tregister uint64_t x;\n");
+	if (halves_used)
+		fprintf(c, "\tregister uint32_t w, lo = 0, hi = 0;\n");
 	if (motorola_used)
 		fprintf(c, "\tregister uint64_t m = 0;\n");
 	if (intel_used)
 		fprintf(c, "\tregister uint64_t i = 0;\n");
 	if (!message_has_signals)
 		fprintf(c, "\tUNUSED(o);\n\tUNUSED(data);\n");
-	signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, true);
+	signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, true, copts);
 
 	if (multiplexor)
-		if (multiplexor_switch(msg, multiplexor, c, name, true) < 0)
+		if (multiplexor_switch(msg, multiplexor, c, name, true, copts) < 0)
 			return -1;
 
 	if (message_has_signals) {
-		fprintf(c, "\t*data = %s%s%s%s%s;\n",
+		fprintf(c, "\t*data = %s%s%s%s%s%s%s;\n",
+			halves_used ? "(((uint64_t)hi << 32) | lo)" : "",
+			halves_used && (motorola_used || intel_used) ? "|" : "",
 			swap_motorola && motorola_used ? "reverse_byte_order" : "",
 			motorola_used ? "(m)" : "",
 			motorola_used && intel_used ? "|" : "",
 			(!swap_motorola && intel_used) ? "reverse_byte_order" : "",
 			intel_used ? "(i)" : "");
 	}
-	fprintf(c, "\to->%s_tx = 1;\n", name);
-	fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
 	return 0;
 }
 
-static int msg_unpack(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, const char *god, dbc2c_options_t *copts)
+/* The multiplexor selecting 'sig' with extended multiplexing, if any */
+static signal_t *signal_extended_multiplexor(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	assert(sig);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		for (size_t j = 0; j < msg->sigs[i]->mul_num; j++)
+			if (msg->sigs[i]->muxed[j] == sig)
+				return msg->sigs[i];
+	return NULL;
+}
+
+/* Print a condition on the raw payload 'raw' of a lazy message, true if the
+ * value of the multiplexor 'sig' is in a range selecting 'muxed', or in any
+ * of its ranges if 'muxed' is NULL. Comparisons the width of 'sig' makes
+ * always true are left out. */
+static void lazy_mux_values(can_msg_t *msg, signal_t *sig, signal_t *muxed, FILE *c, const char *name, const char *raw)
+{
+	assert(msg);
+	assert(sig);
+	assert(c);
+	assert(name);
+	assert(raw);
+	size_t count = 0, runs = 0;
+	mux_range_t *ranges = mux_ranges(sig, &count);
+	const unsigned long long top = sig->bit_length >= 32 ? UINT_MAX : (1ull << sig->bit_length) - 1ull;
+	for (size_t r = 0; r < count; r++)
+		runs += !muxed || mux_selects(sig, &ranges[r], muxed);
+	fputc('(', c);
+	const char *or = "";
+	for (size_t r = 0; r < count; r++) {
+		if (muxed && !mux_selects(sig, &ranges[r], muxed))
+			continue;
+		size_t e = r;
+		while (e + 1 < count && ranges[e].max_value + 1ull == ranges[e + 1].min_value && (!muxed || mux_selects(sig, &ranges[e + 1], muxed)))
+			e++;
+		const bool low = ranges[r].min_value || sig->is_signed || sig->is_floating, high = ranges[e].max_value < top;
+		const unsigned min = ranges[r].min_value, max = ranges[e].max_value;
+		fputs(or, c);
+		if (min == max)
+			fprintf(c, "get_%s_%s(%s) == %u", name, sig->name, raw, min);
+		else if (low && high)
+			fprintf(c, runs > 1 ? "(get_%s_%s(%s) >= %u && get_%s_%s(%s) <= %u)" : "get_%s_%s(%s) >= %u && get_%s_%s(%s) <= %u", name, sig->name, raw, min, name, sig->name, raw, max);
+		else if (low)
+			fprintf(c, "get_%s_%s(%s) >= %u", name, sig->name, raw, min);
+		else if (high)
+			fprintf(c, "get_%s_%s(%s) <= %u", name, sig->name, raw, max);
+		else
+			fputs("1", c);
+		or = " || ";
+		r = e;
+	}
+	fputc(')', c);
+	free_mux_ranges(ranges, count);
+}
+
+/* Print a condition on the raw payload 'raw' of a lazy message, true if the
+ * extended multiplexors above 'sig' select it, returning false if there are
+ * none and nothing was printed */
+static bool lazy_mux_selected(can_msg_t *msg, signal_t *sig, FILE *c, const char *name, const char *raw)
+{
+	assert(msg);
+	assert(sig);
+	signal_t *multiplexor = signal_extended_multiplexor(msg, sig);
+	if (!multiplexor)
+		return false;
+	if (lazy_mux_selected(msg, multiplexor, c, name, raw))
+		fputs(" && ", c);
+	lazy_mux_values(msg, multiplexor, sig, c, name, raw);
+	return true;
+}
+
+/* A lazy message is not unpacked, so its multiplexors have to be checked on
+ * the raw payload: return -1 for the values no signal is multiplexed on.
+ * With extended multiplexing each multiplexor is checked when those above
+ * it select it, as 'mux_nested' does when unpacking. */
+static void lazy_multiplexor_check(can_msg_t *msg, FILE *c, const char *name, const char *raw)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(raw);
+	signal_t *multiplexor = msg_simple_multiplexor(msg);
+	if (!multiplexor) {
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *sig = msg->sigs[i];
+			if (!sig->mul_num)
+				continue;
+			fputs("\tif (", c);
+			if (lazy_mux_selected(msg, sig, c, name, raw))
+				fputs(" && ", c);
+			fputc('!', c);
+			lazy_mux_values(msg, sig, NULL, c, name, raw);
+			fputs(")\n\t\treturn -1;\n", c);
+		}
+		return;
+	}
+	fprintf(c, "\tswitch (get_%s_%s(%s)) {\n", name, multiplexor->name, raw);
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		bool seen = false;
+		for (size_t j = 0; j < i; j++)
+			seen = seen || (msg->sigs[j]->is_multiplexed && msg->sigs[j]->switchval == sig->switchval);
+		if (sig->is_multiplexed && !seen)
+			fprintf(c, "\tcase %u:\n", sig->switchval);
+	}
+	fprintf(c, "\t\tbreak;\n\tdefault:\n\t\treturn -1;\n\t}\n");
+}
+
+static int msg_pack(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	const bool message_has_signals = motorola_used || intel_used;
+	const unsigned fd_length = msg_fd_length(msg);
+	if (msg_is_lazy(msg, copts)) {
+		print_function_name(c, "pack", name, " {\n", false, "uint64_t", false, god);
+		if (copts->generate_asserts) {
+			fprintf(c, "\tassert(o);\n");
+			fprintf(c, "\tassert(data);\n");
+		}
+		char raw[MAX_NAME_LENGTH + 8];
+		snprintf(raw, sizeof raw, "o->%s.raw", name);
+		lazy_multiplexor_check(msg, c, name, raw);
+		fprintf(c, "\t*data = o->%s.raw;\n", name);
+		msg_set_flag(msg, c, name, "tx", copts);
+		fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+		return 0;
+	}
+	if (msg_uses_tables(msg, copts)) {
+		print_function_name(c, "pack", name, " {\n", false, "uint64_t", false, god);
+		if (copts->generate_asserts) {
+			fprintf(c, "\tassert(o);\n");
+			fprintf(c, "\tassert(data);\n");
+		}
+		char table[MAX_NAME_LENGTH];
+		fprintf(c, "\tif (dbcc_table_pack(&o->%s, %s_signals, %d, data) < 0)\n\t\treturn -1;\n", name, msg_table_name(table, sizeof table, msg, copts), signal_table_index(msg, NULL));
+		msg_set_flag(msg, c, name, "tx", copts);
+		fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+		return 0;
+	}
+	if (fd_length) {
+		print_function_name(c, "pack", name, " {\n", false, "uint8_t", false, god);
+		if (copts->generate_asserts) {
+			fprintf(c, "\tassert(o);\n");
+			fprintf(c, "\tassert(data);\n");
+		}
+		if (message_has_signals)
+			fprintf(c, "\tregister uint64_t x;\n");
+		else
+			fprintf(c, "\tUNUSED(o);\n");
+		fprintf(c, "\tmemset(data, 0, %u);\n", fd_length);
+		signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, true, copts);
+		if (multiplexor)
+			if (multiplexor_switch(msg, multiplexor, c, name, true, copts) < 0)
+				return -1;
+		msg_set_flag(msg, c, name, "tx", copts);
+		fprintf(c, "\treturn %u;\n}\n\n", fd_length);
+		return 0;
+	}
+	print_function_name(c, "pack", name, " {\n", false, "uint64_t", false, god);
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(data);\n");
+	}
+	if (msg->codec) {
+		char codec[MAX_NAME_LENGTH];
+		fprintf(c, "\tif (pack_shared_%s((const unsigned char *)&o->%s, %s_layout, data) < 0)\n\t\treturn -1;\n", msg_codec_name(codec, sizeof codec, msg, copts), name, name);
+	} else if (msg_pack_signals(msg, c, name, motorola_used, intel_used, copts) < 0) {
+		return -1;
+	}
+	msg_set_flag(msg, c, name, "tx", copts);
+	fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+	return 0;
+}
+
+/* Declare the variables the unpacking code for a message uses, which
+ * depend on the options, from the 'uint64_t' called 'data' */
+static void msg_unpack_declarations(can_msg_t *msg, FILE *c, bool motorola_used, bool intel_used, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(copts);
+	bool window_used = false, lo_used = false, hi_used = false;
+	if (copts->use_byte_window || copts->target_32bit) {
+		motorola_used = false;
+		intel_used = false;
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *sig = msg->sigs[i];
+			if (signal_uses_byte_window(sig, copts)) {
+				window_used = true;
+				lo_used = lo_used || signal_uses_half(sig, false);
+				hi_used = hi_used || signal_uses_half(sig, true);
+			} else if (sig->endianess == endianess_motorola_e) {
+				motorola_used = true;
+			} else {
+				intel_used = true;
+			}
+		}
+	}
+	if (motorola_used || intel_used)
+		fprintf(c, "\tregister uint64_t x;\n");
+	if (window_used)
+		fprintf(c, "\tregister uint32_t w;\n");
+	if (copts->target_32bit && lo_used)
+		fprintf(c, "\tregister const uint32_t lo = data;\n");
+	if (copts->target_32bit && hi_used)
+		fprintf(c, "\tregister const uint32_t hi = data >> 32;\n");
+	if (motorola_used)
+		fprintf(c, "\tregister uint64_t m = %s(data);\n", swap_motorola ? "reverse_byte_order" : "");
+	if (intel_used)
+		fprintf(c, "\tregister uint64_t i = %s(data);\n", swap_motorola ? "" : "reverse_byte_order");
+}
+
+/* Check the length of a message and unpack its signals from 'data' */
+static int msg_unpack_signals(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	msg_unpack_declarations(msg, c, motorola_used, intel_used, copts);
+	if (!motorola_used && !intel_used)
+		fprintf(c, "\tUNUSED(o);\n\tUNUSED(data);\n");
+	if (msg->dlc)
+		fprintf(c, "\tif (dlc < %u)\n\t\treturn -1;\n", msg->dlc);
+	else
+		fprintf(c, "\tUNUSED(dlc);\n");
+
+	signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, false, copts);
+	if (multiplexor)
+		if (multiplexor_switch(msg, multiplexor, c, name, false, copts) < 0)
+			return -1;
+	return 0;
+}
+
+static int msg_unpack_body(can_msg_t *msg, FILE *c, const char *name, const char *function, bool motorola_used, bool intel_used, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(function);
+	assert(copts);
+	const bool message_has_signals = motorola_used || intel_used;
+	char received[MAX_NAME_LENGTH * 2];
+	const unsigned fd_length = msg_fd_length(msg);
+	if (fd_length) {
+		print_function_name(c, "unpack", function, " {\n", false, "const uint8_t", true, god);
+		if (copts->generate_asserts) {
+			fprintf(c, "\tassert(o);\n");
+			fprintf(c, "\tassert(data);\n");
+			fprintf(c, "\tassert(dlc <= 64);\n");
+		}
+		if (message_has_signals)
+			fprintf(c, "\tregister uint64_t x;\n");
+		else
+			fprintf(c, "\tUNUSED(data);\n");
+		fprintf(c, "\tif (dlc < %u)\n\t\treturn -1;\n", fd_length);
+		signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, false, copts);
+		if (multiplexor)
+			if (multiplexor_switch(msg, multiplexor, c, name, false, copts) < 0)
+				return -1;
+		if (!copts->use_bitmaps)
+			fprintf(c, "\to->%s_rx = 1;\n", name);
+		fprintf(c, "\to->%s_time_stamp_rx = time_stamp;\n", name);
+		fprintf(c, "\treturn %u;\n}\n\n", fd_length);
+		return 0;
+	}
+	print_function_name(c, "unpack", function, " {\n", true, "uint64_t", true, god);
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(dlc <= 8);\n");
+	}
+	if (msg_is_lazy(msg, copts)) {
+		if (msg->dlc)
+			fprintf(c, "\tif (dlc < %u)\n\t\treturn -1;\n", msg->dlc);
+		lazy_multiplexor_check(msg, c, name, "data"); /* reject the same frames a full unpack would */
+		if (msg_has_changes(msg, copts))
+			fprintf(c, "\to->%s_changed = %s ? changes_%s(o->%s.raw, data) : 0x%"PRIx64"uLL;\n", name, msg_flag(received, sizeof received, msg, name, "rx", copts), name, name, msg_change_all(msg));
+		fprintf(c, "\to->%s.raw = data;\n", name);
+		fprintf(c, "\to->%s.dlc = dlc;\n", name);
+		if (!copts->use_bitmaps)
+			fprintf(c, "\to->%s_rx = 1;\n", name);
+		fprintf(c, "\to->%s_time_stamp_rx = time_stamp;\n", name);
+		fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+		return 0;
+	}
+	if (msg_uses_tables(msg, copts)) {
+		if (msg->dlc)
+			fprintf(c, "\tif (dlc < %u)\n\t\treturn -1;\n", msg->dlc);
+		else
+			fprintf(c, "\tUNUSED(dlc);\n");
+		char table[MAX_NAME_LENGTH];
+		fprintf(c, "\tif (dbcc_table_unpack(&o->%s, %s_signals, %d, data) < 0)\n\t\treturn -1;\n", name, msg_table_name(table, sizeof table, msg, copts), signal_table_index(msg, NULL));
+	} else if (msg->codec) {
+		char codec[MAX_NAME_LENGTH];
+		fprintf(c, "\tif (unpack_shared_%s((unsigned char *)&o->%s, %s_layout, data, dlc) < 0)\n\t\treturn -1;\n", msg_codec_name(codec, sizeof codec, msg, copts), name, name);
+	} else if (msg_unpack_signals(msg, c, name, motorola_used, intel_used, copts) < 0) {
+		return -1;
+	}
+	if (msg_has_changes(msg, copts)) {
+		fprintf(c, "\to->%s_changed = %s ? changes_%s(o->%s_payload, data) : 0x%"PRIx64"uLL;\n", name, msg_flag(received, sizeof received, msg, name, "rx", copts), name, name, msg_change_all(msg));
+		fprintf(c, "\to->%s_payload = data;\n", name);
+	}
+	if (!copts->use_bitmaps)
+		fprintf(c, "\to->%s_rx = 1;\n", name);
+	fprintf(c, "\to->%s_time_stamp_rx = time_stamp;\n", name);
+	fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+	return 0;
+}
+
+/* Unpack a message with its sequence number odd, so readers know to retry,
+ * and set its flags in the bitmaps once it has been unpacked */
+static int msg_unpack(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	if (!msg_has_sequence(msg, copts) && !copts->use_bitmaps)
+		return msg_unpack_body(msg, c, name, name, motorola_used, intel_used, god, copts);
+	char function[MAX_NAME_LENGTH + 16] = {0}, index[MAX_NAME_LENGTH + 16];
+	snprintf(function, sizeof function, "%s_body", name);
+	if (msg_unpack_body(msg, c, name, function, motorola_used, intel_used, god, copts) < 0)
+		return -1;
+	if (msg_fd_length(msg))
+		print_function_name(c, "unpack", name, " {\n", false, "const uint8_t", true, god);
+	else
+		print_function_name(c, "unpack", name, " {\n", true, "uint64_t", true, god);
+	if (copts->generate_asserts)
+		fprintf(c, "\tassert(o);\n");
+	if (msg_has_sequence(msg, copts))
+		fprintf(c, "\tdbcc_write_begin(&o->%s_sequence);\n", name);
+	fprintf(c, "\tconst int r = unpack_%s(o, data, dlc, time_stamp);\n", function);
+	if (msg_has_sequence(msg, copts))
+		fprintf(c, "\tdbcc_write_end(&o->%s_sequence);\n", name);
+	if (copts->use_bitmaps) {
+		msg_index_name(index, sizeof index, msg);
+		fprintf(c, "\tif (r < 0) {\n");
+		fprintf(c, "\t\tdbcc_flag_set(o->error_flags, %s);\n", index);
+		fprintf(c, "\t\treturn r;\n");
+		fprintf(c, "\t}\n");
+		msg_set_flag(msg, c, name, "rx", copts);
+		fprintf(c, "\tdbcc_flag_set(o->updated_flags, %s);\n", index);
+	}
+	return fprintf(c, "\treturn r;\n}\n\n");
+}
+
+/* The offsets of the members of the structure of a message sharing a codec,
+ * in the order of the names of the signals of the first message sharing it,
+ * followed by the offset and size of the union of multiplexed signals */
+static int msg2layout(can_msg_t *msg, FILE *c, const char *name, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(msg->codec);
+	assert(c);
+	assert(name);
+	assert(copts);
+	char codec[MAX_NAME_LENGTH], member[MAX_NAME_LENGTH * 2];
+	signal_t **map = allocate(msg->signal_count * sizeof *map);
+	msg_match_codec(msg->codec, msg, map);
+	fprintf(c, "static const uint16_t %s_layout[] = { /* members for the signals of %s */\n", name, msg_codec_name(codec, sizeof codec, msg, copts));
+	for (size_t rank = 0; rank < msg->signal_count; rank++)
+		fprintf(c, "\toffsetof(%s_t, %s),\n", name, signal_member(member, sizeof member, msg, map[rank], copts));
+	if (msg_has_union(msg, copts))
+		fprintf(c, "\toffsetof(%s_t, mux), sizeof (((%s_t *)0)->mux),\n", name, name);
+	free(map);
+	return fputs("};\n\n", c) < 0 ? -1 : 0;
+}
+
+/* The functions packing, unpacking, encoding and decoding the structure of
+ * the first of the messages sharing a codec, called by those of each one */
+static int msg2shared(can_msg_t *msg, FILE *c, const char *name, bool motorola_used, bool intel_used, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(msg->codec == msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	if (copts->generate_pack) {
+		fprintf(c, "static DBCC_NOINLINE int pack_shared_%s(const unsigned char *o, const uint16_t *layout, uint64_t *data) {\n", name);
+		if (copts->generate_asserts) {
+			fprintf(c, "\tassert(o);\n");
+			fprintf(c, "\tassert(data);\n");
+		}
+		if (msg_pack_signals(msg, c, "", motorola_used, intel_used, copts) < 0)
+			return -1;
+		fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+	}
+	if (copts->generate_unpack) {
+		fprintf(c, "static DBCC_NOINLINE int unpack_shared_%s(unsigned char *o, const uint16_t *layout, uint64_t data, uint8_t dlc) {\n", name);
+		if (copts->generate_asserts) {
+			fprintf(c, "\tassert(o);\n");
+			fprintf(c, "\tassert(dlc <= 8);\n");
+		}
+		if (msg_unpack_signals(msg, c, "", motorola_used, intel_used, copts) < 0)
+			return -1;
+		fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
+	}
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		if (copts->generate_unpack && signal2shared(msg, msg->sigs[i], c, true, copts) < 0)
+			return -1;
+		if (copts->generate_pack && signal2shared(msg, msg->sigs[i], c, false, copts) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* Copy a message and its members from the object into another, as one
+ * consistent read, for a reader to decode from. The flags in the bitmaps
+ * are not copied. */
+static int msg2snapshot(can_msg_t *msg, FILE *c, const char *name, bool header, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int read_%s_snapshot(const can_obj_%s_t *o, can_obj_%s_t *snapshot)", name, god, god);
+	if (header)
+		return fputs(";\n", c);
+	fputs(" {\n", c);
+	if (copts->generate_asserts) {
+		fputs("\tassert(o);\n", c);
+		fputs("\tassert(snapshot);\n", c);
+	}
+	fputs("\tdbcc_sequence_t s;\n", c);
+	fputs("\tdo {\n", c);
+	fprintf(c, "\t\ts = dbcc_read_begin(&o->%s_sequence);\n", name);
+	fprintf(c, "\t\tsnapshot->%s = o->%s;\n", name, name);
+	fprintf(c, "\t\tsnapshot->%s_time_stamp_rx = o->%s_time_stamp_rx;\n", name, name);
+	if (msg_has_changes(msg, copts)) {
+		if (!msg_is_lazy(msg, copts))
+			fprintf(c, "\t\tsnapshot->%s_payload = o->%s_payload;\n", name, name);
+		fprintf(c, "\t\tsnapshot->%s_changed = o->%s_changed;\n", name, name);
+	}
+	if (!copts->use_bitmaps) {
+		fprintf(c, "\t\tsnapshot->%s_status = o->%s_status;\n", name, name);
+		fprintf(c, "\t\tsnapshot->%s_rx = o->%s_rx;\n", name, name);
+	}
+	fprintf(c, "\t} while (dbcc_read_retry(&o->%s_sequence, s));\n", name);
+	fprintf(c, "\tsnapshot->%s_sequence = s;\n", name);
+	return fputs("\treturn s ? 0 : -1;\n}\n\n", c);
+}
+
+/* Decode or encode every signal of a message at once, to or from a
+ * '<message>_phys_t', returning a mask of the signals that are out of range
+ * with a bit for each as in '<message>_signal_e'. The functions called for
+ * each signal are defined in the same file, so they can be inlined. Where
+ * multiplexed signals share storage only those selected are encoded. */
+static int msg2phys(can_msg_t *msg, FILE *c, const char *name, bool decode, bool header, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	if (decode)
+		fprintf(c, "uint64_t decode_%s_all(const can_obj_%s_t *o, %s_phys_t *out)", name, god, name);
+	else
+		fprintf(c, "uint64_t encode_%s_all(can_obj_%s_t *o, const %s_phys_t *in)", name, god, name);
+	if (header)
+		return fputs(";\n", c) < 0 ? -1 : 0;
+	fputs(" {\n", c);
+	if (copts->generate_asserts) {
+		fputs("\tassert(o);\n", c);
+		fprintf(c, "\tassert(%s);\n", decode ? "out" : "in");
+	}
+	const bool locked = decode && msg_has_sequence(msg, copts);
+	signal_t *multiplexor = msg_simple_multiplexor(msg);
+	const bool shared = multiplexor && (msg_is_lazy(msg, copts) || msg_has_union(msg, copts));
+	char selector[MAX_NAME_LENGTH * 3];
+	if (shared)
+		signal_rvalue(selector, sizeof selector, msg, name, multiplexor, copts);
+	fputs("\tuint64_t invalid = 0;\n", c);
+	if (locked) {
+		fputs("\tdbcc_sequence_t s;\n", c);
+		fputs("\tdo {\n", c);
+		fprintf(c, "\t\ts = dbcc_read_begin(&o->%s_sequence);\n", name);
+		fputs("\t\tinvalid = 0;\n", c);
+	}
+	for (int pass = 0; pass < (decode ? 1 : 2); pass++) { /* encoding the multiplexors first */
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *sig = msg->sigs[i];
+			char function[MAX_NAME_LENGTH * 2], call[MAX_NAME_LENGTH * 4];
+			if (!decode && sig->is_multiplexed != (pass == 1))
+				continue;
+			signal_function_name(function, sizeof function, decode ? "decode" : "encode", name, msg, sig, copts);
+			if (decode)
+				snprintf(call, sizeof call, "%s%s(o, &out->%s)", function, locked ? "_unlocked" : "", sig->name);
+			else
+				snprintf(call, sizeof call, "%s(o, in->%s)", function, sig->name);
+			const char *indent = locked ? "\t\t" : "\t";
+			if (!decode && shared && sig->is_multiplexed) {
+				fprintf(c, "\tif (%s == %u)\n", selector, sig->switchval);
+				indent = "\t\t";
+			}
+			const int bit = signal_bit(msg, sig);
+			if (bit < 0)
+				fprintf(c, "%s(void)%s;\n", indent, call);
+			else
+				fprintf(c, "%sinvalid |= (uint64_t)(%s < 0) << %d; /* %s */\n", indent, call, bit, sig->name);
+		}
+	}
+	if (locked)
+		fprintf(c, "\t} while (dbcc_read_retry(&o->%s_sequence, s));\n", name);
+	return fputs("\treturn invalid;\n}\n\n", c) < 0 ? -1 : 0;
+}
+
+static bool msg_has_build(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	if (!copts->generate_build || !copts->generate_pack || !msg->signal_count || msg_fd_length(msg))
+		return false;
+	for (size_t i = 0; i < msg->signal_count; i++) /* extended multiplexing is not built */
+		if (msg->sigs[i]->is_multiplexed && !msg_simple_multiplexor(msg))
+			return false;
+	return true;
+}
+
+/* Scale, range check and insert one signal from a '<message>_phys_t' into
+ * the 'i' or 'm' word, keeping the raw value of a multiplexor in 'mux'. A
+ * signal that needs converting is copied, in a block of its own unless it
+ * is already in one. */
+static int signal2build(signal_t *sig, FILE *c, const char *indent, bool scoped, dbc2c_options_t *copts)
+{
+	assert(sig);
+	assert(c);
+	assert(indent);
+	assert(copts);
+	const char *raw = determine_type(sig->bit_length, sig->is_signed, sig->is_floating), *type = NULL;
+	const char *in = signal_decode_type(sig, &type, copts);
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	const bool use_fixed = signal_fixed_point(sig, copts, &fixed);
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	char value[MAX_NAME_LENGTH + 8], src[MAX_NAME_LENGTH + 64], inner[8];
+	dbc2c_options_t kopts = *copts; /* built into whole words */
+	kopts.use_byte_window = false;
+	kopts.target_32bit = false;
+	snprintf(value, sizeof value, "in->%s", sig->name);
+	const bool convert = gmin || gmax || sig->scaling != 1.0 || sig->offset != 0.0;
+	const bool block = convert && !scoped;
+	if (block) {
+		snprintf(inner, sizeof inner, "%s\t", indent);
+		fprintf(c, "%s{\n", indent);
+		indent = inner;
+	}
+	if (convert) {
+		fprintf(c, "%s%s v = %s;\n", indent, in, value);
+		if (use_fixed)
+			signal2fixed_raw(sig, "v", c, indent, &fixed);
+		else
+			signal2scaling_raw(sig, "v", c, indent);
+		snprintf(value, sizeof value, "v");
+	}
+	snprintf(src, sizeof src, sig->is_floating || !strcmp(raw, in) ? "%s" : "(%s)(%s)", sig->is_floating || !strcmp(raw, in) ? value : raw, value);
+	if (sig->is_multiplexor)
+		fprintf(c, "%smux = ((%s)(%s)) & 0x%"PRIx64";\n", indent, determine_unsigned_type(sig->bit_length), src,
+				(uint64_t)(sig->bit_length == 64 ? 0xFFFFFFFFFFFFFFFFuLL : (1uLL << sig->bit_length) - 1uLL));
+	if (signal2serializer(sig, src, c, indent, &kopts, 0) < 0)
+		return -1;
+	if (block)
+		fprintf(c, "%.*s}\n", (int)strlen(inner) - 1, inner);
+	return 0;
+}
+
+/* Encode a '<message>_phys_t' straight into the bytes of a frame, without
+ * going through the object, returning the length of the frame or -1 if a
+ * signal is out of range, in which case 'out' is not written. Only the
+ * multiplexed signals selected by the multiplexor are encoded. */
+static int msg2build(can_msg_t *msg, FILE *c, const char *name, bool header, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int build_%s(const %s_phys_t *in, uint8_t out[8])", name, name);
+	if (header)
+		return fputs(";\n", c) < 0 ? -1 : 0;
+	fputs(" {\n", c);
+	if (copts->generate_asserts) {
+		fputs("\tassert(in);\n", c);
+		fputs("\tassert(out);\n", c);
+	}
+	bool motorola_used = false, intel_used = false;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (msg->sigs[i]->endianess == endianess_motorola_e)
+			motorola_used = true;
+		else
+			intel_used = true;
+	signal_t *multiplexor = msg_simple_multiplexor(msg);
+	fputs("\tregister uint64_t x;\n", c);
+	if (motorola_used)
+		fputs("\tregister uint64_t m = 0;\n", c);
+	if (intel_used)
+		fputs("\tregister uint64_t i = 0;\n", c);
+	if (multiplexor)
+		fputs("\tuint64_t mux = 0;\n", c);
+	for (int pass = 0; pass < 2; pass++) { /* the multiplexor first */
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *sig = msg->sigs[i];
+			const char *indent = "\t";
+			if (sig->is_multiplexed != (pass == 1))
+				continue;
+			if (sig->is_multiplexed) {
+				fprintf(c, "\tif (mux == %u) {\n", sig->switchval);
+				indent = "\t\t";
+			}
+			if (signal2build(sig, c, indent, sig->is_multiplexed, copts) < 0)
+				return -1;
+			if (sig->is_multiplexed)
+				fputs("\t}\n", c);
+		}
+	}
+	fprintf(c, "\tconst uint64_t data = %s%s%s%s%s;\n",
+		swap_motorola && motorola_used ? "reverse_byte_order" : "",
+		motorola_used ? "(m)" : "",
+		motorola_used && intel_used ? " | " : "",
+		(!swap_motorola && intel_used) ? "reverse_byte_order" : "",
+		intel_used ? "(i)" : "");
+	fputs("\tfor (unsigned k = 0; k < 8; k++)\n", c);
+	fputs("\t\tout[k] = (uint8_t)(data >> (8 * k));\n", c);
+	return fprintf(c, "\treturn %u;\n}\n\n", msg->dlc) < 0 ? -1 : 0;
+}
+
+static int msg_print(can_msg_t *msg, FILE *c, const char *name, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int print_%s(const can_obj_%s_t *o, FILE *output) {\n", name, god);
+	if (copts->generate_asserts) {
+		fputs("\tassert(o);\n", c);
+		fputs("\tassert(output);\n", c);
+		/* you may note the UNUSED macro may be generated, we should
+		 * still assert we are passed the correct things */
+	}
+	if (msg->signal_count)
+		fprintf(c, "\tint r = 0;\n"); //fprintf(c, "\tdouble scaled;\n\tint r = 0;\n");
+	else
+		fprintf(c, "\tUNUSED(o);\n\tUNUSED(output);\n");
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		if (signal2print(msg, msg->sigs[i], name, c, copts) < 0)
+			return -1;
+	}
+	return msg->signal_count ? fprintf(c, "\treturn r;\n}\n\n") : fprintf(c, "\treturn 0;\n}\n\n");
+}
+
+/* The formatters write a number in at most this many characters */
+#define FORMAT_NUMBER_MAX (24u)
+
+typedef enum {
+	FORMAT_TEXT_E,
+	FORMAT_JSON_E,
+	FORMAT_CSV_E,
+} format_e;
+
+static const char *format_names[] = { "text", "json", "csv" };
+
+/* Literal text for a formatter, held back until other code is written so
+ * that neighbouring literals are copied into the buffer at once */
+typedef struct {
+	char text[256];
+	size_t length;
+} fragment_t;
+
+static int fragment_flush(FILE *c, fragment_t *f, const char *indent)
+{
+	assert(c);
+	assert(f);
+	assert(indent);
+	if (!f->length)
+		return 0;
+	if (f->length == 1) {
+		fprintf(c, "%s*p++ = ", indent);
+		if (f->text[0] == '\n')
+			fputs("'\\n';\n", c);
+		else if (f->text[0] == '\'' || f->text[0] == '\\')
+			fprintf(c, "'\\%c';\n", f->text[0]);
+		else if (isprint((unsigned char)f->text[0]))
+			fprintf(c, "'%c';\n", f->text[0]);
+		else
+			fprintf(c, "'\\%03o';\n", (unsigned char)f->text[0]);
+		f->length = 0;
+		return 0;
+	}
+	fprintf(c, "%smemcpy(p, \"", indent);
+	for (size_t i = 0; i < f->length; i++) {
+		const unsigned char ch = f->text[i];
+		if (ch == '\n')
+			fputs("\\n", c);
+		else if (ch == '"' || ch == '\\' || ch == '?') /* '?' could start a trigraph */
+			fprintf(c, "\\%c", ch);
+		else if (isprint(ch) && ch < 128)
+			fputc(ch, c);
+		else
+			fprintf(c, "\\%03o", ch);
+	}
+	fprintf(c, "\", %u);\n%sp += %u;\n", (unsigned)f->length, indent, (unsigned)f->length);
+	f->length = 0;
+	return 0;
+}
+
+static int fragment_add(FILE *c, fragment_t *f, const char *indent, const char *s, size_t length)
+{
+	assert(c);
+	assert(f);
+	assert(s);
+	for (size_t i = 0; i < length; i++) {
+		if (f->length == sizeof f->text)
+			fragment_flush(c, f, indent);
+		f->text[f->length++] = s[i];
+	}
+	return 0;
+}
+
+static int fragment_puts(FILE *c, fragment_t *f, const char *indent, const char *s)
+{
+	return fragment_add(c, f, indent, s, strlen(s));
+}
+
+/* An enumeration name as it is written by a formatter, quoted as a JSON
+ * string or as a CSV field if needed, the result must be freed */
+static char *format_enum_name(const char *name, format_e format)
+{
+	assert(name);
+	const size_t l = strlen(name);
+	char *n = allocate(l * 6 + 3);
+	size_t j = 0;
+	bool quote = false;
+	if (format == FORMAT_CSV_E)
+		for (size_t i = 0; i < l; i++)
+			quote = quote || strchr(",\"\r\n", name[i]);
+	if (format == FORMAT_JSON_E || quote)
+		n[j++] = '"';
+	for (size_t i = 0; i < l; i++) {
+		const unsigned char ch = name[i];
+		if (format == FORMAT_JSON_E && (ch == '"' || ch == '\\')) {
+			n[j++] = '\\';
+		} else if (format == FORMAT_JSON_E && ch < 0x20) {
+			j += sprintf(&n[j], "\\u%04x", ch);
+			continue;
+		} else if (quote && ch == '"') {
+			n[j++] = '"';
+		}
+		n[j++] = ch;
+	}
+	if (format == FORMAT_JSON_E || quote)
+		n[j++] = '"';
+	n[j] = '\0';
+	return n;
+}
+
+/* Does an earlier item of a value list have the same value as item 'j' */
+static bool val_list_duplicate(val_list_t *list, size_t j)
+{
+	assert(list);
+	for (size_t i = 0; i < j; i++)
+		if (list->val_list_items[i]->value == list->val_list_items[j]->value)
+			return true;
+	return false;
+}
+
+static int64_t signal_sign_extend(signal_t *sig, uint64_t value)
+{
+	assert(sig);
+	if (sig->bit_length < 64 && (value >> (sig->bit_length - 1)) == 1)
+		return (int64_t)value - (INT64_C(1) << sig->bit_length);
+	return (int64_t)value;
+}
+
+static bool signal_has_names(signal_t *sig)
+{
+	assert(sig);
+	return sig->val_list && sig->val_list->val_list_item_count && !sig->is_floating;
+}
+
+/* The most characters the value of a signal, with its enumeration name if
+ * it has one, is written in by a formatter */
+static size_t signal_format_size(signal_t *sig, format_e format)
+{
+	assert(sig);
+	size_t longest = 0;
+	if (signal_has_names(sig))
+		for (size_t i = 0; i < sig->val_list->val_list_item_count; i++) {
+			char *n = format_enum_name(sig->val_list->val_list_items[i]->name, format);
+			const size_t l = strlen(n);
+			longest = l > longest ? l : longest;
+			free(n);
+		}
+	if (format == FORMAT_TEXT_E)
+		return FORMAT_NUMBER_MAX + (sig->units ? strlen(sig->units) + 1 : 0) + (longest ? longest + 3 : 0);
+	return longest > FORMAT_NUMBER_MAX ? longest : FORMAT_NUMBER_MAX;
+}
+
+/* The number of decimals the physical value of a signal can be written with
+ * exactly, using 'raw * scaling + offset' in units of 10 to the power of
+ * minus that, or -1 if there is none or that may overflow */
+static int signal_format_decimals(signal_t *sig, int64_t *scaling, int64_t *offset)
+{
+	assert(sig);
+	assert(scaling);
+	assert(offset);
+	double d = 1.0;
+	for (int i = 0; i <= 9; i++, d *= 10.0) {
+		const double s = sig->scaling * d, o = sig->offset * d;
+		if (fabs(s - nearbyint(s)) > fabs(s) * 1e-12 || fabs(o - nearbyint(o)) > fabs(o) * 1e-12)
+			continue;
+		if (ldexp(fabs(s), sig->bit_length) + fabs(o) >= 9e18)
+			return -1;
+		*scaling = llround(s);
+		*offset = llround(o);
+		return i;
+	}
+	return -1;
+}
+
+/* Write the physical value of a signal, using integers where that is exact */
+static int signal2format_value(signal_t *sig, const char *value, FILE *c, const char *indent, format_e format)
+{
+	assert(sig);
+	assert(value);
+	assert(c);
+	assert(indent);
+	int64_t scaling = 0, offset = 0;
+	const bool integer = !sig->is_floating && sig->scaling == 1.0 && sig->offset == 0.0;
+	if (integer && sig->is_signed)
+		return fprintf(c, "%sp = dbcc_format_i64(p, %s);\n", indent, value);
+	if (integer)
+		return fprintf(c, "%sp = dbcc_format_u64(p, %s);\n", indent, value);
+	const int decimals = sig->is_floating ? -1 : signal_format_decimals(sig, &scaling, &offset);
+	if (decimals == 0)
+		return fprintf(c, "%sp = dbcc_format_i64(p, (int64_t)(%s) * INT64_C(%"PRId64") + INT64_C(%"PRId64"));\n",
+				indent, value, scaling, offset);
+	if (decimals > 0)
+		return fprintf(c, "%sp = dbcc_format_fixed(p, (int64_t)(%s) * INT64_C(%"PRId64") + INT64_C(%"PRId64"), %d);\n",
+				indent, value, scaling, offset, decimals);
+	const bool json = format == FORMAT_JSON_E;
+	if (sig->scaling == 1.0 && sig->offset == 0.0)
+		return fprintf(c, "%sp = dbcc_format_double(p, (double)(%s), %d);\n", indent, value, json);
+	char s[64], o[64];
+	return fprintf(c, "%sp = dbcc_format_double(p, (double)(%s) * %s + %s, %d);\n", indent, value,
+			double_constant(s, sizeof s, sig->scaling), double_constant(o, sizeof o, sig->offset), json);
+}
+
+static int signal2format(can_msg_t *msg, signal_t *sig, const char *msg_name, FILE *c, fragment_t *f, format_e format, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(sig);
+	assert(msg_name);
+	assert(c);
+	assert(f);
+	assert(copts);
+	char value[MAX_NAME_LENGTH * 3], selector[MAX_NAME_LENGTH * 3];
+	const char *indent = "\t";
+	signal_t *multiplexor = msg_simple_multiplexor(msg);
+	signal_rvalue(value, sizeof value, msg, msg_name, sig, copts);
+	if (sig->is_multiplexed && multiplexor) { /* only the selected signals are written */
+		fragment_flush(c, f, indent);
+		signal_rvalue(selector, sizeof selector, msg, msg_name, multiplexor, copts);
+		fprintf(c, "\tif (%s == %u) {\n", selector, sig->switchval);
+		indent = "\t\t";
+	}
+	if (format == FORMAT_TEXT_E) {
+		fragment_puts(c, f, indent, sig->name);
+		fragment_puts(c, f, indent, " = ");
+	} else if (format == FORMAT_JSON_E) {
+		fragment_puts(c, f, indent, "\"");
+		fragment_puts(c, f, indent, sig->name);
+		fragment_puts(c, f, indent, "\":");
+	}
+	fragment_flush(c, f, indent);
+	const bool names = signal_has_names(sig);
+	if (format == FORMAT_TEXT_E || !names)
+		signal2format_value(sig, value, c, indent, format);
+	if (format == FORMAT_TEXT_E && sig->units && sig->units[0]) {
+		fragment_puts(c, f, indent, " ");
+		fragment_puts(c, f, indent, sig->units);
+	}
+	if (names) {
+		val_list_t *list = sig->val_list;
+		fragment_flush(c, f, indent);
+		fprintf(c, "%sswitch (%s) {\n", indent, value);
+		for (size_t i = 0; i < list->val_list_item_count; i++) {
+			if (val_list_duplicate(list, i))
+				continue;
+			char *n = format_enum_name(list->val_list_items[i]->name, format);
+			if (sig->is_signed) /* values are given as the bits of the signal */
+				fprintf(c, "%scase %"PRId64":\n", indent, signal_sign_extend(sig, list->val_list_items[i]->value));
+			else
+				fprintf(c, "%scase %uu:\n", indent, list->val_list_items[i]->value);
+			char inner[8];
+			snprintf(inner, sizeof inner, "%s\t", indent);
+			if (format == FORMAT_TEXT_E)
+				fragment_puts(c, f, inner, " (");
+			fragment_puts(c, f, inner, n);
+			if (format == FORMAT_TEXT_E)
+				fragment_puts(c, f, inner, ")");
+			fragment_flush(c, f, inner);
+			fprintf(c, "%s\tbreak;\n", indent);
+			free(n);
+		}
+		if (format != FORMAT_TEXT_E) {
+			fprintf(c, "%sdefault:\n", indent);
+			char inner[8];
+			snprintf(inner, sizeof inner, "%s\t", indent);
+			signal2format_value(sig, value, c, inner, format);
+			fprintf(c, "%s\tbreak;\n", indent);
+		}
+		fprintf(c, "%s}\n", indent);
+	}
+	if (format == FORMAT_TEXT_E)
+		fragment_puts(c, f, indent, "\n");
+	if (format == FORMAT_JSON_E)
+		fragment_puts(c, f, indent, ",");
+	if (sig->is_multiplexed && multiplexor) {
+		fragment_flush(c, f, indent);
+		fputs("\t}\n", c);
+	}
+	if (format == FORMAT_CSV_E)
+		fragment_puts(c, f, "\t", ",");
+	return 0;
+}
+
+static int signal_name_compare(const void *a, const void *b)
+{
+	assert(a);
+	assert(b);
+	return strcmp((*(signal_t**)a)->name, (*(signal_t**)b)->name);
+}
+
+/* The signals of a message in order of name, as the order of 'msg->sigs'
+ * changes as code is generated, the result must be freed */
+static signal_t **msg_signals_by_name(can_msg_t *msg)
+{
+	assert(msg);
+	signal_t **sigs = allocate((msg->signal_count + 1) * sizeof *sigs);
+	memcpy(sigs, msg->sigs, msg->signal_count * sizeof *sigs);
+	qsort(sigs, msg->signal_count, sizeof *sigs, signal_name_compare);
+	return sigs;
+}
+
+/* Write the physical values of the signals of a message into a buffer of
+ * 'cap' characters, which is not terminated, returning the number written
+ * or 0 if the buffer could be too small. Text has a line for each signal,
+ * with its units and the name of its value if it has one, JSON an object on
+ * one line, and CSV a line of fields in the order of '<MESSAGE>_CSV_HEADER',
+ * the signals are in order of name.
+ * Multiplexed signals that are not selected are left out, or left empty in
+ * CSV. */
+static int msg2format(can_msg_t *msg, FILE *c, const char *name, format_e format, bool header, const char *god, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "size_t format_%s_%s(const can_obj_%s_t *o, char *buf, size_t cap)", name, format_names[format], god);
+	if (header)
+		return fputs(";\n", c) < 0 ? -1 : 0;
+	fputs(" {\n", c);
+	if (copts->generate_asserts) {
+		fputs("\tassert(o);\n", c);
+		fputs("\tassert(buf);\n", c);
+	}
+	size_t size = format == FORMAT_JSON_E ? 3 : 1;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		size += signal_format_size(sig, format);
+		if (format == FORMAT_TEXT_E)
+			size += strlen(sig->name) + 4;
+		else if (format == FORMAT_JSON_E)
+			size += strlen(sig->name) + 4;
+		else
+			size += 1;
+	}
+	if (!msg->signal_count)
+		fputs("\tUNUSED(o);\n", c);
+	fprintf(c, "\tif (cap < %u)\n\t\treturn 0;\n", (unsigned)size);
+	fputs("\tchar *p = buf;\n", c);
+	fragment_t f = { .length = 0 };
+	if (format == FORMAT_JSON_E)
+		fragment_puts(c, &f, "\t", "{");
+	signal_t **sigs = msg_signals_by_name(msg);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (signal2format(msg, sigs[i], name, c, &f, format, copts) < 0) {
+			free(sigs);
+			return -1;
+		}
+	free(sigs);
+	fragment_flush(c, &f, "\t");
+	if (format == FORMAT_JSON_E) {
+		if (msg->signal_count)
+			fputs("\tp -= p[-1] == ','; /* the last separator is replaced */\n", c);
+		fragment_puts(c, &f, "\t", "}\n");
+	} else if (format == FORMAT_CSV_E) {
+		if (msg->signal_count)
+			fputs("\tp--; /* the last separator is replaced */\n", c);
+		fragment_puts(c, &f, "\t", "\n");
+	}
+	fragment_flush(c, &f, "\t");
+	return fputs("\treturn p - buf;\n}\n\n", c) < 0 ? -1 : 0;
+}
+
+static int msg_dlc_check(can_msg_t *msg) {
+	assert(msg);
+	const unsigned bits = msg->dlc * 8;
+	unsigned used = 0;
+	if (find_multiplexor(msg)) // skip multiplexed messages for now
+		return 0;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *s = msg->sigs[i];
+		used += s->bit_length;
+	}
+	if (used > bits) {
+		warning("Too many signals, not enough bytes (DLC is too low, fix your DBC file): %s", msg->name);
+		return -1;
+	}
+	return 0;
+}
+
+static bool signal_is_extractable(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	assert(sig);
+	return !msg_fd_length(msg) && !sig->is_multiplexed;
+}
+
+static int signal2extract_name(FILE *o, const char *msg_name, signal_t *sig, const char *variant, bool phys)
+{
+	assert(o);
+	assert(msg_name);
+	assert(sig);
+	assert(variant);
+	const char *type = phys ? "dbcc_double_t" : determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
+	return fprintf(o, "void extract%s_%s_%s%s(const uint64_t *payloads, size_t n, %s *out)",
+			variant, msg_name, sig->name, phys ? "_phys" : "", type);
+}
+
+/* Signals which have an AVX2 variant of their extract function, the '_phys'
+ * variant converts through 32-bit integers as AVX2 has no 64-bit integer to
+ * double conversion */
+static bool signal_is_vectorizable(signal_t *sig, bool phys)
+{
+	assert(sig);
+	if (sig->is_floating)
+		return false;
+	return !phys || sig->bit_length <= 31 || (sig->is_signed && sig->bit_length <= 32);
+}
+
+/* The AVX2 variant of an extract function handles four payloads at a time,
+ * with the same byte reverse, shift, mask and sign extension 'unpack' does,
+ * and leaves the rest to the scalar kernel */
+static int signal2extract_avx2(const char *msg_name, signal_t *sig, FILE *o, bool phys)
+{
+	assert(msg_name);
+	assert(sig);
+	assert(o);
+	assert(signal_is_vectorizable(sig, phys));
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	const bool reverse = motorola == swap_motorola;
+	const unsigned start = fix_start_bit(motorola, sig->start_bit, sig->bit_length);
+	const unsigned length = sig->bit_length;
+	/* the width of the type from 'determine_type', '_phys' goes through 32 bits */
+	const unsigned width = phys || (length > 16 && length <= 32) ? 32 : length > 32 ? 64 : length > 8 ? 16 : 8;
+
+	fputs("DBCC_AVX2 static ", o);
+	signal2extract_name(o, msg_name, sig, "_avx2", phys);
+	fputs(" {\n", o);
+	if (length < 64)
+		fprintf(o, "\tconst __m256i mask = _mm256_set1_epi64x(0x%"PRIx64");\n", (UINT64_C(1) << length) - 1);
+	if (reverse)
+		fputs("\tconst __m256i swap = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);\n", o);
+	if (sig->is_signed && length < 64)
+		fprintf(o, "\tconst __m256i top = _mm256_set1_epi64x(0x%"PRIx64");\n", UINT64_C(1) << (length - 1));
+	if (width < 64)
+		fputs("\tconst __m256i low = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);\n", o);
+	if (width == 16)
+		fputs("\tconst __m128i narrow = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);\n", o);
+	if (width == 8)
+		fputs("\tconst __m128i narrow = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);\n", o);
+	if (phys) {
+		char constant[64];
+		if (sig->scaling != 1.0)
+			fprintf(o, "\tconst __m256d scaling = _mm256_set1_pd(%s);\n", double_constant(constant, sizeof constant, sig->scaling));
+		if (sig->offset != 0.0)
+			fprintf(o, "\tconst __m256d offset = _mm256_set1_pd(%s);\n", double_constant(constant, sizeof constant, sig->offset));
+	}
+	fputs("\tsize_t k = 0;\n", o);
+	fputs("\tfor (; (k + 4) <= n; k += 4) {\n", o);
+	fputs("\t\t__m256i x = _mm256_loadu_si256((const __m256i *)(payloads + k));\n", o);
+	if (reverse)
+		fputs("\t\tx = _mm256_shuffle_epi8(x, swap);\n", o);
+	if (start)
+		fprintf(o, "\t\tx = _mm256_srli_epi64(x, %u);\n", start);
+	if (length < 64)
+		fputs("\t\tx = _mm256_and_si256(x, mask);\n", o);
+	if (sig->is_signed && length < 64) /* (x ^ top) - top sign extends */
+		fputs("\t\tx = _mm256_sub_epi64(_mm256_xor_si256(x, top), top);\n", o);
+	if (width < 64)
+		fputs("\t\tconst __m128i y = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x, low));\n", o);
+	if (phys) {
+		fputs("\t\t__m256d d = _mm256_cvtepi32_pd(y);\n", o);
+		if (sig->scaling != 1.0)
+			fputs("\t\td = _mm256_mul_pd(d, scaling);\n", o);
+		if (sig->offset != 0.0)
+			fputs("\t\td = _mm256_add_pd(d, offset);\n", o);
+		fputs("\t\t_mm256_storeu_pd((double *)(out + k), d);\n", o);
+	} else if (width == 64) {
+		fputs("\t\t_mm256_storeu_si256((__m256i *)(out + k), x);\n", o);
+	} else if (width == 32) {
+		fputs("\t\t_mm_storeu_si128((__m128i *)(out + k), y);\n", o);
+	} else if (width == 16) {
+		fputs("\t\t_mm_storel_epi64((__m128i *)(out + k), _mm_shuffle_epi8(y, narrow));\n", o);
+	} else {
+		fputs("\t\tconst uint32_t b = (uint32_t)_mm_cvtsi128_si32(_mm_shuffle_epi8(y, narrow));\n", o);
+		fputs("\t\tfor (unsigned j = 0; j < 4; j++)\n", o);
+		fputs("\t\t\tout[k + j] = b >> (j * 8);\n", o);
+	}
+	fputs("\t}\n", o);
+	fprintf(o, "\textract_kernel_%s_%s%s(payloads + k, n - k, out + k);\n", msg_name, sig->name, phys ? "_phys" : "");
+	return fputs("}\n\n", o) < 0 ? -1 : 0;
+}
+
+/* Extract a single signal from many frames of one message into an array,
+ * the kernel is a loop around the same code 'unpack' uses. Where AVX2 is
+ * available, four frames at a time are done by 'signal2extract_avx2' instead,
+ * which is picked at run time. The '_phys' variant also applies the scaling
+ * and offset. */
+static int signal2extract(const char *msg_name, signal_t *sig, FILE *o, bool header, bool phys, dbc2c_options_t *copts)
+{
+	assert(msg_name);
+	assert(sig);
+	assert(o);
+	assert(copts);
+	if (header) {
+		linkage(o, copts);
+		signal2extract_name(o, msg_name, sig, "", phys);
+		return fputs(";\n", o) < 0 ? -1 : 0;
+	}
+	dbc2c_options_t kopts = *copts;
+	kopts.use_byte_window = false;
+	kopts.target_32bit = false;
+	const char *type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
+	const bool simd = signal_is_vectorizable(sig, phys);
+
+	fputs("static inline ", o);
+	signal2extract_name(o, msg_name, sig, "_kernel", phys);
+	fputs(" {\n", o);
+	fputs("\tfor (size_t k = 0; k < n; k++) {\n", o);
+	if (signal_word_declaration(sig, o, "\t\t", "payloads[k]") < 0)
+		return -1;
+	if (phys)
+		fprintf(o, "\t\t%s v;\n", type);
+	if (signal2deserializer(sig, phys ? "v" : "out[k]", o, "\t\t", &kopts, 0) < 0)
+		return -1;
+	if (phys) {
+		char constant[64];
+		fputs("\t\tout[k] = (dbcc_double_t)v", o);
+		if (sig->scaling != 1.0)
+			fprintf(o, " * %s", double_constant(constant, sizeof constant, sig->scaling));
+		if (sig->offset != 0.0)
+			fprintf(o, " + %s", double_constant(constant, sizeof constant, sig->offset));
+		fputs(";\n", o);
+	}
+	fputs("\t}\n}\n\n", o);
+
+	if (simd) {
+		fputs("#if DBCC_SIMD\n", o);
+		if (signal2extract_avx2(msg_name, sig, o, phys) < 0)
+			return -1;
+		fputs("#endif\n\n", o);
+	}
+
+	linkage(o, copts);
+	signal2extract_name(o, msg_name, sig, "", phys);
+	fputs(" {\n", o);
+	if (copts->generate_asserts) {
+		fputs("\tassert(payloads || n == 0);\n", o);
+		fputs("\tassert(out || n == 0);\n", o);
+	}
+	if (simd) {
+		fputs("#if DBCC_SIMD\n", o);
+		fprintf(o, "\tif (%sdbcc_simd_level()) {\n", phys ? "sizeof(dbcc_double_t) == sizeof(double) && " : "");
+		fprintf(o, "\t\textract_avx2_%s_%s%s(payloads, n, out);\n", msg_name, sig->name, phys ? "_phys" : "");
+		fputs("\t\treturn;\n\t}\n", o);
+		fputs("#endif\n", o);
+	}
+	fprintf(o, "\textract_kernel_%s_%s%s(payloads, n, out);\n", msg_name, sig->name, phys ? "_phys" : "");
+	return fputs("}\n\n", o) < 0 ? -1 : 0;
+}
+
+/* The bits a signal occupies in a payload, with the first byte of the frame
+ * in the least significant byte */
+static uint64_t signal_payload_mask(signal_t *sig)
+{
+	assert(sig);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	const unsigned start = fix_start_bit(motorola, sig->start_bit, sig->bit_length);
+	const uint64_t mask = sig->bit_length == 64 ?
+		0xFFFFFFFFFFFFFFFFuLL :
+		(1uLL << sig->bit_length) - 1uLL;
+	uint64_t bits = mask << start;
+	if (motorola) {
+		uint64_t b = 0;
+		for (unsigned i = 0; i < 8; i++)
+			b |= ((bits >> (8 * i)) & 0xFF) << (8 * (7 - i));
+		bits = b;
+	}
+	return bits;
+}
+
+static int signal2lazy(const char *name, signal_t *sig, FILE *c, dbc2c_options_t *copts)
+{
+	assert(name);
+	assert(sig);
+	assert(c);
+	assert(copts);
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	const char *type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
+	dbc2c_options_t kopts = *copts; /* accessors work on the whole word */
+	kopts.use_byte_window = false;
+	kopts.target_32bit = false;
+	const uint64_t keep = ~signal_payload_mask(sig);
+
+	if (copts->generate_unpack || copts->generate_print) {
+		fprintf(c, "static inline %s get_%s_%s(const uint64_t data) {\n", type, name, sig->name);
+		if (signal_word_declaration(sig, c, "\t", "data") < 0)
+			return -1;
+		fprintf(c, "\t%s v;\n", type);
+		if (signal2deserializer(sig, "v", c, "\t", &kopts, 0) < 0)
+			return -1;
+		fputs("\treturn v;\n}\n\n", c);
+	}
+	if (copts->generate_pack) {
+		fprintf(c, "static inline uint64_t set_%s_%s(const uint64_t data, const %s v) {\n", name, sig->name, type);
+		if (signal_word_declaration(sig, c, "\t", NULL) < 0)
+			return -1;
+		if (signal2serializer(sig, "v", c, "\t", &kopts, 0) < 0)
+			return -1;
+		fprintf(c, "\treturn (data & 0x%"PRIx64") | %s(%c);\n}\n\n", keep,
+				motorola == swap_motorola ? "reverse_byte_order" : "", motorola ? 'm' : 'i');
+	}
+	return 0;
+}
+
+static bool signal_is_patchable(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->generate_patch && copts->generate_pack && !msg_fd_length(msg);
+}
+
+/* Encode a signal straight into a frame, changing only the bits it is in;
+ * into the bytes of the frame, or with 'word' into a 'uint64_t' holding
+ * them with the first byte in the least significant byte, as 'pack'
+ * writes it. The frame is not changed if the value is out of range. */
+static int signal2patch(const char *name, signal_t *sig, FILE *c, bool word, bool header, dbc2c_options_t *copts)
+{
+	assert(name);
+	assert(sig);
+	assert(c);
+	assert(copts);
+	const char *raw = determine_type(sig->bit_length, sig->is_signed, sig->is_floating), *type = NULL;
+	const char *in = signal_decode_type(sig, &type, copts);
+	fixed_scaling_t fixed = { 0, 0, 0 };
+	linkage(c, copts);
+	if (word)
+		fprintf(c, "int patch_%s_%s_u64(uint64_t *data, %s in)", name, sig->name, in);
+	else
+		fprintf(c, "int patch_%s_%s(uint8_t *frame, %s in)", name, sig->name, in);
+	if (header)
+		return fputs(";\n", c) < 0 ? -1 : 0;
+	fputs(" {\n", c);
+	if (copts->generate_asserts)
+		fprintf(c, "\tassert(%s);\n", word ? "data" : "frame");
+	if (signal_fixed_point(sig, copts, &fixed))
+		signal2fixed_raw(sig, "in", c, "\t", &fixed);
+	else
+		signal2scaling_raw(sig, "in", c, "\t");
+	char src[64];
+	snprintf(src, sizeof src, sig->is_floating || !strcmp(raw, in) ? "in" : "(%s)(in)", raw);
+
+	const bool motorola = (sig->endianess == endianess_motorola_e);
+	dbc2c_options_t kopts = *copts; /* patching works on whole words or bytes */
+	kopts.use_byte_window = false;
+	kopts.target_32bit = false;
+	if (word) {
+		if (signal_word_declaration(sig, c, "\t", NULL) < 0)
+			return -1;
+		if (signal2serializer(sig, src, c, "\t", &kopts, 0) < 0)
+			return -1;
+		fprintf(c, "\t*data = (*data & 0x%"PRIx64") | %s(%c);\n", ~signal_payload_mask(sig),
+				motorola == swap_motorola ? "reverse_byte_order" : "", motorola ? 'm' : 'i');
+		return fputs("\treturn 0;\n}\n\n", c) < 0 ? -1 : 0;
+	}
+
+	const unsigned length = sig->bit_length;
+	const unsigned start = fix_start_bit(motorola, sig->start_bit, length);
+	const uint64_t mask = length == 64 ? 0xFFFFFFFFFFFFFFFFuLL : (1uLL << length) - 1uLL;
+	if (comment(sig, c, "\t") < 0)
+		return -1;
+	if (sig->is_floating)
+		fprintf(c, "\tconst uint64_t x = pack754_%u(%s) & 0x%"PRIx64";\n", length, src, mask);
+	else
+		fprintf(c, "\tconst uint64_t x = ((%s)(%s)) & 0x%"PRIx64";\n", determine_unsigned_type(length), src, mask);
+	for (unsigned k = start / 8; k <= (start + length - 1) / 8; k++) {
+		const unsigned lsb = start > k * 8 ? start : k * 8;
+		const unsigned msb = start + length < (k + 1) * 8 ? start + length : (k + 1) * 8;
+		const unsigned byte = motorola ? 7 - k : k;
+		const unsigned put = ((1u << (msb - lsb)) - 1u) << (lsb - k * 8);
+		if (put == 0xFF && lsb == k * 8) {
+			fprintf(c, lsb > start ? "\tframe[%u] = (uint8_t)(x >> %u);\n" : "\tframe[%u] = (uint8_t)x;\n", byte, lsb - start);
+			continue;
+		}
+		fprintf(c, "\tframe[%u] = (uint8_t)((frame[%u] & 0x%02x) | ", byte, byte, ~put & 0xFFu);
+		if (lsb > start)
+			fprintf(c, "((x >> %u) & 0x%02x));\n", lsb - start, put);
+		else if (lsb > k * 8)
+			fprintf(c, "((x << %u) & 0x%02x));\n", lsb - k * 8, put);
+		else
+			fprintf(c, "(x & 0x%02x));\n", put);
+	}
+	return fputs("\treturn 0;\n}\n\n", c) < 0 ? -1 : 0;
+}
+
+/* A multiplexed signal has changed if its bits have, or if the value of a
+ * multiplexor has, as its bits might then mean something else */
+static uint64_t signal_change_mask(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	assert(sig);
+	uint64_t bits = signal_payload_mask(sig);
+	if (sig->is_multiplexed)
+		for (size_t i = 0; i < msg->signal_count; i++)
+			if (msg->sigs[i]->is_multiplexor || msg->sigs[i]->mul_num)
+				bits |= signal_payload_mask(msg->sigs[i]);
+	return bits;
+}
+
+static int msg2changes(can_msg_t *msg, FILE *c, const char *name, bool header, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(c);
+	assert(name);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "uint64_t changes_%s(const uint64_t previous, const uint64_t data)", name);
+	if (header)
+		return fputs(";\n", c) < 0 ? -1 : 0;
+	fputs(" {\n", c);
+	fputs("\tconst uint64_t d = previous ^ data;\n", c);
+	fputs("\tuint64_t changed = 0;\n", c);
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		const int bit = signal_bit(msg, sig);
+		if (bit < 0)
+			continue;
+		fprintf(c, "\tchanged |= (uint64_t)((d & 0x%"PRIx64"uLL) != 0) << %d; /* %s */\n", signal_change_mask(msg, sig), bit, sig->name);
+	}
+	return fputs("\treturn changed;\n}\n\n", c) < 0 ? -1 : 0;
+}
+
+static bool msg_has_series(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->generate_series && copts->generate_unpack && !msg_fd_length(msg) && msg->signal_count && !copts->lazy_decode;
+}
+
+/* A series holds every sample of a message received, as one column per
+ * signal (and one for the time stamps) that grows as samples are added */
+static int msg2series_type(can_msg_t *msg, FILE *h, const char *name)
 {
 	assert(msg);
-	assert(c);
+	assert(h);
 	assert(name);
-	assert(copts);
-	const bool message_has_signals = motorola_used || intel_used;
-	print_function_name(c, "unpack", name, " {\n", true, "uint64_t", true, god);
-	if (copts->generate_asserts) {
-		fprintf(c, "\tassert(o);\n");
-		fprintf(c, "\tassert(dlc <= 8);\n");
+	fprintf(h, "typedef struct {\n");
+	fprintf(h, "\tsize_t count, capacity; /* samples in, and size of, each column */\n");
+	fprintf(h, "\tdbcc_time_stamp_t *time_stamp;\n");
+	fprintf(h, "\tstruct { /* apart from the above, so signals can have any name */\n");
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		fprintf(h, "\t\t%s *%s;\n", determine_type(sig->bit_length, sig->is_signed, sig->is_floating), sig->name);
 	}
-	if (message_has_signals)
-		fprintf(c, "\tregister uint64_t x;\n");
-	if (motorola_used)
-		fprintf(c, "\tregister uint64_t m = %s(data);\n", swap_motorola ? "reverse_byte_order" : "");
-	if (intel_used)
-		fprintf(c, "\tregister uint64_t i = %s(data);\n", swap_motorola ? "" : "reverse_byte_order");
-	if (!message_has_signals)
-		fprintf(c, "\tUNUSED(o);\n\tUNUSED(data);\n");
-	if (msg->dlc)
-		fprintf(c, "\tif (dlc < %u)\n\t\treturn -1;\n", msg->dlc);
-	else
-		fprintf(c, "\tUNUSED(dlc);\n");
+	fprintf(h, "\t} columns;\n");
+	return fprintf(h, "} %s_series_t;\n\n", name) < 0 ? -1 : 0;
+}
 
-	signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, false);
-	if (multiplexor)
-		if (multiplexor_switch(msg, multiplexor, c, name, false) < 0)
-			return -1;
-	fprintf(c, "\to->%s_rx = 1;\n", name);
-	fprintf(c, "\to->%s_time_stamp_rx = time_stamp;\n", name);
-	fprintf(c, "\treturn %d;\n}\n\n", msg->dlc);
-	return 0;
+static int signal2column_name(FILE *o, const char *name, signal_t *sig)
+{
+	assert(o);
+	assert(name);
+	assert(sig);
+	return fprintf(o, "int decode_%s_%s_column(const %s_series_t *s, dbcc_double_t *out)", name, sig->name, name);
 }
 
-static int msg_print(can_msg_t *msg, FILE *c, const char *name, const char *god, dbc2c_options_t *copts)
+/* Convert a column to physical units, a value that is out of range is set
+ * to zero and -1 is returned, like the 'decode' functions */
+static int signal2column(const char *name, signal_t *sig, FILE *c, dbc2c_options_t *copts)
 {
-	assert(msg);
-	assert(c);
 	assert(name);
-	assert(god);
+	assert(sig);
+	assert(c);
 	assert(copts);
-	fprintf(c, "int print_%s(const can_obj_%s_t *o, FILE *output) {\n", name, god);
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if (sig->scaling == 0.0)
+		error("invalid scaling factor (fix your DBC file)");
+	linkage(c, copts);
+	signal2column_name(c, name, sig);
+	fputs(" {\n", c);
 	if (copts->generate_asserts) {
-		fputs("\tassert(o);\n", c);
-		fputs("\tassert(output);\n", c);
-		/* you may note the UNUSED macro may be generated, we should
-		 * still assert we are passed the correct things */
-	}
-	if (msg->signal_count)
-		fprintf(c, "\tint r = 0;\n"); //fprintf(c, "\tdouble scaled;\n\tint r = 0;\n");
-	else
-		fprintf(c, "\tUNUSED(o);\n\tUNUSED(output);\n");
-	for (size_t i = 0; i < msg->signal_count; i++) {
-		if (signal2print(msg->sigs[i], msg->id, name, c) < 0)
-			return -1;
+		fputs("\tassert(s);\n", c);
+		fputs("\tassert(out || s->count == 0);\n", c);
 	}
-	return msg->signal_count ? fprintf(c, "\treturn r;\n}\n\n") : fprintf(c, "\treturn 0;\n}\n\n");
+	if (gmin || gmax)
+		fputs("\tint r = 0;\n", c);
+	fputs("\tfor (size_t k = 0; k < s->count; k++) {\n", c);
+	fprintf(c, "\t\tdbcc_double_t rval = (dbcc_double_t)(s->columns.%s[k])", sig->name);
+	char constant[64], limit[64];
+	if (sig->scaling != 1.0)
+		fprintf(c, " * %s", double_constant(constant, sizeof constant, sig->scaling));
+	if (sig->offset != 0.0)
+		fprintf(c, " + %s", double_constant(constant, sizeof constant, sig->offset));
+	fputs(";\n", c);
+	if (gmin && gmax)
+		fprintf(c, "\t\tif ((rval < %s) || (rval > %s)) {\n", double_constant(constant, sizeof constant, sig->minimum), double_constant(limit, sizeof limit, sig->maximum));
+	else if (gmin)
+		fprintf(c, "\t\tif (rval < %s) {\n", double_constant(constant, sizeof constant, sig->minimum));
+	else if (gmax)
+		fprintf(c, "\t\tif (rval > %s) {\n", double_constant(constant, sizeof constant, sig->maximum));
+	if (gmin || gmax)
+		fputs("\t\t\trval = 0;\n\t\t\tr = -1;\n\t\t}\n", c);
+	fputs("\t\tout[k] = rval;\n", c);
+	fputs("\t}\n", c);
+	return fputs((gmin || gmax) ? "\treturn r;\n}\n\n" : "\treturn 0;\n}\n\n", c) < 0 ? -1 : 0;
 }
 
-static int msg_dlc_check(can_msg_t *msg) {
+static int msg2series(can_msg_t *msg, FILE *c, const char *name, bool header, bool motorola_used, bool intel_used, dbc2c_options_t *copts)
+{
 	assert(msg);
-	const unsigned bits = msg->dlc * 8;
-	unsigned used = 0;
-	if (find_multiplexor(msg)) // skip multiplexed messages for now
+	assert(c);
+	assert(name);
+	assert(copts);
+	if (header) {
+		linkage(c, copts);
+		fprintf(c, "int append_%s(%s_series_t *s, uint64_t data, dbcc_time_stamp_t time_stamp);\n", name, name);
+		linkage(c, copts);
+		fprintf(c, "void free_%s_series(%s_series_t *s);\n", name, name);
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			linkage(c, copts);
+			signal2column_name(c, name, msg->sigs[i]);
+			fputs(";\n", c);
+		}
 		return 0;
+	}
+
+	fprintf(c, "static int grow_%s_series(%s_series_t *s) {\n", name, name);
+	fputs("\tconst size_t capacity = s->capacity ? s->capacity * 2 : DBCC_SERIES_CAPACITY;\n", c);
+	fputs("\tvoid *p = NULL;\n", c);
+	fputs("\tif (capacity < s->capacity)\n\t\treturn -1;\n", c);
+	fputs("\tif (!(p = realloc(s->time_stamp, capacity * sizeof(*s->time_stamp))))\n\t\treturn -1;\n", c);
+	fputs("\ts->time_stamp = p;\n", c);
 	for (size_t i = 0; i < msg->signal_count; i++) {
-		signal_t *s = msg->sigs[i];
-		used += s->bit_length;
+		const char *sn = msg->sigs[i]->name;
+		fprintf(c, "\tif (!(p = realloc(s->columns.%s, capacity * sizeof(*s->columns.%s))))\n\t\treturn -1;\n", sn, sn);
+		fprintf(c, "\ts->columns.%s = p;\n", sn);
 	}
-	if (used > bits) {
-		warning("Too many signals, not enough bytes (DLC is too low, fix your DBC file): %s", msg->name);
-		return -1;
+	fputs("\ts->capacity = capacity;\n", c);
+	fputs("\treturn 0;\n}\n\n", c);
+
+	linkage(c, copts);
+	fprintf(c, "void free_%s_series(%s_series_t *s) {\n", name, name);
+	if (copts->generate_asserts)
+		fputs("\tassert(s);\n", c);
+	fputs("\tfree(s->time_stamp);\n", c);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		fprintf(c, "\tfree(s->columns.%s);\n", msg->sigs[i]->name);
+	fputs("\tmemset(s, 0, sizeof(*s));\n", c);
+	fputs("}\n\n", c);
+
+	/* The message is unpacked with the same code as 'unpack' into a local
+	 * copy, which the compiler keeps in registers, then stored as a row */
+	linkage(c, copts);
+	fprintf(c, "int append_%s(%s_series_t *s, uint64_t data, dbcc_time_stamp_t time_stamp) {\n", name, name);
+	if (copts->generate_asserts)
+		fputs("\tassert(s);\n", c);
+	dbc2c_options_t sopts = *copts; /* every signal is stored in a series */
+	sopts.generate_subscriptions = false;
+	fprintf(c, "\tstruct { %s_t %s; } frame, *o = &frame;\n", name, name);
+	fputs("\tmemset(&frame, 0, sizeof(frame));\n", c);
+	msg_unpack_declarations(msg, c, motorola_used, intel_used, &sopts);
+	signal_t *multiplexor = process_signals_and_find_multiplexer(msg, c, name, false, &sopts);
+	if (multiplexor)
+		if (multiplexor_switch(msg, multiplexor, c, name, false, &sopts) < 0)
+			return -1;
+	fprintf(c, "\tif (s->count == s->capacity && grow_%s_series(s) < 0)\n\t\treturn -1;\n", name);
+	fputs("\ts->time_stamp[s->count] = time_stamp;\n", c);
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		char member[MAX_NAME_LENGTH * 2];
+		signal_member(member, sizeof member, msg, sig, copts);
+		if (sig->is_multiplexed && msg_has_union(msg, copts)) /* the other signals in the union are not zero */
+			fprintf(c, "\ts->columns.%s[s->count] = frame.%s.%s == %u ? frame.%s.%s : 0;\n", sig->name, name, multiplexor->name, sig->switchval, name, member);
+		else
+			fprintf(c, "\ts->columns.%s[s->count] = frame.%s.%s;\n", sig->name, name, member);
 	}
+	fputs("\ts->count++;\n", c);
+	fputs("\treturn 0;\n}\n\n", c);
+
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (signal2column(name, msg->sigs[i], c, copts) < 0)
+			return -1;
 	return 0;
 }
 
@@ -756,24 +3818,84 @@ static int msg2c(can_msg_t *msg, FILE *c, dbc2c_options_t *copts, char *god)
 	 * in the DBC file and parsing it. Oh Well. */
 	msg_dlc_check(msg);
 
+	if (msg_is_lazy(msg, copts))
+		for (size_t i = 0; i < msg->signal_count; i++)
+			if (signal2lazy(name, msg->sigs[i], c, copts) < 0)
+				return -1;
+
+	if ((copts->generate_pack || copts->generate_unpack) && msg_uses_tables(msg, copts))
+		if (msg2table(msg, c, name, copts) < 0)
+			return -1;
+
+	if (msg->codec == msg && msg2shared(msg, c, name, motorola_used, intel_used, copts) < 0)
+		return -1;
+	if (msg->codec && (copts->generate_pack || copts->generate_unpack) && msg2layout(msg, c, name, copts) < 0)
+		return -1;
+	/* the signals are left in the order 'multiplexor_switch' would put them */
+	const bool codec = copts->generate_pack || copts->generate_unpack;
+	if (codec && msg->codec && msg->codec != msg && msg_simple_multiplexor(msg))
+		qsort(msg->sigs, msg->signal_count, sizeof(*msg->sigs), cmp_signal);
+
 	if (copts->generate_pack && msg_pack(msg, c, name, motorola_used, intel_used, god, copts) < 0)
 		return -1;
 
+	if (msg_has_changes(msg, copts) && msg2changes(msg, c, name, false, copts) < 0)
+		return -1;
+
 	if (copts->generate_unpack && msg_unpack(msg, c, name, motorola_used, intel_used, god, copts) < 0)
 		return -1;
 
 	for (size_t i = 0; i < msg->signal_count; i++) {
 		if (copts->generate_unpack)
-			if (signal2scaling(name, msg->id, msg->sigs[i], c, true, false, god, copts) < 0)
+			if (signal2scaling(name, msg, msg->sigs[i], c, true, false, god, copts) < 0)
 				return -1;
 		if (copts->generate_pack)
-			if (signal2scaling(name, msg->id, msg->sigs[i], c, false, false, god, copts) < 0)
+			if (signal2scaling(name, msg, msg->sigs[i], c, false, false, god, copts) < 0)
 				return -1;
 	}
 
+	if (signal_is_patchable(msg, copts))
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			if (signal2patch(name, msg->sigs[i], c, false, false, copts) < 0)
+				return -1;
+			if (signal2patch(name, msg->sigs[i], c, true, false, copts) < 0)
+				return -1;
+		}
+
+	if (msg_has_sequence(msg, copts) && msg2snapshot(msg, c, name, false, god, copts) < 0)
+		return -1;
+
+	if (msg_has_phys(msg, copts)) {
+		if (copts->generate_unpack && msg2phys(msg, c, name, true, false, god, copts) < 0)
+			return -1;
+		if (copts->generate_pack && msg2phys(msg, c, name, false, false, god, copts) < 0)
+			return -1;
+	}
+
+	if (msg_has_build(msg, copts) && msg2build(msg, c, name, false, copts) < 0)
+		return -1;
+
+	if (msg_has_series(msg, copts) && msg2series(msg, c, name, false, motorola_used, intel_used, copts) < 0)
+		return -1;
+
+	if (copts->generate_extract && copts->generate_unpack)
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			if (!signal_is_extractable(msg, msg->sigs[i]))
+				continue;
+			if (signal2extract(name, msg->sigs[i], c, false, false, copts) < 0)
+				return -1;
+			if (signal2extract(name, msg->sigs[i], c, false, true, copts) < 0)
+				return -1;
+		}
+
 	if (copts->generate_print && msg_print(msg, c, name, god, copts) < 0)
 		return -1;
 
+	if (copts->generate_format)
+		for (format_e f = FORMAT_TEXT_E; f <= FORMAT_CSV_E; f++)
+			if (msg2format(msg, c, name, f, false, god, copts) < 0)
+				return -1;
+
 	return 0;
 }
 
@@ -788,86 +3910,827 @@ static int msg2h(can_msg_t *msg, FILE *h, dbc2c_options_t *copts, const char *go
 
 	for (size_t i = 0; i < msg->signal_count; i++) {
 		if (copts->generate_unpack)
-			if (signal2scaling(name, msg->id, msg->sigs[i], h, true, true, god, copts) < 0)
+			if (signal2scaling(name, msg, msg->sigs[i], h, true, true, god, copts) < 0)
+				return -1;
+		if (copts->generate_pack)
+			if (signal2scaling(name, msg, msg->sigs[i], h, false, true, god, copts) < 0)
 				return -1;
+	}
+	if (msg_has_changes(msg, copts))
+		msg2changes(msg, h, name, true, copts);
+	if (signal_is_patchable(msg, copts))
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal2patch(name, msg->sigs[i], h, false, true, copts);
+			signal2patch(name, msg->sigs[i], h, true, true, copts);
+		}
+	if (msg_has_sequence(msg, copts))
+		msg2snapshot(msg, h, name, true, god, copts);
+	if (msg_has_phys(msg, copts)) {
+		if (copts->generate_unpack)
+			msg2phys(msg, h, name, true, true, god, copts);
 		if (copts->generate_pack)
-			if (signal2scaling(name, msg->id, msg->sigs[i], h, false, true, god, copts) < 0)
+			msg2phys(msg, h, name, false, true, god, copts);
+	}
+	if (msg_has_build(msg, copts))
+		msg2build(msg, h, name, true, copts);
+	if (msg_has_series(msg, copts))
+		msg2series(msg, h, name, true, false, false, copts);
+	if (copts->generate_extract && copts->generate_unpack)
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			if (!signal_is_extractable(msg, msg->sigs[i]))
+				continue;
+			if (signal2extract(name, msg->sigs[i], h, true, false, copts) < 0)
 				return -1;
+			if (signal2extract(name, msg->sigs[i], h, true, true, copts) < 0)
+				return -1;
+		}
+	if (copts->generate_format) {
+		char upper[MAX_NAME_LENGTH] = { 0 };
+		for (size_t i = 0; name[i]; i++)
+			upper[i] = toupper(name[i]);
+		signal_t **sigs = msg_signals_by_name(msg);
+		fprintf(h, "#define %s_CSV_HEADER \"", upper);
+		for (size_t i = 0; i < msg->signal_count; i++)
+			fprintf(h, "%s%s", i ? "," : "", sigs[i]->name);
+		fputs("\\n\"\n", h);
+		free(sigs);
+		for (format_e f = FORMAT_TEXT_E; f <= FORMAT_CSV_E; f++)
+			msg2format(msg, h, name, f, true, god, copts);
+	}
+	fputs("\n\n", h);
+	return 0;
+}
+
+static const char *cfunctions =
+"static inline uint64_t reverse_byte_order(uint64_t x) {\n"
+"\tx = (x & 0x00000000FFFFFFFF) << 32 | (x & 0xFFFFFFFF00000000) >> 32;\n"
+"\tx = (x & 0x0000FFFF0000FFFF) << 16 | (x & 0xFFFF0000FFFF0000) >> 16;\n"
+"\tx = (x & 0x00FF00FF00FF00FF) << 8  | (x & 0xFF00FF00FF00FF00) >> 8;\n"
+"\treturn x;\n"
+"}\n\n";
+static const char *cextract =
+"#ifndef DBCC_SIMD\n"
+"#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))\n"
+"#define DBCC_SIMD (1) /* select AVX2 variants of extract functions at run time */\n"
+"#else\n"
+"#define DBCC_SIMD (0)\n"
+"#endif\n"
+"#endif\n\n"
+"#if DBCC_SIMD\n"
+"#include <immintrin.h>\n\n"
+"#define DBCC_AVX2 __attribute__((target(\"avx2\")))\n\n"
+"/* 1 if AVX2 can be used, every thread computes the same value */\n"
+"static __attribute__((unused)) int dbcc_simd_level(void) {\n"
+"\tstatic int level = -1;\n"
+"\tint l = __atomic_load_n(&level, __ATOMIC_RELAXED);\n"
+"\tif (l < 0) {\n"
+"\t\t__builtin_cpu_init();\n"
+"\t\tl = __builtin_cpu_supports(\"avx2\") ? 1 : 0;\n"
+"\t\t__atomic_store_n(&level, l, __ATOMIC_RELAXED);\n"
+"\t}\n"
+"\treturn l;\n"
+"}\n"
+"#endif\n\n";
+static const char *cseries =
+"#ifndef DBCC_SERIES_CAPACITY\n"
+"#define DBCC_SERIES_CAPACITY (1024) /* initial number of samples in a series */\n"
+"#endif\n\n";
+static const char *cfunctions_fd =
+"static inline uint64_t dbcc_load_le64(const uint8_t *b) {\n"
+"\tuint64_t x = 0;\n"
+"\tfor (int j = 7; j >= 0; j--)\n"
+"\t\tx = (x << 8) | b[j];\n"
+"\treturn x;\n"
+"}\n\n"
+"static inline uint64_t dbcc_load_be64(const uint8_t *b) {\n"
+"\tuint64_t x = 0;\n"
+"\tfor (int j = 0; j < 8; j++)\n"
+"\t\tx = (x << 8) | b[j];\n"
+"\treturn x;\n"
+"}\n\n"
+"static inline void dbcc_store_le64(uint8_t *b, uint64_t x) {\n"
+"\tfor (int j = 0; j < 8; j++, x >>= 8)\n"
+"\t\tb[j] = x;\n"
+"}\n\n"
+"static inline void dbcc_store_be64(uint8_t *b, uint64_t x) {\n"
+"\tfor (int j = 7; j >= 0; j--, x >>= 8)\n"
+"\t\tb[j] = x;\n"
+"}\n\n"
+"static inline uint64_t dbcc_load_classic(const uint8_t *b, uint8_t dlc) {\n"
+"\tuint8_t t[8] = { 0 };\n"
+"\tmemcpy(t, b, dlc > 8 ? 8 : dlc);\n"
+"\treturn dbcc_load_le64(t);\n"
+"}\n\n";
+static const char *cfixed =
+"/* Divide by a positive number, rounding to the nearest integer */\n"
+"static inline dbcc_fixed_t dbcc_fixed_divide(dbcc_fixed_t n, dbcc_fixed_t d) {\n"
+"\treturn n < 0 ? -((-n + d / 2) / d) : (n + d / 2) / d;\n"
+"}\n\n";
+
+static const char *cmetadata =
+"/* FNV-1a of a signal name, the perfect hash of the names mixes it */\n"
+"static uint32_t dbcc_signal_hash(const char *s) {\n"
+"\tuint32_t h = UINT32_C(2166136261);\n"
+"\tfor (; *s; s++)\n"
+"\t\th = (h ^ (unsigned char)*s) * UINT32_C(16777619);\n"
+"\treturn h;\n"
+"}\n\n"
+"/* Mix a hash with a seed, with the MurmurHash3 finaliser, and take the high\n"
+" * bits of the result to index a table of DBCC_SIGNAL_COUNT entries */\n"
+"static uint32_t dbcc_signal_mix(uint32_t h, const uint32_t seed) {\n"
+"\th ^= seed;\n"
+"\th = (h ^ (h >> 16)) * UINT32_C(0x85ebca6b);\n"
+"\th = (h ^ (h >> 13)) * UINT32_C(0xc2b2ae35);\n"
+"\th ^= h >> 16;\n"
+"\treturn (uint32_t)(((uint64_t)h * DBCC_SIGNAL_COUNT) >> 32);\n"
+"}\n\n";
+
+static const char *cseqlock =
+"#ifndef DBCC_SEQUENCE_LOAD /* define all three for compilers without these built-ins */\n"
+"#define DBCC_SEQUENCE_LOAD(P, ORDER)     __atomic_load_n((P), __ATOMIC_ ## ORDER)\n"
+"#define DBCC_SEQUENCE_STORE(P, V, ORDER) __atomic_store_n((P), (V), __ATOMIC_ ## ORDER)\n"
+"#define DBCC_SEQUENCE_FENCE(ORDER)       __atomic_thread_fence(__ATOMIC_ ## ORDER)\n"
+"#endif\n\n"
+"/* Only one thread may unpack a message at a time, readers never write */\n"
+"static inline void dbcc_write_begin(dbcc_sequence_t *s) {\n"
+"\tDBCC_SEQUENCE_STORE(s, DBCC_SEQUENCE_LOAD(s, RELAXED) + 1, RELAXED);\n"
+"\tDBCC_SEQUENCE_FENCE(RELEASE);\n"
+"}\n\n"
+"static inline void dbcc_write_end(dbcc_sequence_t *s) {\n"
+"\tDBCC_SEQUENCE_STORE(s, DBCC_SEQUENCE_LOAD(s, RELAXED) + 1, RELEASE);\n"
+"}\n\n"
+"static inline dbcc_sequence_t dbcc_read_begin(const dbcc_sequence_t *s) {\n"
+"\treturn DBCC_SEQUENCE_LOAD(s, ACQUIRE);\n"
+"}\n\n"
+"/* Was the message being unpacked when read began, or since? */\n"
+"static inline int dbcc_read_retry(const dbcc_sequence_t *s, dbcc_sequence_t begin) {\n"
+"\tDBCC_SEQUENCE_FENCE(ACQUIRE);\n"
+"\treturn (begin & 1) || DBCC_SEQUENCE_LOAD(s, RELAXED) != begin;\n"
+"}\n\n";
+
+static const char *cbitmaps =
+"static inline int dbcc_popcount(uint64_t x) {\n"
+"#ifdef __GNUC__\n"
+"\treturn __builtin_popcountll(x);\n"
+"#else\n"
+"\tint n = 0;\n"
+"\tfor (; x; x &= x - 1)\n"
+"\t\tn++;\n"
+"\treturn n;\n"
+"#endif\n"
+"}\n\n";
+
+static const char *ctables =
+"/* Table driven codec, each message is described by an array of its signals\n"
+" * which a generic interpreter walks to pack and unpack it */\n"
+"#define DBCC_TABLE_MOTOROLA    (1u << 0)\n"
+"#define DBCC_TABLE_SIGNED      (1u << 1)\n"
+"#define DBCC_TABLE_FLOAT       (1u << 2)\n"
+"#define DBCC_TABLE_MULTIPLEXOR (1u << 3)\n"
+"#define DBCC_TABLE_MULTIPLEXED (1u << 4)\n"
+"\n"
+"typedef struct {\n"
+"\tuint32_t switchval; /* multiplexor value a multiplexed signal is present for */\n"
+"\tuint16_t field;     /* offset of the signal in the message structure */\n"
+"\tuint8_t start;      /* of the signal in the frame, byte reversed if Motorola */\n"
+"\tuint8_t length;     /* in bits */\n"
+"\tuint8_t size;       /* in bytes, of an integer signal in the message structure */\n"
+"\tuint8_t flags;      /* DBCC_TABLE_* */\n"
+"} dbcc_signal_t;\n"
+"\n"
+"static inline uint64_t dbcc_table_mask(const unsigned length) {\n"
+"\treturn length == 64 ? 0xFFFFFFFFFFFFFFFFuLL : (1uLL << length) - 1uLL;\n"
+"}\n"
+"\n"
+"/* Read an integer signal from a message structure, sign extended */\n"
+"static inline uint64_t dbcc_table_read(const unsigned char *p, const dbcc_signal_t *s) {\n"
+"\tuint64_t x = 0;\n"
+"\tswitch (s->size) {\n"
+"\tcase 1: { uint8_t v; memcpy(&v, p, sizeof v); x = v; break; }\n"
+"\tcase 2: { uint16_t v; memcpy(&v, p, sizeof v); x = v; break; }\n"
+"\tcase 4: { uint32_t v; memcpy(&v, p, sizeof v); x = v; break; }\n"
+"\tdefault: memcpy(&x, p, sizeof x); break;\n"
+"\t}\n"
+"\tif ((s->flags & DBCC_TABLE_SIGNED) && ((x >> (s->size * 8 - 1)) & 1))\n"
+"\t\tx |= ~dbcc_table_mask(s->size * 8);\n"
+"\treturn x;\n"
+"}\n"
+"\n"
+"static inline void dbcc_table_write(unsigned char *p, const dbcc_signal_t *s, const uint64_t x) {\n"
+"\tswitch (s->size) {\n"
+"\tcase 1: { const uint8_t v = x; memcpy(p, &v, sizeof v); break; }\n"
+"\tcase 2: { const uint16_t v = x; memcpy(p, &v, sizeof v); break; }\n"
+"\tcase 4: { const uint32_t v = x; memcpy(p, &v, sizeof v); break; }\n"
+"\tdefault: memcpy(p, &x, sizeof x); break;\n"
+"\t}\n"
+"}\n"
+"\n";
+static const char *ctables_unpack =
+"static void dbcc_table_set(void *m, const dbcc_signal_t *s, const uint64_t x) {\n"
+"\tunsigned char *p = (unsigned char*)m + s->field;\n"
+"#if DBCC_TABLE_FLOATS\n"
+"\tif ((s->flags & DBCC_TABLE_FLOAT) && s->length == 64) {\n"
+"\t\tconst dbcc_double_t f = unpack754_64(x);\n"
+"\t\tmemcpy(p, &f, sizeof f);\n"
+"\t\treturn;\n"
+"\t}\n"
+"\tif (s->flags & DBCC_TABLE_FLOAT) {\n"
+"\t\tconst dbcc_float_t f = unpack754_32(x);\n"
+"\t\tmemcpy(p, &f, sizeof f);\n"
+"\t\treturn;\n"
+"\t}\n"
+"#endif\n"
+"\tdbcc_table_write(p, s, x);\n"
+"}\n"
+"\n"
+"/* Multiplexed signals are only unpacked if the multiplexor, which comes\n"
+" * before them in the table, selects them; a frame that selects none is\n"
+" * rejected */\n"
+"static int dbcc_table_unpack(void *m, const dbcc_signal_t *s, size_t count, const uint64_t data) {\n"
+"\tconst uint64_t motorola = reverse_byte_order(data);\n"
+"\tuint64_t selector = 0;\n"
+"\tint multiplexed = 0, present = 0;\n"
+"\tfor (; count; count--, s++) {\n"
+"\t\tif (s->flags & DBCC_TABLE_MULTIPLEXED) {\n"
+"\t\t\tif (s->switchval != selector)\n"
+"\t\t\t\tcontinue;\n"
+"\t\t\tpresent = 1;\n"
+"\t\t}\n"
+"\t\tconst uint64_t mask = dbcc_table_mask(s->length);\n"
+"\t\tuint64_t x = (((s->flags & DBCC_TABLE_MOTOROLA) ? motorola : data) >> s->start) & mask;\n"
+"\t\tif ((s->flags & DBCC_TABLE_SIGNED) && ((x >> (s->length - 1)) & 1))\n"
+"\t\t\tx |= ~mask;\n"
+"\t\tif (s->flags & DBCC_TABLE_MULTIPLEXOR) {\n"
+"\t\t\tselector = x;\n"
+"\t\t\tmultiplexed = 1;\n"
+"\t\t}\n"
+"\t\tdbcc_table_set(m, s, x);\n"
+"\t}\n"
+"\treturn multiplexed && !present ? -1 : 0;\n"
+"}\n"
+"\n";
+static const char *ctables_pack =
+"static uint64_t dbcc_table_get(const void *m, const dbcc_signal_t *s) {\n"
+"\tconst unsigned char *p = (const unsigned char*)m + s->field;\n"
+"#if DBCC_TABLE_FLOATS\n"
+"\tif ((s->flags & DBCC_TABLE_FLOAT) && s->length == 64) {\n"
+"\t\tdbcc_double_t f;\n"
+"\t\tmemcpy(&f, p, sizeof f);\n"
+"\t\treturn pack754_64(f);\n"
+"\t}\n"
+"\tif (s->flags & DBCC_TABLE_FLOAT) {\n"
+"\t\tdbcc_float_t f;\n"
+"\t\tmemcpy(&f, p, sizeof f);\n"
+"\t\treturn pack754_32(f);\n"
+"\t}\n"
+"#endif\n"
+"\treturn dbcc_table_read(p, s);\n"
+"}\n"
+"\n"
+"static int dbcc_table_pack(const void *m, const dbcc_signal_t *s, size_t count, uint64_t *data) {\n"
+"\tuint64_t motorola = 0, intel = 0, selector = 0;\n"
+"\tint multiplexed = 0, present = 0;\n"
+"\tfor (; count; count--, s++) {\n"
+"\t\tif (s->flags & DBCC_TABLE_MULTIPLEXED) {\n"
+"\t\t\tif (s->switchval != selector)\n"
+"\t\t\t\tcontinue;\n"
+"\t\t\tpresent = 1;\n"
+"\t\t}\n"
+"\t\tconst uint64_t x = dbcc_table_get(m, s);\n"
+"\t\tif (s->flags & DBCC_TABLE_MULTIPLEXOR) {\n"
+"\t\t\tselector = x;\n"
+"\t\t\tmultiplexed = 1;\n"
+"\t\t}\n"
+"\t\tif (s->flags & DBCC_TABLE_MOTOROLA)\n"
+"\t\t\tmotorola |= (x & dbcc_table_mask(s->length)) << s->start;\n"
+"\t\telse\n"
+"\t\t\tintel |= (x & dbcc_table_mask(s->length)) << s->start;\n"
+"\t}\n"
+"\tif (multiplexed && !present)\n"
+"\t\treturn -1;\n"
+"\t*data = reverse_byte_order(motorola) | intel;\n"
+"\treturn 0;\n"
+"}\n"
+"\n";
+static const char *cformat =
+"/* Write a number at 'p', without using the locale, and return the end of\n"
+" * what was written */\n"
+"static inline char *dbcc_format_u64(char *p, uint64_t x) {\n"
+"\tchar t[20];\n"
+"\tsize_t n = 0;\n"
+"\tdo {\n"
+"\t\tt[n++] = '0' + x % 10;\n"
+"\t\tx /= 10;\n"
+"\t} while (x);\n"
+"\twhile (n)\n"
+"\t\t*p++ = t[--n];\n"
+"\treturn p;\n"
+"}\n\n"
+"static inline char *dbcc_format_i64(char *p, int64_t x) {\n"
+"\tif (x < 0)\n"
+"\t\t*p++ = '-';\n"
+"\treturn dbcc_format_u64(p, x < 0 ? -(uint64_t)x : (uint64_t)x);\n"
+"}\n\n"
+"/* 'x' is in units of 10 to the power of minus 'decimals' */\n"
+"static inline char *dbcc_format_fixed(char *p, int64_t x, unsigned decimals) {\n"
+"\tuint64_t u = x < 0 ? -(uint64_t)x : (uint64_t)x, scale = 1;\n"
+"\tfor (unsigned i = 0; i < decimals; i++)\n"
+"\t\tscale *= 10;\n"
+"\tif (x < 0)\n"
+"\t\t*p++ = '-';\n"
+"\tp = dbcc_format_u64(p, u / scale);\n"
+"\tif (!decimals)\n"
+"\t\treturn p;\n"
+"\t*p++ = '.';\n"
+"\tu %= scale;\n"
+"\tfor (unsigned i = decimals; i; i--) {\n"
+"\t\tp[i - 1] = '0' + u % 10;\n"
+"\t\tu /= 10;\n"
+"\t}\n"
+"\treturn p + decimals;\n"
+"}\n\n"
+"/* Six decimals at most with no trailing zeros, an exponent for very large\n"
+" * values, and 'null' for JSON if the value is not finite */\n"
+"static inline char *dbcc_format_double(char *p, double x, int json) {\n"
+"\tif (x != x || x - x != 0) {\n"
+"\t\tconst char *s = json ? \"null\" : x != x ? \"nan\" : x < 0 ? \"-inf\" : \"inf\";\n"
+"\t\twhile (*s)\n"
+"\t\t\t*p++ = *s++;\n"
+"\t\treturn p;\n"
+"\t}\n"
+"\tif (x > -9e12 && x < 9e12) {\n"
+"\t\tp = dbcc_format_fixed(p, (int64_t)(x * 1e6 + (x < 0 ? -0.5 : 0.5)), 6);\n"
+"\t\twhile (p[-1] == '0')\n"
+"\t\t\tp--;\n"
+"\t\treturn p[-1] == '.' ? p - 1 : p;\n"
+"\t}\n"
+"\tunsigned exponent = 0;\n"
+"\tfor (; x <= -1e18 || x >= 1e18; exponent++)\n"
+"\t\tx /= 10;\n"
+"\tp = dbcc_format_i64(p, (int64_t)x);\n"
+"\tif (!exponent)\n"
+"\t\treturn p;\n"
+"\t*p++ = 'e';\n"
+"\treturn dbcc_format_u64(p, exponent);\n"
+"}\n\n";
+
+static const char *cfunctions_print_only =
+"static inline int print_helper(int r, int print_return_value) {\n"
+"\treturn ((r >= 0) && (print_return_value >= 0)) ? r + print_return_value : -1;\n"
+"}\n\n";
+
+static int switch_function(FILE *c, dbc_t *dbc, char *function, bool unpack,
+		bool prototype, const char *datatype, bool dlc, const char *god, dbc2c_options_t *copts)
+{
+	assert(c);
+	assert(dbc);
+	assert(function);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int %s_message(can_obj_%s_t *o, const unsigned long id, %s %sdata%s)",
+			function, god, datatype, unpack ? "" : "*",
+			dlc ? ", uint8_t dlc, dbcc_time_stamp_t time_stamp" : "");
+	if (prototype)
+		return fprintf(c, ";\n");
+	fprintf(c, " {\n");
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */\n");
+		if (dlc)
+			fprintf(c, "\tassert(dlc <= 8);         /* Maximum of 8 bytes in a CAN packet */\n");
+	}
+
+	fprintf(c, "\tswitch (id) {\n");
+	size_t cases = 0;
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		char name[MAX_NAME_LENGTH] = {0};
+		if (msg_fd_length(msg)) /* see switch_function_fd */
+			continue;
+		make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+		fprintf(c, "\tcase 0x%03lx: return %s_%s(o, data%s);\n",
+				msg->id,
+				function,
+				name,
+				dlc ? ", dlc, time_stamp" : "");
+		cases++;
+	}
+	fprintf(c, "\tdefault: break; \n\t}\n");
+	if (!cases)
+		fprintf(c, dlc ? "\tUNUSED(o);\n\tUNUSED(data);\n\tUNUSED(dlc);\n\tUNUSED(time_stamp);\n" : "\tUNUSED(o);\n\tUNUSED(data);\n");
+	return fprintf(c, "\treturn -1; \n}\n\n") < 0 ? -1 : 0;
+}
+
+/* 'unpack_messages' unpacks a batch of frames with 'unpack_message', which
+ * the compiler can inline into the loop, and reports the frames unpacked in
+ * a bitmap. Looking the frames of a batch up in a table of unpack functions
+ * through a perfect hash of the IDs, and sorting a batch by message so each
+ * message is dispatched to once, were both measured to be slower than the
+ * switch in 'unpack_message', whose branches are predicted well. */
+static int batch_function(FILE *c, bool prototype, const char *god, dbc2c_options_t *copts)
+{
+	assert(c);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "size_t unpack_messages(can_obj_%s_t *o, const dbcc_frame_t *frames, size_t n, uint32_t *status)", god);
+	if (prototype)
+		return fprintf(c, ";\n") < 0 ? -1 : 0;
+	fprintf(c, " {\n");
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(frames || n == 0);\n");
+		fprintf(c, "\tassert(status || n == 0);\n");
+	}
+	fprintf(c, "\tsize_t count = 0;\n");
+	fprintf(c, "\tfor (size_t i = 0; i < ((n + 31) / 32); i++)\n\t\tstatus[i] = 0;\n");
+	fprintf(c, "\tfor (size_t i = 0; i < n; i++) {\n");
+	fprintf(c, "\t\tif (unpack_message(o, frames[i].id, frames[i].data, frames[i].dlc, frames[i].time_stamp) < 0)\n");
+	fprintf(c, "\t\t\tcontinue;\n");
+	fprintf(c, "\t\tstatus[i / 32] |= UINT32_C(1) << (i %% 32);\n");
+	fprintf(c, "\t\tcount++;\n");
+	fprintf(c, "\t}\n");
+	return fprintf(c, "\treturn count;\n}\n\n") < 0 ? -1 : 0;
+}
+
+/* Signals of lazily decoded messages are not in the object, so they have no
+ * metadata */
+static bool msg_has_metadata(can_msg_t *msg, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(copts);
+	return copts->generate_metadata && !msg_is_lazy(msg, copts);
+}
+
+static size_t metadata_count(dbc_t *dbc, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(copts);
+	size_t count = 0;
+	for (size_t i = 0; i < dbc->message_count; i++)
+		if (msg_has_metadata(dbc->messages[i], copts))
+			count += dbc->messages[i]->signal_count;
+	return count;
+}
+
+/* The same as 'dbcc_signal_hash' in the generated code */
+static uint32_t metadata_hash(const char *s)
+{
+	assert(s);
+	uint32_t h = UINT32_C(2166136261);
+	for (; *s; s++)
+		h = (h ^ (unsigned char)*s) * UINT32_C(16777619);
+	return h;
+}
+
+/* The same as 'dbcc_signal_mix' in the generated code, for a table of 'n' */
+static uint32_t metadata_mix(uint32_t h, uint32_t seed, size_t n)
+{
+	h ^= seed;
+	h = (h ^ (h >> 16)) * UINT32_C(0x85ebca6b);
+	h = (h ^ (h >> 13)) * UINT32_C(0xc2b2ae35);
+	h ^= h >> 16;
+	return (uint32_t)(((uint64_t)h * n) >> 32);
+}
+
+/* Build a minimal perfect hash of 'n' names with the hash and displace
+ * method; the names are put into 'n' buckets by their hash, then, biggest
+ * bucket first, a seed for a second hash is searched for that puts every
+ * name in a bucket into a free slot, and that seed is the displacement of
+ * the bucket. A bucket with one name in it gets the next free slot, stored
+ * as minus one less the slot. 'slots' maps a slot to the index of a name.
+ * This fails if names are duplicated or their hashes collide. */
+static int metadata_perfect_hash(char **names, size_t n, int32_t *displace, uint32_t *slots)
+{
+	assert(names);
+	assert(displace);
+	assert(slots);
+	int r = 0;
+	uint32_t *hash = allocate(n * sizeof *hash); /* of each name */
+	size_t *bucket = allocate(n * sizeof *bucket); /* of each name */
+	size_t *start = allocate((n + 1) * sizeof *start); /* of each bucket in 'members' */
+	size_t *members = allocate(n * sizeof *members);
+	size_t *fill = allocate(n * sizeof *fill);
+	uint32_t *trial = allocate(n * sizeof *trial);
+	bool *used = allocate(n * sizeof *used);
+	size_t largest = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		hash[i] = metadata_hash(names[i]);
+		bucket[i] = metadata_mix(hash[i], 0, n);
+		start[bucket[i] + 1]++;
+	}
+	for (size_t b = 0; b < n; b++) {
+		largest = start[b + 1] > largest ? start[b + 1] : largest;
+		start[b + 1] += start[b];
+	}
+	for (size_t i = 0; i < n; i++)
+		members[start[bucket[i]] + fill[bucket[i]]++] = i;
+
+	for (size_t size = largest; size > 1; size--) {
+		for (size_t b = 0; b < n; b++) {
+			if (start[b + 1] - start[b] != size)
+				continue;
+			uint32_t seed = 1;
+			for (; seed < (UINT32_C(1) << 16); seed++) {
+				bool ok = true;
+				for (size_t j = 0; ok && j < size; j++) {
+					trial[j] = metadata_mix(hash[members[start[b] + j]], seed, n);
+					ok = !used[trial[j]];
+					for (size_t k = 0; ok && k < j; k++)
+						ok = trial[k] != trial[j];
+				}
+				if (ok)
+					break;
+			}
+			if (seed == (UINT32_C(1) << 16)) {
+				r = -1;
+				goto done;
+			}
+			displace[b] = seed;
+			for (size_t j = 0; j < size; j++) {
+				used[trial[j]] = true;
+				slots[trial[j]] = members[start[b] + j];
+			}
+		}
+	}
+
+	for (size_t b = 0, slot = 0; b < n; b++) {
+		if (start[b + 1] - start[b] != 1)
+			continue;
+		while (used[slot])
+			slot++;
+		used[slot] = true;
+		slots[slot] = members[start[b]];
+		displace[b] = -(int32_t)slot - 1;
+	}
+done:
+	free(hash);
+	free(bucket);
+	free(start);
+	free(members);
+	free(fill);
+	free(trial);
+	free(used);
+	return r;
+}
+
+static int metadata_name_compare(const void *a, const void *b)
+{
+	return strcmp(**(char ***)a, **(char ***)b);
+}
+
+/* The 'dbcc_type_e' value of each type a signal can have in the object */
+static const char *metadata_types[][2] = {
+	{ "UINT8", "uint8_t" }, { "UINT16", "uint16_t" }, { "UINT32", "uint32_t" }, { "UINT64", "uint64_t" },
+	{ "INT8",  "int8_t" },  { "INT16",  "int16_t" },  { "INT32",  "int32_t" },  { "INT64",  "int64_t" },
+	{ "FLOAT", "dbcc_float_t" }, { "DOUBLE", "dbcc_double_t" },
+};
+
+static const char *metadata_type(signal_t *sig)
+{
+	assert(sig);
+	if (sig->is_floating)
+		return sig->bit_length == 64 ? "DOUBLE" : "FLOAT";
+	const unsigned size = sig->bit_length <= 8 ? 0 : sig->bit_length <= 16 ? 1 : sig->bit_length <= 32 ? 2 : 3;
+	return metadata_types[size + 4 * sig->is_signed][0];
+}
+
+/* A table describing every signal, a perfect hash to find one by name and
+ * functions to get and set the physical value of a signal by its index */
+static int metadata_function(FILE *c, dbc_t *dbc, bool prototype, const char *god, dbc2c_options_t *copts)
+{
+	assert(c);
+	assert(dbc);
+	assert(god);
+	assert(copts);
+	const size_t n = metadata_count(dbc, copts);
+	if (prototype) {
+		fprintf(c, "#define DBCC_SIGNAL_COUNT (%zu)\n", n);
+		fprintf(c, "%s const dbcc_signal_info_t dbcc_signals[DBCC_SIGNAL_COUNT];\n", copts->header_only ? "static" : "extern");
+		linkage(c, copts);
+		fprintf(c, "int dbcc_signal_lookup(const char *name);\n");
+		linkage(c, copts);
+		fprintf(c, "int dbcc_get_phys(const can_obj_%s_t *o, size_t index, dbcc_double_t *out);\n", god);
+		linkage(c, copts);
+		return fprintf(c, "int dbcc_set_phys(can_obj_%s_t *o, size_t index, dbcc_double_t in);\n", god);
 	}
-	fputs("\n\n", h);
-	return 0;
-}
 
-static const char *cfunctions =
-"static inline uint64_t reverse_byte_order(uint64_t x) {\n"
-"\tx = (x & 0x00000000FFFFFFFF) << 32 | (x & 0xFFFFFFFF00000000) >> 32;\n"
-"\tx = (x & 0x0000FFFF0000FFFF) << 16 | (x & 0xFFFF0000FFFF0000) >> 16;\n"
-"\tx = (x & 0x00FF00FF00FF00FF) << 8  | (x & 0xFF00FF00FF00FF00) >> 8;\n"
-"\treturn x;\n"
-"}\n\n";
-static const char *cfunctions_print_only =
-"static inline int print_helper(int r, int print_return_value) {\n"
-"\treturn ((r >= 0) && (print_return_value >= 0)) ? r + print_return_value : -1;\n"
-"}\n\n";
+	char **names = allocate(n * sizeof *names);
+	int32_t *displace = allocate(n * sizeof *displace);
+	uint32_t *slots = allocate(n * sizeof *slots);
+	char scaling[64], offset[64], minimum[64], maximum[64];
 
-static int message_compare_function(const void *a, const void *b)
-{
-	assert(a);
-	assert(b);
-	can_msg_t *ap = *((can_msg_t**)a);
-	can_msg_t *bp = *((can_msg_t**)b);
-	if (ap->id <  bp->id) return -1;
-	if (ap->id == bp->id) return  0;
-	if (ap->id >  bp->id) return  1;
+	fprintf(c, "%sconst dbcc_signal_info_t dbcc_signals[DBCC_SIGNAL_COUNT] = {\n", copts->header_only ? "static " : "");
+	for (size_t i = 0, index = 0, message = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		char name[MAX_NAME_LENGTH] = {0};
+		if (!msg_has_metadata(msg, copts))
+			continue;
+		make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+		for (size_t j = 0; j < msg->signal_count; j++, index++) {
+			signal_t *sig = msg->sigs[j];
+			char member[MAX_NAME_LENGTH * 2];
+			bool gmin = false, gmax = false;
+			signal_range_checks(sig, &gmin, &gmax);
+			names[index] = allocate(strlen(msg->name) + strlen(sig->name) + 2);
+			sprintf(names[index], "%s.%s", msg->name, sig->name);
+			fprintf(c, "\t{ \"%s\", \"%s\", 0x%03lx, %zu, DBCC_TYPE_%s_E, %s, offsetof(can_obj_%s_t, %s.%s), %s, %s, %s, %s },\n",
+				names[index], sig->units ? sig->units : "", msg->id, message,
+				metadata_type(sig),
+				gmin && gmax ? "DBCC_INFO_MINIMUM | DBCC_INFO_MAXIMUM" : gmin ? "DBCC_INFO_MINIMUM" : gmax ? "DBCC_INFO_MAXIMUM" : "0",
+				god, name, signal_member(member, sizeof member, msg, sig, copts),
+				double_constant(scaling, sizeof scaling, sig->scaling),
+				double_constant(offset, sizeof offset, sig->offset),
+				double_constant(minimum, sizeof minimum, sig->minimum),
+				double_constant(maximum, sizeof maximum, sig->maximum));
+		}
+		message++;
+	}
+	fprintf(c, "};\n\n");
+
+	if (metadata_perfect_hash(names, n, displace, slots) < 0) {
+		/* a binary search of the names sorted by 'strcmp' always works */
+		char ***sorted = allocate(n * sizeof *sorted);
+		for (size_t i = 0; i < n; i++)
+			sorted[i] = &names[i];
+		qsort(sorted, n, sizeof *sorted, metadata_name_compare);
+		fprintf(c, "static const uint32_t dbcc_signal_sorted[DBCC_SIGNAL_COUNT] = {\n");
+		for (size_t i = 0; i < n; i++)
+			fprintf(c, "%s%lu,%s", i % 16 ? " " : "\t", (unsigned long)(sorted[i] - names), (i % 16 == 15 || i == n - 1) ? "\n" : "");
+		fprintf(c, "};\n\n");
+		free(sorted);
+		linkage(c, copts);
+		fprintf(c, "int dbcc_signal_lookup(const char *name) {\n");
+		if (copts->generate_asserts)
+			fprintf(c, "\tassert(name);\n");
+		fprintf(c, "\tsize_t low = 0, high = DBCC_SIGNAL_COUNT;\n");
+		fprintf(c, "\twhile (low < high) {\n");
+		fprintf(c, "\t\tconst size_t middle = low + (high - low) / 2;\n");
+		fprintf(c, "\t\tconst uint32_t index = dbcc_signal_sorted[middle];\n");
+		fprintf(c, "\t\tconst int r = strcmp(dbcc_signals[index].name, name);\n");
+		fprintf(c, "\t\tif (!r)\n\t\t\treturn (int)index;\n");
+		fprintf(c, "\t\tif (r < 0)\n\t\t\tlow = middle + 1;\n\t\telse\n\t\t\thigh = middle;\n");
+		fprintf(c, "\t}\n");
+		fprintf(c, "\treturn -1;\n");
+		fprintf(c, "}\n\n");
+	} else {
+		fputs(cmetadata, c);
+		fprintf(c, "static const int32_t dbcc_signal_displace[DBCC_SIGNAL_COUNT] = {\n");
+		for (size_t i = 0; i < n; i++)
+			fprintf(c, "%s%ld,%s", i % 16 ? " " : "\t", (long)displace[i], (i % 16 == 15 || i == n - 1) ? "\n" : "");
+		fprintf(c, "};\n\n");
+		fprintf(c, "static const uint32_t dbcc_signal_slots[DBCC_SIGNAL_COUNT] = {\n");
+		for (size_t i = 0; i < n; i++)
+			fprintf(c, "%s%lu,%s", i % 16 ? " " : "\t", (unsigned long)slots[i], (i % 16 == 15 || i == n - 1) ? "\n" : "");
+		fprintf(c, "};\n\n");
+		linkage(c, copts);
+		fprintf(c, "int dbcc_signal_lookup(const char *name) {\n");
+		if (copts->generate_asserts)
+			fprintf(c, "\tassert(name);\n");
+		fprintf(c, "\tconst uint32_t h = dbcc_signal_hash(name);\n");
+		fprintf(c, "\tconst int32_t d = dbcc_signal_displace[dbcc_signal_mix(h, 0)];\n");
+		fprintf(c, "\tconst uint32_t slot = d < 0 ? (uint32_t)(-(d + 1)) : dbcc_signal_mix(h, (uint32_t)d);\n");
+		fprintf(c, "\tconst uint32_t index = dbcc_signal_slots[slot];\n");
+		fprintf(c, "\treturn strcmp(dbcc_signals[index].name, name) ? -1 : (int)index;\n");
+		fprintf(c, "}\n\n");
+	}
+
+	linkage(c, copts);
+	fprintf(c, "int dbcc_get_phys(const can_obj_%s_t *o, size_t index, dbcc_double_t *out) {\n", god);
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(out);\n");
+	}
+	fprintf(c, "\t*out = 0;\n");
+	fprintf(c, "\tif (index >= DBCC_SIGNAL_COUNT)\n\t\treturn -1;\n");
+	fprintf(c, "\tconst dbcc_signal_info_t *s = &dbcc_signals[index];\n");
+	fprintf(c, "\tconst unsigned char *p = (const unsigned char*)o + s->field;\n");
+	fprintf(c, "\tdbcc_double_t rval = 0;\n");
+	fprintf(c, "\tswitch (s->type) {\n");
+	for (size_t i = 0; i < sizeof (metadata_types) / sizeof (metadata_types[0]); i++)
+		fprintf(c, "\tcase DBCC_TYPE_%s_E: { %s v; memcpy(&v, p, sizeof v); rval = v; break; }\n", metadata_types[i][0], metadata_types[i][1]);
+	fprintf(c, "\tdefault: return -1;\n");
+	fprintf(c, "\t}\n");
+	fprintf(c, "\trval = rval * s->scaling + s->offset;\n");
+	fprintf(c, "\tif ((s->flags & DBCC_INFO_MINIMUM) && !(rval >= s->minimum))\n\t\treturn -1;\n");
+	fprintf(c, "\tif ((s->flags & DBCC_INFO_MAXIMUM) && !(rval <= s->maximum))\n\t\treturn -1;\n");
+	fprintf(c, "\t*out = rval;\n");
+	fprintf(c, "\treturn 0;\n");
+	fprintf(c, "}\n\n");
+
+	linkage(c, copts);
+	fprintf(c, "int dbcc_set_phys(can_obj_%s_t *o, size_t index, dbcc_double_t in) {\n", god);
+	if (copts->generate_asserts)
+		fprintf(c, "\tassert(o);\n");
+	fprintf(c, "\tif (index >= DBCC_SIGNAL_COUNT)\n\t\treturn -1;\n");
+	fprintf(c, "\tconst dbcc_signal_info_t *s = &dbcc_signals[index];\n");
+	fprintf(c, "\tunsigned char *p = (unsigned char*)o + s->field;\n");
+	fprintf(c, "\tint r = 0;\n");
+	fprintf(c, "\tif (((s->flags & DBCC_INFO_MINIMUM) && in < s->minimum) || ((s->flags & DBCC_INFO_MAXIMUM) && in > s->maximum)) {\n");
+	fprintf(c, "\t\tin = 0; /* the signal is zeroed, as the encode functions do */\n");
+	fprintf(c, "\t\tr = -1;\n");
+	fprintf(c, "\t} else {\n");
+	fprintf(c, "\t\tin = (in - s->offset) * (1 / s->scaling); /* rounds as the encode functions do */\n");
+	fprintf(c, "\t}\n");
+	fprintf(c, "\tswitch (s->type) {\n");
+	for (size_t i = 0; i < sizeof (metadata_types) / sizeof (metadata_types[0]); i++)
+		fprintf(c, "\tcase DBCC_TYPE_%s_E: { const %s v = in; memcpy(p, &v, sizeof v); break; }\n", metadata_types[i][0], metadata_types[i][1]);
+	fprintf(c, "\tdefault: return -1;\n");
+	fprintf(c, "\t}\n");
+	fprintf(c, "\treturn r;\n");
+	fprintf(c, "}\n\n");
+	for (size_t i = 0; i < n; i++)
+		free(names[i]);
+	free(names);
+	free(displace);
+	free(slots);
 	return 0;
 }
 
-static int signal_compare_function(const void *a, const void *b)
+static bool dbc_has_fd(dbc_t *dbc)
 {
-	assert(a);
-	assert(b);
-	signal_t *ap = *((signal_t**)a);
-	signal_t *bp = *((signal_t**)b);
-	if (ap->bit_length <  bp->bit_length) return  1;
-	if (ap->bit_length == bp->bit_length) return  0;
-	if (ap->bit_length >  bp->bit_length) return -1;
-	return 0;
+	assert(dbc);
+	for (size_t i = 0; i < dbc->message_count; i++)
+		if (dbc->messages[i]->is_fd || msg_fd_length(dbc->messages[i]))
+			return true;
+	return false;
 }
 
-static int switch_function(FILE *c, dbc_t *dbc, char *function, bool unpack,
-		bool prototype, const char *datatype, bool dlc, const char *god, dbc2c_options_t *copts)
+/* CAN-FD frames are handled as byte arrays, messages of eight bytes or
+ * less are passed on to the 'uint64_t' functions */
+static int switch_function_fd(FILE *c, dbc_t *dbc, bool unpack, bool prototype, const char *god, dbc2c_options_t *copts)
 {
 	assert(c);
 	assert(dbc);
-	assert(function);
 	assert(god);
 	assert(copts);
-	fprintf(c, "int %s_message(can_obj_%s_t *o, const unsigned long id, %s %sdata%s)",
-			function, god, datatype, unpack ? "" : "*",
-			dlc ? ", uint8_t dlc, dbcc_time_stamp_t time_stamp" : "");
+	linkage(c, copts);
+	if (unpack)
+		fprintf(c, "int unpack_message_fd(can_obj_%s_t *o, const unsigned long id, const uint8_t *data, uint8_t dlc, dbcc_time_stamp_t time_stamp)", god);
+	else
+		fprintf(c, "int pack_message_fd(can_obj_%s_t *o, const unsigned long id, uint8_t *data)", god);
 	if (prototype)
 		return fprintf(c, ";\n");
 	fprintf(c, " {\n");
 	if (copts->generate_asserts) {
 		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(data);\n");
 		fprintf(c, "\tassert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */\n");
-		if (dlc)
-			fprintf(c, "\tassert(dlc <= 8);         /* Maximum of 8 bytes in a CAN packet */\n");
+		if (unpack)
+			fprintf(c, "\tassert(dlc <= 64);        /* Maximum of 64 bytes in a CAN-FD packet */\n");
 	}
+	if (!unpack)
+		fprintf(c, "\tuint64_t x = 0;\n\tint r = -1;\n");
 
 	fprintf(c, "\tswitch (id) {\n");
 	for (size_t i = 0; i < dbc->message_count; i++) {
 		can_msg_t *msg = dbc->messages[i];
 		char name[MAX_NAME_LENGTH] = {0};
 		make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
-		fprintf(c, "\tcase 0x%03lx: return %s_%s(o, data%s);\n",
-				msg->id,
-				function,
-				name,
-				dlc ? ", dlc, time_stamp" : "");
+		if (msg_fd_length(msg))
+			fprintf(c, unpack ?
+				"\tcase 0x%03lx: return unpack_%s(o, data, dlc, time_stamp);\n" :
+				"\tcase 0x%03lx: return pack_%s(o, data);\n",
+				msg->id, name);
+		else
+			fprintf(c, unpack ?
+				"\tcase 0x%03lx: return unpack_%s(o, dbcc_load_classic(data, dlc), dlc > 8 ? 8 : dlc, time_stamp);\n" :
+				"\tcase 0x%03lx: r = pack_%s(o, &x); break;\n",
+				msg->id, name);
 	}
 	fprintf(c, "\tdefault: break; \n\t}\n");
-	return fprintf(c, "\treturn -1; \n}\n\n") < 0 ? -1 : 0;
+	if (!unpack)
+		fprintf(c, "\tif (r > 0)\n\t\tdbcc_store_le64(data, x);\n\treturn r;\n}\n\n");
+	else
+		fprintf(c, "\treturn -1; \n}\n\n");
+	return 0;
+}
+
+static int switch_message_fd_flags(FILE *c, dbc_t *dbc, bool prototype, dbc2c_options_t *copts)
+{
+	assert(c);
+	assert(dbc);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int message_fd_flags(const unsigned long id)");
+	if (prototype)
+		return fprintf(c, ";\n");
+	fprintf(c, " {\n");
+	if (copts->generate_asserts)
+		fprintf(c, "\tassert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */\n");
+
+	fprintf(c, "\tswitch (id) {\n");
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		if (!msg->is_fd)
+			continue;
+		fprintf(c, "\tcase 0x%03lx: return %s;\n", msg->id,
+				msg->is_brs ? "DBCC_FD_FRAME | DBCC_FD_BRS" : "DBCC_FD_FRAME");
+	}
+	fprintf(c, "\tdefault: break; \n\t}\n");
+	return fprintf(c, "\treturn 0; \n}\n\n");
 }
 
 static int switch_function_print(FILE *c, dbc_t *dbc, bool prototype, const char *god, dbc2c_options_t *copts)
@@ -876,6 +4739,7 @@ static int switch_function_print(FILE *c, dbc_t *dbc, bool prototype, const char
 	assert(dbc);
 	assert(god);
 	assert(copts);
+	linkage(c, copts);
 	fprintf(c, "int print_message(const can_obj_%s_t *o, const unsigned long id, FILE *output)", god);
 	if (prototype)
 		return fprintf(c, ";\n");
@@ -902,6 +4766,7 @@ static int switch_message_dlc(FILE *c, dbc_t *dbc, bool prototype, dbc2c_options
 	assert(c);
 	assert(dbc);
 	assert(copts);
+	linkage(c, copts);
 	fprintf(c, "int message_dlc(const unsigned long id)");
 	if (prototype)
 		return fprintf(c, ";\n");
@@ -920,8 +4785,92 @@ static int switch_message_dlc(FILE *c, dbc_t *dbc, bool prototype, dbc2c_options
 	return fprintf(c, "\treturn -1; \n}\n\n");
 }
 
+static int switch_subscribe(FILE *c, dbc_t *dbc, bool prototype, const char *god, dbc2c_options_t *copts)
+{
+	assert(c);
+	assert(dbc);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int subscribe_message(can_obj_%s_t *o, const unsigned long id, const uint64_t mask)", god);
+	if (prototype)
+		return fprintf(c, ";\n");
+	fprintf(c, " {\n");
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */\n");
+	}
+	size_t cases = 0;
+	fprintf(c, "\tswitch (id) {\n");
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		char name[MAX_NAME_LENGTH] = {0};
+		make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+		if (msg_has_subscriptions(msg, copts)) {
+			fprintf(c, "\tcase 0x%03lx: o->%s_unsubscribed = ~mask; return 0;\n", msg->id, name);
+			cases++;
+		} else {
+			fprintf(c, "\tcase 0x%03lx: return 0;\n", msg->id);
+		}
+	}
+	fprintf(c, "\tdefault: break; \n\t}\n");
+	if (!cases)
+		fprintf(c, "\tUNUSED(o);\n\tUNUSED(mask);\n");
+	return fprintf(c, "\treturn -1; \n}\n\n");
+}
+
 // TODO: Define enums as well/instead of.
 /* NB. We should really use these enum names instead of the msg->id */
+/* Take (fetch and clear) the 'updated' or 'error' flags of every message,
+ * returning how many were set */
+static int poll_function(FILE *c, dbc_t *dbc, const char *flags, bool prototype, const char *god, dbc2c_options_t *copts)
+{
+	assert(c);
+	assert(dbc);
+	assert(flags);
+	assert(god);
+	assert(copts);
+	linkage(c, copts);
+	fprintf(c, "int poll_%s(can_obj_%s_t *o, uint64_t *%s)", strcmp(flags, "error") ? "messages" : "errors", god, flags);
+	if (prototype)
+		return fprintf(c, ";\n");
+	fprintf(c, " {\n");
+	if (copts->generate_asserts) {
+		fprintf(c, "\tassert(o);\n");
+		fprintf(c, "\tassert(%s);\n", flags);
+	}
+	fprintf(c, "\tint n = 0;\n");
+	fprintf(c, "\tfor (size_t i = 0; i < %zu; i++)\n", msg_flag_words(dbc));
+	fprintf(c, "\t\tn += dbcc_popcount(%s[i] = DBCC_FLAG_TAKE(&o->%s_flags[i]));\n", flags, flags);
+	return fprintf(c, "\treturn n;\n}\n\n");
+}
+
+/* Declare 'bit' as the index of the lowest bit set in 'word', which is not 0 */
+static void lowest_bit(FILE *h, const char *indent, const char *word)
+{
+	assert(h);
+	assert(indent);
+	assert(word);
+	static const unsigned char debruijn[64] = {
+		0, 1, 2, 53, 3, 7, 54, 27, 4, 38, 41, 8, 34, 55, 48, 28,
+		62, 5, 39, 46, 44, 42, 22, 9, 24, 35, 59, 56, 49, 18, 29, 11,
+		63, 52, 6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+		51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12,
+	};
+	fprintf(h, "#ifdef __GNUC__\n");
+	fprintf(h, "%sconst int bit = __builtin_ctzll(%s);\n", indent, word);
+	fprintf(h, "#else\n");
+	fprintf(h, "%sstatic const uint8_t debruijn[64] = {\n", indent);
+	for (size_t i = 0; i < 64; i += 16) {
+		fprintf(h, "%s\t", indent);
+		for (size_t j = i; j < i + 16; j++)
+			fprintf(h, "%u,%s", debruijn[j], j == i + 15 ? "\n" : " ");
+	}
+	fprintf(h, "%s};\n", indent);
+	fprintf(h, "%sconst int bit = debruijn[((%s & -%s) * UINT64_C(0x022fdd63cc95386d)) >> 58];\n", indent, word, word);
+	fprintf(h, "#endif\n");
+}
+
 static void msg2h_define_can_ids(dbc_t *dbc, FILE *h, dbc2c_options_t *copts) {
 	assert(dbc);
 	assert(h);
@@ -949,6 +4898,14 @@ static void msg2h_define_can_ids(dbc_t *dbc, FILE *h, dbc2c_options_t *copts) {
 
 		free(name);
 	}
+	for (size_t i = 0; copts->use_bitmaps && i < dbc->message_count; i++) {
+		char index[MAX_NAME_LENGTH + 16];
+		msg_index_name(index, sizeof index, dbc->messages[i]);
+		if (ens)
+			fprintf(h, "\t%s = %zu,\n", index, i);
+		else
+			fprintf(h, "#define %s (%zu)\n", index, i);
+	}
 	if (ens) {
 		fprintf(h, "};\n");
 	}
@@ -956,27 +4913,61 @@ static void msg2h_define_can_ids(dbc_t *dbc, FILE *h, dbc2c_options_t *copts) {
 	fprintf(h, "\n");
 }
 
-static char *escape_string(const char *s, int upper) {
-	const size_t max_char_len = 4;
-	const size_t l = strlen(s) * max_char_len + 1;
-	char *n = allocate(l);
-	int ch = 0;
-	for (size_t i = 0, j = 0; (ch = s[i]); i++) {
-		assert(j < l);
-		ch = ch == ' ' ? '_' : ch;
-		if (!isalnum(ch) && ch != '_') {
-
-			sprintf(&n[j], "_%02x_", ch);
-			j += max_char_len;
-		} else {
-			if (upper > 0)
-				ch = toupper(ch);
-			if (upper < 0)
-				ch = tolower(ch);
-			n[j++] = ch;
+/* The signals of a message which are not multiplexed, followed by a union
+ * of a structure for each value of its multiplexor, in order of value */
+static int msg2union(can_msg_t *msg, FILE *h)
+{
+	assert(msg);
+	assert(h);
+	bool found = true;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (!msg->sigs[i]->is_multiplexed && signal2type(msg->sigs[i], h, "\t") < 0)
+			return -1;
+	fprintf(h, "\tunion { /* the signals for the value of %s */\n", msg_simple_multiplexor(msg)->name);
+	for (unsigned value = 0; found; value++) {
+		unsigned next = UINT_MAX;
+		found = false;
+		for (size_t i = 0; i < msg->signal_count; i++) {
+			signal_t *sig = msg->sigs[i];
+			if (!sig->is_multiplexed || sig->switchval < value)
+				continue;
+			found = true;
+			next = sig->switchval < next ? sig->switchval : next;
 		}
+		if (!found)
+			break;
+		fprintf(h, "\t\tstruct {\n");
+		for (size_t i = 0; i < msg->signal_count; i++)
+			if (msg->sigs[i]->is_multiplexed && msg->sigs[i]->switchval == next && signal2type(msg->sigs[i], h, "\t\t\t") < 0)
+				return -1;
+		fprintf(h, "\t\t} m%u;\n", next);
+		if (next == UINT_MAX)
+			break;
+		value = next;
 	}
-	return n;
+	return fprintf(h, "\t} mux;\n");
+}
+
+/* The structure of a message */
+static int msg2struct(can_msg_t *msg, FILE *h, const char *name, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(h);
+	assert(name);
+	assert(copts);
+	fprintf(h, "typedef PREPACK struct {\n" );
+	if (msg_is_lazy(msg, copts)) {
+		fprintf(h, "\tuint64_t raw; /* payload, signals are decoded when read */\n");
+		fprintf(h, "\tuint8_t dlc;\n");
+	} else if (msg_has_union(msg, copts)) {
+		if (msg2union(msg, h) < 0)
+			return -1;
+	} else {
+		for (size_t i = 0; i < msg->signal_count; i++)
+			if (signal2type(msg->sigs[i], h, "\t") < 0)
+				return -1;
+	}
+	return fprintf(h, "} POSTPACK %s_t;\n\n", name);
 }
 
 static int msg2h_types(dbc_t *dbc, FILE *h, dbc2c_options_t *copts)
@@ -993,11 +4984,50 @@ static int msg2h_types(dbc_t *dbc, FILE *h, dbc2c_options_t *copts)
 		if (msg->comment)
 			fprintf(h, "/* %s */\n", msg->comment);
 
-		fprintf(h, "typedef PREPACK struct {\n" );
-		for (size_t i = 0; i < msg->signal_count; i++)
-			if (signal2type(msg->sigs[i], h) < 0)
-				return -1;
-		fprintf(h, "} POSTPACK %s_t;\n\n", name);
+		if (msg2struct(msg, h, name, copts) < 0)
+			return -1;
+
+		if (msg->signal_count > 64 && (msg_has_changes(msg, copts) || msg_has_phys(msg, copts) || msg_has_build(msg, copts) || msg_has_subscriptions(msg, copts)))
+			warning("message %s has %u signals, those past the 64th by name have no bit in its masks: they are always unpacked, and never marked as changed or invalid", msg->name, (unsigned)msg->signal_count);
+
+		if (msg_has_changes(msg, copts) || msg_has_phys(msg, copts)) {
+			fprintf(h, "typedef enum {\n");
+			for (size_t i = 0; i < msg->signal_count; i++) {
+				signal_t *sig = msg->sigs[i];
+				char ename[MAX_NAME_LENGTH * 2];
+				const int bit = signal_bit(msg, sig);
+				if (bit < 0)
+					continue;
+				snprintf(ename, sizeof ename, "%s_SIGNAL_%s", name, sig->name);
+				for (size_t j = 0; ename[j]; j++)
+					ename[j] = toupper(ename[j]);
+				fprintf(h, "\t%s = %d,\n", ename, bit);
+			}
+			fprintf(h, "} %s_signal_e;\n\n", name);
+		}
+
+		if (msg_has_phys(msg, copts) || msg_has_build(msg, copts)) {
+			fprintf(h, "typedef struct { /* physical values */\n");
+			for (size_t i = 0; i < msg->signal_count; i++) {
+				const char *type = NULL;
+				fprintf(h, "\t%s %s;\n", signal_decode_type(msg->sigs[i], &type, copts), msg->sigs[i]->name);
+			}
+			fprintf(h, "} %s_phys_t;\n\n", name);
+		}
+
+		if (msg_has_subscriptions(msg, copts)) {
+			for (size_t i = 0; i < msg->signal_count; i++) {
+				signal_t *sig = msg->sigs[i];
+				char mask[MAX_NAME_LENGTH * 2];
+				const int bit = signal_subscription_bit(msg, sig);
+				if (bit >= 0)
+					fprintf(h, "#define %s (UINT64_C(1) << %d)\n", signal_subscription_name(mask, sizeof mask, name, sig), bit);
+			}
+			fputc('\n', h);
+		}
+
+		if (msg_has_series(msg, copts) && msg2series_type(msg, h, name) < 0)
+			return -1;
 
 		for (size_t i = 0; i < msg->signal_count; i++) {
 			signal_t* signal = msg->sigs[i];
@@ -1041,6 +5071,74 @@ static int msg2h_types(dbc_t *dbc, FILE *h, dbc2c_options_t *copts)
 	return 0;
 }
 
+/* Each message has its time stamp, status bits and signals next to each
+ * other, so unpacking one touches as few cache lines as it can, and the
+ * messages sent most often are first and start on a cache line */
+static char *msg2h_god_object_grouped(dbc_t *dbc, FILE *h, char *object_name, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(h);
+	assert(object_name);
+	assert(copts);
+	can_msg_t **order = allocate((dbc->message_count + 1) * sizeof *order);
+	size_t *start = allocate((dbc->message_count + 1) * sizeof *start);
+	size_t *stop = allocate((dbc->message_count + 1) * sizeof *stop);
+	size_t end = 0, align = 1, hot = 0;
+	memcpy(order, dbc->messages, dbc->message_count * sizeof *order);
+	qsort(order, dbc->message_count, sizeof *order, cycle_time_compare_function);
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		size_t a = 1;
+		start[i] = round_up(end, msg_is_hot(order[i], copts) ? 64 : sizeof (uint32_t));
+		end = stop[i] = msg_layout(order[i], start[i], &a, copts);
+		align = msg_is_hot(order[i], copts) ? 64 : a > align ? a : align;
+		hot += msg_is_hot(order[i], copts);
+	}
+	if (copts->use_bitmaps) {
+		end = round_up(end, 8) + 4 * 8 * msg_flag_words(dbc);
+		align = align > 8 ? align : 8;
+	}
+	start[dbc->message_count] = round_up(end, align);
+	fprintf(h, "/* Each message's members are grouped together, the %zu sent at least every\n", hot);
+	fprintf(h, " * %u ms start on a cache line. The object is about %zu bytes. */\n", copts->hot_cycle_time, start[dbc->message_count]);
+	fprintf(h, "typedef PREPACK struct {\n");
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = order[i];
+		char name[MAX_NAME_LENGTH] = {0};
+		make_name(name, MAX_NAME_LENGTH, msg->name, msg->id, copts);
+		const size_t footprint = round_up(stop[i], sizeof (uint32_t)) - start[i];
+		fprintf(h, "\t/* %s: about %zu bytes (%zu cache line%s)", name, footprint,
+				(footprint + 63) / 64, footprint > 64 ? "s" : "");
+		if (msg->cycle_time)
+			fprintf(h, ", sent every %u ms", msg->cycle_time);
+		fprintf(h, " */\n");
+		if (msg_data_type_time_stamp(h, msg, msg_is_hot(msg, copts), copts) < 0)
+			goto fail;
+		if (msg_data_type_sequence(h, msg, copts) < 0)
+			goto fail;
+		if (msg_data_type_subscription(h, msg, copts) < 0)
+			goto fail;
+		if (msg_data_type_changes(h, msg, copts) < 0)
+			goto fail;
+		if (msg_data_type_bitfields(h, msg, copts) < 0)
+			goto fail;
+		if (msg_data_type(h, msg, false, copts) < 0)
+			goto fail;
+	}
+	if (msg_data_type_flags(h, dbc, copts) < 0)
+		goto fail;
+	fprintf(h, "} POSTPACK can_obj_%s_t;\n\n", object_name);
+	free(order);
+	free(start);
+	free(stop);
+	return object_name;
+fail:
+	free(order);
+	free(start);
+	free(stop);
+	free(object_name);
+	return NULL;
+}
+
 static char *msg2h_god_object(dbc_t *dbc, FILE *h, const char *name, dbc2c_options_t *copts)
 {
 	assert(h);
@@ -1050,9 +5148,20 @@ static char *msg2h_god_object(dbc_t *dbc, FILE *h, const char *name, dbc2c_optio
 	const size_t object_name_len = strlen(object_name);
 	for (size_t i = 0; i < object_name_len; i++)
 		object_name[i] = (isalnum(object_name[i])) ?  tolower(object_name[i]) : '_';
+	if (copts->group_messages)
+		return msg2h_god_object_grouped(dbc, h, object_name, copts);
 	fprintf(h, "typedef PREPACK struct {\n");
 	for (size_t i = 0; i < dbc->message_count; i++)
-		if (msg_data_type_time_stamp(h, dbc->messages[i], copts) < 0)
+		if (msg_data_type_time_stamp(h, dbc->messages[i], false, copts) < 0)
+			goto fail;
+	for (size_t i = 0; i < dbc->message_count; i++)
+		if (msg_data_type_sequence(h, dbc->messages[i], copts) < 0)
+			goto fail;
+	for (size_t i = 0; i < dbc->message_count; i++)
+		if (msg_data_type_subscription(h, dbc->messages[i], copts) < 0)
+			goto fail;
+	for (size_t i = 0; i < dbc->message_count; i++)
+		if (msg_data_type_changes(h, dbc->messages[i], copts) < 0)
 			goto fail;
 	for (size_t i = 0; i < dbc->message_count; i++)
 		if (msg_data_type_bitfields(h, dbc->messages[i], copts) < 0)
@@ -1060,6 +5169,8 @@ static char *msg2h_god_object(dbc_t *dbc, FILE *h, const char *name, dbc2c_optio
 	for (size_t i = 0; i < dbc->message_count; i++)
 		if (msg_data_type(h, dbc->messages[i], false, copts) < 0)
 			goto fail;
+	if (msg_data_type_flags(h, dbc, copts) < 0)
+		goto fail;
 	fprintf(h, "} POSTPACK can_obj_%s_t;\n\n", object_name);
 	return object_name;
 fail:
@@ -1067,19 +5178,33 @@ fail:
 	return NULL;
 }
 
+/* With 'header-only' the C file, 'c', is not used and may be NULL */
 int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts)
 {
 	assert(dbc);
-	assert(c);
 	assert(h);
 	assert(name);
 	assert(copts);
+	if (copts->header_only)
+		c = h;
+	assert(c);
 	int rv = 0;
 	time_t rawtime = time(NULL);
 	struct tm *timeinfo = localtime(&rawtime); /* This is not considered safe on Visual Studio */
 	char *god = NULL;
 	char *file_guard = duplicate(name);
 	const size_t file_guard_len = strlen(file_guard);
+	const bool has_fd = dbc_has_fd(dbc);
+	const bool batch = copts->generate_batch && copts->generate_unpack;
+	const bool extract = copts->generate_extract && copts->generate_unpack;
+	const bool series = copts->generate_series && copts->generate_unpack;
+	const bool subscriptions = copts->generate_subscriptions && copts->generate_unpack;
+	const bool changes = copts->generate_changes && copts->generate_unpack;
+	const bool metadata = metadata_count(dbc, copts) > 0;
+	const bool seqlock = copts->use_seqlock && copts->generate_unpack;
+	const bool bitmaps = copts->use_bitmaps;
+	bool fixed = false;
+	bool tables = false, unions = false, shared = false;
 
 	/* make file guard all upper case alphanumeric only, first character
 	 * alpha only*/
@@ -1095,7 +5220,17 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 	for (size_t i = 0; i < dbc->message_count; i++) {
 		can_msg_t *msg = dbc->messages[i];
 		qsort(msg->sigs, msg->signal_count, sizeof(msg->sigs[0]), signal_compare_function);
+		tables = tables || ((copts->generate_pack || copts->generate_unpack) && msg_uses_tables(msg, copts));
+		unions = unions || msg_has_union(msg, copts);
+		for (size_t j = 0; j < msg->signal_count; j++) {
+			fixed_scaling_t f;
+			fixed = fixed || signal_fixed_point(msg->sigs[j], copts, &f);
+		}
 	}
+	dbc_share_codecs(dbc, copts);
+	dbc_share_tables(dbc, copts);
+	for (size_t i = 0; i < dbc->message_count; i++)
+		shared = shared || dbc->messages[i]->codec;
 
 	/* header file (begin) */
 	fprintf(h, "/* CAN message encoder/decoder: automatically generated - do not edit.\n\n");
@@ -1116,7 +5251,7 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 		"\n//DBC Version: `Version(\"%s\")`\n\n"
 		"#define DBCC_GENERATOR_VERSION (%d)\n\n"
 		"#include <stdint.h>\n"
-		"%s\n\n"
+		"%s%s\n\n"
 		"#ifdef __cplusplus\n"
 		"extern \"C\" { \n"
 		"#endif\n\n",
@@ -1124,6 +5259,7 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 		file_guard,
 		dbc->dbc_version ? dbc->dbc_version : "",
 		copts->version,
+		batch || extract || series || metadata || bitmaps || copts->generate_format ? "#include <stddef.h>\n" : "",
 		copts->generate_print   ? "#include <stdio.h>"  : "") < 0)
 			return -1;
 
@@ -1146,10 +5282,116 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 	fprintf(h, "typedef float dbcc_float_t;\n");
 	fprintf(h, "#endif\n\n");
 
+	if (copts->use_fixed_point) {
+		fprintf(h, "#ifndef DBCC_FIXED_TYPE\n");
+		fprintf(h, "#define DBCC_FIXED_TYPE\n");
+		fprintf(h, "#define DBCC_FIXED_Q (%d) /* fraction bits of a fixed point physical value */\n", FIXED_Q);
+		fprintf(h, "typedef int64_t dbcc_fixed_t;\n");
+		fprintf(h, "#endif\n\n");
+	}
+
+	if (copts->group_messages) {
+		fprintf(h, "#ifndef DBCC_CACHE_ALIGN\n");
+		fprintf(h, "#ifdef __GNUC__\n");
+		fprintf(h, "#define DBCC_CACHE_ALIGN __attribute__((aligned(64)))\n");
+		fprintf(h, "#else\n");
+		fprintf(h, "#define DBCC_CACHE_ALIGN\n");
+		fprintf(h, "#endif\n");
+		fprintf(h, "#endif\n\n");
+	}
+
+	if (copts->share_codecs) {
+		fprintf(h, "#ifndef DBCC_NOINLINE\n");
+		fprintf(h, "#define DBCC_NOINLINE /* __attribute__((noinline)) keeps shared codecs shared at -O2 */\n");
+		fprintf(h, "#endif\n\n");
+	}
+
 	fprintf(h, "#ifndef DBCC_TIME_STAMP\n");
 	fprintf(h, "#define DBCC_TIME_STAMP\n");
 	fprintf(h, "typedef uint32_t dbcc_time_stamp_t; /* Time stamp for message; you decide on units */\n");
 	fprintf(h, "#endif\n\n");
+	if (seqlock) {
+		fprintf(h, "#ifndef DBCC_SEQUENCE_TYPE\n");
+		fprintf(h, "#define DBCC_SEQUENCE_TYPE\n");
+		fprintf(h, "typedef uint32_t dbcc_sequence_t; /* Incremented before and after a message is unpacked */\n");
+		fprintf(h, "#endif\n\n");
+	}
+
+	if (has_fd) {
+		fprintf(h, "#ifndef DBCC_FD_FLAGS\n");
+		fprintf(h, "#define DBCC_FD_FLAGS\n");
+		fprintf(h, "#define DBCC_FD_FRAME (1) /* Message is sent as a CAN-FD frame */\n");
+		fprintf(h, "#define DBCC_FD_BRS   (2) /* CAN-FD frame uses bit rate switching */\n\n");
+		fprintf(h, "/* Convert between a CAN-FD DLC code (0-15) and a length in bytes (0-64) */\n");
+		fprintf(h, "static inline unsigned dbcc_dlc_to_length(unsigned dlc) {\n");
+		fprintf(h, "\tstatic const uint8_t lengths[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };\n");
+		fprintf(h, "\treturn lengths[dlc & 0xF];\n");
+		fprintf(h, "}\n\n");
+		fprintf(h, "static inline unsigned dbcc_length_to_dlc(unsigned length) {\n");
+		fprintf(h, "\tif (length <= 8)\n\t\treturn length;\n");
+		fprintf(h, "\tif (length <= 24)\n\t\treturn 9 + ((length - 9) / 4);\n");
+		fprintf(h, "\treturn length <= 32 ? 13 : length <= 48 ? 14 : 15;\n");
+		fprintf(h, "}\n");
+		fprintf(h, "#endif\n\n");
+	}
+
+	if (batch) {
+		fprintf(h, "#ifndef DBCC_FRAME_TYPE\n");
+		fprintf(h, "#define DBCC_FRAME_TYPE\n");
+		fprintf(h, "typedef struct {\n");
+		fprintf(h, "\tunsigned long id;\n");
+		fprintf(h, "\tuint64_t data; /* first byte of the frame in the least significant byte */\n");
+		fprintf(h, "\tuint8_t dlc;\n");
+		fprintf(h, "\tdbcc_time_stamp_t time_stamp;\n");
+		fprintf(h, "} dbcc_frame_t;\n");
+		fprintf(h, "#endif\n\n");
+	}
+
+	if (changes) {
+		fprintf(h, "#ifndef DBCC_NEXT_CHANGE\n");
+		fprintf(h, "#define DBCC_NEXT_CHANGE\n");
+		fprintf(h, "/* Remove the lowest bit set in a mask of changed signals and return its\n");
+		fprintf(h, " * index, a '<message>_signal_e' value, or return -1 if none are set */\n");
+		fprintf(h, "static inline int dbcc_next_change(uint64_t *changed) {\n");
+		fprintf(h, "\tif (!*changed)\n\t\treturn -1;\n");
+		lowest_bit(h, "\t", "*changed");
+		fprintf(h, "\t*changed &= *changed - 1;\n");
+		fprintf(h, "\treturn bit;\n");
+		fprintf(h, "}\n");
+		fprintf(h, "#endif\n\n");
+	}
+
+	if (bitmaps) {
+		fprintf(h, "#ifndef DBCC_FLAGS\n");
+		fprintf(h, "#define DBCC_FLAGS\n");
+		fprintf(h, "#ifndef DBCC_FLAG_LOAD /* define all three for compilers without these built-ins */\n");
+		fprintf(h, "#define DBCC_FLAG_LOAD(P)   __atomic_load_n((P), __ATOMIC_RELAXED)\n");
+		fprintf(h, "#define DBCC_FLAG_SET(P, V) __atomic_fetch_or((P), (V), __ATOMIC_RELEASE)\n");
+		fprintf(h, "#define DBCC_FLAG_TAKE(P)   __atomic_exchange_n((P), 0, __ATOMIC_ACQUIRE)\n");
+		fprintf(h, "#endif\n\n");
+		fprintf(h, "/* The number of words in each flag bitmap of an object type */\n");
+		fprintf(h, "#define DBCC_FLAG_WORDS(OBJECT) (sizeof ((OBJECT*)0)->rx_flags / sizeof (uint64_t))\n\n");
+		fprintf(h, "/* Is the flag of message 'index', a 'CAN_INDEX_*' value, set in a bitmap */\n");
+		fprintf(h, "static inline int dbcc_flag(const uint64_t *flags, unsigned index) {\n");
+		fprintf(h, "\treturn (DBCC_FLAG_LOAD(&flags[index / 64]) >> (index %% 64)) & 1;\n");
+		fprintf(h, "}\n\n");
+		fprintf(h, "static inline void dbcc_flag_set(uint64_t *flags, unsigned index) {\n");
+		fprintf(h, "\tDBCC_FLAG_SET(&flags[index / 64], UINT64_C(1) << (index %% 64));\n");
+		fprintf(h, "}\n\n");
+		fprintf(h, "/* Remove the lowest flag set in a bitmap of 'words' words, which is not\n");
+		fprintf(h, " * shared, such as one filled in by 'poll_messages', and return the index\n");
+		fprintf(h, " * of its message, or return -1 if none are set */\n");
+		fprintf(h, "static inline int dbcc_next_flag(uint64_t *flags, size_t words) {\n");
+		fprintf(h, "\tfor (size_t i = 0; i < words; i++) {\n");
+		fprintf(h, "\t\tif (!flags[i])\n\t\t\tcontinue;\n");
+		lowest_bit(h, "\t\t", "flags[i]");
+		fprintf(h, "\t\tflags[i] &= flags[i] - 1;\n");
+		fprintf(h, "\t\treturn i * 64 + bit;\n");
+		fprintf(h, "\t}\n");
+		fprintf(h, "\treturn -1;\n");
+		fprintf(h, "}\n");
+		fprintf(h, "#endif\n\n");
+	}
 
 	fprintf(h, "#ifndef DBCC_STATUS_ENUM\n");
 	fprintf(h, "#define DBCC_STATUS_ENUM\n");
@@ -1160,6 +5402,28 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 	fprintf(h, "} dbcc_signal_status_e;\n");
 	fprintf(h, "#endif\n\n");
 
+	if (metadata) {
+		fprintf(h, "#ifndef DBCC_SIGNAL_INFO_TYPE\n");
+		fprintf(h, "#define DBCC_SIGNAL_INFO_TYPE\n");
+		fprintf(h, "typedef enum {\n");
+		for (size_t i = 0; i < sizeof (metadata_types) / sizeof (metadata_types[0]); i++)
+			fprintf(h, "\tDBCC_TYPE_%s_E,\n", metadata_types[i][0]);
+		fprintf(h, "} dbcc_type_e;\n\n");
+		fprintf(h, "#define DBCC_INFO_MINIMUM (1u << 0) /* the minimum is checked by dbcc_get_phys/dbcc_set_phys */\n");
+		fprintf(h, "#define DBCC_INFO_MAXIMUM (1u << 1) /* the maximum is checked by dbcc_get_phys/dbcc_set_phys */\n\n");
+		fprintf(h, "typedef struct {\n");
+		fprintf(h, "\tconst char *name;  /* 'message.signal', as named in the DBC file */\n");
+		fprintf(h, "\tconst char *units;\n");
+		fprintf(h, "\tunsigned long id;  /* of the message the signal is in */\n");
+		fprintf(h, "\tuint16_t message;  /* index of that message, in order of ID */\n");
+		fprintf(h, "\tuint8_t type;      /* dbcc_type_e, of the signal in the object */\n");
+		fprintf(h, "\tuint8_t flags;     /* DBCC_INFO_* */\n");
+		fprintf(h, "\tsize_t field;      /* offset of the signal in the object */\n");
+		fprintf(h, "\tdbcc_double_t scaling, offset, minimum, maximum;\n");
+		fprintf(h, "} dbcc_signal_info_t;\n");
+		fprintf(h, "#endif\n\n");
+	}
+
 	msg2h_define_can_ids(dbc, h, copts);
 
 	if (msg2h_types(dbc, h, copts) < 0) {
@@ -1184,6 +5448,28 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 	if (copts->generate_print)
 		switch_function_print(h, dbc, true, god, copts);
 
+	if (batch)
+		batch_function(h, true, god, copts);
+
+	if (subscriptions)
+		switch_subscribe(h, dbc, true, god, copts);
+
+	if (bitmaps) {
+		poll_function(h, dbc, "updated", true, god, copts);
+		poll_function(h, dbc, "error", true, god, copts);
+	}
+
+	if (metadata)
+		metadata_function(h, dbc, true, god, copts);
+
+	if (has_fd) {
+		if (copts->generate_unpack)
+			switch_function_fd(h, dbc, true, true, god, copts);
+		if (copts->generate_pack)
+			switch_function_fd(h, dbc, false, true, god, copts);
+		switch_message_fd_flags(h, dbc, true, copts);
+	}
+
 	fputs("\n", h);
 
 	for (size_t i = 0; i < dbc->message_count; i++)
@@ -1193,9 +5479,10 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 	fputs(
 		"#ifdef __cplusplus\n"
 		"} \n"
-		"#endif\n\n"
-		"#endif\n",
+		"#endif\n\n",
 		h);
+	if (!copts->header_only)
+		fputs("#endif\n", h);
 	/* header file (end) */
 
 	/* C FILE */
@@ -1207,24 +5494,58 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 		"For those with paid support or to inquire about paid support\n"
 		"please Email <mailto:hello.operator.co.uk@gmail.com>.\n\n*/\n\n";
 
-	if (fputs(cput, c) < 0) return -1;
-
-	if (fprintf(c, "#include \"%s\"\n", name) < 0) return -1;
+	if (copts->header_only) { /* the rest of the header, for C only */
+		fputs("#ifdef __GNUC__ /* not every helper is used by every file */\n", c);
+		fputs("#pragma GCC diagnostic push\n", c);
+		fputs("#pragma GCC diagnostic ignored \"-Wunused-function\"\n", c);
+		fputs("#endif\n\n", c);
+	} else {
+		if (fputs(cput, c) < 0) return -1;
+		if (fprintf(c, "#include \"%s\"\n", name) < 0) return -1;
+	}
 	if (fprintf(c, "#include <inttypes.h>\n") < 0) return -1;
 	if (dbc->use_float)
 		fprintf(c, "#include <math.h> /* uses macros NAN, INFINITY, signbit, no need for -lm */\n");
 	if (copts->generate_asserts)
 		fprintf(c, "#include <assert.h>\n");
+	if (series)
+		fprintf(c, "#include <stdlib.h>\n");
+	if (tables || metadata || shared)
+		fprintf(c, "#include <stddef.h>\n");
+	if (has_fd || series || tables || metadata || unions || copts->generate_format)
+		fprintf(c, "#include <string.h>\n");
 	fputc('\n', c);
 	fprintf(c, "#define UNUSED(X) ((void)(X))\n\n");
+	if (extract)
+		fputs(cextract, c);
+	if (series)
+		fputs(cseries, c);
+	if (fixed)
+		fputs(cfixed, c);
+	if (seqlock)
+		fputs(cseqlock, c);
+	if (bitmaps)
+		fputs(cbitmaps, c);
 	fputs(cfunctions, c);
 	if (copts->generate_print)
 		fputs(cfunctions_print_only, c);
+	if (copts->generate_format)
+		fputs(cformat, c);
+	if (has_fd)
+		fputs(cfunctions_fd, c);
 
-	if (copts->generate_unpack && dbc->use_float)
+	if ((copts->generate_unpack || (copts->lazy_decode && (copts->generate_print || copts->generate_format))) && dbc->use_float)
 		fputs(float_unpack, c);
 	if (copts->generate_pack && dbc->use_float)
 		fputs(float_pack, c);
+	if (tables) {
+		fprintf(c, "#define DBCC_TABLE_FLOATS (%d)\n\n", dbc->use_float);
+		fputs(ctables, c);
+		if (copts->generate_unpack)
+			fputs(ctables_unpack, c);
+		if (copts->generate_pack)
+			fputs(ctables_pack, c);
+	}
 
 	for (size_t i = 0; i < dbc->message_count; i++)
 		if (msg2c(dbc->messages[i], c, copts, god) < 0) {
@@ -1243,9 +5564,88 @@ int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts
 	if (copts->generate_print)
 		switch_function_print(c, dbc, false, god, copts);
 
+	if (batch)
+		batch_function(c, false, god, copts);
+
+	if (subscriptions)
+		switch_subscribe(c, dbc, false, god, copts);
+
+	if (bitmaps) {
+		poll_function(c, dbc, "updated", false, god, copts);
+		poll_function(c, dbc, "error", false, god, copts);
+	}
+
+	if (metadata && metadata_function(c, dbc, false, god, copts) < 0) {
+		rv = -1;
+		goto fail;
+	}
+
+	if (has_fd) {
+		if (copts->generate_unpack)
+			switch_function_fd(c, dbc, true, false, god, copts);
+		if (copts->generate_pack)
+			switch_function_fd(c, dbc, false, false, god, copts);
+		switch_message_fd_flags(c, dbc, false, copts);
+	}
+
+	if (copts->header_only) {
+		fputs("#ifdef __GNUC__\n", c);
+		fputs("#pragma GCC diagnostic pop\n", c);
+		fputs("#endif\n\n", c);
+		fputs("#endif\n", c);
+	}
 fail:
 	free(file_guard);
 	free(god);
 	return rv;
 }
 
+
+/* An X-macro file, with a 'DBCC_MESSAGE' line for each message followed by
+ * a 'DBCC_SIGNAL' line for each of its signals, in the order they are in the
+ * structures generated by 'dbc2c' (which must have been called first). */
+int dbc2def(dbc_t *dbc, FILE *o, const char *name, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(o);
+	assert(name);
+	assert(copts);
+	char msg_name[MAX_NAME_LENGTH] = { 0 };
+	char scaling[64], offset[64], minimum[64], maximum[64];
+
+	fprintf(o, "/* CAN message descriptions: automatically generated - do not edit.\n\n");
+	fprintf(o,
+		"This file was generated by dbcc from '%s': See <https://github.com/howerj/dbcc>\n\n"
+		"Define 'DBCC_MESSAGE' and/or 'DBCC_SIGNAL' and include this file to\n"
+		"expand them once for each message and signal, they are undefined\n"
+		"at the end of this file so it can be included more than once:\n\n"
+		"\tDBCC_MESSAGE(msg, id, dlc, signals)\n"
+		"\tDBCC_SIGNAL(msg, id, sig, start, len, endian, signed, type, scale, offset, min, max, unit)\n\n"
+		"'msg' is the name of the message in the generated C code, 'start' is\n"
+		"the start bit as it is in the DBC file, 'endian' is 'intel' or\n"
+		"'motorola', 'signed' is 0 or 1 and 'type' is the type of the signal\n"
+		"in the message structure. 'unit' is a string. */\n\n", name);
+	fprintf(o, "#ifndef DBCC_MESSAGE\n#define DBCC_MESSAGE(msg, id, dlc, signals)\n#endif\n\n");
+	fprintf(o, "#ifndef DBCC_SIGNAL\n#define DBCC_SIGNAL(msg, id, sig, start, len, endian, signed, type, scale, offset, min, max, unit)\n#endif\n\n");
+
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		make_name(msg_name, sizeof msg_name, msg->name, msg->id, copts);
+		fprintf(o, "DBCC_MESSAGE(%s, 0x%03lx, %u, %zu)\n", msg_name, msg->id, msg->dlc, msg->signal_count);
+		for (size_t j = 0; j < msg->signal_count; j++) {
+			signal_t *sig = msg->sigs[j];
+			fprintf(o, "DBCC_SIGNAL(%s, 0x%03lx, %s, %u, %u, %s, %d, %s, %s, %s, %s, %s, \"%s\")\n",
+				msg_name, msg->id, sig->name, sig->start_bit, sig->bit_length,
+				sig->endianess == endianess_motorola_e ? "motorola" : "intel",
+				sig->is_signed,
+				determine_type(sig->bit_length, sig->is_signed, sig->is_floating),
+				double_constant(scaling, sizeof scaling, sig->scaling),
+				double_constant(offset, sizeof offset, sig->offset),
+				double_constant(minimum, sizeof minimum, sig->minimum),
+				double_constant(maximum, sizeof maximum, sig->maximum),
+				sig->units ? sig->units : "");
+		}
+	}
+
+	return fprintf(o, "\n#undef DBCC_MESSAGE\n#undef DBCC_SIGNAL\n") < 0 ? -1 : 0;
+}
@@ -15,10 +15,35 @@ typedef struct {
 	bool generate_print, generate_pack, generate_unpack;
 	bool generate_asserts;
 	bool generate_enum_can_ids;
+	bool use_byte_window; /* when unpacking, assemble only the bytes each signal spans */
+	bool target_32bit; /* pack and unpack signals of 32 bits or less in 32-bit halves of the frame */
+	bool generate_batch; /* unpack an array of frames with a single call */
+	bool generate_extract; /* extract a signal from an array of frames into an array of values */
+	bool generate_series; /* keep every sample of a message received as a growable column per signal */
+	bool lazy_decode; /* store the raw payload, the signals are unpacked when they are read */
+	bool generate_subscriptions; /* unpacking skips the signals masked out for each message at run time */
+	bool generate_changes; /* report which signals changed value when unpacking */
+	bool use_fixed_point; /* encode and decode signals as fixed point integers, not floating point */
+	bool use_tables; /* pack and unpack messages with an interpreter walking a table of signals */
+	bool generate_def; /* also write an X-macro file describing the signals */
+	bool generate_metadata; /* a constant table describing every signal, with lookup by name */
+	bool group_messages; /* lay out each message's members in the object together */
+	unsigned hot_cycle_time; /* in ms, grouped messages sent this often are cache line aligned */
+	bool use_seqlock; /* unpack under a sequence counter per message, for concurrent readers */
+	bool use_bitmaps; /* message rx/tx/error flags are bits in atomically set words, not bit-fields */
+	bool use_mux_unions; /* the signals for each multiplexor value share storage */
+	bool generate_phys; /* decode and encode all the signals of a message to and from a structure */
+	bool header_only; /* generate everything into the header, with the functions static inline */
+	bool generate_format; /* write the signals of a message as text, JSON or CSV into a buffer */
+	bool generate_patch; /* encode a signal straight into the bytes of a frame */
+	bool generate_build; /* encode a whole message from its physical values straight into a frame */
+	bool share_codecs; /* messages with the same signals share their pack, unpack, encode and decode code */
+	const char *subscriptions; /* file listing the signals to generate code for */
 	int version;
 } dbc2c_options_t;
 
 int dbc2c(dbc_t *dbc, FILE *c, FILE *h, const char *name, dbc2c_options_t *copts);
+int dbc2def(dbc_t *dbc, FILE *o, const char *name, dbc2c_options_t *copts);
 
 #ifdef __cplusplus
 }
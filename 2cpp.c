@@ -0,0 +1,626 @@
+/**@file 2cpp.c
+ * @brief Convert the Abstract Syntax Tree generated by mpc for the DBC file
+ * into a header only C++ library. Each signal is described by a structure
+ * of constants which templates in the 'dbcc' namespace are instantiated
+ * with, so accessing a signal folds down to a shift and a mask.
+ * @copyright Richard James Howe (2018)
+ * @license MIT */
+#include "2cpp.h"
+#include "util.h"
+#include <assert.h>
+#include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_NAME_LENGTH (512u)
+
+/* The run time is split up to keep each string short */
+static const char *cpp_runtime =
+"#ifndef DBCC_CPP_RUNTIME\n"
+"#define DBCC_CPP_RUNTIME\n"
+"/* Shared by every header generated by dbcc, signals are described by\n"
+" * structures holding 'static constexpr' members and these templates are\n"
+" * instantiated with them, so each access compiles to a shift and mask */\n"
+"namespace dbcc {\n"
+"\n"
+"enum class endianess { intel, motorola };\n"
+"\n"
+"constexpr uint64_t reverse_byte_order(uint64_t x) noexcept {\n"
+"\tx = (x & 0x00000000FFFFFFFFull) << 32 | (x & 0xFFFFFFFF00000000ull) >> 32;\n"
+"\tx = (x & 0x0000FFFF0000FFFFull) << 16 | (x & 0xFFFF0000FFFF0000ull) >> 16;\n"
+"\tx = (x & 0x00FF00FF00FF00FFull) << 8  | (x & 0xFF00FF00FF00FF00ull) >> 8;\n"
+"\treturn x;\n"
+"}\n"
+"\n"
+"template <unsigned Length>\n"
+"constexpr uint64_t mask() noexcept {\n"
+"\tif constexpr (Length == 64)\n"
+"\t\treturn ~0ull;\n"
+"\telse\n"
+"\t\treturn (1ull << Length) - 1ull;\n"
+"}\n"
+"\n"
+"template <typename To, typename From>\n"
+"constexpr To bits(const From from) noexcept {\n"
+"\tstatic_assert(sizeof(To) == sizeof(From), \"can only reinterpret types of the same size\");\n"
+"#ifdef __cpp_lib_bit_cast\n"
+"\treturn std::bit_cast<To>(from);\n"
+"#else\n"
+"\tTo to {};\n"
+"\tstd::memcpy(&to, &from, sizeof to);\n"
+"\treturn to;\n"
+"#endif\n"
+"}\n"
+"\n"
+"/* A payload as the word a signal is in, byte reversed if it is Motorola */\n"
+"template <typename S>\n"
+"constexpr uint64_t word(const uint64_t payload) noexcept {\n"
+"\tif constexpr (S::endianess == endianess::motorola)\n"
+"\t\treturn reverse_byte_order(payload);\n"
+"\telse\n"
+"\t\treturn payload;\n"
+"}\n"
+"\n"
+"/* Get a signal from the word it is in */\n"
+"template <typename S>\n"
+"constexpr typename S::type extract(const uint64_t word) noexcept {\n"
+"\tconst uint64_t x = (word >> S::start) & mask<S::length>();\n"
+"\tif constexpr (S::is_floating && S::length == 32) {\n"
+"\t\treturn bits<float>(static_cast<uint32_t>(x));\n"
+"\t} else if constexpr (S::is_floating) {\n"
+"\t\treturn bits<double>(x);\n"
+"\t} else if constexpr (S::is_signed) {\n"
+"\t\tconstexpr uint64_t top = 1ull << (S::length - 1);\n"
+"\t\treturn static_cast<typename S::type>(static_cast<int64_t>((x ^ top) - top));\n"
+"\t} else {\n"
+"\t\treturn static_cast<typename S::type>(x);\n"
+"\t}\n"
+"}\n"
+"\n"
+"/* Put a signal into the word it is in, which should be or'ed in */\n"
+"template <typename S>\n"
+"constexpr uint64_t place(const typename S::type value) noexcept {\n"
+"\tuint64_t x = 0;\n"
+"\tif constexpr (S::is_floating && S::length == 32)\n"
+"\t\tx = bits<uint32_t>(value);\n"
+"\telse if constexpr (S::is_floating)\n"
+"\t\tx = bits<uint64_t>(value);\n"
+"\telse\n"
+"\t\tx = static_cast<uint64_t>(value);\n"
+"\treturn (x & mask<S::length>()) << S::start;\n"
+"}\n"
+"\n";
+
+static const char *cpp_access =
+"/* The first byte of a payload is in its least significant byte */\n"
+"template <typename S>\n"
+"constexpr typename S::type get(const uint64_t payload) noexcept {\n"
+"\treturn extract<S>(word<S>(payload));\n"
+"}\n"
+"\n"
+"template <typename S>\n"
+"constexpr void set(uint64_t &payload, const typename S::type value) noexcept {\n"
+"\tconstexpr uint64_t field = mask<S::length>() << S::start;\n"
+"\tif constexpr (S::endianess == endianess::motorola)\n"
+"\t\tpayload = (payload & ~reverse_byte_order(field)) | reverse_byte_order(place<S>(value));\n"
+"\telse\n"
+"\t\tpayload = (payload & ~field) | place<S>(value);\n"
+"}\n"
+"\n"
+"/* Convert a raw value to a physical one, returning false if it is out of\n"
+" * range (and setting it to zero) */\n"
+"template <typename S>\n"
+"constexpr bool decode(const typename S::type raw, typename S::physical &out) noexcept {\n"
+"\ttypename S::physical rval = static_cast<typename S::physical>(raw);\n"
+"\tif constexpr (S::scaling != 1.0)\n"
+"\t\trval *= S::scaling;\n"
+"\tif constexpr (S::offset != 0.0)\n"
+"\t\trval += S::offset;\n"
+"\tif constexpr (S::check_minimum) {\n"
+"\t\tif (!(rval >= S::minimum)) {\n"
+"\t\t\tout = 0;\n"
+"\t\t\treturn false;\n"
+"\t\t}\n"
+"\t}\n"
+"\tif constexpr (S::check_maximum) {\n"
+"\t\tif (!(rval <= S::maximum)) {\n"
+"\t\t\tout = 0;\n"
+"\t\t\treturn false;\n"
+"\t\t}\n"
+"\t}\n"
+"\tout = rval;\n"
+"\treturn true;\n"
+"}\n"
+"\n"
+"/* Convert a physical value to a raw one, returning false and leaving it\n"
+" * alone if the value is out of range */\n"
+"template <typename S>\n"
+"constexpr bool encode(typename S::physical in, typename S::type &raw) noexcept {\n"
+"\tif constexpr (S::check_minimum) {\n"
+"\t\tif (in < S::minimum)\n"
+"\t\t\treturn false;\n"
+"\t}\n"
+"\tif constexpr (S::check_maximum) {\n"
+"\t\tif (in > S::maximum)\n"
+"\t\t\treturn false;\n"
+"\t}\n"
+"\tif constexpr (S::offset != 0.0)\n"
+"\t\tin -= S::offset;\n"
+"\tif constexpr (S::scaling != 1.0)\n"
+"\t\tin *= 1.0 / S::scaling;\n"
+"\traw = static_cast<typename S::type>(in);\n"
+"\treturn true;\n"
+"}\n"
+"\n";
+
+static const char *cpp_span =
+"#ifdef DBCC_CPP_SPAN\n"
+"inline uint64_t load(const std::span<const std::byte> data) noexcept {\n"
+"\tuint64_t x = 0;\n"
+"\tif constexpr (std::endian::native == std::endian::little) {\n"
+"\t\tif (data.size() >= sizeof x) {\n"
+"\t\t\tstd::memcpy(&x, data.data(), sizeof x);\n"
+"\t\t\treturn x;\n"
+"\t\t}\n"
+"\t}\n"
+"\tfor (std::size_t j = 0; j < data.size() && j < sizeof x; j++)\n"
+"\t\tx |= static_cast<uint64_t>(data[j]) << (8 * j);\n"
+"\treturn x;\n"
+"}\n"
+"\n"
+"inline void store(const std::span<std::byte> data, const uint64_t x) noexcept {\n"
+"\tfor (std::size_t j = 0; j < data.size() && j < sizeof x; j++)\n"
+"\t\tdata[j] = static_cast<std::byte>(x >> (8 * j));\n"
+"}\n"
+"\n"
+"template <typename S>\n"
+"inline typename S::type get(const std::span<const std::byte> payload) noexcept {\n"
+"\treturn get<S>(load(payload));\n"
+"}\n"
+"\n"
+"template <typename S>\n"
+"inline void set(const std::span<std::byte> payload, const typename S::type value) noexcept {\n"
+"\tuint64_t x = load(payload);\n"
+"\tset<S>(x, value);\n"
+"\tstore(payload, x);\n"
+"}\n"
+"#endif\n"
+"\n"
+"} /* namespace dbcc */\n"
+"#endif\n"
+"\n";
+
+static const char *determine_type(unsigned length, bool is_signed, bool is_floating)
+{
+	if (is_floating)
+		return length == 64 ? "double" : "float";
+	return is_signed ?
+		determine_signed_type(length) :
+		determine_unsigned_type(length);
+}
+
+/* The minimum and maximum only need checking if they are tighter than the
+ * range of the raw value */
+static void signal_range_checks(signal_t *sig, bool *gmin, bool *gmax)
+{
+	assert(sig);
+	assert(gmin);
+	assert(gmax);
+	*gmin = false;
+	*gmax = false;
+	if (sig->minimum == sig->maximum)
+		return;
+	if (sig->is_floating) {
+		*gmin = true;
+		*gmax = true;
+		return;
+	}
+	const double top = ldexp(1.0, sig->bit_length - sig->is_signed);
+	*gmin = sig->minimum > (sig->is_signed ? -top : 0.0);
+	*gmax = sig->maximum < top - 1.0;
+}
+
+/* Only the keywords a file might be named after, signal names are used as
+ * they are, as they are by the C code generator */
+static bool is_keyword(const char *name)
+{
+	assert(name);
+	static const char *keywords[] = {
+		"auto", "bool", "break", "case", "char", "class", "const", "default",
+		"delete", "do", "double", "else", "enum", "explicit", "export",
+		"extern", "false", "float", "for", "friend", "goto", "if", "inline",
+		"int", "long", "namespace", "new", "operator", "private",
+		"protected", "public", "register", "return", "short", "signed",
+		"sizeof", "static", "struct", "switch", "template", "this", "throw",
+		"true", "try", "typedef", "typename", "union", "unsigned", "using",
+		"virtual", "void", "volatile", "while",
+	};
+	for (size_t i = 0; i < sizeof (keywords) / sizeof (keywords[0]); i++)
+		if (!strcmp(keywords[i], name))
+			return true;
+	return false;
+}
+
+static void make_name(char *newname, size_t maxlen, const char *name, unsigned id, dbc2c_options_t *copts)
+{
+	assert(newname);
+	assert(name);
+	assert(copts);
+	if (copts->use_id_in_name)
+		snprintf(newname, maxlen-1, "can_0x%03x_%s", id, name);
+	else
+		snprintf(newname, maxlen-1, "can_%s", name);
+}
+
+/* Only classic CAN frames, with every signal inside them, are supported */
+static bool msg_is_supported(can_msg_t *msg)
+{
+	assert(msg);
+	if (msg->dlc > 8)
+		return false;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		const bool motorola = sig->endianess == endianess_motorola_e;
+		if (sig->bit_length == 0 || sig->bit_length > 64)
+			return false;
+		if (sig->is_floating && sig->bit_length != 32 && sig->bit_length != 64)
+			return false;
+		if (fix_start_bit(motorola, sig->start_bit, sig->bit_length) > 64u - sig->bit_length)
+			return false;
+	}
+	return true;
+}
+
+static int signal2descriptor(signal_t *sig, FILE *o)
+{
+	assert(sig);
+	assert(o);
+	const bool motorola = sig->endianess == endianess_motorola_e;
+	const bool scaled = sig->scaling != 1.0 || sig->offset != 0.0;
+	const char *type = determine_type(sig->bit_length, sig->is_signed, sig->is_floating);
+	char scaling[64], offset[64], minimum[64], maximum[64];
+	bool gmin = false, gmax = false;
+	signal_range_checks(sig, &gmin, &gmax);
+	if (sig->scaling == 0.0)
+		error("invalid scaling factor (fix your DBC file)");
+	if (sig->comment)
+		fprintf(o, "/* %s */\n", sig->comment);
+	fprintf(o, "struct %s {\n", sig->name);
+	fprintf(o, "\tusing type = %s;\n", type);
+	fprintf(o, "\tusing physical = %s;\n", scaled ? "double" : type);
+	fprintf(o, "\tstatic constexpr const char *name = \"%s\";\n", sig->name);
+	fprintf(o, "\tstatic constexpr unsigned start = %u, length = %u, switchval = %u;\n",
+		fix_start_bit(motorola, sig->start_bit, sig->bit_length), sig->bit_length,
+		sig->is_multiplexed ? sig->switchval : 0);
+	fprintf(o, "\tstatic constexpr dbcc::endianess endianess = dbcc::endianess::%s;\n", motorola ? "motorola" : "intel");
+	fprintf(o, "\tstatic constexpr bool is_signed = %s, is_floating = %s, is_multiplexor = %s, is_multiplexed = %s;\n",
+		sig->is_signed ? "true" : "false", sig->is_floating ? "true" : "false",
+		sig->is_multiplexor ? "true" : "false", sig->is_multiplexed ? "true" : "false");
+	fprintf(o, "\tstatic constexpr double scaling = %s, offset = %s, minimum = %s, maximum = %s;\n",
+		double_constant(scaling, sizeof scaling, sig->scaling),
+		double_constant(offset, sizeof offset, sig->offset),
+		double_constant(minimum, sizeof minimum, sig->minimum),
+		double_constant(maximum, sizeof maximum, sig->maximum));
+	fprintf(o, "\tstatic constexpr bool check_minimum = %s, check_maximum = %s;\n", gmin ? "true" : "false", gmax ? "true" : "false");
+	if (sig->val_list && sig->val_list->val_list_item_count) {
+		/* named after the signal too, so no name starts with a digit */
+		char *sname = escape_string(sig->name, 1);
+		fputs("\tenum values {\n", o);
+		for (size_t i = 0; i < sig->val_list->val_list_item_count; i++) {
+			val_list_item_t *item = sig->val_list->val_list_items[i];
+			char *ename = escape_string(item->name, 1);
+			for (size_t j = 0; ename[j]; j++)
+				ename[j] = toupper(ename[j]);
+			fprintf(o, "\t\t%s_%s = %u,\n", sname, ename, item->value);
+			free(ename);
+		}
+		fputs("\t};\n", o);
+		free(sname);
+	}
+	return fputs("};\n\n", o) < 0 ? -1 : 0;
+}
+
+static int signal2cpp(signal_t *sig, FILE *o, const char *ns, bool pack, const char *indent)
+{
+	assert(sig);
+	assert(o);
+	assert(ns);
+	assert(indent);
+	const char word = sig->endianess == endianess_motorola_e ? 'm' : 'i';
+	if (pack)
+		return fprintf(o, "%s%c |= dbcc::place<%s::%s>(%s);\n", indent, word, ns, sig->name, sig->name) < 0 ? -1 : 0;
+	return fprintf(o, "%s%s = dbcc::extract<%s::%s>(%c);\n", indent, sig->name, ns, sig->name, word) < 0 ? -1 : 0;
+}
+
+/* Print a condition that the multiplexor 'sig' has a value in one of the
+ * ranges selecting 'muxed', or in any of its ranges if 'muxed' is NULL.
+ * Comparisons the type of 'sig' makes always true are left out, they are
+ * warned about by '-Wtype-limits'. */
+static void mux_condition(signal_t *sig, signal_t *muxed, FILE *o)
+{
+	assert(sig);
+	assert(o);
+	const unsigned long long top = sig->bit_length >= 32 ? UINT_MAX : (1ull << sig->bit_length) - 1ull;
+	size_t terms = 0;
+	for (size_t i = 0; i < sig->mul_num; i++)
+		terms += !muxed || sig->muxed[i] == muxed;
+	const char *or = "";
+	for (size_t i = 0; i < sig->mul_num; i++) {
+		mul_val_list_t *mul_val = sig->mux_vals[i];
+		if (muxed && sig->muxed[i] != muxed)
+			continue;
+		const bool low = mul_val->min_value || sig->is_signed || sig->is_floating, high = mul_val->max_value < top;
+		fputs(or, o);
+		if (mul_val->min_value == mul_val->max_value)
+			fprintf(o, "%s == %u", sig->name, mul_val->min_value);
+		else if (low && high)
+			fprintf(o, terms > 1 ? "(%s >= %u && %s <= %u)" : "%s >= %u && %s <= %u", sig->name, mul_val->min_value, sig->name, mul_val->max_value);
+		else if (low)
+			fprintf(o, "%s >= %u", sig->name, mul_val->min_value);
+		else if (high)
+			fprintf(o, "%s <= %u", sig->name, mul_val->max_value);
+		else
+			fputs("true", o);
+		or = " || ";
+	}
+}
+
+/* Signals using extended multiplexing (SG_MUL_VAL_), the ranges of a
+ * multiplexor can overlap so each signal it selects is tested for on its
+ * own, after values outside of all of them are rejected */
+static int multiplexed2cpp(signal_t *sig, FILE *o, const char *ns, bool pack, unsigned depth)
+{
+	assert(sig);
+	assert(o);
+	assert(ns);
+	char indent[MAX_NAME_LENGTH] = { 0 };
+	for (unsigned i = 0; i < depth && i < sizeof (indent) - 1; i++)
+		indent[i] = '\t';
+	if (signal2cpp(sig, o, ns, pack, indent) < 0)
+		return -1;
+	if (!sig->mul_num)
+		return 0;
+	fprintf(o, "%sif (!(", indent);
+	mux_condition(sig, NULL, o);
+	fprintf(o, "))\n%s\treturn false;\n", indent);
+	for (size_t i = 0; i < sig->mul_num; i++) {
+		bool seen = false;
+		for (size_t j = 0; j < i; j++)
+			seen = seen || sig->muxed[j] == sig->muxed[i];
+		if (seen)
+			continue;
+		fprintf(o, "%sif (", indent);
+		mux_condition(sig, sig->muxed[i], o);
+		fputs(") {\n", o);
+		if (multiplexed2cpp(sig->muxed[i], o, ns, pack, depth + 1) < 0)
+			return -1;
+		fprintf(o, "%s}\n", indent);
+	}
+	return 0;
+}
+
+static int signals2cpp(can_msg_t *msg, FILE *o, const char *ns, bool pack)
+{
+	assert(msg);
+	assert(o);
+	assert(ns);
+	signal_t *multiplexor = NULL;
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		if (sig->is_multiplexed)
+			continue;
+		if (sig->muxed) {
+			if (multiplexed2cpp(sig, o, ns, pack, 2) < 0)
+				return -1;
+			continue;
+		}
+		if (sig->is_multiplexor) {
+			if (multiplexor)
+				error("multiple multiplexor values detected (only one per CAN msg is allowed) for %s", msg->name);
+			multiplexor = sig;
+		}
+		if (signal2cpp(sig, o, ns, pack, "\t\t") < 0)
+			return -1;
+	}
+	if (!multiplexor)
+		return 0;
+	fprintf(o, "\t\tswitch (%s) {\n", multiplexor->name);
+	for (size_t i = 0; i < msg->signal_count; i++) {
+		signal_t *sig = msg->sigs[i];
+		bool seen = false;
+		for (size_t j = 0; j < i; j++)
+			seen = seen || (msg->sigs[j]->is_multiplexed && msg->sigs[j]->switchval == sig->switchval);
+		if (!sig->is_multiplexed || seen)
+			continue;
+		fprintf(o, "\t\tcase %u:\n", sig->switchval);
+		for (size_t j = i; j < msg->signal_count; j++)
+			if (msg->sigs[j]->is_multiplexed && msg->sigs[j]->switchval == sig->switchval)
+				if (signal2cpp(msg->sigs[j], o, ns, pack, "\t\t\t") < 0)
+					return -1;
+		fputs("\t\t\tbreak;\n", o);
+	}
+	fputs("\t\tdefault:\n\t\t\treturn false;\n\t\t}\n", o);
+	return 0;
+}
+
+static int msg2cpp(can_msg_t *msg, FILE *o, const char *ns, dbc2c_options_t *copts)
+{
+	assert(msg);
+	assert(o);
+	assert(ns);
+	assert(copts);
+	char name[MAX_NAME_LENGTH] = { 0 }, qualified[MAX_NAME_LENGTH] = { 0 };
+	make_name(name, sizeof name, msg->name, msg->id, copts);
+	/* members are named after signals, so the signal descriptors are
+	 * referred to by their fully qualified names in the message */
+	snprintf(qualified, sizeof qualified, "::%s::%s", ns, name);
+	bool motorola_used = false, intel_used = false;
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (msg->sigs[i]->endianess == endianess_motorola_e)
+			motorola_used = true;
+		else
+			intel_used = true;
+
+	if (msg->comment)
+		fprintf(o, "/* %s */\n", msg->comment);
+	fprintf(o, "namespace %s {\n\n", name);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		if (signal2descriptor(msg->sigs[i], o) < 0)
+			return -1;
+
+	fprintf(o, "struct message {\n");
+	fprintf(o, "\tstatic constexpr unsigned long id = 0x%03lx;\n", msg->id);
+	fprintf(o, "\tstatic constexpr unsigned dlc = %u;\n", msg->dlc);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		fprintf(o, "\t%s::%s::type %s{};\n", qualified, msg->sigs[i]->name, msg->sigs[i]->name);
+
+	fprintf(o, "\n\t/* Returns false if the frame is too short or a multiplexor value is unknown */\n");
+	fprintf(o, "\tconstexpr bool unpack(const uint64_t data, const unsigned length = dlc) noexcept {\n");
+	fprintf(o, "\t\tif (length < dlc)\n\t\t\treturn false;\n");
+	if (motorola_used)
+		fprintf(o, "\t\tconst uint64_t m = dbcc::reverse_byte_order(data);\n");
+	if (intel_used)
+		fprintf(o, "\t\tconst uint64_t i = data;\n");
+	if (!msg->signal_count)
+		fprintf(o, "\t\tstatic_cast<void>(data);\n");
+	if (signals2cpp(msg, o, qualified, false) < 0)
+		return -1;
+	fprintf(o, "\t\treturn true;\n\t}\n\n");
+
+	fprintf(o, "\tconstexpr bool pack(uint64_t &data) const noexcept {\n");
+	if (motorola_used)
+		fprintf(o, "\t\tuint64_t m = 0;\n");
+	if (intel_used)
+		fprintf(o, "\t\tuint64_t i = 0;\n");
+	if (signals2cpp(msg, o, qualified, true) < 0)
+		return -1;
+	fprintf(o, "\t\tdata = %s%s%s;\n",
+		motorola_used ? "dbcc::reverse_byte_order(m)" : "",
+		motorola_used && intel_used ? " | " : "",
+		intel_used ? "i" : motorola_used ? "" : "0");
+	fprintf(o, "\t\treturn true;\n\t}\n");
+
+	fprintf(o, "\n#ifdef DBCC_CPP_SPAN\n");
+	fprintf(o, "\tbool unpack(const std::span<const std::byte> data) noexcept {\n");
+	fprintf(o, "\t\treturn unpack(dbcc::load(data), data.size() < dlc ? data.size() : dlc);\n\t}\n\n");
+	fprintf(o, "\tbool pack(const std::span<std::byte> data) const noexcept {\n");
+	fprintf(o, "\t\tuint64_t x = 0;\n");
+	fprintf(o, "\t\tif (data.size() < dlc || !pack(x))\n\t\t\treturn false;\n");
+	fprintf(o, "\t\tdbcc::store(data.first(dlc), x);\n");
+	fprintf(o, "\t\treturn true;\n\t}\n");
+	fprintf(o, "#endif\n");
+	fprintf(o, "};\n\n");
+	return fprintf(o, "} /* namespace %s */\n\n", name) < 0 ? -1 : 0;
+}
+
+static int messages2cpp(dbc_t *dbc, FILE *o, const char *ns, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(o);
+	assert(ns);
+	assert(copts);
+	char name[MAX_NAME_LENGTH] = { 0 };
+	fprintf(o, "/* All of the messages, and functions to unpack and pack them by ID */\n");
+	fprintf(o, "struct messages {\n");
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		if (!msg_is_supported(msg))
+			continue;
+		make_name(name, sizeof name, msg->name, msg->id, copts);
+		fprintf(o, "\t::%s::%s::message %s;\n", ns, name, name);
+	}
+	for (int pack = 0; pack < 2; pack++) {
+		if (pack)
+			fprintf(o, "\n\tconstexpr bool pack(const unsigned long id, uint64_t &data) const noexcept {\n");
+		else
+			fprintf(o, "\n\tconstexpr bool unpack(const unsigned long id, const uint64_t data, const unsigned length = 8) noexcept {\n");
+		fprintf(o, "\t\tswitch (id) {\n");
+		for (size_t i = 0; i < dbc->message_count; i++) {
+			can_msg_t *msg = dbc->messages[i];
+			if (!msg_is_supported(msg))
+				continue;
+			make_name(name, sizeof name, msg->name, msg->id, copts);
+			fprintf(o, "\t\tcase 0x%03lx: return %s.%s;\n", msg->id, name, pack ? "pack(data)" : "unpack(data, length)");
+		}
+		fprintf(o, "\t\tdefault: break;\n\t\t}\n");
+		if (pack)
+			fprintf(o, "\t\tstatic_cast<void>(data);\n");
+		else
+			fprintf(o, "\t\tstatic_cast<void>(data);\n\t\tstatic_cast<void>(length);\n");
+		fprintf(o, "\t\treturn false;\n\t}\n");
+	}
+	return fputs("};\n\n", o) < 0 ? -1 : 0;
+}
+
+int dbc2cpp(dbc_t *dbc, FILE *output, const char *name, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(output);
+	assert(name);
+	assert(copts);
+	time_t rawtime = time(NULL);
+	struct tm *timeinfo = localtime(&rawtime);
+	char ns[MAX_NAME_LENGTH] = { 0 }, guard[MAX_NAME_LENGTH] = { 0 };
+
+	/* the namespace is the file name without its extension, the include
+	 * guard is that in upper case */
+	snprintf(ns, sizeof ns, "%s%s", isalpha(name[0]) ? "" : "_", name);
+	char *dot = strrchr(ns, '.');
+	if (dot)
+		*dot = '\0';
+	for (size_t i = 0; ns[i]; i++) {
+		ns[i] = isalnum(ns[i]) ? ns[i] : '_';
+		guard[i] = toupper(ns[i]);
+	}
+	if (is_keyword(ns))
+		strcat(ns, "_");
+
+	qsort(dbc->messages, dbc->message_count, sizeof(dbc->messages[0]), message_compare_function);
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		qsort(msg->sigs, msg->signal_count, sizeof(msg->sigs[0]), signal_compare_function);
+	}
+
+	fprintf(output, "/* CAN message encoder/decoder: automatically generated - do not edit.\n\n");
+	if (copts->use_time_stamps)
+		fprintf(output, "  * @note  Generated on %s", asctime(timeinfo));
+	fprintf(output,
+		"This file was generated by dbcc: See <https://github.com/howerj/dbcc>\n\n"
+		"It is a header only C++17 library, 'dbcc::get<Signal>(payload)' and\n"
+		"'dbcc::set<Signal>(payload, value)' access a signal in a payload with the\n"
+		"first byte of the frame in its least significant byte, and a\n"
+		"'std::span<const std::byte>' can be used instead of a payload with C++20. */\n\n");
+	fprintf(output, "#ifndef %s_HPP\n#define %s_HPP\n\n", guard, guard);
+	fprintf(output, "//DBC Version: `Version(\"%s\")`\n\n", dbc->dbc_version ? dbc->dbc_version : "");
+	fprintf(output,
+		"#include <cstddef>\n"
+		"#include <cstdint>\n"
+		"#include <cstring>\n"
+		"#if __cplusplus >= 202002L\n"
+		"#include <bit>\n"
+		"#include <span>\n"
+		"#define DBCC_CPP_SPAN\n"
+		"#endif\n\n");
+	fputs(cpp_runtime, output);
+	fputs(cpp_access, output);
+	fputs(cpp_span, output);
+
+	fprintf(output, "namespace %s {\n\n", ns);
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		if (!msg_is_supported(msg)) {
+			warning("C++ output does not support message '%s', it is a CAN-FD message or a signal is outside of it", msg->name);
+			fprintf(output, "/* %s is not supported */\n\n", msg->name);
+			continue;
+		}
+		if (msg2cpp(msg, output, ns, copts) < 0)
+			return -1;
+	}
+	if (messages2cpp(dbc, output, ns, copts) < 0)
+		return -1;
+	fprintf(output, "} /* namespace %s */\n\n", ns);
+	return fprintf(output, "#endif\n") < 0 ? -1 : 0;
+}
@@ -0,0 +1,15 @@
+#ifndef _2CPP_H
+#define _2CPP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "2c.h"
+
+int dbc2cpp(dbc_t *dbc, FILE *output, const char *name, dbc2c_options_t *copts);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,12513 @@
+/* Generated by DBCC, see <https://github.com/howerj/dbcc> 
+This file was generated by dbcc: See <https://github.com/howerj/dbcc>
+
+Consider donating; see the repo for more information, this project 
+requires your support to continue.
+
+For those with paid support or to inquire about paid support
+please Email <mailto:hello.operator.co.uk@gmail.com>.
+
+*/
+
+#include "ex1.h"
+#include <inttypes.h>
+#include <math.h> /* uses macros NAN, INFINITY, signbit, no need for -lm */
+
+#define UNUSED(X) ((void)(X))
+
+static inline uint64_t reverse_byte_order(uint64_t x) {
+	x = (x & 0x00000000FFFFFFFF) << 32 | (x & 0xFFFFFFFF00000000) >> 32;
+	x = (x & 0x0000FFFF0000FFFF) << 16 | (x & 0xFFFF0000FFFF0000) >> 16;
+	x = (x & 0x00FF00FF00FF00FF) << 8  | (x & 0xFF00FF00FF00FF00) >> 8;
+	return x;
+}
+
+static inline int print_helper(int r, int print_return_value) {
+	return ((r >= 0) && (print_return_value >= 0)) ? r + print_return_value : -1;
+}
+
+/* unpack754() -- unpack a floating point number from IEEE-754 format */ 
+static double unpack754(const uint64_t i, const unsigned bits, const unsigned expbits) {
+	if (i == 0) return 0.0;
+
+	const uint64_t expset = ((1uLL << expbits) - 1uLL) << (bits - expbits - 1);
+	if ((i & expset) == expset) { /* NaN or +/-Infinity */
+		if (i & ((1uLL << (bits - expbits - 1)) - 1uLL)) /* Non zero Mantissa means NaN */
+			return NAN;
+		return (i & (1uLL << (bits - 1))) ? -INFINITY : INFINITY;
+	}
+
+	/* pull the significand */
+	const unsigned significandbits = bits - expbits - 1; /* - 1 for sign bit */
+	double result = (i & ((1LL << significandbits) - 1)); /* mask */
+	result /= (1LL << significandbits);  /* convert back to float */
+	result += 1.0f;                        /* add the one back on */
+
+	/* deal with the exponent */
+	const unsigned bias = (1 << (expbits - 1)) - 1;
+	long long shift = ((i >> significandbits) & ((1LL << expbits) - 1)) - bias;
+	while (shift > 0) { result *= 2.0; shift--; }
+	while (shift < 0) { result /= 2.0; shift++; }
+	
+	return ((i >> (bits - 1)) & 1) ? -result : result; /* sign it, and return */
+}
+
+static inline float    unpack754_32(uint32_t i) { return unpack754(i, 32, 8); }
+static inline double   unpack754_64(uint64_t i) { return unpack754(i, 64, 11); }
+
+
+/* pack754() -- pack a floating point number into IEEE-754 format */ 
+static uint64_t pack754(const double f, const unsigned bits, const unsigned expbits) {
+	if (f == 0.0) /* get this special case out of the way */
+		return signbit(f) ? (1uLL << (bits - 1)) :  0;
+	if (f != f) /* NaN, encoded as Exponent == all-bits-set, Mantissa != 0, Signbit == Do not care */
+		return (1uLL << (bits - 1)) - 1uLL;
+	if (f == INFINITY) /* +INFINITY encoded as Mantissa == 0, Exponent == all-bits-set */
+		return ((1uLL << expbits) - 1uLL) << (bits - expbits - 1);
+	if (f == -INFINITY) /* -INFINITY encoded as Mantissa == 0, Exponent == all-bits-set, Signbit == 1 */
+		return (1uLL << (bits - 1)) | ((1uLL << expbits) - 1uLL) << (bits - expbits - 1);
+
+	long long sign = 0;
+	double fnorm = f;
+	/* check sign and begin normalization */
+	if (f < 0) { sign = 1; fnorm = -f; }
+
+	/* get the normalized form of f and track the exponent */
+	int shift = 0;
+	while (fnorm >= 2.0) { fnorm /= 2.0; shift++; }
+	while (fnorm < 1.0)  { fnorm *= 2.0; shift--; }
+	fnorm = fnorm - 1.0;
+
+	const unsigned significandbits = bits - expbits - 1; // -1 for sign bit
+
+	/* calculate the binary form (non-float) of the significand data */
+	const long long significand = fnorm * (( 1LL << significandbits) + 0.5f);
+
+	/* get the biased exponent */
+	const long long exp = shift + ((1LL << (expbits - 1)) - 1); // shift + bias
+
+	/* return the final answer */
+	return (sign << (bits - 1)) | (exp << (bits - expbits - 1)) | significand;
+}
+
+static inline uint32_t   pack754_32(const float  f)   { return   pack754(f, 32, 8); }
+static inline uint64_t   pack754_64(const double f)   { return   pack754(f, 64, 11); }
+
+
+static int pack_can_0x020_MagicCanNode1RBootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicNode1R_BLAddy: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x020_MagicCanNode1RBootloaderAddress.MagicNode1R_BLAddy)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x020_MagicCanNode1RBootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x020_MagicCanNode1RBootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* MagicNode1R_BLAddy: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x020_MagicCanNode1RBootloaderAddress.MagicNode1R_BLAddy = w;
+	o->can_0x020_MagicCanNode1RBootloaderAddress_rx = 1;
+	o->can_0x020_MagicCanNode1RBootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x020_MagicNode1R_BLAddy(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x020_MagicCanNode1RBootloaderAddress.MagicNode1R_BLAddy);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x020_MagicNode1R_BLAddy(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x020_MagicCanNode1RBootloaderAddress.MagicNode1R_BLAddy = in;
+	return 0;
+}
+
+int print_can_0x020_MagicCanNode1RBootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicNode1R_BLAddy = (wire: %.0f)\n", (double)(o->can_0x020_MagicCanNode1RBootloaderAddress.MagicNode1R_BLAddy)));
+	return r;
+}
+
+static int pack_can_0x022_MagicCanNode2MBootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicNode2M_BLAddy: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x022_MagicCanNode2MBootloaderAddress.MagicNode2M_BLAddy)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x022_MagicCanNode2MBootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x022_MagicCanNode2MBootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* MagicNode2M_BLAddy: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x022_MagicCanNode2MBootloaderAddress.MagicNode2M_BLAddy = w;
+	o->can_0x022_MagicCanNode2MBootloaderAddress_rx = 1;
+	o->can_0x022_MagicCanNode2MBootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x022_MagicNode2M_BLAddy(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x022_MagicCanNode2MBootloaderAddress.MagicNode2M_BLAddy);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x022_MagicNode2M_BLAddy(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x022_MagicCanNode2MBootloaderAddress.MagicNode2M_BLAddy = in;
+	return 0;
+}
+
+int print_can_0x022_MagicCanNode2MBootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicNode2M_BLAddy = (wire: %.0f)\n", (double)(o->can_0x022_MagicCanNode2MBootloaderAddress.MagicNode2M_BLAddy)));
+	return r;
+}
+
+static int pack_can_0x023_MagicCanNode2Heartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicNode2Flags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x023_MagicCanNode2Heartbeat.MagicNode2Flags)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x023_MagicCanNode2Heartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x023_MagicCanNode2Heartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* MagicNode2Flags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x023_MagicCanNode2Heartbeat.MagicNode2Flags = w;
+	o->can_0x023_MagicCanNode2Heartbeat_rx = 1;
+	o->can_0x023_MagicCanNode2Heartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x023_MagicNode2Flags(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x023_MagicCanNode2Heartbeat.MagicNode2Flags);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x023_MagicNode2Flags(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x023_MagicCanNode2Heartbeat.MagicNode2Flags = in;
+	return 0;
+}
+
+int print_can_0x023_MagicCanNode2Heartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicNode2Flags = (wire: %.0f)\n", (double)(o->can_0x023_MagicCanNode2Heartbeat.MagicNode2Flags)));
+	return r;
+}
+
+static int pack_can_0x024_MagicCanNode3FBootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicNode3F_BLAddy: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x024_MagicCanNode3FBootloaderAddress.MagicNode3F_BLAddy)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x024_MagicCanNode3FBootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x024_MagicCanNode3FBootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* MagicNode3F_BLAddy: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x024_MagicCanNode3FBootloaderAddress.MagicNode3F_BLAddy = w;
+	o->can_0x024_MagicCanNode3FBootloaderAddress_rx = 1;
+	o->can_0x024_MagicCanNode3FBootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x024_MagicNode3F_BLAddy(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x024_MagicCanNode3FBootloaderAddress.MagicNode3F_BLAddy);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x024_MagicNode3F_BLAddy(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x024_MagicCanNode3FBootloaderAddress.MagicNode3F_BLAddy = in;
+	return 0;
+}
+
+int print_can_0x024_MagicCanNode3FBootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicNode3F_BLAddy = (wire: %.0f)\n", (double)(o->can_0x024_MagicCanNode3FBootloaderAddress.MagicNode3F_BLAddy)));
+	return r;
+}
+
+static int pack_can_0x025_MagicCanNode3Heartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicNode3Flags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x025_MagicCanNode3Heartbeat.MagicNode3Flags)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x025_MagicCanNode3Heartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x025_MagicCanNode3Heartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* MagicNode3Flags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x025_MagicCanNode3Heartbeat.MagicNode3Flags = w;
+	o->can_0x025_MagicCanNode3Heartbeat_rx = 1;
+	o->can_0x025_MagicCanNode3Heartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x025_MagicNode3Flags(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x025_MagicCanNode3Heartbeat.MagicNode3Flags);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x025_MagicNode3Flags(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x025_MagicCanNode3Heartbeat.MagicNode3Flags = in;
+	return 0;
+}
+
+int print_can_0x025_MagicCanNode3Heartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicNode3Flags = (wire: %.0f)\n", (double)(o->can_0x025_MagicCanNode3Heartbeat.MagicNode3Flags)));
+	return r;
+}
+
+static int pack_can_0x026_FrameFaultBootloaderAddres(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* FrameFaultBootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x026_FrameFaultBootloaderAddres.FrameFaultBootloaderAddress)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x026_FrameFaultBootloaderAddres_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x026_FrameFaultBootloaderAddres(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* FrameFaultBootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x026_FrameFaultBootloaderAddres.FrameFaultBootloaderAddress = w;
+	o->can_0x026_FrameFaultBootloaderAddres_rx = 1;
+	o->can_0x026_FrameFaultBootloaderAddres_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x026_FrameFaultBootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x026_FrameFaultBootloaderAddres.FrameFaultBootloaderAddress);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x026_FrameFaultBootloaderAddress(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x026_FrameFaultBootloaderAddres.FrameFaultBootloaderAddress = in;
+	return 0;
+}
+
+int print_can_0x026_FrameFaultBootloaderAddres(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "FrameFaultBootloaderAddress = (wire: %.0f)\n", (double)(o->can_0x026_FrameFaultBootloaderAddres.FrameFaultBootloaderAddress)));
+	return r;
+}
+
+static int pack_can_0x027_FrameFaultHeartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* FrameFaultFlags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x027_FrameFaultHeartbeat.FrameFaultFlags)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x027_FrameFaultHeartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x027_FrameFaultHeartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* FrameFaultFlags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x027_FrameFaultHeartbeat.FrameFaultFlags = w;
+	o->can_0x027_FrameFaultHeartbeat_rx = 1;
+	o->can_0x027_FrameFaultHeartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x027_FrameFaultFlags(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x027_FrameFaultHeartbeat.FrameFaultFlags);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x027_FrameFaultFlags(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x027_FrameFaultHeartbeat.FrameFaultFlags = in;
+	return 0;
+}
+
+int print_can_0x027_FrameFaultHeartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "FrameFaultFlags = (wire: %.0f)\n", (double)(o->can_0x027_FrameFaultHeartbeat.FrameFaultFlags)));
+	return r;
+}
+
+static int pack_can_0x028_FrameFaultCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* FrameFaultCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x028_FrameFaultCommand.FrameFaultCommandValue)) & 0xffffffff;
+	lo |= w;
+	/* FrameFaultCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x028_FrameFaultCommand.FrameFaultCommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x028_FrameFaultCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x028_FrameFaultCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* FrameFaultCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x028_FrameFaultCommand.FrameFaultCommandValue = w;
+	/* FrameFaultCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x028_FrameFaultCommand.FrameFaultCommandCode = w;
+	o->can_0x028_FrameFaultCommand_rx = 1;
+	o->can_0x028_FrameFaultCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x028_FrameFaultCommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x028_FrameFaultCommand.FrameFaultCommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x028_FrameFaultCommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x028_FrameFaultCommand.FrameFaultCommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x028_FrameFaultCommand.FrameFaultCommandValue = in;
+	return 0;
+}
+
+int decode_can_0x028_FrameFaultCommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x028_FrameFaultCommand.FrameFaultCommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x028_FrameFaultCommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x028_FrameFaultCommand.FrameFaultCommandCode = in;
+	return 0;
+}
+
+int print_can_0x028_FrameFaultCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "FrameFaultCommandValue = (wire: %.0f)\n", (double)(o->can_0x028_FrameFaultCommand.FrameFaultCommandValue)));
+	r = print_helper(r, fprintf(output, "FrameFaultCommandCode = (wire: %.0f)\n", (double)(o->can_0x028_FrameFaultCommand.FrameFaultCommandCode)));
+	return r;
+}
+
+static int pack_can_0x02c_DriveControlsBootloader(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* DriveControlsBootloader: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x02c_DriveControlsBootloader.DriveControlsBootloader)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x02c_DriveControlsBootloader_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x02c_DriveControlsBootloader(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* DriveControlsBootloader: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x02c_DriveControlsBootloader.DriveControlsBootloader = w;
+	o->can_0x02c_DriveControlsBootloader_rx = 1;
+	o->can_0x02c_DriveControlsBootloader_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x02c_DriveControlsBootloader(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x02c_DriveControlsBootloader.DriveControlsBootloader);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x02c_DriveControlsBootloader(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x02c_DriveControlsBootloader.DriveControlsBootloader = in;
+	return 0;
+}
+
+int print_can_0x02c_DriveControlsBootloader(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "DriveControlsBootloader = (wire: %.0f)\n", (double)(o->can_0x02c_DriveControlsBootloader.DriveControlsBootloader)));
+	return r;
+}
+
+static int pack_can_0x02d_DriveControlsCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* DriveControlCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x02d_DriveControlsCommand.DriveControlCommandValue)) & 0xffffffff;
+	lo |= w;
+	/* DriveControlCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x02d_DriveControlsCommand.DriveControlCommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x02d_DriveControlsCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x02d_DriveControlsCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* DriveControlCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x02d_DriveControlsCommand.DriveControlCommandValue = w;
+	/* DriveControlCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x02d_DriveControlsCommand.DriveControlCommandCode = w;
+	o->can_0x02d_DriveControlsCommand_rx = 1;
+	o->can_0x02d_DriveControlsCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x02d_DriveControlCommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x02d_DriveControlsCommand.DriveControlCommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x02d_DriveControlCommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x02d_DriveControlsCommand.DriveControlCommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x02d_DriveControlsCommand.DriveControlCommandValue = in;
+	return 0;
+}
+
+int decode_can_0x02d_DriveControlCommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x02d_DriveControlsCommand.DriveControlCommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x02d_DriveControlCommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x02d_DriveControlsCommand.DriveControlCommandCode = in;
+	return 0;
+}
+
+int print_can_0x02d_DriveControlsCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "DriveControlCommandValue = (wire: %.0f)\n", (double)(o->can_0x02d_DriveControlsCommand.DriveControlCommandValue)));
+	r = print_helper(r, fprintf(output, "DriveControlCommandCode = (wire: %.0f)\n", (double)(o->can_0x02d_DriveControlsCommand.DriveControlCommandCode)));
+	return r;
+}
+
+static int pack_can_0x02e_DriveControlsHeartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* DriveControlTritiumError: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x02e_DriveControlsHeartbeat.DriveControlTritiumError)) & 0x1;
+	lo |= w << 1;
+	/* DriveControlMaxError: start-bit 2, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x02e_DriveControlsHeartbeat.DriveControlMaxError)) & 0x1;
+	lo |= w << 2;
+	/* DriveControlMinError: start-bit 3, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x02e_DriveControlsHeartbeat.DriveControlMinError)) & 0x1;
+	lo |= w << 3;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x02e_DriveControlsHeartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x02e_DriveControlsHeartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* DriveControlTritiumError: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 1) & 0x1;
+	o->can_0x02e_DriveControlsHeartbeat.DriveControlTritiumError = w;
+	/* DriveControlMaxError: start-bit 2, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 2) & 0x1;
+	o->can_0x02e_DriveControlsHeartbeat.DriveControlMaxError = w;
+	/* DriveControlMinError: start-bit 3, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 3) & 0x1;
+	o->can_0x02e_DriveControlsHeartbeat.DriveControlMinError = w;
+	o->can_0x02e_DriveControlsHeartbeat_rx = 1;
+	o->can_0x02e_DriveControlsHeartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x02e_DriveControlTritiumError(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x02e_DriveControlsHeartbeat.DriveControlTritiumError);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x02e_DriveControlTritiumError(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x02e_DriveControlsHeartbeat.DriveControlTritiumError = in;
+	return 0;
+}
+
+int decode_can_0x02e_DriveControlMaxError(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x02e_DriveControlsHeartbeat.DriveControlMaxError);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x02e_DriveControlMaxError(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x02e_DriveControlsHeartbeat.DriveControlMaxError = in;
+	return 0;
+}
+
+int decode_can_0x02e_DriveControlMinError(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x02e_DriveControlsHeartbeat.DriveControlMinError);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x02e_DriveControlMinError(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x02e_DriveControlsHeartbeat.DriveControlMinError = in;
+	return 0;
+}
+
+int print_can_0x02e_DriveControlsHeartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "DriveControlTritiumError = (wire: %.0f)\n", (double)(o->can_0x02e_DriveControlsHeartbeat.DriveControlTritiumError)));
+	r = print_helper(r, fprintf(output, "DriveControlMaxError = (wire: %.0f)\n", (double)(o->can_0x02e_DriveControlsHeartbeat.DriveControlMaxError)));
+	r = print_helper(r, fprintf(output, "DriveControlMinError = (wire: %.0f)\n", (double)(o->can_0x02e_DriveControlsHeartbeat.DriveControlMinError)));
+	return r;
+}
+
+static int pack_can_0x030_CANMirrorBootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* CANMirrorBootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x030_CANMirrorBootloaderAddress.CANMirrorBootloaderAddress)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x030_CANMirrorBootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x030_CANMirrorBootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* CANMirrorBootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x030_CANMirrorBootloaderAddress.CANMirrorBootloaderAddress = w;
+	o->can_0x030_CANMirrorBootloaderAddress_rx = 1;
+	o->can_0x030_CANMirrorBootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x030_CANMirrorBootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x030_CANMirrorBootloaderAddress.CANMirrorBootloaderAddress);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x030_CANMirrorBootloaderAddress(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x030_CANMirrorBootloaderAddress.CANMirrorBootloaderAddress = in;
+	return 0;
+}
+
+int print_can_0x030_CANMirrorBootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "CANMirrorBootloaderAddress = (wire: %.0f)\n", (double)(o->can_0x030_CANMirrorBootloaderAddress.CANMirrorBootloaderAddress)));
+	return r;
+}
+
+static int pack_can_0x031_CANMirrorHeatbeart(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* CANMirrorOverflowCounter: start-bit 0, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x031_CANMirrorHeatbeart.CANMirrorOverflowCounter)) & 0xff;
+	lo |= w;
+	/* Timeout: start-bit 8, length 6, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x031_CANMirrorHeatbeart.Timeout)) & 0x3f;
+	lo |= w << 8;
+	/* Mirror_can_error: start-bit 14, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x031_CANMirrorHeatbeart.Mirror_can_error)) & 0x1;
+	lo |= w << 14;
+	/* Mirror_CANa_Status: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x031_CANMirrorHeatbeart.Mirror_CANa_Status)) & 0x1;
+	lo |= w << 15;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x031_CANMirrorHeatbeart_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x031_CANMirrorHeatbeart(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* CANMirrorOverflowCounter: start-bit 0, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xff;
+	o->can_0x031_CANMirrorHeatbeart.CANMirrorOverflowCounter = w;
+	/* Timeout: start-bit 8, length 6, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 8) & 0x3f;
+	o->can_0x031_CANMirrorHeatbeart.Timeout = w;
+	/* Mirror_can_error: start-bit 14, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 14) & 0x1;
+	o->can_0x031_CANMirrorHeatbeart.Mirror_can_error = w;
+	/* Mirror_CANa_Status: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x031_CANMirrorHeatbeart.Mirror_CANa_Status = w;
+	o->can_0x031_CANMirrorHeatbeart_rx = 1;
+	o->can_0x031_CANMirrorHeatbeart_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x031_CANMirrorOverflowCounter(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x031_CANMirrorHeatbeart.CANMirrorOverflowCounter);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x031_CANMirrorOverflowCounter(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x031_CANMirrorHeatbeart.CANMirrorOverflowCounter = in;
+	return 0;
+}
+
+int decode_can_0x031_Timeout(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x031_CANMirrorHeatbeart.Timeout);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x031_Timeout(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x031_CANMirrorHeatbeart.Timeout = in;
+	return 0;
+}
+
+int decode_can_0x031_Mirror_can_error(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x031_CANMirrorHeatbeart.Mirror_can_error);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x031_Mirror_can_error(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x031_CANMirrorHeatbeart.Mirror_can_error = in;
+	return 0;
+}
+
+int decode_can_0x031_Mirror_CANa_Status(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x031_CANMirrorHeatbeart.Mirror_CANa_Status);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x031_Mirror_CANa_Status(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x031_CANMirrorHeatbeart.Mirror_CANa_Status = in;
+	return 0;
+}
+
+int print_can_0x031_CANMirrorHeatbeart(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "CANMirrorOverflowCounter = (wire: %.0f)\n", (double)(o->can_0x031_CANMirrorHeatbeart.CANMirrorOverflowCounter)));
+	r = print_helper(r, fprintf(output, "Timeout = (wire: %.0f)\n", (double)(o->can_0x031_CANMirrorHeatbeart.Timeout)));
+	r = print_helper(r, fprintf(output, "Mirror_can_error = (wire: %.0f)\n", (double)(o->can_0x031_CANMirrorHeatbeart.Mirror_can_error)));
+	r = print_helper(r, fprintf(output, "Mirror_CANa_Status = (wire: %.0f)\n", (double)(o->can_0x031_CANMirrorHeatbeart.Mirror_CANa_Status)));
+	return r;
+}
+
+static int pack_can_0x032_CANMirrorCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* CANMirrorCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x032_CANMirrorCommand.CANMirrorCommandValue)) & 0xffffffff;
+	lo |= w;
+	/* CANMirrorCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x032_CANMirrorCommand.CANMirrorCommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x032_CANMirrorCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x032_CANMirrorCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* CANMirrorCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x032_CANMirrorCommand.CANMirrorCommandValue = w;
+	/* CANMirrorCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x032_CANMirrorCommand.CANMirrorCommandCode = w;
+	o->can_0x032_CANMirrorCommand_rx = 1;
+	o->can_0x032_CANMirrorCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x032_CANMirrorCommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x032_CANMirrorCommand.CANMirrorCommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x032_CANMirrorCommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x032_CANMirrorCommand.CANMirrorCommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x032_CANMirrorCommand.CANMirrorCommandValue = in;
+	return 0;
+}
+
+int decode_can_0x032_CANMirrorCommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x032_CANMirrorCommand.CANMirrorCommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x032_CANMirrorCommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x032_CANMirrorCommand.CANMirrorCommandCode = in;
+	return 0;
+}
+
+int print_can_0x032_CANMirrorCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "CANMirrorCommandValue = (wire: %.0f)\n", (double)(o->can_0x032_CANMirrorCommand.CANMirrorCommandValue)));
+	r = print_helper(r, fprintf(output, "CANMirrorCommandCode = (wire: %.0f)\n", (double)(o->can_0x032_CANMirrorCommand.CANMirrorCommandCode)));
+	return r;
+}
+
+static int pack_can_0x033_RiderDisplayBootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* RiderDisplayBootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x033_RiderDisplayBootloaderAddress.RiderDisplayBootloaderAddress)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x033_RiderDisplayBootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x033_RiderDisplayBootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* RiderDisplayBootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x033_RiderDisplayBootloaderAddress.RiderDisplayBootloaderAddress = w;
+	o->can_0x033_RiderDisplayBootloaderAddress_rx = 1;
+	o->can_0x033_RiderDisplayBootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x033_RiderDisplayBootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x033_RiderDisplayBootloaderAddress.RiderDisplayBootloaderAddress);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x033_RiderDisplayBootloaderAddress(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x033_RiderDisplayBootloaderAddress.RiderDisplayBootloaderAddress = in;
+	return 0;
+}
+
+int print_can_0x033_RiderDisplayBootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "RiderDisplayBootloaderAddress = (wire: %.0f)\n", (double)(o->can_0x033_RiderDisplayBootloaderAddress.RiderDisplayBootloaderAddress)));
+	return r;
+}
+
+static int pack_can_0x034_RiderDisplayHeartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* RiderDisplayFlags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x034_RiderDisplayHeartbeat.RiderDisplayFlags)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x034_RiderDisplayHeartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x034_RiderDisplayHeartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* RiderDisplayFlags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x034_RiderDisplayHeartbeat.RiderDisplayFlags = w;
+	o->can_0x034_RiderDisplayHeartbeat_rx = 1;
+	o->can_0x034_RiderDisplayHeartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x034_RiderDisplayFlags(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x034_RiderDisplayHeartbeat.RiderDisplayFlags);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x034_RiderDisplayFlags(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x034_RiderDisplayHeartbeat.RiderDisplayFlags = in;
+	return 0;
+}
+
+int print_can_0x034_RiderDisplayHeartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "RiderDisplayFlags = (wire: %.0f)\n", (double)(o->can_0x034_RiderDisplayHeartbeat.RiderDisplayFlags)));
+	return r;
+}
+
+static int pack_can_0x035_RiderDisplayCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* RiderDisplayCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x035_RiderDisplayCommand.RiderDisplayCommandValue)) & 0xffffffff;
+	lo |= w;
+	/* RiderDisplayCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x035_RiderDisplayCommand.RiderDisplayCommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x035_RiderDisplayCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x035_RiderDisplayCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* RiderDisplayCommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x035_RiderDisplayCommand.RiderDisplayCommandValue = w;
+	/* RiderDisplayCommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x035_RiderDisplayCommand.RiderDisplayCommandCode = w;
+	o->can_0x035_RiderDisplayCommand_rx = 1;
+	o->can_0x035_RiderDisplayCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x035_RiderDisplayCommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x035_RiderDisplayCommand.RiderDisplayCommandValue);
+	if (rval <= 2.14748e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x035_RiderDisplayCommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x035_RiderDisplayCommand.RiderDisplayCommandValue = 0;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x035_RiderDisplayCommand.RiderDisplayCommandValue = in;
+	return 0;
+}
+
+int decode_can_0x035_RiderDisplayCommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x035_RiderDisplayCommand.RiderDisplayCommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x035_RiderDisplayCommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x035_RiderDisplayCommand.RiderDisplayCommandCode = in;
+	return 0;
+}
+
+int print_can_0x035_RiderDisplayCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "RiderDisplayCommandValue = (wire: %.0f)\n", (double)(o->can_0x035_RiderDisplayCommand.RiderDisplayCommandValue)));
+	r = print_helper(r, fprintf(output, "RiderDisplayCommandCode = (wire: %.0f)\n", (double)(o->can_0x035_RiderDisplayCommand.RiderDisplayCommandCode)));
+	return r;
+}
+
+static int pack_can_0x039_BIM1BootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM1BootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x039_BIM1BootloaderAddress.BIM1BootloaderAddress)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x039_BIM1BootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x039_BIM1BootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM1BootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x039_BIM1BootloaderAddress.BIM1BootloaderAddress = w;
+	o->can_0x039_BIM1BootloaderAddress_rx = 1;
+	o->can_0x039_BIM1BootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x039_BIM1BootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x039_BIM1BootloaderAddress.BIM1BootloaderAddress);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x039_BIM1BootloaderAddress(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x039_BIM1BootloaderAddress.BIM1BootloaderAddress = in;
+	return 0;
+}
+
+int print_can_0x039_BIM1BootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM1BootloaderAddress = (wire: %.0f)\n", (double)(o->can_0x039_BIM1BootloaderAddress.BIM1BootloaderAddress)));
+	return r;
+}
+
+static int pack_can_0x03a_BIM1Heartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM1BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03a_BIM1Heartbeat.BIM1BQ)) & 0x3f;
+	lo |= w << 2;
+	/* BIM1Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03a_BIM1Heartbeat.BIM1Init)) & 0x1;
+	lo |= w;
+	/* BIM1SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03a_BIM1Heartbeat.BIM1SPI)) & 0x1;
+	lo |= w << 1;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x03a_BIM1Heartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x03a_BIM1Heartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM1BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 2) & 0x3f;
+	o->can_0x03a_BIM1Heartbeat.BIM1BQ = w;
+	/* BIM1Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x1;
+	o->can_0x03a_BIM1Heartbeat.BIM1Init = w;
+	/* BIM1SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 1) & 0x1;
+	o->can_0x03a_BIM1Heartbeat.BIM1SPI = w;
+	o->can_0x03a_BIM1Heartbeat_rx = 1;
+	o->can_0x03a_BIM1Heartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x03a_BIM1BQ(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03a_BIM1Heartbeat.BIM1BQ);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03a_BIM1BQ(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03a_BIM1Heartbeat.BIM1BQ = in;
+	return 0;
+}
+
+int decode_can_0x03a_BIM1Init(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03a_BIM1Heartbeat.BIM1Init);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03a_BIM1Init(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03a_BIM1Heartbeat.BIM1Init = in;
+	return 0;
+}
+
+int decode_can_0x03a_BIM1SPI(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03a_BIM1Heartbeat.BIM1SPI);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03a_BIM1SPI(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03a_BIM1Heartbeat.BIM1SPI = in;
+	return 0;
+}
+
+int print_can_0x03a_BIM1Heartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM1BQ = (wire: %.0f)\n", (double)(o->can_0x03a_BIM1Heartbeat.BIM1BQ)));
+	r = print_helper(r, fprintf(output, "BIM1Init = (wire: %.0f)\n", (double)(o->can_0x03a_BIM1Heartbeat.BIM1Init)));
+	r = print_helper(r, fprintf(output, "BIM1SPI = (wire: %.0f)\n", (double)(o->can_0x03a_BIM1Heartbeat.BIM1SPI)));
+	return r;
+}
+
+static int pack_can_0x03b_BIM2BootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM2BootloaderAddres: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x03b_BIM2BootloaderAddress.BIM2BootloaderAddres)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x03b_BIM2BootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x03b_BIM2BootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM2BootloaderAddres: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x03b_BIM2BootloaderAddress.BIM2BootloaderAddres = w;
+	o->can_0x03b_BIM2BootloaderAddress_rx = 1;
+	o->can_0x03b_BIM2BootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x03b_BIM2BootloaderAddres(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x03b_BIM2BootloaderAddress.BIM2BootloaderAddres);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03b_BIM2BootloaderAddres(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x03b_BIM2BootloaderAddress.BIM2BootloaderAddres = in;
+	return 0;
+}
+
+int print_can_0x03b_BIM2BootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM2BootloaderAddres = (wire: %.0f)\n", (double)(o->can_0x03b_BIM2BootloaderAddress.BIM2BootloaderAddres)));
+	return r;
+}
+
+static int pack_can_0x03c_BIM2Heartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM2BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03c_BIM2Heartbeat.BIM2BQ)) & 0x3f;
+	lo |= w << 2;
+	/* BIM2Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03c_BIM2Heartbeat.BIM2Init)) & 0x1;
+	lo |= w;
+	/* BIM2SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03c_BIM2Heartbeat.BIM2SPI)) & 0x1;
+	lo |= w << 1;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x03c_BIM2Heartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x03c_BIM2Heartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM2BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 2) & 0x3f;
+	o->can_0x03c_BIM2Heartbeat.BIM2BQ = w;
+	/* BIM2Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x1;
+	o->can_0x03c_BIM2Heartbeat.BIM2Init = w;
+	/* BIM2SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 1) & 0x1;
+	o->can_0x03c_BIM2Heartbeat.BIM2SPI = w;
+	o->can_0x03c_BIM2Heartbeat_rx = 1;
+	o->can_0x03c_BIM2Heartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x03c_BIM2BQ(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03c_BIM2Heartbeat.BIM2BQ);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03c_BIM2BQ(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03c_BIM2Heartbeat.BIM2BQ = in;
+	return 0;
+}
+
+int decode_can_0x03c_BIM2Init(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03c_BIM2Heartbeat.BIM2Init);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03c_BIM2Init(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03c_BIM2Heartbeat.BIM2Init = in;
+	return 0;
+}
+
+int decode_can_0x03c_BIM2SPI(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03c_BIM2Heartbeat.BIM2SPI);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03c_BIM2SPI(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03c_BIM2Heartbeat.BIM2SPI = in;
+	return 0;
+}
+
+int print_can_0x03c_BIM2Heartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM2BQ = (wire: %.0f)\n", (double)(o->can_0x03c_BIM2Heartbeat.BIM2BQ)));
+	r = print_helper(r, fprintf(output, "BIM2Init = (wire: %.0f)\n", (double)(o->can_0x03c_BIM2Heartbeat.BIM2Init)));
+	r = print_helper(r, fprintf(output, "BIM2SPI = (wire: %.0f)\n", (double)(o->can_0x03c_BIM2Heartbeat.BIM2SPI)));
+	return r;
+}
+
+static int pack_can_0x03d_BIM3BootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM3BootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x03d_BIM3BootloaderAddress.BIM3BootloaderAddress)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x03d_BIM3BootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x03d_BIM3BootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM3BootloaderAddress: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x03d_BIM3BootloaderAddress.BIM3BootloaderAddress = w;
+	o->can_0x03d_BIM3BootloaderAddress_rx = 1;
+	o->can_0x03d_BIM3BootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x03d_BIM3BootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x03d_BIM3BootloaderAddress.BIM3BootloaderAddress);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03d_BIM3BootloaderAddress(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x03d_BIM3BootloaderAddress.BIM3BootloaderAddress = in;
+	return 0;
+}
+
+int print_can_0x03d_BIM3BootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM3BootloaderAddress = (wire: %.0f)\n", (double)(o->can_0x03d_BIM3BootloaderAddress.BIM3BootloaderAddress)));
+	return r;
+}
+
+static int pack_can_0x03e_BIM3Heartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM3BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03e_BIM3Heartbeat.BIM3BQ)) & 0x3f;
+	lo |= w << 2;
+	/* BIM3Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03e_BIM3Heartbeat.BIM3Init)) & 0x1;
+	lo |= w;
+	/* BIM3SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x03e_BIM3Heartbeat.BIM3SPI)) & 0x1;
+	lo |= w << 1;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x03e_BIM3Heartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x03e_BIM3Heartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM3BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 2) & 0x3f;
+	o->can_0x03e_BIM3Heartbeat.BIM3BQ = w;
+	/* BIM3Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x1;
+	o->can_0x03e_BIM3Heartbeat.BIM3Init = w;
+	/* BIM3SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 1) & 0x1;
+	o->can_0x03e_BIM3Heartbeat.BIM3SPI = w;
+	o->can_0x03e_BIM3Heartbeat_rx = 1;
+	o->can_0x03e_BIM3Heartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x03e_BIM3BQ(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03e_BIM3Heartbeat.BIM3BQ);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03e_BIM3BQ(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03e_BIM3Heartbeat.BIM3BQ = in;
+	return 0;
+}
+
+int decode_can_0x03e_BIM3Init(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03e_BIM3Heartbeat.BIM3Init);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03e_BIM3Init(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03e_BIM3Heartbeat.BIM3Init = in;
+	return 0;
+}
+
+int decode_can_0x03e_BIM3SPI(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x03e_BIM3Heartbeat.BIM3SPI);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03e_BIM3SPI(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x03e_BIM3Heartbeat.BIM3SPI = in;
+	return 0;
+}
+
+int print_can_0x03e_BIM3Heartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM3BQ = (wire: %.0f)\n", (double)(o->can_0x03e_BIM3Heartbeat.BIM3BQ)));
+	r = print_helper(r, fprintf(output, "BIM3Init = (wire: %.0f)\n", (double)(o->can_0x03e_BIM3Heartbeat.BIM3Init)));
+	r = print_helper(r, fprintf(output, "BIM3SPI = (wire: %.0f)\n", (double)(o->can_0x03e_BIM3Heartbeat.BIM3SPI)));
+	return r;
+}
+
+static int pack_can_0x03f_BIM4BootloaderAddress(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM4BootloaderAddres: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x03f_BIM4BootloaderAddress.BIM4BootloaderAddres)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x03f_BIM4BootloaderAddress_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x03f_BIM4BootloaderAddress(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM4BootloaderAddres: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x03f_BIM4BootloaderAddress.BIM4BootloaderAddres = w;
+	o->can_0x03f_BIM4BootloaderAddress_rx = 1;
+	o->can_0x03f_BIM4BootloaderAddress_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x03f_BIM4BootloaderAddres(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x03f_BIM4BootloaderAddress.BIM4BootloaderAddres);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x03f_BIM4BootloaderAddres(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x03f_BIM4BootloaderAddress.BIM4BootloaderAddres = in;
+	return 0;
+}
+
+int print_can_0x03f_BIM4BootloaderAddress(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM4BootloaderAddres = (wire: %.0f)\n", (double)(o->can_0x03f_BIM4BootloaderAddress.BIM4BootloaderAddres)));
+	return r;
+}
+
+static int pack_can_0x040_BIM4Heartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM4BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x040_BIM4Heartbeat.BIM4BQ)) & 0x3f;
+	lo |= w << 2;
+	/* BIM4Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x040_BIM4Heartbeat.BIM4Init)) & 0x1;
+	lo |= w;
+	/* BIM4SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x040_BIM4Heartbeat.BIM4SPI)) & 0x1;
+	lo |= w << 1;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x040_BIM4Heartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x040_BIM4Heartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* BIM4BQ: start-bit 2, length 6, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 2) & 0x3f;
+	o->can_0x040_BIM4Heartbeat.BIM4BQ = w;
+	/* BIM4Init: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x1;
+	o->can_0x040_BIM4Heartbeat.BIM4Init = w;
+	/* BIM4SPI: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 1) & 0x1;
+	o->can_0x040_BIM4Heartbeat.BIM4SPI = w;
+	o->can_0x040_BIM4Heartbeat_rx = 1;
+	o->can_0x040_BIM4Heartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x040_BIM4BQ(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x040_BIM4Heartbeat.BIM4BQ);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x040_BIM4BQ(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x040_BIM4Heartbeat.BIM4BQ = in;
+	return 0;
+}
+
+int decode_can_0x040_BIM4Init(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x040_BIM4Heartbeat.BIM4Init);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x040_BIM4Init(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x040_BIM4Heartbeat.BIM4Init = in;
+	return 0;
+}
+
+int decode_can_0x040_BIM4SPI(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x040_BIM4Heartbeat.BIM4SPI);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x040_BIM4SPI(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x040_BIM4Heartbeat.BIM4SPI = in;
+	return 0;
+}
+
+int print_can_0x040_BIM4Heartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM4BQ = (wire: %.0f)\n", (double)(o->can_0x040_BIM4Heartbeat.BIM4BQ)));
+	r = print_helper(r, fprintf(output, "BIM4Init = (wire: %.0f)\n", (double)(o->can_0x040_BIM4Heartbeat.BIM4Init)));
+	r = print_helper(r, fprintf(output, "BIM4SPI = (wire: %.0f)\n", (double)(o->can_0x040_BIM4Heartbeat.BIM4SPI)));
+	return r;
+}
+
+static int pack_can_0x0a0_MagicCanNode1RCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicCanNode1CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* MagicCanNode1CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0a0_MagicCanNode1RCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0a0_MagicCanNode1RCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MagicCanNode1CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandValue = w;
+	/* MagicCanNode1CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandCode = w;
+	o->can_0x0a0_MagicCanNode1RCommand_rx = 1;
+	o->can_0x0a0_MagicCanNode1RCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0a0_MagicCanNode1CommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x0a0_MagicCanNode1CommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0a0_MagicCanNode1CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0a0_MagicCanNode1CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0a0_MagicCanNode1RCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicCanNode1CommandValue = (wire: %.0f)\n", (double)(o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandValue)));
+	r = print_helper(r, fprintf(output, "MagicCanNode1CommandCode = (wire: %.0f)\n", (double)(o->can_0x0a0_MagicCanNode1RCommand.MagicCanNode1CommandCode)));
+	return r;
+}
+
+static int pack_can_0x0a1_MagicCanNode2MCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicCanNode2CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* MagicCanNode2CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0a1_MagicCanNode2MCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0a1_MagicCanNode2MCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MagicCanNode2CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandValue = w;
+	/* MagicCanNode2CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandCode = w;
+	o->can_0x0a1_MagicCanNode2MCommand_rx = 1;
+	o->can_0x0a1_MagicCanNode2MCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0a1_MagicCanNode2CommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x0a1_MagicCanNode2CommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0a1_MagicCanNode2CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0a1_MagicCanNode2CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0a1_MagicCanNode2MCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicCanNode2CommandValue = (wire: %.0f)\n", (double)(o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandValue)));
+	r = print_helper(r, fprintf(output, "MagicCanNode2CommandCode = (wire: %.0f)\n", (double)(o->can_0x0a1_MagicCanNode2MCommand.MagicCanNode2CommandCode)));
+	return r;
+}
+
+static int pack_can_0x0a2_MagicCanNode3FCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicCanNode3CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* MagicCanNode3CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0a2_MagicCanNode3FCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0a2_MagicCanNode3FCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MagicCanNode3CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandValue = w;
+	/* MagicCanNode3CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandCode = w;
+	o->can_0x0a2_MagicCanNode3FCommand_rx = 1;
+	o->can_0x0a2_MagicCanNode3FCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0a2_MagicCanNode3CommandValue(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandValue);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0a2_MagicCanNode3CommandValue(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0a2_MagicCanNode3CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0a2_MagicCanNode3CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0a2_MagicCanNode3FCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicCanNode3CommandValue = (wire: %.0f)\n", (double)(o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandValue)));
+	r = print_helper(r, fprintf(output, "MagicCanNode3CommandCode = (wire: %.0f)\n", (double)(o->can_0x0a2_MagicCanNode3FCommand.MagicCanNode3CommandCode)));
+	return r;
+}
+
+static int pack_can_0x0aa_CANcorderHeartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* CANcorderHeartbeat: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x0aa_CANcorderHeartbeat.CANcorderHeartbeat)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0aa_CANcorderHeartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0x0aa_CANcorderHeartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* CANcorderHeartbeat: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x0aa_CANcorderHeartbeat.CANcorderHeartbeat = w;
+	o->can_0x0aa_CANcorderHeartbeat_rx = 1;
+	o->can_0x0aa_CANcorderHeartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0x0aa_CANcorderHeartbeat(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x0aa_CANcorderHeartbeat.CANcorderHeartbeat);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0aa_CANcorderHeartbeat(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x0aa_CANcorderHeartbeat.CANcorderHeartbeat = in;
+	return 0;
+}
+
+int print_can_0x0aa_CANcorderHeartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "CANcorderHeartbeat = (wire: %.0f)\n", (double)(o->can_0x0aa_CANcorderHeartbeat.CANcorderHeartbeat)));
+	return r;
+}
+
+static int pack_can_0x0b0_BIM1Command(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM1CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b0_BIM1Command.BIM1CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* BIM1CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b0_BIM1Command.BIM1CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0b0_BIM1Command_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0b0_BIM1Command(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BIM1CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0b0_BIM1Command.BIM1CommandValue = w;
+	/* BIM1CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0b0_BIM1Command.BIM1CommandCode = w;
+	o->can_0x0b0_BIM1Command_rx = 1;
+	o->can_0x0b0_BIM1Command_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0b0_BIM1CommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x0b0_BIM1Command.BIM1CommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x0b0_BIM1CommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x0b0_BIM1Command.BIM1CommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x0b0_BIM1Command.BIM1CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0b0_BIM1CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0b0_BIM1Command.BIM1CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0b0_BIM1CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0b0_BIM1Command.BIM1CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0b0_BIM1Command(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM1CommandValue = (wire: %.0f)\n", (double)(o->can_0x0b0_BIM1Command.BIM1CommandValue)));
+	r = print_helper(r, fprintf(output, "BIM1CommandCode = (wire: %.0f)\n", (double)(o->can_0x0b0_BIM1Command.BIM1CommandCode)));
+	return r;
+}
+
+static int pack_can_0x0b1_BIM2Command(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM2CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b1_BIM2Command.BIM2CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* BIM2CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b1_BIM2Command.BIM2CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0b1_BIM2Command_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0b1_BIM2Command(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BIM2CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0b1_BIM2Command.BIM2CommandValue = w;
+	/* BIM2CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0b1_BIM2Command.BIM2CommandCode = w;
+	o->can_0x0b1_BIM2Command_rx = 1;
+	o->can_0x0b1_BIM2Command_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0b1_BIM2CommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x0b1_BIM2Command.BIM2CommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x0b1_BIM2CommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x0b1_BIM2Command.BIM2CommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x0b1_BIM2Command.BIM2CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0b1_BIM2CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0b1_BIM2Command.BIM2CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0b1_BIM2CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0b1_BIM2Command.BIM2CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0b1_BIM2Command(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM2CommandValue = (wire: %.0f)\n", (double)(o->can_0x0b1_BIM2Command.BIM2CommandValue)));
+	r = print_helper(r, fprintf(output, "BIM2CommandCode = (wire: %.0f)\n", (double)(o->can_0x0b1_BIM2Command.BIM2CommandCode)));
+	return r;
+}
+
+static int pack_can_0x0b2_BIM3Command(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM3CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b2_BIM3Command.BIM3CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* BIM3CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b2_BIM3Command.BIM3CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0b2_BIM3Command_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0b2_BIM3Command(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BIM3CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0b2_BIM3Command.BIM3CommandValue = w;
+	/* BIM3CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0b2_BIM3Command.BIM3CommandCode = w;
+	o->can_0x0b2_BIM3Command_rx = 1;
+	o->can_0x0b2_BIM3Command_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0b2_BIM3CommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x0b2_BIM3Command.BIM3CommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x0b2_BIM3CommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x0b2_BIM3Command.BIM3CommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x0b2_BIM3Command.BIM3CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0b2_BIM3CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0b2_BIM3Command.BIM3CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0b2_BIM3CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0b2_BIM3Command.BIM3CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0b2_BIM3Command(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM3CommandValue = (wire: %.0f)\n", (double)(o->can_0x0b2_BIM3Command.BIM3CommandValue)));
+	r = print_helper(r, fprintf(output, "BIM3CommandCode = (wire: %.0f)\n", (double)(o->can_0x0b2_BIM3Command.BIM3CommandCode)));
+	return r;
+}
+
+static int pack_can_0x0b3_BIM4Command(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM4CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b3_BIM4Command.BIM4CommandValue)) & 0xffffffff;
+	lo |= w;
+	/* BIM4CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x0b3_BIM4Command.BIM4CommandCode)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x0b3_BIM4Command_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x0b3_BIM4Command(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BIM4CommandValue: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x0b3_BIM4Command.BIM4CommandValue = w;
+	/* BIM4CommandCode: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x0b3_BIM4Command.BIM4CommandCode = w;
+	o->can_0x0b3_BIM4Command_rx = 1;
+	o->can_0x0b3_BIM4Command_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x0b3_BIM4CommandValue(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x0b3_BIM4Command.BIM4CommandValue);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int32_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x0b3_BIM4CommandValue(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x0b3_BIM4Command.BIM4CommandValue = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x0b3_BIM4Command.BIM4CommandValue = in;
+	return 0;
+}
+
+int decode_can_0x0b3_BIM4CommandCode(const can_obj_ex1_h_t *o, uint32_t *out) {
+	uint32_t rval = (uint32_t)(o->can_0x0b3_BIM4Command.BIM4CommandCode);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x0b3_BIM4CommandCode(can_obj_ex1_h_t *o, uint32_t in) {
+	o->can_0x0b3_BIM4Command.BIM4CommandCode = in;
+	return 0;
+}
+
+int print_can_0x0b3_BIM4Command(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM4CommandValue = (wire: %.0f)\n", (double)(o->can_0x0b3_BIM4Command.BIM4CommandValue)));
+	r = print_helper(r, fprintf(output, "BIM4CommandCode = (wire: %.0f)\n", (double)(o->can_0x0b3_BIM4Command.BIM4CommandCode)));
+	return r;
+}
+
+static int pack_can_0x100_FrameFaultDetectionStatus(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* EstimatedPackFrameResistance: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x100_FrameFaultDetectionStatus.EstimatedPackFrameResistance) & 0xffffffff;
+	lo |= w;
+	/* FaultStatus: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x100_FrameFaultDetectionStatus.FaultStatus)) & 0xffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x100_FrameFaultDetectionStatus_tx = 1;
+	return 6;
+}
+
+static int unpack_can_0x100_FrameFaultDetectionStatus(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 6)
+		return -1;
+	/* EstimatedPackFrameResistance: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x100_FrameFaultDetectionStatus.EstimatedPackFrameResistance = unpack754_32(w);
+	/* FaultStatus: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x100_FrameFaultDetectionStatus.FaultStatus = w;
+	o->can_0x100_FrameFaultDetectionStatus_rx = 1;
+	o->can_0x100_FrameFaultDetectionStatus_time_stamp_rx = time_stamp;
+	return 6;
+}
+
+int decode_can_0x100_EstimatedPackFrameResistance(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x100_FrameFaultDetectionStatus.EstimatedPackFrameResistance);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x100_EstimatedPackFrameResistance(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x100_FrameFaultDetectionStatus.EstimatedPackFrameResistance = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x100_FrameFaultDetectionStatus.EstimatedPackFrameResistance = in;
+	return 0;
+}
+
+int decode_can_0x100_FaultStatus(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x100_FrameFaultDetectionStatus.FaultStatus);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x100_FaultStatus(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x100_FrameFaultDetectionStatus.FaultStatus = in;
+	return 0;
+}
+
+int print_can_0x100_FrameFaultDetectionStatus(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "EstimatedPackFrameResistance = (wire: %g)\n", (double)(o->can_0x100_FrameFaultDetectionStatus.EstimatedPackFrameResistance)));
+	r = print_helper(r, fprintf(output, "FaultStatus = (wire: %.0f)\n", (double)(o->can_0x100_FrameFaultDetectionStatus.FaultStatus)));
+	return r;
+}
+
+static int pack_can_0x101_FrontBrakePressure(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* FrontBrakePressure: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x101_FrontBrakePressure.FrontBrakePressure) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x101_FrontBrakePressure_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x101_FrontBrakePressure(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* FrontBrakePressure: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x101_FrontBrakePressure.FrontBrakePressure = unpack754_32(w);
+	o->can_0x101_FrontBrakePressure_rx = 1;
+	o->can_0x101_FrontBrakePressure_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x101_FrontBrakePressure(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x101_FrontBrakePressure.FrontBrakePressure);
+	if ((rval >= -2.14748e+09) && (rval <= 2.14748e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x101_FrontBrakePressure(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x101_FrontBrakePressure.FrontBrakePressure = 0;
+	if (in < -2.14748e+09)
+		return -1;
+	if (in > 2.14748e+09)
+		return -1;
+	o->can_0x101_FrontBrakePressure.FrontBrakePressure = in;
+	return 0;
+}
+
+int print_can_0x101_FrontBrakePressure(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "FrontBrakePressure = (wire: %g)\n", (double)(o->can_0x101_FrontBrakePressure.FrontBrakePressure)));
+	return r;
+}
+
+static int pack_can_0x102_RearBrakePressure(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* RearBrakePressure: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x102_RearBrakePressure.RearBrakePressure) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x102_RearBrakePressure_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x102_RearBrakePressure(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* RearBrakePressure: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x102_RearBrakePressure.RearBrakePressure = unpack754_32(w);
+	o->can_0x102_RearBrakePressure_rx = 1;
+	o->can_0x102_RearBrakePressure_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x102_RearBrakePressure(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x102_RearBrakePressure.RearBrakePressure);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x102_RearBrakePressure(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x102_RearBrakePressure.RearBrakePressure = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x102_RearBrakePressure.RearBrakePressure = in;
+	return 0;
+}
+
+int print_can_0x102_RearBrakePressure(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "RearBrakePressure = (wire: %g)\n", (double)(o->can_0x102_RearBrakePressure.RearBrakePressure)));
+	return r;
+}
+
+static int pack_can_0x103_FrontSuspensionTravel(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* FrontSuspensionPosition: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x103_FrontSuspensionTravel.FrontSuspensionPosition) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x103_FrontSuspensionTravel_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x103_FrontSuspensionTravel(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* FrontSuspensionPosition: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x103_FrontSuspensionTravel.FrontSuspensionPosition = unpack754_32(w);
+	o->can_0x103_FrontSuspensionTravel_rx = 1;
+	o->can_0x103_FrontSuspensionTravel_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x103_FrontSuspensionPosition(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x103_FrontSuspensionTravel.FrontSuspensionPosition);
+	if ((rval >= -1) && (rval <= 1)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x103_FrontSuspensionPosition(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x103_FrontSuspensionTravel.FrontSuspensionPosition = 0;
+	if (in < -1)
+		return -1;
+	if (in > 1)
+		return -1;
+	o->can_0x103_FrontSuspensionTravel.FrontSuspensionPosition = in;
+	return 0;
+}
+
+int print_can_0x103_FrontSuspensionTravel(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "FrontSuspensionPosition = (wire: %g)\n", (double)(o->can_0x103_FrontSuspensionTravel.FrontSuspensionPosition)));
+	return r;
+}
+
+static int pack_can_0x104_RearSuspensionTravel(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* RearSuspensionPosition: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x104_RearSuspensionTravel.RearSuspensionPosition) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x104_RearSuspensionTravel_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x104_RearSuspensionTravel(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* RearSuspensionPosition: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x104_RearSuspensionTravel.RearSuspensionPosition = unpack754_32(w);
+	o->can_0x104_RearSuspensionTravel_rx = 1;
+	o->can_0x104_RearSuspensionTravel_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x104_RearSuspensionPosition(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x104_RearSuspensionTravel.RearSuspensionPosition);
+	if ((rval >= -1) && (rval <= 1)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x104_RearSuspensionPosition(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x104_RearSuspensionTravel.RearSuspensionPosition = 0;
+	if (in < -1)
+		return -1;
+	if (in > 1)
+		return -1;
+	o->can_0x104_RearSuspensionTravel.RearSuspensionPosition = in;
+	return 0;
+}
+
+int print_can_0x104_RearSuspensionTravel(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "RearSuspensionPosition = (wire: %g)\n", (double)(o->can_0x104_RearSuspensionTravel.RearSuspensionPosition)));
+	return r;
+}
+
+static int pack_can_0x106_BusVoltage12V(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BusVoltage12V: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x106_BusVoltage12V.BusVoltage12V) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x106_BusVoltage12V_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x106_BusVoltage12V(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* BusVoltage12V: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x106_BusVoltage12V.BusVoltage12V = unpack754_32(w);
+	o->can_0x106_BusVoltage12V_rx = 1;
+	o->can_0x106_BusVoltage12V_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x106_BusVoltage12V(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x106_BusVoltage12V.BusVoltage12V);
+	if ((rval >= -10) && (rval <= 20)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x106_BusVoltage12V(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x106_BusVoltage12V.BusVoltage12V = 0;
+	if (in < -10)
+		return -1;
+	if (in > 20)
+		return -1;
+	o->can_0x106_BusVoltage12V.BusVoltage12V = in;
+	return 0;
+}
+
+int print_can_0x106_BusVoltage12V(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BusVoltage12V = (wire: %g)\n", (double)(o->can_0x106_BusVoltage12V.BusVoltage12V)));
+	return r;
+}
+
+static int pack_can_0x107_PostMotorCoolantTemp(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* PostMotorCoolantTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x107_PostMotorCoolantTemp.PostMotorCoolantTemp) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x107_PostMotorCoolantTemp_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x107_PostMotorCoolantTemp(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* PostMotorCoolantTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x107_PostMotorCoolantTemp.PostMotorCoolantTemp = unpack754_32(w);
+	o->can_0x107_PostMotorCoolantTemp_rx = 1;
+	o->can_0x107_PostMotorCoolantTemp_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x107_PostMotorCoolantTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x107_PostMotorCoolantTemp.PostMotorCoolantTemp);
+	if ((rval >= -10) && (rval <= 100)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x107_PostMotorCoolantTemp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x107_PostMotorCoolantTemp.PostMotorCoolantTemp = 0;
+	if (in < -10)
+		return -1;
+	if (in > 100)
+		return -1;
+	o->can_0x107_PostMotorCoolantTemp.PostMotorCoolantTemp = in;
+	return 0;
+}
+
+int print_can_0x107_PostMotorCoolantTemp(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "PostMotorCoolantTemp = (wire: %g)\n", (double)(o->can_0x107_PostMotorCoolantTemp.PostMotorCoolantTemp)));
+	return r;
+}
+
+static int pack_can_0x108_PostControllerCoolantTemp(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* PostControllerCoolantTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x108_PostControllerCoolantTemp.PostControllerCoolantTemp) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x108_PostControllerCoolantTemp_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x108_PostControllerCoolantTemp(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* PostControllerCoolantTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x108_PostControllerCoolantTemp.PostControllerCoolantTemp = unpack754_32(w);
+	o->can_0x108_PostControllerCoolantTemp_rx = 1;
+	o->can_0x108_PostControllerCoolantTemp_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x108_PostControllerCoolantTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x108_PostControllerCoolantTemp.PostControllerCoolantTemp);
+	if ((rval >= -10) && (rval <= 100)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x108_PostControllerCoolantTemp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x108_PostControllerCoolantTemp.PostControllerCoolantTemp = 0;
+	if (in < -10)
+		return -1;
+	if (in > 100)
+		return -1;
+	o->can_0x108_PostControllerCoolantTemp.PostControllerCoolantTemp = in;
+	return 0;
+}
+
+int print_can_0x108_PostControllerCoolantTemp(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "PostControllerCoolantTemp = (wire: %g)\n", (double)(o->can_0x108_PostControllerCoolantTemp.PostControllerCoolantTemp)));
+	return r;
+}
+
+static int pack_can_0x109_RadiatorCoolSideCoolantTemp(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* RadiatorCoolSideCoolantTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x109_RadiatorCoolSideCoolantTemp.RadiatorCoolSideCoolantTemp) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x109_RadiatorCoolSideCoolantTemp_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x109_RadiatorCoolSideCoolantTemp(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* RadiatorCoolSideCoolantTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x109_RadiatorCoolSideCoolantTemp.RadiatorCoolSideCoolantTemp = unpack754_32(w);
+	o->can_0x109_RadiatorCoolSideCoolantTemp_rx = 1;
+	o->can_0x109_RadiatorCoolSideCoolantTemp_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x109_RadiatorCoolSideCoolantTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x109_RadiatorCoolSideCoolantTemp.RadiatorCoolSideCoolantTemp);
+	if ((rval >= -10) && (rval <= 100)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x109_RadiatorCoolSideCoolantTemp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x109_RadiatorCoolSideCoolantTemp.RadiatorCoolSideCoolantTemp = 0;
+	if (in < -10)
+		return -1;
+	if (in > 100)
+		return -1;
+	o->can_0x109_RadiatorCoolSideCoolantTemp.RadiatorCoolSideCoolantTemp = in;
+	return 0;
+}
+
+int print_can_0x109_RadiatorCoolSideCoolantTemp(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "RadiatorCoolSideCoolantTemp = (wire: %g)\n", (double)(o->can_0x109_RadiatorCoolSideCoolantTemp.RadiatorCoolSideCoolantTemp)));
+	return r;
+}
+
+static int pack_can_0x10a_AmbientTemp(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* AmbientTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x10a_AmbientTemp.AmbientTemp) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x10a_AmbientTemp_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x10a_AmbientTemp(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* AmbientTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x10a_AmbientTemp.AmbientTemp = unpack754_32(w);
+	o->can_0x10a_AmbientTemp_rx = 1;
+	o->can_0x10a_AmbientTemp_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x10a_AmbientTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x10a_AmbientTemp.AmbientTemp);
+	if ((rval >= -50) && (rval <= 150)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x10a_AmbientTemp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x10a_AmbientTemp.AmbientTemp = 0;
+	if (in < -50)
+		return -1;
+	if (in > 150)
+		return -1;
+	o->can_0x10a_AmbientTemp.AmbientTemp = in;
+	return 0;
+}
+
+int print_can_0x10a_AmbientTemp(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "AmbientTemp = (wire: %g)\n", (double)(o->can_0x10a_AmbientTemp.AmbientTemp)));
+	return r;
+}
+
+static int pack_can_0x10b_GPSLatAndValidityStatus(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* GPSLatitude: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x10b_GPSLatAndValidityStatus.GPSLatitude) & 0xffffffff;
+	lo |= w;
+	/* GPSValidityStatus: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x10b_GPSLatAndValidityStatus.GPSValidityStatus)) & 0xff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x10b_GPSLatAndValidityStatus_tx = 1;
+	return 5;
+}
+
+static int unpack_can_0x10b_GPSLatAndValidityStatus(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 5)
+		return -1;
+	/* GPSLatitude: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x10b_GPSLatAndValidityStatus.GPSLatitude = unpack754_32(w);
+	/* GPSValidityStatus: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xff;
+	o->can_0x10b_GPSLatAndValidityStatus.GPSValidityStatus = w;
+	o->can_0x10b_GPSLatAndValidityStatus_rx = 1;
+	o->can_0x10b_GPSLatAndValidityStatus_time_stamp_rx = time_stamp;
+	return 5;
+}
+
+int decode_can_0x10b_GPSLatitude(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x10b_GPSLatAndValidityStatus.GPSLatitude);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x10b_GPSLatitude(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x10b_GPSLatAndValidityStatus.GPSLatitude = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x10b_GPSLatAndValidityStatus.GPSLatitude = in;
+	return 0;
+}
+
+int decode_can_0x10b_GPSValidityStatus(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x10b_GPSLatAndValidityStatus.GPSValidityStatus);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10b_GPSValidityStatus(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x10b_GPSLatAndValidityStatus.GPSValidityStatus = in;
+	return 0;
+}
+
+int print_can_0x10b_GPSLatAndValidityStatus(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "GPSLatitude = (wire: %g)\n", (double)(o->can_0x10b_GPSLatAndValidityStatus.GPSLatitude)));
+	r = print_helper(r, fprintf(output, "GPSValidityStatus = (wire: %.0f)\n", (double)(o->can_0x10b_GPSLatAndValidityStatus.GPSValidityStatus)));
+	return r;
+}
+
+static int pack_can_0x10c_GPSLongitude(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* GPSLongitude: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x10c_GPSLongitude.GPSLongitude) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x10c_GPSLongitude_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x10c_GPSLongitude(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* GPSLongitude: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x10c_GPSLongitude.GPSLongitude = unpack754_32(w);
+	o->can_0x10c_GPSLongitude_rx = 1;
+	o->can_0x10c_GPSLongitude_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x10c_GPSLongitude(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x10c_GPSLongitude.GPSLongitude);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x10c_GPSLongitude(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x10c_GPSLongitude.GPSLongitude = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x10c_GPSLongitude.GPSLongitude = in;
+	return 0;
+}
+
+int print_can_0x10c_GPSLongitude(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "GPSLongitude = (wire: %g)\n", (double)(o->can_0x10c_GPSLongitude.GPSLongitude)));
+	return r;
+}
+
+static int pack_can_0x10d_GPSAltitudeAndAccuracy(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* GPSAltitude: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x10d_GPSAltitudeAndAccuracy.GPSAltitude) & 0xffffffff;
+	lo |= w;
+	/* PositionDOP: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x10d_GPSAltitudeAndAccuracy.PositionDOP) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x10d_GPSAltitudeAndAccuracy_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x10d_GPSAltitudeAndAccuracy(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* GPSAltitude: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x10d_GPSAltitudeAndAccuracy.GPSAltitude = unpack754_32(w);
+	/* PositionDOP: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x10d_GPSAltitudeAndAccuracy.PositionDOP = unpack754_32(w);
+	o->can_0x10d_GPSAltitudeAndAccuracy_rx = 1;
+	o->can_0x10d_GPSAltitudeAndAccuracy_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x10d_GPSAltitude(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x10d_GPSAltitudeAndAccuracy.GPSAltitude);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x10d_GPSAltitude(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x10d_GPSAltitudeAndAccuracy.GPSAltitude = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x10d_GPSAltitudeAndAccuracy.GPSAltitude = in;
+	return 0;
+}
+
+int decode_can_0x10d_PositionDOP(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x10d_GPSAltitudeAndAccuracy.PositionDOP);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x10d_PositionDOP(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x10d_GPSAltitudeAndAccuracy.PositionDOP = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x10d_GPSAltitudeAndAccuracy.PositionDOP = in;
+	return 0;
+}
+
+int print_can_0x10d_GPSAltitudeAndAccuracy(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "GPSAltitude = (wire: %g)\n", (double)(o->can_0x10d_GPSAltitudeAndAccuracy.GPSAltitude)));
+	r = print_helper(r, fprintf(output, "PositionDOP = (wire: %g)\n", (double)(o->can_0x10d_GPSAltitudeAndAccuracy.PositionDOP)));
+	return r;
+}
+
+static int pack_can_0x10e_CurrentTime(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Years: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x10e_CurrentTime.Years)) & 0xffff;
+	lo |= w;
+	/* Month: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x10e_CurrentTime.Month)) & 0xff;
+	lo |= w << 16;
+	/* Day: start-bit 24, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x10e_CurrentTime.Day)) & 0xff;
+	lo |= w << 24;
+	/* Hours: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x10e_CurrentTime.Hours)) & 0xff;
+	hi |= w;
+	/* Minutes: start-bit 40, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x10e_CurrentTime.Minutes)) & 0xff;
+	hi |= w << 8;
+	/* Seconds: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x10e_CurrentTime.Seconds)) & 0xff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x10e_CurrentTime_tx = 1;
+	return 7;
+}
+
+static int unpack_can_0x10e_CurrentTime(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 7)
+		return -1;
+	/* Years: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x10e_CurrentTime.Years = w;
+	/* Month: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xff;
+	o->can_0x10e_CurrentTime.Month = w;
+	/* Day: start-bit 24, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 24) & 0xff;
+	o->can_0x10e_CurrentTime.Day = w;
+	/* Hours: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xff;
+	o->can_0x10e_CurrentTime.Hours = w;
+	/* Minutes: start-bit 40, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 8) & 0xff;
+	o->can_0x10e_CurrentTime.Minutes = w;
+	/* Seconds: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xff;
+	o->can_0x10e_CurrentTime.Seconds = w;
+	o->can_0x10e_CurrentTime_rx = 1;
+	o->can_0x10e_CurrentTime_time_stamp_rx = time_stamp;
+	return 7;
+}
+
+int decode_can_0x10e_Years(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x10e_CurrentTime.Years);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10e_Years(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x10e_CurrentTime.Years = in;
+	return 0;
+}
+
+int decode_can_0x10e_Month(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x10e_CurrentTime.Month);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10e_Month(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x10e_CurrentTime.Month = in;
+	return 0;
+}
+
+int decode_can_0x10e_Day(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x10e_CurrentTime.Day);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10e_Day(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x10e_CurrentTime.Day = in;
+	return 0;
+}
+
+int decode_can_0x10e_Hours(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x10e_CurrentTime.Hours);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10e_Hours(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x10e_CurrentTime.Hours = in;
+	return 0;
+}
+
+int decode_can_0x10e_Minutes(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x10e_CurrentTime.Minutes);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10e_Minutes(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x10e_CurrentTime.Minutes = in;
+	return 0;
+}
+
+int decode_can_0x10e_Seconds(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x10e_CurrentTime.Seconds);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10e_Seconds(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x10e_CurrentTime.Seconds = in;
+	return 0;
+}
+
+int print_can_0x10e_CurrentTime(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Years = (wire: %.0f)\n", (double)(o->can_0x10e_CurrentTime.Years)));
+	r = print_helper(r, fprintf(output, "Month = (wire: %.0f)\n", (double)(o->can_0x10e_CurrentTime.Month)));
+	r = print_helper(r, fprintf(output, "Day = (wire: %.0f)\n", (double)(o->can_0x10e_CurrentTime.Day)));
+	r = print_helper(r, fprintf(output, "Hours = (wire: %.0f)\n", (double)(o->can_0x10e_CurrentTime.Hours)));
+	r = print_helper(r, fprintf(output, "Minutes = (wire: %.0f)\n", (double)(o->can_0x10e_CurrentTime.Minutes)));
+	r = print_helper(r, fprintf(output, "Seconds = (wire: %.0f)\n", (double)(o->can_0x10e_CurrentTime.Seconds)));
+	return r;
+}
+
+static int pack_can_0x10f_IMUAccelerationMeasurement(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* XAxisAcceleration: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x10f_IMUAccelerationMeasurement.XAxisAcceleration)) & 0xffff;
+	lo |= w;
+	/* YAxisAcceleration: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x10f_IMUAccelerationMeasurement.YAxisAcceleration)) & 0xffff;
+	lo |= w << 16;
+	/* ZAxisAcceleration: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x10f_IMUAccelerationMeasurement.ZAxisAcceleration)) & 0xffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x10f_IMUAccelerationMeasurement_tx = 1;
+	return 6;
+}
+
+static int unpack_can_0x10f_IMUAccelerationMeasurement(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 6)
+		return -1;
+	/* XAxisAcceleration: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x10f_IMUAccelerationMeasurement.XAxisAcceleration = w;
+	/* YAxisAcceleration: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x10f_IMUAccelerationMeasurement.YAxisAcceleration = w;
+	/* ZAxisAcceleration: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x10f_IMUAccelerationMeasurement.ZAxisAcceleration = w;
+	o->can_0x10f_IMUAccelerationMeasurement_rx = 1;
+	o->can_0x10f_IMUAccelerationMeasurement_time_stamp_rx = time_stamp;
+	return 6;
+}
+
+int decode_can_0x10f_XAxisAcceleration(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x10f_IMUAccelerationMeasurement.XAxisAcceleration);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10f_XAxisAcceleration(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x10f_IMUAccelerationMeasurement.XAxisAcceleration = in;
+	return 0;
+}
+
+int decode_can_0x10f_YAxisAcceleration(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x10f_IMUAccelerationMeasurement.YAxisAcceleration);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10f_YAxisAcceleration(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x10f_IMUAccelerationMeasurement.YAxisAcceleration = in;
+	return 0;
+}
+
+int decode_can_0x10f_ZAxisAcceleration(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x10f_IMUAccelerationMeasurement.ZAxisAcceleration);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x10f_ZAxisAcceleration(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x10f_IMUAccelerationMeasurement.ZAxisAcceleration = in;
+	return 0;
+}
+
+int print_can_0x10f_IMUAccelerationMeasurement(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "XAxisAcceleration = (wire: %.0f)\n", (double)(o->can_0x10f_IMUAccelerationMeasurement.XAxisAcceleration)));
+	r = print_helper(r, fprintf(output, "YAxisAcceleration = (wire: %.0f)\n", (double)(o->can_0x10f_IMUAccelerationMeasurement.YAxisAcceleration)));
+	r = print_helper(r, fprintf(output, "ZAxisAcceleration = (wire: %.0f)\n", (double)(o->can_0x10f_IMUAccelerationMeasurement.ZAxisAcceleration)));
+	return r;
+}
+
+static int pack_can_0x110_IMUGyroMeasurement(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* XAxisRoll: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x110_IMUGyroMeasurement.XAxisRoll)) & 0xffff;
+	lo |= w;
+	/* YAxisRoll: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x110_IMUGyroMeasurement.YAxisRoll)) & 0xffff;
+	lo |= w << 16;
+	/* ZAxisRoll: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x110_IMUGyroMeasurement.ZAxisRoll)) & 0xffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x110_IMUGyroMeasurement_tx = 1;
+	return 6;
+}
+
+static int unpack_can_0x110_IMUGyroMeasurement(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 6)
+		return -1;
+	/* XAxisRoll: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x110_IMUGyroMeasurement.XAxisRoll = w;
+	/* YAxisRoll: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x110_IMUGyroMeasurement.YAxisRoll = w;
+	/* ZAxisRoll: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x110_IMUGyroMeasurement.ZAxisRoll = w;
+	o->can_0x110_IMUGyroMeasurement_rx = 1;
+	o->can_0x110_IMUGyroMeasurement_time_stamp_rx = time_stamp;
+	return 6;
+}
+
+int decode_can_0x110_XAxisRoll(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x110_IMUGyroMeasurement.XAxisRoll);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x110_XAxisRoll(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x110_IMUGyroMeasurement.XAxisRoll = in;
+	return 0;
+}
+
+int decode_can_0x110_YAxisRoll(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x110_IMUGyroMeasurement.YAxisRoll);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x110_YAxisRoll(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x110_IMUGyroMeasurement.YAxisRoll = in;
+	return 0;
+}
+
+int decode_can_0x110_ZAxisRoll(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x110_IMUGyroMeasurement.ZAxisRoll);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x110_ZAxisRoll(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x110_IMUGyroMeasurement.ZAxisRoll = in;
+	return 0;
+}
+
+int print_can_0x110_IMUGyroMeasurement(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "XAxisRoll = (wire: %.0f)\n", (double)(o->can_0x110_IMUGyroMeasurement.XAxisRoll)));
+	r = print_helper(r, fprintf(output, "YAxisRoll = (wire: %.0f)\n", (double)(o->can_0x110_IMUGyroMeasurement.YAxisRoll)));
+	r = print_helper(r, fprintf(output, "ZAxisRoll = (wire: %.0f)\n", (double)(o->can_0x110_IMUGyroMeasurement.ZAxisRoll)));
+	return r;
+}
+
+static int pack_can_0x111_MotorPlateTemp(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorPlateTemp1: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x111_MotorPlateTemp.MotorPlateTemp1) & 0xffffffff;
+	lo |= w;
+	/* MotorPlateTemp2: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x111_MotorPlateTemp.MotorPlateTemp2) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x111_MotorPlateTemp_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x111_MotorPlateTemp(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MotorPlateTemp1: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x111_MotorPlateTemp.MotorPlateTemp1 = unpack754_32(w);
+	/* MotorPlateTemp2: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x111_MotorPlateTemp.MotorPlateTemp2 = unpack754_32(w);
+	o->can_0x111_MotorPlateTemp_rx = 1;
+	o->can_0x111_MotorPlateTemp_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x111_MotorPlateTemp1(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x111_MotorPlateTemp.MotorPlateTemp1);
+	if ((rval >= -10) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x111_MotorPlateTemp1(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x111_MotorPlateTemp.MotorPlateTemp1 = 0;
+	if (in < -10)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x111_MotorPlateTemp.MotorPlateTemp1 = in;
+	return 0;
+}
+
+int decode_can_0x111_MotorPlateTemp2(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x111_MotorPlateTemp.MotorPlateTemp2);
+	if ((rval >= -10) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x111_MotorPlateTemp2(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x111_MotorPlateTemp.MotorPlateTemp2 = 0;
+	if (in < -10)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x111_MotorPlateTemp.MotorPlateTemp2 = in;
+	return 0;
+}
+
+int print_can_0x111_MotorPlateTemp(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorPlateTemp1 = (wire: %g)\n", (double)(o->can_0x111_MotorPlateTemp.MotorPlateTemp1)));
+	r = print_helper(r, fprintf(output, "MotorPlateTemp2 = (wire: %g)\n", (double)(o->can_0x111_MotorPlateTemp.MotorPlateTemp2)));
+	return r;
+}
+
+static int pack_can_0x112_MotorScoop(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorScoop: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x112_MotorScoop.MotorScoop) & 0xffffffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x112_MotorScoop_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x112_MotorScoop(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* MotorScoop: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x112_MotorScoop.MotorScoop = unpack754_32(w);
+	o->can_0x112_MotorScoop_rx = 1;
+	o->can_0x112_MotorScoop_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x112_MotorScoop(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x112_MotorScoop.MotorScoop);
+	if ((rval >= 0) && (rval <= 4.29497e+09)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x112_MotorScoop(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x112_MotorScoop.MotorScoop = 0;
+	if (in < 0)
+		return -1;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x112_MotorScoop.MotorScoop = in;
+	return 0;
+}
+
+int print_can_0x112_MotorScoop(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorScoop = (wire: %g)\n", (double)(o->can_0x112_MotorScoop.MotorScoop)));
+	return r;
+}
+
+static int pack_can_0x113_IMU1(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* IMUAccelX: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x113_IMU1.IMUAccelX)) & 0xffffffff;
+	lo |= w;
+	/* IMUAceelY: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x113_IMU1.IMUAceelY)) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x113_IMU1_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x113_IMU1(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* IMUAccelX: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x113_IMU1.IMUAccelX = w;
+	/* IMUAceelY: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x113_IMU1.IMUAceelY = w;
+	o->can_0x113_IMU1_rx = 1;
+	o->can_0x113_IMU1_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x113_IMUAccelX(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x113_IMU1.IMUAccelX);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x113_IMUAccelX(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x113_IMU1.IMUAccelX = in;
+	return 0;
+}
+
+int decode_can_0x113_IMUAceelY(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x113_IMU1.IMUAceelY);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x113_IMUAceelY(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x113_IMU1.IMUAceelY = in;
+	return 0;
+}
+
+int print_can_0x113_IMU1(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "IMUAccelX = (wire: %.0f)\n", (double)(o->can_0x113_IMU1.IMUAccelX)));
+	r = print_helper(r, fprintf(output, "IMUAceelY = (wire: %.0f)\n", (double)(o->can_0x113_IMU1.IMUAceelY)));
+	return r;
+}
+
+static int pack_can_0x114_IMU2(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* IMUAccelZ: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x114_IMU2.IMUAccelZ)) & 0xffffffff;
+	lo |= w;
+	/* GravityX: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x114_IMU2.GravityX) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x114_IMU2_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x114_IMU2(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* IMUAccelZ: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x114_IMU2.IMUAccelZ = w;
+	/* GravityX: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x114_IMU2.GravityX = unpack754_32(w);
+	o->can_0x114_IMU2_rx = 1;
+	o->can_0x114_IMU2_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x114_IMUAccelZ(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x114_IMU2.IMUAccelZ);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x114_IMUAccelZ(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x114_IMU2.IMUAccelZ = in;
+	return 0;
+}
+
+int decode_can_0x114_GravityX(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x114_IMU2.GravityX);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x114_GravityX(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x114_IMU2.GravityX = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x114_IMU2.GravityX = in;
+	return 0;
+}
+
+int print_can_0x114_IMU2(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "IMUAccelZ = (wire: %.0f)\n", (double)(o->can_0x114_IMU2.IMUAccelZ)));
+	r = print_helper(r, fprintf(output, "GravityX = (wire: %g)\n", (double)(o->can_0x114_IMU2.GravityX)));
+	return r;
+}
+
+static int pack_can_0x115_IMU3(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* GravityY: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x115_IMU3.GravityY) & 0xffffffff;
+	lo |= w;
+	/* GravityZ: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x115_IMU3.GravityZ) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x115_IMU3_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x115_IMU3(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* GravityY: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x115_IMU3.GravityY = unpack754_32(w);
+	/* GravityZ: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x115_IMU3.GravityZ = unpack754_32(w);
+	o->can_0x115_IMU3_rx = 1;
+	o->can_0x115_IMU3_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x115_GravityY(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x115_IMU3.GravityY);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x115_GravityY(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x115_IMU3.GravityY = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x115_IMU3.GravityY = in;
+	return 0;
+}
+
+int decode_can_0x115_GravityZ(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x115_IMU3.GravityZ);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x115_GravityZ(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x115_IMU3.GravityZ = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x115_IMU3.GravityZ = in;
+	return 0;
+}
+
+int print_can_0x115_IMU3(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "GravityY = (wire: %g)\n", (double)(o->can_0x115_IMU3.GravityY)));
+	r = print_helper(r, fprintf(output, "GravityZ = (wire: %g)\n", (double)(o->can_0x115_IMU3.GravityZ)));
+	return r;
+}
+
+static int pack_can_0x116_IMU4(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Yaw: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x116_IMU4.Yaw) & 0xffffffff;
+	lo |= w;
+	/* Pitch: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x116_IMU4.Pitch) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x116_IMU4_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x116_IMU4(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Yaw: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x116_IMU4.Yaw = unpack754_32(w);
+	/* Pitch: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x116_IMU4.Pitch = unpack754_32(w);
+	o->can_0x116_IMU4_rx = 1;
+	o->can_0x116_IMU4_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x116_Yaw(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x116_IMU4.Yaw);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x116_Yaw(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x116_IMU4.Yaw = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x116_IMU4.Yaw = in;
+	return 0;
+}
+
+int decode_can_0x116_Pitch(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x116_IMU4.Pitch);
+	if (rval <= 4.29497e+09) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x116_Pitch(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x116_IMU4.Pitch = 0;
+	if (in > 4.29497e+09)
+		return -1;
+	o->can_0x116_IMU4.Pitch = in;
+	return 0;
+}
+
+int print_can_0x116_IMU4(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Yaw = (wire: %g)\n", (double)(o->can_0x116_IMU4.Yaw)));
+	r = print_helper(r, fprintf(output, "Pitch = (wire: %g)\n", (double)(o->can_0x116_IMU4.Pitch)));
+	return r;
+}
+
+static int pack_can_0x29a_IMU5(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* normal: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x29a_IMU5.normal)) & 0xff;
+	lo |= w << 16;
+	/* multiplexor: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x29a_IMU5.multiplexor)) & 0xf;
+	lo |= w;
+	switch (o->can_0x29a_IMU5.multiplexor) {
+	case 0:
+		/* multi2a: start-bit 6, length 2, endianess intel, scaling 1, offset 0 */
+		w = ((uint8_t)(o->can_0x29a_IMU5.multi2a)) & 0x3;
+		lo |= w << 6;
+		/* multi2b: start-bit 8, length 2, endianess intel, scaling 1, offset 0 */
+		w = ((uint8_t)(o->can_0x29a_IMU5.multi2b)) & 0x3;
+		lo |= w << 8;
+		break;
+	case 1:
+		/* multi1: start-bit 8, length 4, endianess intel, scaling 1, offset 0 */
+		w = ((uint8_t)(o->can_0x29a_IMU5.multi1)) & 0xf;
+		lo |= w << 8;
+		break;
+	case 2:
+		/* multi3: start-bit 8, length 4, endianess intel, scaling 1, offset 0 */
+		w = ((uint8_t)(o->can_0x29a_IMU5.multi3)) & 0xf;
+		lo |= w << 8;
+		break;
+	case 3:
+		/* multi4: start-bit 8, length 4, endianess intel, scaling 1, offset 0 */
+		w = ((uint8_t)(o->can_0x29a_IMU5.multi4)) & 0xf;
+		lo |= w << 8;
+		break;
+	default:
+		return -1;
+	}
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x29a_IMU5_tx = 1;
+	return 4;
+}
+
+static int unpack_can_0x29a_IMU5(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 4)
+		return -1;
+	/* normal: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xff;
+	o->can_0x29a_IMU5.normal = w;
+	/* multiplexor: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xf;
+	o->can_0x29a_IMU5.multiplexor = w;
+	switch (o->can_0x29a_IMU5.multiplexor) {
+	case 0:
+		/* multi2a: start-bit 6, length 2, endianess intel, scaling 1, offset 0 */
+		w = (lo >> 6) & 0x3;
+		o->can_0x29a_IMU5.multi2a = w;
+		/* multi2b: start-bit 8, length 2, endianess intel, scaling 1, offset 0 */
+		w = (lo >> 8) & 0x3;
+		o->can_0x29a_IMU5.multi2b = w;
+		break;
+	case 1:
+		/* multi1: start-bit 8, length 4, endianess intel, scaling 1, offset 0 */
+		w = (lo >> 8) & 0xf;
+		o->can_0x29a_IMU5.multi1 = w;
+		break;
+	case 2:
+		/* multi3: start-bit 8, length 4, endianess intel, scaling 1, offset 0 */
+		w = (lo >> 8) & 0xf;
+		o->can_0x29a_IMU5.multi3 = w;
+		break;
+	case 3:
+		/* multi4: start-bit 8, length 4, endianess intel, scaling 1, offset 0 */
+		w = (lo >> 8) & 0xf;
+		o->can_0x29a_IMU5.multi4 = w;
+		break;
+	default:
+		return -1;
+	}
+	o->can_0x29a_IMU5_rx = 1;
+	o->can_0x29a_IMU5_time_stamp_rx = time_stamp;
+	return 4;
+}
+
+int decode_can_0x29a_normal(const can_obj_ex1_h_t *o, int8_t *out) {
+	int8_t rval = (int8_t)(o->can_0x29a_IMU5.normal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_normal(can_obj_ex1_h_t *o, int8_t in) {
+	o->can_0x29a_IMU5.normal = in;
+	return 0;
+}
+
+int decode_can_0x29a_multiplexor(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29a_IMU5.multiplexor);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_multiplexor(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29a_IMU5.multiplexor = in;
+	return 0;
+}
+
+int decode_can_0x29a_multi2a(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29a_IMU5.multi2a);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_multi2a(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29a_IMU5.multi2a = in;
+	return 0;
+}
+
+int decode_can_0x29a_multi2b(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29a_IMU5.multi2b);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_multi2b(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29a_IMU5.multi2b = in;
+	return 0;
+}
+
+int decode_can_0x29a_multi1(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29a_IMU5.multi1);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_multi1(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29a_IMU5.multi1 = in;
+	return 0;
+}
+
+int decode_can_0x29a_multi3(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29a_IMU5.multi3);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_multi3(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29a_IMU5.multi3 = in;
+	return 0;
+}
+
+int decode_can_0x29a_multi4(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29a_IMU5.multi4);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29a_multi4(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29a_IMU5.multi4 = in;
+	return 0;
+}
+
+int print_can_0x29a_IMU5(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "normal = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.normal)));
+	r = print_helper(r, fprintf(output, "multiplexor = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.multiplexor)));
+	r = print_helper(r, fprintf(output, "multi2a = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.multi2a)));
+	r = print_helper(r, fprintf(output, "multi2b = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.multi2b)));
+	r = print_helper(r, fprintf(output, "multi1 = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.multi1)));
+	r = print_helper(r, fprintf(output, "multi3 = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.multi3)));
+	r = print_helper(r, fprintf(output, "multi4 = (wire: %.0f)\n", (double)(o->can_0x29a_IMU5.multi4)));
+	return r;
+}
+
+static int pack_can_0x29b_MESSAGE_NAME(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* NonsenseSignal: start-bit 0, length 3, endianess motorola, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x29b_MESSAGE_NAME.NonsenseSignal)) & 0x7;
+	lo |= (w & 0x3) << 14;
+	lo |= (w >> 2);
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x29b_MESSAGE_NAME_tx = 1;
+	return 0;
+}
+
+static int unpack_can_0x29b_MESSAGE_NAME(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	UNUSED(dlc);
+	/* NonsenseSignal: start-bit 0, length 3, endianess motorola, scaling 1, offset 0 */
+	w = ((uint16_t)((uint16_t)(uint8_t)(lo >> 8) | ((uint16_t)(uint8_t)lo << 8)) >> 6) & 0x7;
+	o->can_0x29b_MESSAGE_NAME.NonsenseSignal = w;
+	o->can_0x29b_MESSAGE_NAME_rx = 1;
+	o->can_0x29b_MESSAGE_NAME_time_stamp_rx = time_stamp;
+	return 0;
+}
+
+int decode_can_0x29b_NonsenseSignal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x29b_MESSAGE_NAME.NonsenseSignal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x29b_NonsenseSignal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x29b_MESSAGE_NAME.NonsenseSignal = in;
+	return 0;
+}
+
+int print_can_0x29b_MESSAGE_NAME(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "NonsenseSignal = (wire: %.0f)\n", (double)(o->can_0x29b_MESSAGE_NAME.NonsenseSignal)));
+	return r;
+}
+
+static int pack_can_0x29c_MESSAGE_NAME2(can_obj_ex1_h_t *o, uint64_t *data) {
+	UNUSED(o);
+	UNUSED(data);
+	o->can_0x29c_MESSAGE_NAME2_tx = 1;
+	return 0;
+}
+
+static int unpack_can_0x29c_MESSAGE_NAME2(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	UNUSED(o);
+	UNUSED(data);
+	UNUSED(dlc);
+	o->can_0x29c_MESSAGE_NAME2_rx = 1;
+	o->can_0x29c_MESSAGE_NAME2_time_stamp_rx = time_stamp;
+	return 0;
+}
+
+int print_can_0x29c_MESSAGE_NAME2(const can_obj_ex1_h_t *o, FILE *output) {
+	UNUSED(o);
+	UNUSED(output);
+	return 0;
+}
+
+static int pack_can_0x300_BIM1CellStatistics1(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM1MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x300_BIM1CellStatistics1.BIM1MaxCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM1MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x300_BIM1CellStatistics1.BIM1MinCellVoltage)) & 0xffff;
+	hi |= w;
+	/* BIM1MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x300_BIM1CellStatistics1.BIM1MaxCellNumber)) & 0xff;
+	lo |= w << 16;
+	/* BIM1MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x300_BIM1CellStatistics1.BIM1MinCellNumber)) & 0xff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x300_BIM1CellStatistics1_tx = 1;
+	return 7;
+}
+
+static int unpack_can_0x300_BIM1CellStatistics1(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 7)
+		return -1;
+	/* BIM1MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x300_BIM1CellStatistics1.BIM1MaxCellVoltage = w;
+	/* BIM1MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x300_BIM1CellStatistics1.BIM1MinCellVoltage = w;
+	/* BIM1MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xff;
+	o->can_0x300_BIM1CellStatistics1.BIM1MaxCellNumber = w;
+	/* BIM1MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xff;
+	o->can_0x300_BIM1CellStatistics1.BIM1MinCellNumber = w;
+	o->can_0x300_BIM1CellStatistics1_rx = 1;
+	o->can_0x300_BIM1CellStatistics1_time_stamp_rx = time_stamp;
+	return 7;
+}
+
+int decode_can_0x300_BIM1MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x300_BIM1CellStatistics1.BIM1MaxCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x300_BIM1MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x300_BIM1CellStatistics1.BIM1MaxCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x300_BIM1MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x300_BIM1CellStatistics1.BIM1MinCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x300_BIM1MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x300_BIM1CellStatistics1.BIM1MinCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x300_BIM1MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x300_BIM1CellStatistics1.BIM1MaxCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x300_BIM1MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x300_BIM1CellStatistics1.BIM1MaxCellNumber = in;
+	return 0;
+}
+
+int decode_can_0x300_BIM1MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x300_BIM1CellStatistics1.BIM1MinCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x300_BIM1MinCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x300_BIM1CellStatistics1.BIM1MinCellNumber = in;
+	return 0;
+}
+
+int print_can_0x300_BIM1CellStatistics1(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM1MaxCellVoltage = (wire: %.0f)\n", (double)(o->can_0x300_BIM1CellStatistics1.BIM1MaxCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM1MinCellVoltage = (wire: %.0f)\n", (double)(o->can_0x300_BIM1CellStatistics1.BIM1MinCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM1MaxCellNumber = (wire: %.0f)\n", (double)(o->can_0x300_BIM1CellStatistics1.BIM1MaxCellNumber)));
+	r = print_helper(r, fprintf(output, "BIM1MinCellNumber = (wire: %.0f)\n", (double)(o->can_0x300_BIM1CellStatistics1.BIM1MinCellNumber)));
+	return r;
+}
+
+static int pack_can_0x301_BIM1CellStatistics2(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM1AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x301_BIM1CellStatistics2.BIM1AvgCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM1StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x301_BIM1CellStatistics2.BIM1StdevCellVoltage)) & 0xffff;
+	lo |= w << 16;
+	/* BIM1NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x301_BIM1CellStatistics2.BIM1NumberBalancingCells)) & 0xff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x301_BIM1CellStatistics2_tx = 1;
+	return 5;
+}
+
+static int unpack_can_0x301_BIM1CellStatistics2(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 5)
+		return -1;
+	/* BIM1AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x301_BIM1CellStatistics2.BIM1AvgCellVoltage = w;
+	/* BIM1StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x301_BIM1CellStatistics2.BIM1StdevCellVoltage = w;
+	/* BIM1NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xff;
+	o->can_0x301_BIM1CellStatistics2.BIM1NumberBalancingCells = w;
+	o->can_0x301_BIM1CellStatistics2_rx = 1;
+	o->can_0x301_BIM1CellStatistics2_time_stamp_rx = time_stamp;
+	return 5;
+}
+
+int decode_can_0x301_BIM1AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x301_BIM1CellStatistics2.BIM1AvgCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x301_BIM1AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x301_BIM1CellStatistics2.BIM1AvgCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x301_BIM1StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x301_BIM1CellStatistics2.BIM1StdevCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x301_BIM1StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x301_BIM1CellStatistics2.BIM1StdevCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x301_BIM1NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x301_BIM1CellStatistics2.BIM1NumberBalancingCells);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x301_BIM1NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x301_BIM1CellStatistics2.BIM1NumberBalancingCells = in;
+	return 0;
+}
+
+int print_can_0x301_BIM1CellStatistics2(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM1AvgCellVoltage = (wire: %.0f)\n", (double)(o->can_0x301_BIM1CellStatistics2.BIM1AvgCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM1StdevCellVoltage = (wire: %.0f)\n", (double)(o->can_0x301_BIM1CellStatistics2.BIM1StdevCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM1NumberBalancingCells = (wire: %.0f)\n", (double)(o->can_0x301_BIM1CellStatistics2.BIM1NumberBalancingCells)));
+	return r;
+}
+
+static int pack_can_0x302_BIM2CellStatisitcs1(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM2MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM2MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellVoltage)) & 0xffff;
+	hi |= w;
+	/* BIM2MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellNumber)) & 0xff;
+	lo |= w << 16;
+	/* BIM2MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellNumber)) & 0xff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x302_BIM2CellStatisitcs1_tx = 1;
+	return 7;
+}
+
+static int unpack_can_0x302_BIM2CellStatisitcs1(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 7)
+		return -1;
+	/* BIM2MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellVoltage = w;
+	/* BIM2MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellVoltage = w;
+	/* BIM2MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xff;
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellNumber = w;
+	/* BIM2MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xff;
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellNumber = w;
+	o->can_0x302_BIM2CellStatisitcs1_rx = 1;
+	o->can_0x302_BIM2CellStatisitcs1_time_stamp_rx = time_stamp;
+	return 7;
+}
+
+int decode_can_0x302_BIM2MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x302_BIM2MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x302_BIM2MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x302_BIM2MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x302_BIM2MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x302_BIM2MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellNumber = in;
+	return 0;
+}
+
+int decode_can_0x302_BIM2MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x302_BIM2MinCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellNumber = in;
+	return 0;
+}
+
+int print_can_0x302_BIM2CellStatisitcs1(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM2MaxCellVoltage = (wire: %.0f)\n", (double)(o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM2MinCellVoltage = (wire: %.0f)\n", (double)(o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM2MaxCellNumber = (wire: %.0f)\n", (double)(o->can_0x302_BIM2CellStatisitcs1.BIM2MaxCellNumber)));
+	r = print_helper(r, fprintf(output, "BIM2MinCellNumber = (wire: %.0f)\n", (double)(o->can_0x302_BIM2CellStatisitcs1.BIM2MinCellNumber)));
+	return r;
+}
+
+static int pack_can_0x303_BIM2CellStatistics2(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM2AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x303_BIM2CellStatistics2.BIM2AvgCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM2StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x303_BIM2CellStatistics2.BIM2StdevCellVoltage)) & 0xffff;
+	lo |= w << 16;
+	/* BIM2NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x303_BIM2CellStatistics2.BIM2NumberBalancingCells)) & 0xff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x303_BIM2CellStatistics2_tx = 1;
+	return 5;
+}
+
+static int unpack_can_0x303_BIM2CellStatistics2(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 5)
+		return -1;
+	/* BIM2AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x303_BIM2CellStatistics2.BIM2AvgCellVoltage = w;
+	/* BIM2StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x303_BIM2CellStatistics2.BIM2StdevCellVoltage = w;
+	/* BIM2NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xff;
+	o->can_0x303_BIM2CellStatistics2.BIM2NumberBalancingCells = w;
+	o->can_0x303_BIM2CellStatistics2_rx = 1;
+	o->can_0x303_BIM2CellStatistics2_time_stamp_rx = time_stamp;
+	return 5;
+}
+
+int decode_can_0x303_BIM2AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x303_BIM2CellStatistics2.BIM2AvgCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x303_BIM2AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x303_BIM2CellStatistics2.BIM2AvgCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x303_BIM2StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x303_BIM2CellStatistics2.BIM2StdevCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x303_BIM2StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x303_BIM2CellStatistics2.BIM2StdevCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x303_BIM2NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x303_BIM2CellStatistics2.BIM2NumberBalancingCells);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x303_BIM2NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x303_BIM2CellStatistics2.BIM2NumberBalancingCells = in;
+	return 0;
+}
+
+int print_can_0x303_BIM2CellStatistics2(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM2AvgCellVoltage = (wire: %.0f)\n", (double)(o->can_0x303_BIM2CellStatistics2.BIM2AvgCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM2StdevCellVoltage = (wire: %.0f)\n", (double)(o->can_0x303_BIM2CellStatistics2.BIM2StdevCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM2NumberBalancingCells = (wire: %.0f)\n", (double)(o->can_0x303_BIM2CellStatistics2.BIM2NumberBalancingCells)));
+	return r;
+}
+
+static int pack_can_0x304_BIM3CellStatisitcs1(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM3MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM3MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellVoltage)) & 0xffff;
+	hi |= w;
+	/* BIM3MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellNumber)) & 0xff;
+	lo |= w << 16;
+	/* BIM3MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellNumber)) & 0xff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x304_BIM3CellStatisitcs1_tx = 1;
+	return 7;
+}
+
+static int unpack_can_0x304_BIM3CellStatisitcs1(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 7)
+		return -1;
+	/* BIM3MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellVoltage = w;
+	/* BIM3MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellVoltage = w;
+	/* BIM3MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xff;
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellNumber = w;
+	/* BIM3MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xff;
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellNumber = w;
+	o->can_0x304_BIM3CellStatisitcs1_rx = 1;
+	o->can_0x304_BIM3CellStatisitcs1_time_stamp_rx = time_stamp;
+	return 7;
+}
+
+int decode_can_0x304_BIM3MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x304_BIM3MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x304_BIM3MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x304_BIM3MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x304_BIM3MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x304_BIM3MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellNumber = in;
+	return 0;
+}
+
+int decode_can_0x304_BIM3MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x304_BIM3MinCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellNumber = in;
+	return 0;
+}
+
+int print_can_0x304_BIM3CellStatisitcs1(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM3MaxCellVoltage = (wire: %.0f)\n", (double)(o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM3MinCellVoltage = (wire: %.0f)\n", (double)(o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM3MaxCellNumber = (wire: %.0f)\n", (double)(o->can_0x304_BIM3CellStatisitcs1.BIM3MaxCellNumber)));
+	r = print_helper(r, fprintf(output, "BIM3MinCellNumber = (wire: %.0f)\n", (double)(o->can_0x304_BIM3CellStatisitcs1.BIM3MinCellNumber)));
+	return r;
+}
+
+static int pack_can_0x305_BIM3CellStatistics2(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM3AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x305_BIM3CellStatistics2.BIM3AvgCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM3StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x305_BIM3CellStatistics2.BIM3StdevCellVoltage)) & 0xffff;
+	lo |= w << 16;
+	/* BIM3NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x305_BIM3CellStatistics2.BIM3NumberBalancingCells)) & 0xff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x305_BIM3CellStatistics2_tx = 1;
+	return 5;
+}
+
+static int unpack_can_0x305_BIM3CellStatistics2(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 5)
+		return -1;
+	/* BIM3AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x305_BIM3CellStatistics2.BIM3AvgCellVoltage = w;
+	/* BIM3StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x305_BIM3CellStatistics2.BIM3StdevCellVoltage = w;
+	/* BIM3NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xff;
+	o->can_0x305_BIM3CellStatistics2.BIM3NumberBalancingCells = w;
+	o->can_0x305_BIM3CellStatistics2_rx = 1;
+	o->can_0x305_BIM3CellStatistics2_time_stamp_rx = time_stamp;
+	return 5;
+}
+
+int decode_can_0x305_BIM3AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x305_BIM3CellStatistics2.BIM3AvgCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x305_BIM3AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x305_BIM3CellStatistics2.BIM3AvgCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x305_BIM3StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x305_BIM3CellStatistics2.BIM3StdevCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x305_BIM3StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x305_BIM3CellStatistics2.BIM3StdevCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x305_BIM3NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x305_BIM3CellStatistics2.BIM3NumberBalancingCells);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x305_BIM3NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x305_BIM3CellStatistics2.BIM3NumberBalancingCells = in;
+	return 0;
+}
+
+int print_can_0x305_BIM3CellStatistics2(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM3AvgCellVoltage = (wire: %.0f)\n", (double)(o->can_0x305_BIM3CellStatistics2.BIM3AvgCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM3StdevCellVoltage = (wire: %.0f)\n", (double)(o->can_0x305_BIM3CellStatistics2.BIM3StdevCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM3NumberBalancingCells = (wire: %.0f)\n", (double)(o->can_0x305_BIM3CellStatistics2.BIM3NumberBalancingCells)));
+	return r;
+}
+
+static int pack_can_0x306_BIM4CellStatistics1(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM4MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x306_BIM4CellStatistics1.BIM4MaxCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM4MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x306_BIM4CellStatistics1.BIM4MinCellVoltage)) & 0xffff;
+	hi |= w;
+	/* BIM4MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x306_BIM4CellStatistics1.BIM4MaxCellNumber)) & 0xff;
+	lo |= w << 16;
+	/* BIM4MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x306_BIM4CellStatistics1.BIM4MinCellNumber)) & 0xff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x306_BIM4CellStatistics1_tx = 1;
+	return 6;
+}
+
+static int unpack_can_0x306_BIM4CellStatistics1(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 6)
+		return -1;
+	/* BIM4MaxCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x306_BIM4CellStatistics1.BIM4MaxCellVoltage = w;
+	/* BIM4MinCellVoltage: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x306_BIM4CellStatistics1.BIM4MinCellVoltage = w;
+	/* BIM4MaxCellNumber: start-bit 16, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xff;
+	o->can_0x306_BIM4CellStatistics1.BIM4MaxCellNumber = w;
+	/* BIM4MinCellNumber: start-bit 48, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xff;
+	o->can_0x306_BIM4CellStatistics1.BIM4MinCellNumber = w;
+	o->can_0x306_BIM4CellStatistics1_rx = 1;
+	o->can_0x306_BIM4CellStatistics1_time_stamp_rx = time_stamp;
+	return 6;
+}
+
+int decode_can_0x306_BIM4MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x306_BIM4CellStatistics1.BIM4MaxCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x306_BIM4MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x306_BIM4CellStatistics1.BIM4MaxCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x306_BIM4MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x306_BIM4CellStatistics1.BIM4MinCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x306_BIM4MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x306_BIM4CellStatistics1.BIM4MinCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x306_BIM4MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x306_BIM4CellStatistics1.BIM4MaxCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x306_BIM4MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x306_BIM4CellStatistics1.BIM4MaxCellNumber = in;
+	return 0;
+}
+
+int decode_can_0x306_BIM4MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x306_BIM4CellStatistics1.BIM4MinCellNumber);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x306_BIM4MinCellNumber(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x306_BIM4CellStatistics1.BIM4MinCellNumber = in;
+	return 0;
+}
+
+int print_can_0x306_BIM4CellStatistics1(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM4MaxCellVoltage = (wire: %.0f)\n", (double)(o->can_0x306_BIM4CellStatistics1.BIM4MaxCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM4MinCellVoltage = (wire: %.0f)\n", (double)(o->can_0x306_BIM4CellStatistics1.BIM4MinCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM4MaxCellNumber = (wire: %.0f)\n", (double)(o->can_0x306_BIM4CellStatistics1.BIM4MaxCellNumber)));
+	r = print_helper(r, fprintf(output, "BIM4MinCellNumber = (wire: %.0f)\n", (double)(o->can_0x306_BIM4CellStatistics1.BIM4MinCellNumber)));
+	return r;
+}
+
+static int pack_can_0x307_BIM4CellStatistics2(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BIM4AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x307_BIM4CellStatistics2.BIM4AvgCellVoltage)) & 0xffff;
+	lo |= w;
+	/* BIM4StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x307_BIM4CellStatistics2.BIM4StdevCellVoltage)) & 0xffff;
+	lo |= w << 16;
+	/* BIM4NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x307_BIM4CellStatistics2.BIM4NumberBalancingCells)) & 0xff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x307_BIM4CellStatistics2_tx = 1;
+	return 5;
+}
+
+static int unpack_can_0x307_BIM4CellStatistics2(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 5)
+		return -1;
+	/* BIM4AvgCellVoltage: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x307_BIM4CellStatistics2.BIM4AvgCellVoltage = w;
+	/* BIM4StdevCellVoltage: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x307_BIM4CellStatistics2.BIM4StdevCellVoltage = w;
+	/* BIM4NumberBalancingCells: start-bit 32, length 8, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xff;
+	o->can_0x307_BIM4CellStatistics2.BIM4NumberBalancingCells = w;
+	o->can_0x307_BIM4CellStatistics2_rx = 1;
+	o->can_0x307_BIM4CellStatistics2_time_stamp_rx = time_stamp;
+	return 5;
+}
+
+int decode_can_0x307_BIM4AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x307_BIM4CellStatistics2.BIM4AvgCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x307_BIM4AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x307_BIM4CellStatistics2.BIM4AvgCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x307_BIM4StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x307_BIM4CellStatistics2.BIM4StdevCellVoltage);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x307_BIM4StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x307_BIM4CellStatistics2.BIM4StdevCellVoltage = in;
+	return 0;
+}
+
+int decode_can_0x307_BIM4NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x307_BIM4CellStatistics2.BIM4NumberBalancingCells);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x307_BIM4NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x307_BIM4CellStatistics2.BIM4NumberBalancingCells = in;
+	return 0;
+}
+
+int print_can_0x307_BIM4CellStatistics2(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BIM4AvgCellVoltage = (wire: %.0f)\n", (double)(o->can_0x307_BIM4CellStatistics2.BIM4AvgCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM4StdevCellVoltage = (wire: %.0f)\n", (double)(o->can_0x307_BIM4CellStatistics2.BIM4StdevCellVoltage)));
+	r = print_helper(r, fprintf(output, "BIM4NumberBalancingCells = (wire: %.0f)\n", (double)(o->can_0x307_BIM4CellStatistics2.BIM4NumberBalancingCells)));
+	return r;
+}
+
+static int pack_can_0x310_Cells_1_4(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell1: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x310_Cells_1_4.Cell1)) & 0x7fff;
+	lo |= w;
+	/* Cell2: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x310_Cells_1_4.Cell2)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell3: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x310_Cells_1_4.Cell3)) & 0x7fff;
+	hi |= w;
+	/* Cell4: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x310_Cells_1_4.Cell4)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell1_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x310_Cells_1_4.Cell1_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell2_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x310_Cells_1_4.Cell2_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell3_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x310_Cells_1_4.Cell3_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell4_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x310_Cells_1_4.Cell4_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x310_Cells_1_4_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x310_Cells_1_4(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell1: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x310_Cells_1_4.Cell1 = w;
+	/* Cell2: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x310_Cells_1_4.Cell2 = w;
+	/* Cell3: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x310_Cells_1_4.Cell3 = w;
+	/* Cell4: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x310_Cells_1_4.Cell4 = w;
+	/* Cell1_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x310_Cells_1_4.Cell1_bal = w;
+	/* Cell2_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x310_Cells_1_4.Cell2_bal = w;
+	/* Cell3_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x310_Cells_1_4.Cell3_bal = w;
+	/* Cell4_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x310_Cells_1_4.Cell4_bal = w;
+	o->can_0x310_Cells_1_4_rx = 1;
+	o->can_0x310_Cells_1_4_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x310_Cell1(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x310_Cells_1_4.Cell1);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell1(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x310_Cells_1_4.Cell1 = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell2(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x310_Cells_1_4.Cell2);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell2(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x310_Cells_1_4.Cell2 = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell3(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x310_Cells_1_4.Cell3);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell3(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x310_Cells_1_4.Cell3 = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell4(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x310_Cells_1_4.Cell4);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell4(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x310_Cells_1_4.Cell4 = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell1_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x310_Cells_1_4.Cell1_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell1_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x310_Cells_1_4.Cell1_bal = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell2_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x310_Cells_1_4.Cell2_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell2_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x310_Cells_1_4.Cell2_bal = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell3_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x310_Cells_1_4.Cell3_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell3_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x310_Cells_1_4.Cell3_bal = in;
+	return 0;
+}
+
+int decode_can_0x310_Cell4_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x310_Cells_1_4.Cell4_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x310_Cell4_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x310_Cells_1_4.Cell4_bal = in;
+	return 0;
+}
+
+int print_can_0x310_Cells_1_4(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell1 = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell1)));
+	r = print_helper(r, fprintf(output, "Cell2 = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell2)));
+	r = print_helper(r, fprintf(output, "Cell3 = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell3)));
+	r = print_helper(r, fprintf(output, "Cell4 = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell4)));
+	r = print_helper(r, fprintf(output, "Cell1_bal = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell1_bal)));
+	r = print_helper(r, fprintf(output, "Cell2_bal = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell2_bal)));
+	r = print_helper(r, fprintf(output, "Cell3_bal = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell3_bal)));
+	r = print_helper(r, fprintf(output, "Cell4_bal = (wire: %.0f)\n", (double)(o->can_0x310_Cells_1_4.Cell4_bal)));
+	return r;
+}
+
+static int pack_can_0x311_Cells_5_8(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell5: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x311_Cells_5_8.Cell5)) & 0x7fff;
+	lo |= w;
+	/* Cell6: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x311_Cells_5_8.Cell6)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell7: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x311_Cells_5_8.Cell7)) & 0x7fff;
+	hi |= w;
+	/* Cell8: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x311_Cells_5_8.Cell8)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell5_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x311_Cells_5_8.Cell5_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell6_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x311_Cells_5_8.Cell6_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell7_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x311_Cells_5_8.Cell7_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell8_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x311_Cells_5_8.Cell8_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x311_Cells_5_8_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x311_Cells_5_8(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell5: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x311_Cells_5_8.Cell5 = w;
+	/* Cell6: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x311_Cells_5_8.Cell6 = w;
+	/* Cell7: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x311_Cells_5_8.Cell7 = w;
+	/* Cell8: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x311_Cells_5_8.Cell8 = w;
+	/* Cell5_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x311_Cells_5_8.Cell5_bal = w;
+	/* Cell6_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x311_Cells_5_8.Cell6_bal = w;
+	/* Cell7_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x311_Cells_5_8.Cell7_bal = w;
+	/* Cell8_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x311_Cells_5_8.Cell8_bal = w;
+	o->can_0x311_Cells_5_8_rx = 1;
+	o->can_0x311_Cells_5_8_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x311_Cell5(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x311_Cells_5_8.Cell5);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell5(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x311_Cells_5_8.Cell5 = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell6(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x311_Cells_5_8.Cell6);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell6(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x311_Cells_5_8.Cell6 = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell7(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x311_Cells_5_8.Cell7);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell7(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x311_Cells_5_8.Cell7 = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell8(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x311_Cells_5_8.Cell8);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell8(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x311_Cells_5_8.Cell8 = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell5_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x311_Cells_5_8.Cell5_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell5_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x311_Cells_5_8.Cell5_bal = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell6_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x311_Cells_5_8.Cell6_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell6_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x311_Cells_5_8.Cell6_bal = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell7_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x311_Cells_5_8.Cell7_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell7_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x311_Cells_5_8.Cell7_bal = in;
+	return 0;
+}
+
+int decode_can_0x311_Cell8_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x311_Cells_5_8.Cell8_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x311_Cell8_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x311_Cells_5_8.Cell8_bal = in;
+	return 0;
+}
+
+int print_can_0x311_Cells_5_8(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell5 = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell5)));
+	r = print_helper(r, fprintf(output, "Cell6 = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell6)));
+	r = print_helper(r, fprintf(output, "Cell7 = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell7)));
+	r = print_helper(r, fprintf(output, "Cell8 = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell8)));
+	r = print_helper(r, fprintf(output, "Cell5_bal = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell5_bal)));
+	r = print_helper(r, fprintf(output, "Cell6_bal = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell6_bal)));
+	r = print_helper(r, fprintf(output, "Cell7_bal = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell7_bal)));
+	r = print_helper(r, fprintf(output, "Cell8_bal = (wire: %.0f)\n", (double)(o->can_0x311_Cells_5_8.Cell8_bal)));
+	return r;
+}
+
+static int pack_can_0x312_Cells_9_12(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell9: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x312_Cells_9_12.Cell9)) & 0x7fff;
+	lo |= w;
+	/* Cell10: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x312_Cells_9_12.Cell10)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell11: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x312_Cells_9_12.Cell11)) & 0x7fff;
+	hi |= w;
+	/* Cell12: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x312_Cells_9_12.Cell12)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell9_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x312_Cells_9_12.Cell9_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell10_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x312_Cells_9_12.Cell10_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell11_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x312_Cells_9_12.Cell11_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell12_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x312_Cells_9_12.Cell12_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x312_Cells_9_12_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x312_Cells_9_12(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell9: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x312_Cells_9_12.Cell9 = w;
+	/* Cell10: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x312_Cells_9_12.Cell10 = w;
+	/* Cell11: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x312_Cells_9_12.Cell11 = w;
+	/* Cell12: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x312_Cells_9_12.Cell12 = w;
+	/* Cell9_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x312_Cells_9_12.Cell9_bal = w;
+	/* Cell10_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x312_Cells_9_12.Cell10_bal = w;
+	/* Cell11_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x312_Cells_9_12.Cell11_bal = w;
+	/* Cell12_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x312_Cells_9_12.Cell12_bal = w;
+	o->can_0x312_Cells_9_12_rx = 1;
+	o->can_0x312_Cells_9_12_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x312_Cell9(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x312_Cells_9_12.Cell9);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell9(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x312_Cells_9_12.Cell9 = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell10(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x312_Cells_9_12.Cell10);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell10(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x312_Cells_9_12.Cell10 = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell11(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x312_Cells_9_12.Cell11);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell11(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x312_Cells_9_12.Cell11 = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell12(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x312_Cells_9_12.Cell12);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell12(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x312_Cells_9_12.Cell12 = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell9_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x312_Cells_9_12.Cell9_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell9_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x312_Cells_9_12.Cell9_bal = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell10_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x312_Cells_9_12.Cell10_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell10_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x312_Cells_9_12.Cell10_bal = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell11_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x312_Cells_9_12.Cell11_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell11_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x312_Cells_9_12.Cell11_bal = in;
+	return 0;
+}
+
+int decode_can_0x312_Cell12_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x312_Cells_9_12.Cell12_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x312_Cell12_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x312_Cells_9_12.Cell12_bal = in;
+	return 0;
+}
+
+int print_can_0x312_Cells_9_12(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell9 = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell9)));
+	r = print_helper(r, fprintf(output, "Cell10 = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell10)));
+	r = print_helper(r, fprintf(output, "Cell11 = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell11)));
+	r = print_helper(r, fprintf(output, "Cell12 = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell12)));
+	r = print_helper(r, fprintf(output, "Cell9_bal = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell9_bal)));
+	r = print_helper(r, fprintf(output, "Cell10_bal = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell10_bal)));
+	r = print_helper(r, fprintf(output, "Cell11_bal = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell11_bal)));
+	r = print_helper(r, fprintf(output, "Cell12_bal = (wire: %.0f)\n", (double)(o->can_0x312_Cells_9_12.Cell12_bal)));
+	return r;
+}
+
+static int pack_can_0x313_Cells_13_16(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell13: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x313_Cells_13_16.Cell13)) & 0x7fff;
+	lo |= w;
+	/* Cell14: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x313_Cells_13_16.Cell14)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell15: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x313_Cells_13_16.Cell15)) & 0x7fff;
+	hi |= w;
+	/* Cell16: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x313_Cells_13_16.Cell16)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell13_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x313_Cells_13_16.Cell13_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell14_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x313_Cells_13_16.Cell14_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell15_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x313_Cells_13_16.Cell15_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell16_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x313_Cells_13_16.Cell16_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x313_Cells_13_16_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x313_Cells_13_16(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell13: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x313_Cells_13_16.Cell13 = w;
+	/* Cell14: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x313_Cells_13_16.Cell14 = w;
+	/* Cell15: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x313_Cells_13_16.Cell15 = w;
+	/* Cell16: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x313_Cells_13_16.Cell16 = w;
+	/* Cell13_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x313_Cells_13_16.Cell13_bal = w;
+	/* Cell14_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x313_Cells_13_16.Cell14_bal = w;
+	/* Cell15_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x313_Cells_13_16.Cell15_bal = w;
+	/* Cell16_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x313_Cells_13_16.Cell16_bal = w;
+	o->can_0x313_Cells_13_16_rx = 1;
+	o->can_0x313_Cells_13_16_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x313_Cell13(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x313_Cells_13_16.Cell13);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell13(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x313_Cells_13_16.Cell13 = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell14(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x313_Cells_13_16.Cell14);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell14(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x313_Cells_13_16.Cell14 = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell15(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x313_Cells_13_16.Cell15);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell15(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x313_Cells_13_16.Cell15 = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell16(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x313_Cells_13_16.Cell16);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell16(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x313_Cells_13_16.Cell16 = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell13_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x313_Cells_13_16.Cell13_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell13_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x313_Cells_13_16.Cell13_bal = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell14_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x313_Cells_13_16.Cell14_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell14_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x313_Cells_13_16.Cell14_bal = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell15_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x313_Cells_13_16.Cell15_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell15_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x313_Cells_13_16.Cell15_bal = in;
+	return 0;
+}
+
+int decode_can_0x313_Cell16_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x313_Cells_13_16.Cell16_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x313_Cell16_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x313_Cells_13_16.Cell16_bal = in;
+	return 0;
+}
+
+int print_can_0x313_Cells_13_16(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell13 = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell13)));
+	r = print_helper(r, fprintf(output, "Cell14 = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell14)));
+	r = print_helper(r, fprintf(output, "Cell15 = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell15)));
+	r = print_helper(r, fprintf(output, "Cell16 = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell16)));
+	r = print_helper(r, fprintf(output, "Cell13_bal = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell13_bal)));
+	r = print_helper(r, fprintf(output, "Cell14_bal = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell14_bal)));
+	r = print_helper(r, fprintf(output, "Cell15_bal = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell15_bal)));
+	r = print_helper(r, fprintf(output, "Cell16_bal = (wire: %.0f)\n", (double)(o->can_0x313_Cells_13_16.Cell16_bal)));
+	return r;
+}
+
+static int pack_can_0x314_Cells_17_20(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell17: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x314_Cells_17_20.Cell17)) & 0x7fff;
+	lo |= w;
+	/* Cell18: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x314_Cells_17_20.Cell18)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell19: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x314_Cells_17_20.Cell19)) & 0x7fff;
+	hi |= w;
+	/* Cell20: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x314_Cells_17_20.Cell20)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell17_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x314_Cells_17_20.Cell17_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell18_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x314_Cells_17_20.Cell18_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell19_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x314_Cells_17_20.Cell19_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell20_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x314_Cells_17_20.Cell20_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x314_Cells_17_20_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x314_Cells_17_20(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell17: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x314_Cells_17_20.Cell17 = w;
+	/* Cell18: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x314_Cells_17_20.Cell18 = w;
+	/* Cell19: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x314_Cells_17_20.Cell19 = w;
+	/* Cell20: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x314_Cells_17_20.Cell20 = w;
+	/* Cell17_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x314_Cells_17_20.Cell17_bal = w;
+	/* Cell18_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x314_Cells_17_20.Cell18_bal = w;
+	/* Cell19_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x314_Cells_17_20.Cell19_bal = w;
+	/* Cell20_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x314_Cells_17_20.Cell20_bal = w;
+	o->can_0x314_Cells_17_20_rx = 1;
+	o->can_0x314_Cells_17_20_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x314_Cell17(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x314_Cells_17_20.Cell17);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell17(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x314_Cells_17_20.Cell17 = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell18(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x314_Cells_17_20.Cell18);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell18(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x314_Cells_17_20.Cell18 = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell19(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x314_Cells_17_20.Cell19);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell19(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x314_Cells_17_20.Cell19 = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell20(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x314_Cells_17_20.Cell20);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell20(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x314_Cells_17_20.Cell20 = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell17_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x314_Cells_17_20.Cell17_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell17_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x314_Cells_17_20.Cell17_bal = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell18_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x314_Cells_17_20.Cell18_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell18_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x314_Cells_17_20.Cell18_bal = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell19_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x314_Cells_17_20.Cell19_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell19_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x314_Cells_17_20.Cell19_bal = in;
+	return 0;
+}
+
+int decode_can_0x314_Cell20_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x314_Cells_17_20.Cell20_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x314_Cell20_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x314_Cells_17_20.Cell20_bal = in;
+	return 0;
+}
+
+int print_can_0x314_Cells_17_20(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell17 = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell17)));
+	r = print_helper(r, fprintf(output, "Cell18 = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell18)));
+	r = print_helper(r, fprintf(output, "Cell19 = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell19)));
+	r = print_helper(r, fprintf(output, "Cell20 = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell20)));
+	r = print_helper(r, fprintf(output, "Cell17_bal = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell17_bal)));
+	r = print_helper(r, fprintf(output, "Cell18_bal = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell18_bal)));
+	r = print_helper(r, fprintf(output, "Cell19_bal = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell19_bal)));
+	r = print_helper(r, fprintf(output, "Cell20_bal = (wire: %.0f)\n", (double)(o->can_0x314_Cells_17_20.Cell20_bal)));
+	return r;
+}
+
+static int pack_can_0x315_Cells_21_24(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell21: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x315_Cells_21_24.Cell21)) & 0x7fff;
+	lo |= w;
+	/* Cell22: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x315_Cells_21_24.Cell22)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell23: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x315_Cells_21_24.Cell23)) & 0x7fff;
+	hi |= w;
+	/* Cell24: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x315_Cells_21_24.Cell24)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell21_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x315_Cells_21_24.Cell21_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell22_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x315_Cells_21_24.Cell22_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell23_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x315_Cells_21_24.Cell23_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell24_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x315_Cells_21_24.Cell24_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x315_Cells_21_24_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x315_Cells_21_24(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell21: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x315_Cells_21_24.Cell21 = w;
+	/* Cell22: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x315_Cells_21_24.Cell22 = w;
+	/* Cell23: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x315_Cells_21_24.Cell23 = w;
+	/* Cell24: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x315_Cells_21_24.Cell24 = w;
+	/* Cell21_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x315_Cells_21_24.Cell21_bal = w;
+	/* Cell22_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x315_Cells_21_24.Cell22_bal = w;
+	/* Cell23_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x315_Cells_21_24.Cell23_bal = w;
+	/* Cell24_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x315_Cells_21_24.Cell24_bal = w;
+	o->can_0x315_Cells_21_24_rx = 1;
+	o->can_0x315_Cells_21_24_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x315_Cell21(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x315_Cells_21_24.Cell21);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x315_Cell21(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x315_Cells_21_24.Cell21 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x315_Cells_21_24.Cell21 = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell22(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x315_Cells_21_24.Cell22);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x315_Cell22(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x315_Cells_21_24.Cell22 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x315_Cells_21_24.Cell22 = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell23(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x315_Cells_21_24.Cell23);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x315_Cell23(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x315_Cells_21_24.Cell23 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x315_Cells_21_24.Cell23 = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell24(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x315_Cells_21_24.Cell24);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x315_Cell24(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x315_Cells_21_24.Cell24 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x315_Cells_21_24.Cell24 = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell21_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x315_Cells_21_24.Cell21_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x315_Cell21_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x315_Cells_21_24.Cell21_bal = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell22_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x315_Cells_21_24.Cell22_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x315_Cell22_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x315_Cells_21_24.Cell22_bal = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell23_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x315_Cells_21_24.Cell23_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x315_Cell23_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x315_Cells_21_24.Cell23_bal = in;
+	return 0;
+}
+
+int decode_can_0x315_Cell24_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x315_Cells_21_24.Cell24_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x315_Cell24_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x315_Cells_21_24.Cell24_bal = in;
+	return 0;
+}
+
+int print_can_0x315_Cells_21_24(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell21 = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell21)));
+	r = print_helper(r, fprintf(output, "Cell22 = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell22)));
+	r = print_helper(r, fprintf(output, "Cell23 = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell23)));
+	r = print_helper(r, fprintf(output, "Cell24 = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell24)));
+	r = print_helper(r, fprintf(output, "Cell21_bal = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell21_bal)));
+	r = print_helper(r, fprintf(output, "Cell22_bal = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell22_bal)));
+	r = print_helper(r, fprintf(output, "Cell23_bal = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell23_bal)));
+	r = print_helper(r, fprintf(output, "Cell24_bal = (wire: %.0f)\n", (double)(o->can_0x315_Cells_21_24.Cell24_bal)));
+	return r;
+}
+
+static int pack_can_0x316_Cells_25_28(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell25: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x316_Cells_25_28.Cell25)) & 0x7fff;
+	lo |= w;
+	/* Cell26: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x316_Cells_25_28.Cell26)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell27: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x316_Cells_25_28.Cell27)) & 0x7fff;
+	hi |= w;
+	/* Cell28: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x316_Cells_25_28.Cell28)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell25_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x316_Cells_25_28.Cell25_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell26_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x316_Cells_25_28.Cell26_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell27_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x316_Cells_25_28.Cell27_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell28_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x316_Cells_25_28.Cell28_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x316_Cells_25_28_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x316_Cells_25_28(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell25: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x316_Cells_25_28.Cell25 = w;
+	/* Cell26: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x316_Cells_25_28.Cell26 = w;
+	/* Cell27: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x316_Cells_25_28.Cell27 = w;
+	/* Cell28: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x316_Cells_25_28.Cell28 = w;
+	/* Cell25_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x316_Cells_25_28.Cell25_bal = w;
+	/* Cell26_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x316_Cells_25_28.Cell26_bal = w;
+	/* Cell27_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x316_Cells_25_28.Cell27_bal = w;
+	/* Cell28_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x316_Cells_25_28.Cell28_bal = w;
+	o->can_0x316_Cells_25_28_rx = 1;
+	o->can_0x316_Cells_25_28_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x316_Cell25(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x316_Cells_25_28.Cell25);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x316_Cell25(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x316_Cells_25_28.Cell25 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x316_Cells_25_28.Cell25 = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell26(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x316_Cells_25_28.Cell26);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x316_Cell26(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x316_Cells_25_28.Cell26 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x316_Cells_25_28.Cell26 = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell27(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x316_Cells_25_28.Cell27);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x316_Cell27(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x316_Cells_25_28.Cell27 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x316_Cells_25_28.Cell27 = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell28(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x316_Cells_25_28.Cell28);
+	if (rval >= -16383) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x316_Cell28(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x316_Cells_25_28.Cell28 = 0;
+	if (in < -16383)
+		return -1;
+	o->can_0x316_Cells_25_28.Cell28 = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell25_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x316_Cells_25_28.Cell25_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x316_Cell25_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x316_Cells_25_28.Cell25_bal = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell26_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x316_Cells_25_28.Cell26_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x316_Cell26_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x316_Cells_25_28.Cell26_bal = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell27_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x316_Cells_25_28.Cell27_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x316_Cell27_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x316_Cells_25_28.Cell27_bal = in;
+	return 0;
+}
+
+int decode_can_0x316_Cell28_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x316_Cells_25_28.Cell28_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x316_Cell28_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x316_Cells_25_28.Cell28_bal = in;
+	return 0;
+}
+
+int print_can_0x316_Cells_25_28(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell25 = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell25)));
+	r = print_helper(r, fprintf(output, "Cell26 = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell26)));
+	r = print_helper(r, fprintf(output, "Cell27 = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell27)));
+	r = print_helper(r, fprintf(output, "Cell28 = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell28)));
+	r = print_helper(r, fprintf(output, "Cell25_bal = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell25_bal)));
+	r = print_helper(r, fprintf(output, "Cell26_bal = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell26_bal)));
+	r = print_helper(r, fprintf(output, "Cell27_bal = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell27_bal)));
+	r = print_helper(r, fprintf(output, "Cell28_bal = (wire: %.0f)\n", (double)(o->can_0x316_Cells_25_28.Cell28_bal)));
+	return r;
+}
+
+static int pack_can_0x317_Cells_29_32(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell29: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x317_Cells_29_32.Cell29)) & 0x7fff;
+	lo |= w;
+	/* Cell30: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x317_Cells_29_32.Cell30)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell31: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x317_Cells_29_32.Cell31)) & 0x7fff;
+	hi |= w;
+	/* Cell32: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x317_Cells_29_32.Cell32)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell29_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x317_Cells_29_32.Cell29_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell30_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x317_Cells_29_32.Cell30_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell31_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x317_Cells_29_32.Cell31_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell32_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x317_Cells_29_32.Cell32_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x317_Cells_29_32_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x317_Cells_29_32(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell29: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x317_Cells_29_32.Cell29 = w;
+	/* Cell30: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x317_Cells_29_32.Cell30 = w;
+	/* Cell31: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x317_Cells_29_32.Cell31 = w;
+	/* Cell32: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x317_Cells_29_32.Cell32 = w;
+	/* Cell29_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x317_Cells_29_32.Cell29_bal = w;
+	/* Cell30_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x317_Cells_29_32.Cell30_bal = w;
+	/* Cell31_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x317_Cells_29_32.Cell31_bal = w;
+	/* Cell32_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x317_Cells_29_32.Cell32_bal = w;
+	o->can_0x317_Cells_29_32_rx = 1;
+	o->can_0x317_Cells_29_32_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x317_Cell29(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x317_Cells_29_32.Cell29);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell29(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x317_Cells_29_32.Cell29 = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell30(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x317_Cells_29_32.Cell30);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell30(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x317_Cells_29_32.Cell30 = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell31(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x317_Cells_29_32.Cell31);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell31(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x317_Cells_29_32.Cell31 = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell32(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x317_Cells_29_32.Cell32);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell32(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x317_Cells_29_32.Cell32 = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell29_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x317_Cells_29_32.Cell29_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell29_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x317_Cells_29_32.Cell29_bal = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell30_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x317_Cells_29_32.Cell30_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell30_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x317_Cells_29_32.Cell30_bal = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell31_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x317_Cells_29_32.Cell31_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell31_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x317_Cells_29_32.Cell31_bal = in;
+	return 0;
+}
+
+int decode_can_0x317_Cell32_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x317_Cells_29_32.Cell32_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x317_Cell32_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x317_Cells_29_32.Cell32_bal = in;
+	return 0;
+}
+
+int print_can_0x317_Cells_29_32(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell29 = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell29)));
+	r = print_helper(r, fprintf(output, "Cell30 = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell30)));
+	r = print_helper(r, fprintf(output, "Cell31 = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell31)));
+	r = print_helper(r, fprintf(output, "Cell32 = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell32)));
+	r = print_helper(r, fprintf(output, "Cell29_bal = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell29_bal)));
+	r = print_helper(r, fprintf(output, "Cell30_bal = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell30_bal)));
+	r = print_helper(r, fprintf(output, "Cell31_bal = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell31_bal)));
+	r = print_helper(r, fprintf(output, "Cell32_bal = (wire: %.0f)\n", (double)(o->can_0x317_Cells_29_32.Cell32_bal)));
+	return r;
+}
+
+static int pack_can_0x318_Cells_33_36(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell33: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x318_Cells_33_36.Cell33)) & 0x7fff;
+	lo |= w;
+	/* Cell34: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x318_Cells_33_36.Cell34)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell35: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x318_Cells_33_36.Cell35)) & 0x7fff;
+	hi |= w;
+	/* Cell36: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x318_Cells_33_36.Cell36)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell33_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x318_Cells_33_36.Cell33_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell34_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x318_Cells_33_36.Cell34_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell35_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x318_Cells_33_36.Cell35_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell36_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x318_Cells_33_36.Cell36_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x318_Cells_33_36_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x318_Cells_33_36(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell33: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x318_Cells_33_36.Cell33 = w;
+	/* Cell34: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x318_Cells_33_36.Cell34 = w;
+	/* Cell35: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x318_Cells_33_36.Cell35 = w;
+	/* Cell36: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x318_Cells_33_36.Cell36 = w;
+	/* Cell33_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x318_Cells_33_36.Cell33_bal = w;
+	/* Cell34_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x318_Cells_33_36.Cell34_bal = w;
+	/* Cell35_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x318_Cells_33_36.Cell35_bal = w;
+	/* Cell36_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x318_Cells_33_36.Cell36_bal = w;
+	o->can_0x318_Cells_33_36_rx = 1;
+	o->can_0x318_Cells_33_36_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x318_Cell33(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x318_Cells_33_36.Cell33);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell33(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x318_Cells_33_36.Cell33 = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell34(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x318_Cells_33_36.Cell34);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell34(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x318_Cells_33_36.Cell34 = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell35(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x318_Cells_33_36.Cell35);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell35(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x318_Cells_33_36.Cell35 = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell36(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x318_Cells_33_36.Cell36);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell36(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x318_Cells_33_36.Cell36 = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell33_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x318_Cells_33_36.Cell33_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell33_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x318_Cells_33_36.Cell33_bal = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell34_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x318_Cells_33_36.Cell34_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell34_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x318_Cells_33_36.Cell34_bal = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell35_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x318_Cells_33_36.Cell35_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell35_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x318_Cells_33_36.Cell35_bal = in;
+	return 0;
+}
+
+int decode_can_0x318_Cell36_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x318_Cells_33_36.Cell36_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x318_Cell36_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x318_Cells_33_36.Cell36_bal = in;
+	return 0;
+}
+
+int print_can_0x318_Cells_33_36(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell33 = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell33)));
+	r = print_helper(r, fprintf(output, "Cell34 = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell34)));
+	r = print_helper(r, fprintf(output, "Cell35 = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell35)));
+	r = print_helper(r, fprintf(output, "Cell36 = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell36)));
+	r = print_helper(r, fprintf(output, "Cell33_bal = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell33_bal)));
+	r = print_helper(r, fprintf(output, "Cell34_bal = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell34_bal)));
+	r = print_helper(r, fprintf(output, "Cell35_bal = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell35_bal)));
+	r = print_helper(r, fprintf(output, "Cell36_bal = (wire: %.0f)\n", (double)(o->can_0x318_Cells_33_36.Cell36_bal)));
+	return r;
+}
+
+static int pack_can_0x319_Cells_37_40(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell37: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x319_Cells_37_40.Cell37)) & 0x7fff;
+	lo |= w;
+	/* Cell38: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x319_Cells_37_40.Cell38)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell39: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x319_Cells_37_40.Cell39)) & 0x7fff;
+	hi |= w;
+	/* Cell40: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x319_Cells_37_40.Cell40)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell37_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x319_Cells_37_40.Cell37_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell38_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x319_Cells_37_40.Cell38_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell39_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x319_Cells_37_40.Cell39_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell40_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x319_Cells_37_40.Cell40_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x319_Cells_37_40_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x319_Cells_37_40(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell37: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x319_Cells_37_40.Cell37 = w;
+	/* Cell38: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x319_Cells_37_40.Cell38 = w;
+	/* Cell39: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x319_Cells_37_40.Cell39 = w;
+	/* Cell40: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x319_Cells_37_40.Cell40 = w;
+	/* Cell37_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x319_Cells_37_40.Cell37_bal = w;
+	/* Cell38_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x319_Cells_37_40.Cell38_bal = w;
+	/* Cell39_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x319_Cells_37_40.Cell39_bal = w;
+	/* Cell40_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x319_Cells_37_40.Cell40_bal = w;
+	o->can_0x319_Cells_37_40_rx = 1;
+	o->can_0x319_Cells_37_40_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x319_Cell37(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x319_Cells_37_40.Cell37);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell37(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x319_Cells_37_40.Cell37 = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell38(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x319_Cells_37_40.Cell38);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell38(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x319_Cells_37_40.Cell38 = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell39(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x319_Cells_37_40.Cell39);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell39(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x319_Cells_37_40.Cell39 = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell40(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x319_Cells_37_40.Cell40);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell40(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x319_Cells_37_40.Cell40 = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell37_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x319_Cells_37_40.Cell37_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell37_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x319_Cells_37_40.Cell37_bal = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell38_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x319_Cells_37_40.Cell38_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell38_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x319_Cells_37_40.Cell38_bal = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell39_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x319_Cells_37_40.Cell39_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell39_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x319_Cells_37_40.Cell39_bal = in;
+	return 0;
+}
+
+int decode_can_0x319_Cell40_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x319_Cells_37_40.Cell40_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x319_Cell40_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x319_Cells_37_40.Cell40_bal = in;
+	return 0;
+}
+
+int print_can_0x319_Cells_37_40(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell37 = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell37)));
+	r = print_helper(r, fprintf(output, "Cell38 = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell38)));
+	r = print_helper(r, fprintf(output, "Cell39 = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell39)));
+	r = print_helper(r, fprintf(output, "Cell40 = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell40)));
+	r = print_helper(r, fprintf(output, "Cell37_bal = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell37_bal)));
+	r = print_helper(r, fprintf(output, "Cell38_bal = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell38_bal)));
+	r = print_helper(r, fprintf(output, "Cell39_bal = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell39_bal)));
+	r = print_helper(r, fprintf(output, "Cell40_bal = (wire: %.0f)\n", (double)(o->can_0x319_Cells_37_40.Cell40_bal)));
+	return r;
+}
+
+static int pack_can_0x31a_Cells_41_44(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell41: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31a_Cells_41_44.Cell41)) & 0x7fff;
+	lo |= w;
+	/* Cell42: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31a_Cells_41_44.Cell42)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell43: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31a_Cells_41_44.Cell43)) & 0x7fff;
+	hi |= w;
+	/* Cell44: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31a_Cells_41_44.Cell44)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell41_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31a_Cells_41_44.Cell41_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell42_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31a_Cells_41_44.Cell42_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell43_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31a_Cells_41_44.Cell43_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell44_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31a_Cells_41_44.Cell44_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x31a_Cells_41_44_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x31a_Cells_41_44(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell41: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31a_Cells_41_44.Cell41 = w;
+	/* Cell42: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31a_Cells_41_44.Cell42 = w;
+	/* Cell43: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31a_Cells_41_44.Cell43 = w;
+	/* Cell44: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31a_Cells_41_44.Cell44 = w;
+	/* Cell41_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x31a_Cells_41_44.Cell41_bal = w;
+	/* Cell42_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x31a_Cells_41_44.Cell42_bal = w;
+	/* Cell43_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x31a_Cells_41_44.Cell43_bal = w;
+	/* Cell44_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x31a_Cells_41_44.Cell44_bal = w;
+	o->can_0x31a_Cells_41_44_rx = 1;
+	o->can_0x31a_Cells_41_44_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x31a_Cell41(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31a_Cells_41_44.Cell41);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell41(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31a_Cells_41_44.Cell41 = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell42(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31a_Cells_41_44.Cell42);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell42(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31a_Cells_41_44.Cell42 = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell43(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31a_Cells_41_44.Cell43);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell43(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31a_Cells_41_44.Cell43 = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell44(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31a_Cells_41_44.Cell44);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell44(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31a_Cells_41_44.Cell44 = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell41_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31a_Cells_41_44.Cell41_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell41_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31a_Cells_41_44.Cell41_bal = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell42_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31a_Cells_41_44.Cell42_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell42_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31a_Cells_41_44.Cell42_bal = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell43_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31a_Cells_41_44.Cell43_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell43_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31a_Cells_41_44.Cell43_bal = in;
+	return 0;
+}
+
+int decode_can_0x31a_Cell44_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31a_Cells_41_44.Cell44_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31a_Cell44_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31a_Cells_41_44.Cell44_bal = in;
+	return 0;
+}
+
+int print_can_0x31a_Cells_41_44(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell41 = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell41)));
+	r = print_helper(r, fprintf(output, "Cell42 = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell42)));
+	r = print_helper(r, fprintf(output, "Cell43 = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell43)));
+	r = print_helper(r, fprintf(output, "Cell44 = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell44)));
+	r = print_helper(r, fprintf(output, "Cell41_bal = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell41_bal)));
+	r = print_helper(r, fprintf(output, "Cell42_bal = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell42_bal)));
+	r = print_helper(r, fprintf(output, "Cell43_bal = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell43_bal)));
+	r = print_helper(r, fprintf(output, "Cell44_bal = (wire: %.0f)\n", (double)(o->can_0x31a_Cells_41_44.Cell44_bal)));
+	return r;
+}
+
+static int pack_can_0x31b_Cells_45_48(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell45: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31b_Cells_45_48.Cell45)) & 0x7fff;
+	lo |= w;
+	/* Cell46: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31b_Cells_45_48.Cell46)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell47: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31b_Cells_45_48.Cell47)) & 0x7fff;
+	hi |= w;
+	/* Cell48: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31b_Cells_45_48.Cell48)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell45_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31b_Cells_45_48.Cell45_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell46_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31b_Cells_45_48.Cell46_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell47_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31b_Cells_45_48.Cell47_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell48_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31b_Cells_45_48.Cell48_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x31b_Cells_45_48_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x31b_Cells_45_48(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell45: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31b_Cells_45_48.Cell45 = w;
+	/* Cell46: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31b_Cells_45_48.Cell46 = w;
+	/* Cell47: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31b_Cells_45_48.Cell47 = w;
+	/* Cell48: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31b_Cells_45_48.Cell48 = w;
+	/* Cell45_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x31b_Cells_45_48.Cell45_bal = w;
+	/* Cell46_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x31b_Cells_45_48.Cell46_bal = w;
+	/* Cell47_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x31b_Cells_45_48.Cell47_bal = w;
+	/* Cell48_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x31b_Cells_45_48.Cell48_bal = w;
+	o->can_0x31b_Cells_45_48_rx = 1;
+	o->can_0x31b_Cells_45_48_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x31b_Cell45(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31b_Cells_45_48.Cell45);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell45(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31b_Cells_45_48.Cell45 = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell46(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31b_Cells_45_48.Cell46);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell46(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31b_Cells_45_48.Cell46 = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell47(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31b_Cells_45_48.Cell47);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell47(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31b_Cells_45_48.Cell47 = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell48(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31b_Cells_45_48.Cell48);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell48(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31b_Cells_45_48.Cell48 = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell45_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31b_Cells_45_48.Cell45_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell45_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31b_Cells_45_48.Cell45_bal = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell46_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31b_Cells_45_48.Cell46_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell46_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31b_Cells_45_48.Cell46_bal = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell47_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31b_Cells_45_48.Cell47_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell47_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31b_Cells_45_48.Cell47_bal = in;
+	return 0;
+}
+
+int decode_can_0x31b_Cell48_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31b_Cells_45_48.Cell48_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31b_Cell48_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31b_Cells_45_48.Cell48_bal = in;
+	return 0;
+}
+
+int print_can_0x31b_Cells_45_48(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell45 = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell45)));
+	r = print_helper(r, fprintf(output, "Cell46 = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell46)));
+	r = print_helper(r, fprintf(output, "Cell47 = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell47)));
+	r = print_helper(r, fprintf(output, "Cell48 = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell48)));
+	r = print_helper(r, fprintf(output, "Cell45_bal = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell45_bal)));
+	r = print_helper(r, fprintf(output, "Cell46_bal = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell46_bal)));
+	r = print_helper(r, fprintf(output, "Cell47_bal = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell47_bal)));
+	r = print_helper(r, fprintf(output, "Cell48_bal = (wire: %.0f)\n", (double)(o->can_0x31b_Cells_45_48.Cell48_bal)));
+	return r;
+}
+
+static int pack_can_0x31c_Cells_49_52(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell49: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31c_Cells_49_52.Cell49)) & 0x7fff;
+	lo |= w;
+	/* Cell50: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31c_Cells_49_52.Cell50)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell51: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31c_Cells_49_52.Cell51)) & 0x7fff;
+	hi |= w;
+	/* Cell52: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31c_Cells_49_52.Cell52)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell49_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31c_Cells_49_52.Cell49_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell50_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31c_Cells_49_52.Cell50_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell51_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31c_Cells_49_52.Cell51_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell52_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31c_Cells_49_52.Cell52_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x31c_Cells_49_52_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x31c_Cells_49_52(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell49: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31c_Cells_49_52.Cell49 = w;
+	/* Cell50: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31c_Cells_49_52.Cell50 = w;
+	/* Cell51: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31c_Cells_49_52.Cell51 = w;
+	/* Cell52: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31c_Cells_49_52.Cell52 = w;
+	/* Cell49_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x31c_Cells_49_52.Cell49_bal = w;
+	/* Cell50_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x31c_Cells_49_52.Cell50_bal = w;
+	/* Cell51_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x31c_Cells_49_52.Cell51_bal = w;
+	/* Cell52_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x31c_Cells_49_52.Cell52_bal = w;
+	o->can_0x31c_Cells_49_52_rx = 1;
+	o->can_0x31c_Cells_49_52_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x31c_Cell49(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31c_Cells_49_52.Cell49);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell49(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31c_Cells_49_52.Cell49 = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell50(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31c_Cells_49_52.Cell50);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell50(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31c_Cells_49_52.Cell50 = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell51(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31c_Cells_49_52.Cell51);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell51(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31c_Cells_49_52.Cell51 = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell52(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31c_Cells_49_52.Cell52);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell52(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31c_Cells_49_52.Cell52 = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell49_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31c_Cells_49_52.Cell49_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell49_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31c_Cells_49_52.Cell49_bal = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell50_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31c_Cells_49_52.Cell50_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell50_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31c_Cells_49_52.Cell50_bal = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell51_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31c_Cells_49_52.Cell51_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell51_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31c_Cells_49_52.Cell51_bal = in;
+	return 0;
+}
+
+int decode_can_0x31c_Cell52_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31c_Cells_49_52.Cell52_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31c_Cell52_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31c_Cells_49_52.Cell52_bal = in;
+	return 0;
+}
+
+int print_can_0x31c_Cells_49_52(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell49 = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell49)));
+	r = print_helper(r, fprintf(output, "Cell50 = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell50)));
+	r = print_helper(r, fprintf(output, "Cell51 = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell51)));
+	r = print_helper(r, fprintf(output, "Cell52 = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell52)));
+	r = print_helper(r, fprintf(output, "Cell49_bal = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell49_bal)));
+	r = print_helper(r, fprintf(output, "Cell50_bal = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell50_bal)));
+	r = print_helper(r, fprintf(output, "Cell51_bal = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell51_bal)));
+	r = print_helper(r, fprintf(output, "Cell52_bal = (wire: %.0f)\n", (double)(o->can_0x31c_Cells_49_52.Cell52_bal)));
+	return r;
+}
+
+static int pack_can_0x31d_Cells_53_54(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell53: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31d_Cells_53_54.Cell53)) & 0x7fff;
+	lo |= w;
+	/* Cell54: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31d_Cells_53_54.Cell54)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell53_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31d_Cells_53_54.Cell53_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell54_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31d_Cells_53_54.Cell54_bal)) & 0x1;
+	lo |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x31d_Cells_53_54_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x31d_Cells_53_54(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 8)
+		return -1;
+	/* Cell53: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31d_Cells_53_54.Cell53 = w;
+	/* Cell54: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31d_Cells_53_54.Cell54 = w;
+	/* Cell53_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x31d_Cells_53_54.Cell53_bal = w;
+	/* Cell54_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x31d_Cells_53_54.Cell54_bal = w;
+	o->can_0x31d_Cells_53_54_rx = 1;
+	o->can_0x31d_Cells_53_54_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x31d_Cell53(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31d_Cells_53_54.Cell53);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31d_Cell53(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31d_Cells_53_54.Cell53 = in;
+	return 0;
+}
+
+int decode_can_0x31d_Cell54(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31d_Cells_53_54.Cell54);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31d_Cell54(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31d_Cells_53_54.Cell54 = in;
+	return 0;
+}
+
+int decode_can_0x31d_Cell53_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31d_Cells_53_54.Cell53_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31d_Cell53_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31d_Cells_53_54.Cell53_bal = in;
+	return 0;
+}
+
+int decode_can_0x31d_Cell54_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31d_Cells_53_54.Cell54_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31d_Cell54_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31d_Cells_53_54.Cell54_bal = in;
+	return 0;
+}
+
+int print_can_0x31d_Cells_53_54(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell53 = (wire: %.0f)\n", (double)(o->can_0x31d_Cells_53_54.Cell53)));
+	r = print_helper(r, fprintf(output, "Cell54 = (wire: %.0f)\n", (double)(o->can_0x31d_Cells_53_54.Cell54)));
+	r = print_helper(r, fprintf(output, "Cell53_bal = (wire: %.0f)\n", (double)(o->can_0x31d_Cells_53_54.Cell53_bal)));
+	r = print_helper(r, fprintf(output, "Cell54_bal = (wire: %.0f)\n", (double)(o->can_0x31d_Cells_53_54.Cell54_bal)));
+	return r;
+}
+
+static int pack_can_0x31e_Cells_55_58(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell55: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31e_Cells_55_58.Cell55)) & 0x7fff;
+	lo |= w;
+	/* Cell56: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31e_Cells_55_58.Cell56)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell57: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31e_Cells_55_58.Cell57)) & 0x7fff;
+	hi |= w;
+	/* Cell58: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31e_Cells_55_58.Cell58)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell55_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31e_Cells_55_58.Cell55_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell56_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31e_Cells_55_58.Cell56_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell57_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31e_Cells_55_58.Cell57_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell58_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31e_Cells_55_58.Cell58_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x31e_Cells_55_58_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x31e_Cells_55_58(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell55: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31e_Cells_55_58.Cell55 = w;
+	/* Cell56: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31e_Cells_55_58.Cell56 = w;
+	/* Cell57: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31e_Cells_55_58.Cell57 = w;
+	/* Cell58: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31e_Cells_55_58.Cell58 = w;
+	/* Cell55_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x31e_Cells_55_58.Cell55_bal = w;
+	/* Cell56_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x31e_Cells_55_58.Cell56_bal = w;
+	/* Cell57_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x31e_Cells_55_58.Cell57_bal = w;
+	/* Cell58_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x31e_Cells_55_58.Cell58_bal = w;
+	o->can_0x31e_Cells_55_58_rx = 1;
+	o->can_0x31e_Cells_55_58_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x31e_Cell55(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31e_Cells_55_58.Cell55);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31e_Cell55(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31e_Cells_55_58.Cell55 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31e_Cells_55_58.Cell55 = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell56(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31e_Cells_55_58.Cell56);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31e_Cell56(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31e_Cells_55_58.Cell56 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31e_Cells_55_58.Cell56 = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell57(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31e_Cells_55_58.Cell57);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31e_Cell57(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31e_Cells_55_58.Cell57 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31e_Cells_55_58.Cell57 = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell58(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31e_Cells_55_58.Cell58);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31e_Cell58(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31e_Cells_55_58.Cell58 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31e_Cells_55_58.Cell58 = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell55_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31e_Cells_55_58.Cell55_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31e_Cell55_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31e_Cells_55_58.Cell55_bal = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell56_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31e_Cells_55_58.Cell56_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31e_Cell56_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31e_Cells_55_58.Cell56_bal = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell57_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31e_Cells_55_58.Cell57_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31e_Cell57_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31e_Cells_55_58.Cell57_bal = in;
+	return 0;
+}
+
+int decode_can_0x31e_Cell58_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31e_Cells_55_58.Cell58_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31e_Cell58_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31e_Cells_55_58.Cell58_bal = in;
+	return 0;
+}
+
+int print_can_0x31e_Cells_55_58(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell55 = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell55)));
+	r = print_helper(r, fprintf(output, "Cell56 = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell56)));
+	r = print_helper(r, fprintf(output, "Cell57 = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell57)));
+	r = print_helper(r, fprintf(output, "Cell58 = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell58)));
+	r = print_helper(r, fprintf(output, "Cell55_bal = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell55_bal)));
+	r = print_helper(r, fprintf(output, "Cell56_bal = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell56_bal)));
+	r = print_helper(r, fprintf(output, "Cell57_bal = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell57_bal)));
+	r = print_helper(r, fprintf(output, "Cell58_bal = (wire: %.0f)\n", (double)(o->can_0x31e_Cells_55_58.Cell58_bal)));
+	return r;
+}
+
+static int pack_can_0x31f_Cells_59_62(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell59: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31f_Cells_59_62.Cell59)) & 0x7fff;
+	lo |= w;
+	/* Cell60: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31f_Cells_59_62.Cell60)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell61: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31f_Cells_59_62.Cell61)) & 0x7fff;
+	hi |= w;
+	/* Cell62: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x31f_Cells_59_62.Cell62)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell59_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31f_Cells_59_62.Cell59_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell60_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31f_Cells_59_62.Cell60_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell61_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31f_Cells_59_62.Cell61_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell62_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x31f_Cells_59_62.Cell62_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x31f_Cells_59_62_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x31f_Cells_59_62(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell59: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31f_Cells_59_62.Cell59 = w;
+	/* Cell60: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31f_Cells_59_62.Cell60 = w;
+	/* Cell61: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31f_Cells_59_62.Cell61 = w;
+	/* Cell62: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x31f_Cells_59_62.Cell62 = w;
+	/* Cell59_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x31f_Cells_59_62.Cell59_bal = w;
+	/* Cell60_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x31f_Cells_59_62.Cell60_bal = w;
+	/* Cell61_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x31f_Cells_59_62.Cell61_bal = w;
+	/* Cell62_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x31f_Cells_59_62.Cell62_bal = w;
+	o->can_0x31f_Cells_59_62_rx = 1;
+	o->can_0x31f_Cells_59_62_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x31f_Cell59(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31f_Cells_59_62.Cell59);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31f_Cell59(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31f_Cells_59_62.Cell59 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31f_Cells_59_62.Cell59 = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell60(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31f_Cells_59_62.Cell60);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31f_Cell60(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31f_Cells_59_62.Cell60 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31f_Cells_59_62.Cell60 = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell61(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31f_Cells_59_62.Cell61);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31f_Cell61(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31f_Cells_59_62.Cell61 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31f_Cells_59_62.Cell61 = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell62(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x31f_Cells_59_62.Cell62);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x31f_Cell62(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x31f_Cells_59_62.Cell62 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x31f_Cells_59_62.Cell62 = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell59_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31f_Cells_59_62.Cell59_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31f_Cell59_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31f_Cells_59_62.Cell59_bal = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell60_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31f_Cells_59_62.Cell60_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31f_Cell60_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31f_Cells_59_62.Cell60_bal = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell61_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31f_Cells_59_62.Cell61_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31f_Cell61_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31f_Cells_59_62.Cell61_bal = in;
+	return 0;
+}
+
+int decode_can_0x31f_Cell62_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x31f_Cells_59_62.Cell62_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x31f_Cell62_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x31f_Cells_59_62.Cell62_bal = in;
+	return 0;
+}
+
+int print_can_0x31f_Cells_59_62(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell59 = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell59)));
+	r = print_helper(r, fprintf(output, "Cell60 = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell60)));
+	r = print_helper(r, fprintf(output, "Cell61 = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell61)));
+	r = print_helper(r, fprintf(output, "Cell62 = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell62)));
+	r = print_helper(r, fprintf(output, "Cell59_bal = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell59_bal)));
+	r = print_helper(r, fprintf(output, "Cell60_bal = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell60_bal)));
+	r = print_helper(r, fprintf(output, "Cell61_bal = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell61_bal)));
+	r = print_helper(r, fprintf(output, "Cell62_bal = (wire: %.0f)\n", (double)(o->can_0x31f_Cells_59_62.Cell62_bal)));
+	return r;
+}
+
+static int pack_can_0x320_Cells_63_66(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell63: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x320_Cells_63_66.Cell63)) & 0x7fff;
+	lo |= w;
+	/* Cell64: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x320_Cells_63_66.Cell64)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell65: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x320_Cells_63_66.Cell65)) & 0x7fff;
+	hi |= w;
+	/* Cell66: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x320_Cells_63_66.Cell66)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell63_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x320_Cells_63_66.Cell63_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell64_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x320_Cells_63_66.Cell64_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell65_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x320_Cells_63_66.Cell65_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell66_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x320_Cells_63_66.Cell66_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x320_Cells_63_66_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x320_Cells_63_66(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell63: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x320_Cells_63_66.Cell63 = w;
+	/* Cell64: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x320_Cells_63_66.Cell64 = w;
+	/* Cell65: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x320_Cells_63_66.Cell65 = w;
+	/* Cell66: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x320_Cells_63_66.Cell66 = w;
+	/* Cell63_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x320_Cells_63_66.Cell63_bal = w;
+	/* Cell64_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x320_Cells_63_66.Cell64_bal = w;
+	/* Cell65_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x320_Cells_63_66.Cell65_bal = w;
+	/* Cell66_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x320_Cells_63_66.Cell66_bal = w;
+	o->can_0x320_Cells_63_66_rx = 1;
+	o->can_0x320_Cells_63_66_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x320_Cell63(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x320_Cells_63_66.Cell63);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x320_Cell63(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x320_Cells_63_66.Cell63 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x320_Cells_63_66.Cell63 = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell64(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x320_Cells_63_66.Cell64);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x320_Cell64(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x320_Cells_63_66.Cell64 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x320_Cells_63_66.Cell64 = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell65(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x320_Cells_63_66.Cell65);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x320_Cell65(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x320_Cells_63_66.Cell65 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x320_Cells_63_66.Cell65 = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell66(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x320_Cells_63_66.Cell66);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x320_Cell66(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x320_Cells_63_66.Cell66 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x320_Cells_63_66.Cell66 = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell63_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x320_Cells_63_66.Cell63_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x320_Cell63_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x320_Cells_63_66.Cell63_bal = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell64_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x320_Cells_63_66.Cell64_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x320_Cell64_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x320_Cells_63_66.Cell64_bal = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell65_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x320_Cells_63_66.Cell65_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x320_Cell65_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x320_Cells_63_66.Cell65_bal = in;
+	return 0;
+}
+
+int decode_can_0x320_Cell66_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x320_Cells_63_66.Cell66_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x320_Cell66_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x320_Cells_63_66.Cell66_bal = in;
+	return 0;
+}
+
+int print_can_0x320_Cells_63_66(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell63 = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell63)));
+	r = print_helper(r, fprintf(output, "Cell64 = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell64)));
+	r = print_helper(r, fprintf(output, "Cell65 = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell65)));
+	r = print_helper(r, fprintf(output, "Cell66 = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell66)));
+	r = print_helper(r, fprintf(output, "Cell63_bal = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell63_bal)));
+	r = print_helper(r, fprintf(output, "Cell64_bal = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell64_bal)));
+	r = print_helper(r, fprintf(output, "Cell65_bal = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell65_bal)));
+	r = print_helper(r, fprintf(output, "Cell66_bal = (wire: %.0f)\n", (double)(o->can_0x320_Cells_63_66.Cell66_bal)));
+	return r;
+}
+
+static int pack_can_0x321_Cells_67_70(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell67: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x321_Cells_67_70.Cell67)) & 0x7fff;
+	lo |= w;
+	/* Cell68: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x321_Cells_67_70.Cell68)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell69: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x321_Cells_67_70.Cell69)) & 0x7fff;
+	hi |= w;
+	/* Cell70: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x321_Cells_67_70.Cell70)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell67_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x321_Cells_67_70.Cell67_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell68_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x321_Cells_67_70.Cell68_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell69_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x321_Cells_67_70.Cell69_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell70_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x321_Cells_67_70.Cell70_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x321_Cells_67_70_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x321_Cells_67_70(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell67: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x321_Cells_67_70.Cell67 = w;
+	/* Cell68: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x321_Cells_67_70.Cell68 = w;
+	/* Cell69: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x321_Cells_67_70.Cell69 = w;
+	/* Cell70: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x321_Cells_67_70.Cell70 = w;
+	/* Cell67_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x321_Cells_67_70.Cell67_bal = w;
+	/* Cell68_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x321_Cells_67_70.Cell68_bal = w;
+	/* Cell69_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x321_Cells_67_70.Cell69_bal = w;
+	/* Cell70_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x321_Cells_67_70.Cell70_bal = w;
+	o->can_0x321_Cells_67_70_rx = 1;
+	o->can_0x321_Cells_67_70_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x321_Cell67(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x321_Cells_67_70.Cell67);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x321_Cell67(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x321_Cells_67_70.Cell67 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x321_Cells_67_70.Cell67 = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell68(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x321_Cells_67_70.Cell68);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x321_Cell68(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x321_Cells_67_70.Cell68 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x321_Cells_67_70.Cell68 = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell69(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x321_Cells_67_70.Cell69);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x321_Cell69(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x321_Cells_67_70.Cell69 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x321_Cells_67_70.Cell69 = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell70(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x321_Cells_67_70.Cell70);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x321_Cell70(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x321_Cells_67_70.Cell70 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x321_Cells_67_70.Cell70 = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell67_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x321_Cells_67_70.Cell67_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x321_Cell67_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x321_Cells_67_70.Cell67_bal = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell68_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x321_Cells_67_70.Cell68_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x321_Cell68_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x321_Cells_67_70.Cell68_bal = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell69_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x321_Cells_67_70.Cell69_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x321_Cell69_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x321_Cells_67_70.Cell69_bal = in;
+	return 0;
+}
+
+int decode_can_0x321_Cell70_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x321_Cells_67_70.Cell70_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x321_Cell70_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x321_Cells_67_70.Cell70_bal = in;
+	return 0;
+}
+
+int print_can_0x321_Cells_67_70(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell67 = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell67)));
+	r = print_helper(r, fprintf(output, "Cell68 = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell68)));
+	r = print_helper(r, fprintf(output, "Cell69 = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell69)));
+	r = print_helper(r, fprintf(output, "Cell70 = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell70)));
+	r = print_helper(r, fprintf(output, "Cell67_bal = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell67_bal)));
+	r = print_helper(r, fprintf(output, "Cell68_bal = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell68_bal)));
+	r = print_helper(r, fprintf(output, "Cell69_bal = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell69_bal)));
+	r = print_helper(r, fprintf(output, "Cell70_bal = (wire: %.0f)\n", (double)(o->can_0x321_Cells_67_70.Cell70_bal)));
+	return r;
+}
+
+static int pack_can_0x322_Cells_71_74(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell71: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x322_Cells_71_74.Cell71)) & 0x7fff;
+	lo |= w;
+	/* Cell72: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x322_Cells_71_74.Cell72)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell73: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x322_Cells_71_74.Cell73)) & 0x7fff;
+	hi |= w;
+	/* Cell74: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x322_Cells_71_74.Cell74)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell71_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x322_Cells_71_74.Cell71_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell72_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x322_Cells_71_74.Cell72_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell73_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x322_Cells_71_74.Cell73_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell74_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x322_Cells_71_74.Cell74_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x322_Cells_71_74_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x322_Cells_71_74(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell71: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x322_Cells_71_74.Cell71 = w;
+	/* Cell72: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x322_Cells_71_74.Cell72 = w;
+	/* Cell73: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x322_Cells_71_74.Cell73 = w;
+	/* Cell74: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x322_Cells_71_74.Cell74 = w;
+	/* Cell71_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x322_Cells_71_74.Cell71_bal = w;
+	/* Cell72_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x322_Cells_71_74.Cell72_bal = w;
+	/* Cell73_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x322_Cells_71_74.Cell73_bal = w;
+	/* Cell74_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x322_Cells_71_74.Cell74_bal = w;
+	o->can_0x322_Cells_71_74_rx = 1;
+	o->can_0x322_Cells_71_74_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x322_Cell71(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x322_Cells_71_74.Cell71);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x322_Cell71(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x322_Cells_71_74.Cell71 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x322_Cells_71_74.Cell71 = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell72(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x322_Cells_71_74.Cell72);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x322_Cell72(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x322_Cells_71_74.Cell72 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x322_Cells_71_74.Cell72 = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell73(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x322_Cells_71_74.Cell73);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x322_Cell73(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x322_Cells_71_74.Cell73 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x322_Cells_71_74.Cell73 = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell74(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x322_Cells_71_74.Cell74);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x322_Cell74(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x322_Cells_71_74.Cell74 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x322_Cells_71_74.Cell74 = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell71_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x322_Cells_71_74.Cell71_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x322_Cell71_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x322_Cells_71_74.Cell71_bal = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell72_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x322_Cells_71_74.Cell72_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x322_Cell72_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x322_Cells_71_74.Cell72_bal = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell73_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x322_Cells_71_74.Cell73_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x322_Cell73_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x322_Cells_71_74.Cell73_bal = in;
+	return 0;
+}
+
+int decode_can_0x322_Cell74_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x322_Cells_71_74.Cell74_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x322_Cell74_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x322_Cells_71_74.Cell74_bal = in;
+	return 0;
+}
+
+int print_can_0x322_Cells_71_74(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell71 = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell71)));
+	r = print_helper(r, fprintf(output, "Cell72 = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell72)));
+	r = print_helper(r, fprintf(output, "Cell73 = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell73)));
+	r = print_helper(r, fprintf(output, "Cell74 = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell74)));
+	r = print_helper(r, fprintf(output, "Cell71_bal = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell71_bal)));
+	r = print_helper(r, fprintf(output, "Cell72_bal = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell72_bal)));
+	r = print_helper(r, fprintf(output, "Cell73_bal = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell73_bal)));
+	r = print_helper(r, fprintf(output, "Cell74_bal = (wire: %.0f)\n", (double)(o->can_0x322_Cells_71_74.Cell74_bal)));
+	return r;
+}
+
+static int pack_can_0x323_Cells_75_78(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell75: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x323_Cells_75_78.Cell75)) & 0x7fff;
+	lo |= w;
+	/* Cell76: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x323_Cells_75_78.Cell76)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell77: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x323_Cells_75_78.Cell77)) & 0x7fff;
+	hi |= w;
+	/* Cell78: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x323_Cells_75_78.Cell78)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell75_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x323_Cells_75_78.Cell75_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell76_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x323_Cells_75_78.Cell76_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell77_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x323_Cells_75_78.Cell77_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell78_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x323_Cells_75_78.Cell78_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x323_Cells_75_78_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x323_Cells_75_78(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell75: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x323_Cells_75_78.Cell75 = w;
+	/* Cell76: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x323_Cells_75_78.Cell76 = w;
+	/* Cell77: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x323_Cells_75_78.Cell77 = w;
+	/* Cell78: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x323_Cells_75_78.Cell78 = w;
+	/* Cell75_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x323_Cells_75_78.Cell75_bal = w;
+	/* Cell76_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x323_Cells_75_78.Cell76_bal = w;
+	/* Cell77_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x323_Cells_75_78.Cell77_bal = w;
+	/* Cell78_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x323_Cells_75_78.Cell78_bal = w;
+	o->can_0x323_Cells_75_78_rx = 1;
+	o->can_0x323_Cells_75_78_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x323_Cell75(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x323_Cells_75_78.Cell75);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x323_Cell75(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x323_Cells_75_78.Cell75 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x323_Cells_75_78.Cell75 = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell76(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x323_Cells_75_78.Cell76);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x323_Cell76(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x323_Cells_75_78.Cell76 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x323_Cells_75_78.Cell76 = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell77(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x323_Cells_75_78.Cell77);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x323_Cell77(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x323_Cells_75_78.Cell77 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x323_Cells_75_78.Cell77 = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell78(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x323_Cells_75_78.Cell78);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x323_Cell78(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x323_Cells_75_78.Cell78 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x323_Cells_75_78.Cell78 = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell75_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x323_Cells_75_78.Cell75_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x323_Cell75_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x323_Cells_75_78.Cell75_bal = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell76_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x323_Cells_75_78.Cell76_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x323_Cell76_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x323_Cells_75_78.Cell76_bal = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell77_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x323_Cells_75_78.Cell77_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x323_Cell77_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x323_Cells_75_78.Cell77_bal = in;
+	return 0;
+}
+
+int decode_can_0x323_Cell78_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x323_Cells_75_78.Cell78_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x323_Cell78_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x323_Cells_75_78.Cell78_bal = in;
+	return 0;
+}
+
+int print_can_0x323_Cells_75_78(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell75 = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell75)));
+	r = print_helper(r, fprintf(output, "Cell76 = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell76)));
+	r = print_helper(r, fprintf(output, "Cell77 = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell77)));
+	r = print_helper(r, fprintf(output, "Cell78 = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell78)));
+	r = print_helper(r, fprintf(output, "Cell75_bal = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell75_bal)));
+	r = print_helper(r, fprintf(output, "Cell76_bal = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell76_bal)));
+	r = print_helper(r, fprintf(output, "Cell77_bal = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell77_bal)));
+	r = print_helper(r, fprintf(output, "Cell78_bal = (wire: %.0f)\n", (double)(o->can_0x323_Cells_75_78.Cell78_bal)));
+	return r;
+}
+
+static int pack_can_0x324_Cells_79_82(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell79: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x324_Cells_79_82.Cell79)) & 0x7fff;
+	lo |= w;
+	/* Cell80: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x324_Cells_79_82.Cell80)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell81: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x324_Cells_79_82.Cell81)) & 0x7fff;
+	hi |= w;
+	/* Cell82: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x324_Cells_79_82.Cell82)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell79_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x324_Cells_79_82.Cell79_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell80_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x324_Cells_79_82.Cell80_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell81_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x324_Cells_79_82.Cell81_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell82_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x324_Cells_79_82.Cell82_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x324_Cells_79_82_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x324_Cells_79_82(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell79: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x324_Cells_79_82.Cell79 = w;
+	/* Cell80: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x324_Cells_79_82.Cell80 = w;
+	/* Cell81: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x324_Cells_79_82.Cell81 = w;
+	/* Cell82: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x324_Cells_79_82.Cell82 = w;
+	/* Cell79_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x324_Cells_79_82.Cell79_bal = w;
+	/* Cell80_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x324_Cells_79_82.Cell80_bal = w;
+	/* Cell81_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x324_Cells_79_82.Cell81_bal = w;
+	/* Cell82_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x324_Cells_79_82.Cell82_bal = w;
+	o->can_0x324_Cells_79_82_rx = 1;
+	o->can_0x324_Cells_79_82_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x324_Cell79(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x324_Cells_79_82.Cell79);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x324_Cell79(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x324_Cells_79_82.Cell79 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x324_Cells_79_82.Cell79 = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell80(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x324_Cells_79_82.Cell80);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x324_Cell80(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x324_Cells_79_82.Cell80 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x324_Cells_79_82.Cell80 = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell81(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x324_Cells_79_82.Cell81);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x324_Cell81(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x324_Cells_79_82.Cell81 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x324_Cells_79_82.Cell81 = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell82(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x324_Cells_79_82.Cell82);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x324_Cell82(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x324_Cells_79_82.Cell82 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x324_Cells_79_82.Cell82 = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell79_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x324_Cells_79_82.Cell79_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x324_Cell79_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x324_Cells_79_82.Cell79_bal = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell80_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x324_Cells_79_82.Cell80_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x324_Cell80_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x324_Cells_79_82.Cell80_bal = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell81_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x324_Cells_79_82.Cell81_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x324_Cell81_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x324_Cells_79_82.Cell81_bal = in;
+	return 0;
+}
+
+int decode_can_0x324_Cell82_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x324_Cells_79_82.Cell82_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x324_Cell82_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x324_Cells_79_82.Cell82_bal = in;
+	return 0;
+}
+
+int print_can_0x324_Cells_79_82(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell79 = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell79)));
+	r = print_helper(r, fprintf(output, "Cell80 = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell80)));
+	r = print_helper(r, fprintf(output, "Cell81 = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell81)));
+	r = print_helper(r, fprintf(output, "Cell82 = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell82)));
+	r = print_helper(r, fprintf(output, "Cell79_bal = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell79_bal)));
+	r = print_helper(r, fprintf(output, "Cell80_bal = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell80_bal)));
+	r = print_helper(r, fprintf(output, "Cell81_bal = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell81_bal)));
+	r = print_helper(r, fprintf(output, "Cell82_bal = (wire: %.0f)\n", (double)(o->can_0x324_Cells_79_82.Cell82_bal)));
+	return r;
+}
+
+static int pack_can_0x325_Cells_83_86(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell83: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x325_Cells_83_86.Cell83)) & 0x7fff;
+	lo |= w;
+	/* Cell84: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x325_Cells_83_86.Cell84)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell85: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x325_Cells_83_86.Cell85)) & 0x7fff;
+	hi |= w;
+	/* Cell86: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x325_Cells_83_86.Cell86)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell83_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x325_Cells_83_86.Cell83_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell84_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x325_Cells_83_86.Cell84_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell85_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x325_Cells_83_86.Cell85_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell86_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x325_Cells_83_86.Cell86_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x325_Cells_83_86_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x325_Cells_83_86(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell83: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x325_Cells_83_86.Cell83 = w;
+	/* Cell84: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x325_Cells_83_86.Cell84 = w;
+	/* Cell85: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x325_Cells_83_86.Cell85 = w;
+	/* Cell86: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x325_Cells_83_86.Cell86 = w;
+	/* Cell83_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x325_Cells_83_86.Cell83_bal = w;
+	/* Cell84_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x325_Cells_83_86.Cell84_bal = w;
+	/* Cell85_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x325_Cells_83_86.Cell85_bal = w;
+	/* Cell86_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x325_Cells_83_86.Cell86_bal = w;
+	o->can_0x325_Cells_83_86_rx = 1;
+	o->can_0x325_Cells_83_86_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x325_Cell83(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x325_Cells_83_86.Cell83);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x325_Cell83(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x325_Cells_83_86.Cell83 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x325_Cells_83_86.Cell83 = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell84(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x325_Cells_83_86.Cell84);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x325_Cell84(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x325_Cells_83_86.Cell84 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x325_Cells_83_86.Cell84 = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell85(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x325_Cells_83_86.Cell85);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x325_Cell85(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x325_Cells_83_86.Cell85 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x325_Cells_83_86.Cell85 = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell86(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x325_Cells_83_86.Cell86);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x325_Cell86(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x325_Cells_83_86.Cell86 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x325_Cells_83_86.Cell86 = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell83_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x325_Cells_83_86.Cell83_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x325_Cell83_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x325_Cells_83_86.Cell83_bal = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell84_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x325_Cells_83_86.Cell84_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x325_Cell84_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x325_Cells_83_86.Cell84_bal = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell85_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x325_Cells_83_86.Cell85_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x325_Cell85_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x325_Cells_83_86.Cell85_bal = in;
+	return 0;
+}
+
+int decode_can_0x325_Cell86_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x325_Cells_83_86.Cell86_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x325_Cell86_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x325_Cells_83_86.Cell86_bal = in;
+	return 0;
+}
+
+int print_can_0x325_Cells_83_86(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell83 = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell83)));
+	r = print_helper(r, fprintf(output, "Cell84 = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell84)));
+	r = print_helper(r, fprintf(output, "Cell85 = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell85)));
+	r = print_helper(r, fprintf(output, "Cell86 = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell86)));
+	r = print_helper(r, fprintf(output, "Cell83_bal = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell83_bal)));
+	r = print_helper(r, fprintf(output, "Cell84_bal = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell84_bal)));
+	r = print_helper(r, fprintf(output, "Cell85_bal = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell85_bal)));
+	r = print_helper(r, fprintf(output, "Cell86_bal = (wire: %.0f)\n", (double)(o->can_0x325_Cells_83_86.Cell86_bal)));
+	return r;
+}
+
+static int pack_can_0x326_Cells_87_90(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell87: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x326_Cells_87_90.Cell87)) & 0x7fff;
+	lo |= w;
+	/* Cell88: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x326_Cells_87_90.Cell88)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell89: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x326_Cells_87_90.Cell89)) & 0x7fff;
+	hi |= w;
+	/* Cell90: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x326_Cells_87_90.Cell90)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell87_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x326_Cells_87_90.Cell87_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell88_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x326_Cells_87_90.Cell88_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell89_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x326_Cells_87_90.Cell89_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell90_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x326_Cells_87_90.Cell90_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x326_Cells_87_90_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x326_Cells_87_90(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell87: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x326_Cells_87_90.Cell87 = w;
+	/* Cell88: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x326_Cells_87_90.Cell88 = w;
+	/* Cell89: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x326_Cells_87_90.Cell89 = w;
+	/* Cell90: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x326_Cells_87_90.Cell90 = w;
+	/* Cell87_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x326_Cells_87_90.Cell87_bal = w;
+	/* Cell88_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x326_Cells_87_90.Cell88_bal = w;
+	/* Cell89_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x326_Cells_87_90.Cell89_bal = w;
+	/* Cell90_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x326_Cells_87_90.Cell90_bal = w;
+	o->can_0x326_Cells_87_90_rx = 1;
+	o->can_0x326_Cells_87_90_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x326_Cell87(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x326_Cells_87_90.Cell87);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x326_Cell87(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x326_Cells_87_90.Cell87 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x326_Cells_87_90.Cell87 = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell88(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x326_Cells_87_90.Cell88);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x326_Cell88(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x326_Cells_87_90.Cell88 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x326_Cells_87_90.Cell88 = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell89(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x326_Cells_87_90.Cell89);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x326_Cell89(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x326_Cells_87_90.Cell89 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x326_Cells_87_90.Cell89 = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell90(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x326_Cells_87_90.Cell90);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x326_Cell90(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x326_Cells_87_90.Cell90 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x326_Cells_87_90.Cell90 = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell87_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x326_Cells_87_90.Cell87_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x326_Cell87_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x326_Cells_87_90.Cell87_bal = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell88_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x326_Cells_87_90.Cell88_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x326_Cell88_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x326_Cells_87_90.Cell88_bal = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell89_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x326_Cells_87_90.Cell89_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x326_Cell89_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x326_Cells_87_90.Cell89_bal = in;
+	return 0;
+}
+
+int decode_can_0x326_Cell90_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x326_Cells_87_90.Cell90_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x326_Cell90_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x326_Cells_87_90.Cell90_bal = in;
+	return 0;
+}
+
+int print_can_0x326_Cells_87_90(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell87 = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell87)));
+	r = print_helper(r, fprintf(output, "Cell88 = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell88)));
+	r = print_helper(r, fprintf(output, "Cell89 = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell89)));
+	r = print_helper(r, fprintf(output, "Cell90 = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell90)));
+	r = print_helper(r, fprintf(output, "Cell87_bal = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell87_bal)));
+	r = print_helper(r, fprintf(output, "Cell88_bal = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell88_bal)));
+	r = print_helper(r, fprintf(output, "Cell89_bal = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell89_bal)));
+	r = print_helper(r, fprintf(output, "Cell90_bal = (wire: %.0f)\n", (double)(o->can_0x326_Cells_87_90.Cell90_bal)));
+	return r;
+}
+
+static int pack_can_0x327_Cells_91_94(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell91: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x327_Cells_91_94.Cell91)) & 0x7fff;
+	lo |= w;
+	/* Cell92: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x327_Cells_91_94.Cell92)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell93: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x327_Cells_91_94.Cell93)) & 0x7fff;
+	hi |= w;
+	/* Cell94: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x327_Cells_91_94.Cell94)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell91_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x327_Cells_91_94.Cell91_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell92_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x327_Cells_91_94.Cell92_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell93_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x327_Cells_91_94.Cell93_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell94_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x327_Cells_91_94.Cell94_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x327_Cells_91_94_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x327_Cells_91_94(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell91: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x327_Cells_91_94.Cell91 = w;
+	/* Cell92: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x327_Cells_91_94.Cell92 = w;
+	/* Cell93: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x327_Cells_91_94.Cell93 = w;
+	/* Cell94: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x327_Cells_91_94.Cell94 = w;
+	/* Cell91_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x327_Cells_91_94.Cell91_bal = w;
+	/* Cell92_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x327_Cells_91_94.Cell92_bal = w;
+	/* Cell93_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x327_Cells_91_94.Cell93_bal = w;
+	/* Cell94_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x327_Cells_91_94.Cell94_bal = w;
+	o->can_0x327_Cells_91_94_rx = 1;
+	o->can_0x327_Cells_91_94_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x327_Cell91(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x327_Cells_91_94.Cell91);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x327_Cell91(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x327_Cells_91_94.Cell91 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x327_Cells_91_94.Cell91 = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell92(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x327_Cells_91_94.Cell92);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x327_Cell92(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x327_Cells_91_94.Cell92 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x327_Cells_91_94.Cell92 = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell93(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x327_Cells_91_94.Cell93);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x327_Cell93(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x327_Cells_91_94.Cell93 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x327_Cells_91_94.Cell93 = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell94(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x327_Cells_91_94.Cell94);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x327_Cell94(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x327_Cells_91_94.Cell94 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x327_Cells_91_94.Cell94 = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell91_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x327_Cells_91_94.Cell91_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x327_Cell91_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x327_Cells_91_94.Cell91_bal = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell92_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x327_Cells_91_94.Cell92_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x327_Cell92_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x327_Cells_91_94.Cell92_bal = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell93_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x327_Cells_91_94.Cell93_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x327_Cell93_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x327_Cells_91_94.Cell93_bal = in;
+	return 0;
+}
+
+int decode_can_0x327_Cell94_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x327_Cells_91_94.Cell94_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x327_Cell94_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x327_Cells_91_94.Cell94_bal = in;
+	return 0;
+}
+
+int print_can_0x327_Cells_91_94(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell91 = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell91)));
+	r = print_helper(r, fprintf(output, "Cell92 = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell92)));
+	r = print_helper(r, fprintf(output, "Cell93 = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell93)));
+	r = print_helper(r, fprintf(output, "Cell94 = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell94)));
+	r = print_helper(r, fprintf(output, "Cell91_bal = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell91_bal)));
+	r = print_helper(r, fprintf(output, "Cell92_bal = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell92_bal)));
+	r = print_helper(r, fprintf(output, "Cell93_bal = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell93_bal)));
+	r = print_helper(r, fprintf(output, "Cell94_bal = (wire: %.0f)\n", (double)(o->can_0x327_Cells_91_94.Cell94_bal)));
+	return r;
+}
+
+static int pack_can_0x328_Cells_95_98(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell95: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x328_Cells_95_98.Cell95)) & 0x7fff;
+	lo |= w;
+	/* Cell96: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x328_Cells_95_98.Cell96)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell97: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x328_Cells_95_98.Cell97)) & 0x7fff;
+	hi |= w;
+	/* Cell98: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x328_Cells_95_98.Cell98)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell95_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x328_Cells_95_98.Cell95_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell96_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x328_Cells_95_98.Cell96_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell97_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x328_Cells_95_98.Cell97_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell98_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x328_Cells_95_98.Cell98_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x328_Cells_95_98_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x328_Cells_95_98(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell95: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x328_Cells_95_98.Cell95 = w;
+	/* Cell96: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x328_Cells_95_98.Cell96 = w;
+	/* Cell97: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x328_Cells_95_98.Cell97 = w;
+	/* Cell98: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x328_Cells_95_98.Cell98 = w;
+	/* Cell95_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x328_Cells_95_98.Cell95_bal = w;
+	/* Cell96_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x328_Cells_95_98.Cell96_bal = w;
+	/* Cell97_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x328_Cells_95_98.Cell97_bal = w;
+	/* Cell98_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x328_Cells_95_98.Cell98_bal = w;
+	o->can_0x328_Cells_95_98_rx = 1;
+	o->can_0x328_Cells_95_98_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x328_Cell95(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x328_Cells_95_98.Cell95);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x328_Cell95(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x328_Cells_95_98.Cell95 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x328_Cells_95_98.Cell95 = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell96(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x328_Cells_95_98.Cell96);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x328_Cell96(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x328_Cells_95_98.Cell96 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x328_Cells_95_98.Cell96 = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell97(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x328_Cells_95_98.Cell97);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x328_Cell97(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x328_Cells_95_98.Cell97 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x328_Cells_95_98.Cell97 = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell98(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x328_Cells_95_98.Cell98);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x328_Cell98(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x328_Cells_95_98.Cell98 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x328_Cells_95_98.Cell98 = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell95_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x328_Cells_95_98.Cell95_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x328_Cell95_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x328_Cells_95_98.Cell95_bal = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell96_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x328_Cells_95_98.Cell96_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x328_Cell96_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x328_Cells_95_98.Cell96_bal = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell97_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x328_Cells_95_98.Cell97_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x328_Cell97_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x328_Cells_95_98.Cell97_bal = in;
+	return 0;
+}
+
+int decode_can_0x328_Cell98_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x328_Cells_95_98.Cell98_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x328_Cell98_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x328_Cells_95_98.Cell98_bal = in;
+	return 0;
+}
+
+int print_can_0x328_Cells_95_98(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell95 = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell95)));
+	r = print_helper(r, fprintf(output, "Cell96 = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell96)));
+	r = print_helper(r, fprintf(output, "Cell97 = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell97)));
+	r = print_helper(r, fprintf(output, "Cell98 = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell98)));
+	r = print_helper(r, fprintf(output, "Cell95_bal = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell95_bal)));
+	r = print_helper(r, fprintf(output, "Cell96_bal = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell96_bal)));
+	r = print_helper(r, fprintf(output, "Cell97_bal = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell97_bal)));
+	r = print_helper(r, fprintf(output, "Cell98_bal = (wire: %.0f)\n", (double)(o->can_0x328_Cells_95_98.Cell98_bal)));
+	return r;
+}
+
+static int pack_can_0x329_Cells_99_102(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell99: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x329_Cells_99_102.Cell99)) & 0x7fff;
+	lo |= w;
+	/* Cell100: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x329_Cells_99_102.Cell100)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell101: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x329_Cells_99_102.Cell101)) & 0x7fff;
+	hi |= w;
+	/* Cell102: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x329_Cells_99_102.Cell102)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell99_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x329_Cells_99_102.Cell99_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell100_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x329_Cells_99_102.Cell100_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell101_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x329_Cells_99_102.Cell101_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell102_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x329_Cells_99_102.Cell102_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x329_Cells_99_102_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x329_Cells_99_102(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell99: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x329_Cells_99_102.Cell99 = w;
+	/* Cell100: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x329_Cells_99_102.Cell100 = w;
+	/* Cell101: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x329_Cells_99_102.Cell101 = w;
+	/* Cell102: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x329_Cells_99_102.Cell102 = w;
+	/* Cell99_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x329_Cells_99_102.Cell99_bal = w;
+	/* Cell100_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x329_Cells_99_102.Cell100_bal = w;
+	/* Cell101_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x329_Cells_99_102.Cell101_bal = w;
+	/* Cell102_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x329_Cells_99_102.Cell102_bal = w;
+	o->can_0x329_Cells_99_102_rx = 1;
+	o->can_0x329_Cells_99_102_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x329_Cell99(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x329_Cells_99_102.Cell99);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x329_Cell99(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x329_Cells_99_102.Cell99 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x329_Cells_99_102.Cell99 = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell100(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x329_Cells_99_102.Cell100);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x329_Cell100(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x329_Cells_99_102.Cell100 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x329_Cells_99_102.Cell100 = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell101(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x329_Cells_99_102.Cell101);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x329_Cell101(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x329_Cells_99_102.Cell101 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x329_Cells_99_102.Cell101 = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell102(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x329_Cells_99_102.Cell102);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x329_Cell102(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x329_Cells_99_102.Cell102 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x329_Cells_99_102.Cell102 = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell99_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x329_Cells_99_102.Cell99_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x329_Cell99_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x329_Cells_99_102.Cell99_bal = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell100_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x329_Cells_99_102.Cell100_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x329_Cell100_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x329_Cells_99_102.Cell100_bal = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell101_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x329_Cells_99_102.Cell101_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x329_Cell101_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x329_Cells_99_102.Cell101_bal = in;
+	return 0;
+}
+
+int decode_can_0x329_Cell102_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x329_Cells_99_102.Cell102_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x329_Cell102_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x329_Cells_99_102.Cell102_bal = in;
+	return 0;
+}
+
+int print_can_0x329_Cells_99_102(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell99 = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell99)));
+	r = print_helper(r, fprintf(output, "Cell100 = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell100)));
+	r = print_helper(r, fprintf(output, "Cell101 = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell101)));
+	r = print_helper(r, fprintf(output, "Cell102 = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell102)));
+	r = print_helper(r, fprintf(output, "Cell99_bal = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell99_bal)));
+	r = print_helper(r, fprintf(output, "Cell100_bal = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell100_bal)));
+	r = print_helper(r, fprintf(output, "Cell101_bal = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell101_bal)));
+	r = print_helper(r, fprintf(output, "Cell102_bal = (wire: %.0f)\n", (double)(o->can_0x329_Cells_99_102.Cell102_bal)));
+	return r;
+}
+
+static int pack_can_0x32a_Cells_103_106(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell103: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32a_Cells_103_106.Cell103)) & 0x7fff;
+	lo |= w;
+	/* Cell104: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32a_Cells_103_106.Cell104)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell105: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32a_Cells_103_106.Cell105)) & 0x7fff;
+	hi |= w;
+	/* Cell106: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32a_Cells_103_106.Cell106)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell103_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32a_Cells_103_106.Cell103_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell104_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32a_Cells_103_106.Cell104_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell105_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32a_Cells_103_106.Cell105_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell106_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32a_Cells_103_106.Cell106_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x32a_Cells_103_106_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x32a_Cells_103_106(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell103: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32a_Cells_103_106.Cell103 = w;
+	/* Cell104: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32a_Cells_103_106.Cell104 = w;
+	/* Cell105: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32a_Cells_103_106.Cell105 = w;
+	/* Cell106: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32a_Cells_103_106.Cell106 = w;
+	/* Cell103_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x32a_Cells_103_106.Cell103_bal = w;
+	/* Cell104_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x32a_Cells_103_106.Cell104_bal = w;
+	/* Cell105_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x32a_Cells_103_106.Cell105_bal = w;
+	/* Cell106_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x32a_Cells_103_106.Cell106_bal = w;
+	o->can_0x32a_Cells_103_106_rx = 1;
+	o->can_0x32a_Cells_103_106_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x32a_Cell103(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32a_Cells_103_106.Cell103);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32a_Cell103(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32a_Cells_103_106.Cell103 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32a_Cells_103_106.Cell103 = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell104(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32a_Cells_103_106.Cell104);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32a_Cell104(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32a_Cells_103_106.Cell104 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32a_Cells_103_106.Cell104 = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell105(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32a_Cells_103_106.Cell105);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32a_Cell105(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32a_Cells_103_106.Cell105 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32a_Cells_103_106.Cell105 = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell106(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32a_Cells_103_106.Cell106);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32a_Cell106(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32a_Cells_103_106.Cell106 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32a_Cells_103_106.Cell106 = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell103_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32a_Cells_103_106.Cell103_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32a_Cell103_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32a_Cells_103_106.Cell103_bal = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell104_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32a_Cells_103_106.Cell104_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32a_Cell104_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32a_Cells_103_106.Cell104_bal = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell105_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32a_Cells_103_106.Cell105_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32a_Cell105_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32a_Cells_103_106.Cell105_bal = in;
+	return 0;
+}
+
+int decode_can_0x32a_Cell106_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32a_Cells_103_106.Cell106_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32a_Cell106_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32a_Cells_103_106.Cell106_bal = in;
+	return 0;
+}
+
+int print_can_0x32a_Cells_103_106(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell103 = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell103)));
+	r = print_helper(r, fprintf(output, "Cell104 = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell104)));
+	r = print_helper(r, fprintf(output, "Cell105 = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell105)));
+	r = print_helper(r, fprintf(output, "Cell106 = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell106)));
+	r = print_helper(r, fprintf(output, "Cell103_bal = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell103_bal)));
+	r = print_helper(r, fprintf(output, "Cell104_bal = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell104_bal)));
+	r = print_helper(r, fprintf(output, "Cell105_bal = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell105_bal)));
+	r = print_helper(r, fprintf(output, "Cell106_bal = (wire: %.0f)\n", (double)(o->can_0x32a_Cells_103_106.Cell106_bal)));
+	return r;
+}
+
+static int pack_can_0x32b_Cells_107_110(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Cell107: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32b_Cells_107_110.Cell107)) & 0x7fff;
+	lo |= w;
+	/* Cell108: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32b_Cells_107_110.Cell108)) & 0x7fff;
+	lo |= w << 16;
+	/* Cell109: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32b_Cells_107_110.Cell109)) & 0x7fff;
+	hi |= w;
+	/* Cell110: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x32b_Cells_107_110.Cell110)) & 0x7fff;
+	hi |= w << 16;
+	/* Cell107_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32b_Cells_107_110.Cell107_bal)) & 0x1;
+	lo |= w << 15;
+	/* Cell108_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32b_Cells_107_110.Cell108_bal)) & 0x1;
+	lo |= w << 31;
+	/* Cell109_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32b_Cells_107_110.Cell109_bal)) & 0x1;
+	hi |= w << 15;
+	/* Cell110_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x32b_Cells_107_110.Cell110_bal)) & 0x1;
+	hi |= w << 31;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x32b_Cells_107_110_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x32b_Cells_107_110(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Cell107: start-bit 0, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32b_Cells_107_110.Cell107 = w;
+	/* Cell108: start-bit 16, length 15, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32b_Cells_107_110.Cell108 = w;
+	/* Cell109: start-bit 32, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32b_Cells_107_110.Cell109 = w;
+	/* Cell110: start-bit 48, length 15, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0x7fff;
+	w = (w & 0x4000) ? (w | 0x8000) : w; 
+	o->can_0x32b_Cells_107_110.Cell110 = w;
+	/* Cell107_bal: start-bit 15, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 15) & 0x1;
+	o->can_0x32b_Cells_107_110.Cell107_bal = w;
+	/* Cell108_bal: start-bit 31, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 31) & 0x1;
+	o->can_0x32b_Cells_107_110.Cell108_bal = w;
+	/* Cell109_bal: start-bit 47, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 15) & 0x1;
+	o->can_0x32b_Cells_107_110.Cell109_bal = w;
+	/* Cell110_bal: start-bit 63, length 1, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 31) & 0x1;
+	o->can_0x32b_Cells_107_110.Cell110_bal = w;
+	o->can_0x32b_Cells_107_110_rx = 1;
+	o->can_0x32b_Cells_107_110_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x32b_Cell107(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32b_Cells_107_110.Cell107);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32b_Cell107(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32b_Cells_107_110.Cell107 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32b_Cells_107_110.Cell107 = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell108(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32b_Cells_107_110.Cell108);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32b_Cell108(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32b_Cells_107_110.Cell108 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32b_Cells_107_110.Cell108 = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell109(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32b_Cells_107_110.Cell109);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32b_Cell109(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32b_Cells_107_110.Cell109 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32b_Cells_107_110.Cell109 = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell110(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x32b_Cells_107_110.Cell110);
+	if ((rval >= 0) && (rval <= 5500)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (int16_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x32b_Cell110(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x32b_Cells_107_110.Cell110 = 0;
+	if (in < 0)
+		return -1;
+	if (in > 5500)
+		return -1;
+	o->can_0x32b_Cells_107_110.Cell110 = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell107_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32b_Cells_107_110.Cell107_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32b_Cell107_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32b_Cells_107_110.Cell107_bal = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell108_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32b_Cells_107_110.Cell108_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32b_Cell108_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32b_Cells_107_110.Cell108_bal = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell109_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32b_Cells_107_110.Cell109_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32b_Cell109_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32b_Cells_107_110.Cell109_bal = in;
+	return 0;
+}
+
+int decode_can_0x32b_Cell110_bal(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x32b_Cells_107_110.Cell110_bal);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x32b_Cell110_bal(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x32b_Cells_107_110.Cell110_bal = in;
+	return 0;
+}
+
+int print_can_0x32b_Cells_107_110(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Cell107 = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell107)));
+	r = print_helper(r, fprintf(output, "Cell108 = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell108)));
+	r = print_helper(r, fprintf(output, "Cell109 = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell109)));
+	r = print_helper(r, fprintf(output, "Cell110 = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell110)));
+	r = print_helper(r, fprintf(output, "Cell107_bal = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell107_bal)));
+	r = print_helper(r, fprintf(output, "Cell108_bal = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell108_bal)));
+	r = print_helper(r, fprintf(output, "Cell109_bal = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell109_bal)));
+	r = print_helper(r, fprintf(output, "Cell110_bal = (wire: %.0f)\n", (double)(o->can_0x32b_Cells_107_110.Cell110_bal)));
+	return r;
+}
+
+static int pack_can_0x335_PackTemperatures1Thru4(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp1: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x335_PackTemperatures1Thru4.Temp1)) & 0xffff;
+	lo |= w;
+	/* Temp2: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x335_PackTemperatures1Thru4.Temp2)) & 0xffff;
+	lo |= w << 16;
+	/* Temp3: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x335_PackTemperatures1Thru4.Temp3)) & 0xffff;
+	hi |= w;
+	/* Temp4: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x335_PackTemperatures1Thru4.Temp4)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x335_PackTemperatures1Thru4_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x335_PackTemperatures1Thru4(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp1: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x335_PackTemperatures1Thru4.Temp1 = w;
+	/* Temp2: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x335_PackTemperatures1Thru4.Temp2 = w;
+	/* Temp3: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x335_PackTemperatures1Thru4.Temp3 = w;
+	/* Temp4: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x335_PackTemperatures1Thru4.Temp4 = w;
+	o->can_0x335_PackTemperatures1Thru4_rx = 1;
+	o->can_0x335_PackTemperatures1Thru4_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x335_Temp1(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x335_PackTemperatures1Thru4.Temp1);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x335_Temp1(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x335_PackTemperatures1Thru4.Temp1 = in;
+	return 0;
+}
+
+int decode_can_0x335_Temp2(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x335_PackTemperatures1Thru4.Temp2);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x335_Temp2(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x335_PackTemperatures1Thru4.Temp2 = in;
+	return 0;
+}
+
+int decode_can_0x335_Temp3(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x335_PackTemperatures1Thru4.Temp3);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x335_Temp3(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x335_PackTemperatures1Thru4.Temp3 = in;
+	return 0;
+}
+
+int decode_can_0x335_Temp4(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x335_PackTemperatures1Thru4.Temp4);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x335_Temp4(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x335_PackTemperatures1Thru4.Temp4 = in;
+	return 0;
+}
+
+int print_can_0x335_PackTemperatures1Thru4(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp1 = (wire: %.0f)\n", (double)(o->can_0x335_PackTemperatures1Thru4.Temp1)));
+	r = print_helper(r, fprintf(output, "Temp2 = (wire: %.0f)\n", (double)(o->can_0x335_PackTemperatures1Thru4.Temp2)));
+	r = print_helper(r, fprintf(output, "Temp3 = (wire: %.0f)\n", (double)(o->can_0x335_PackTemperatures1Thru4.Temp3)));
+	r = print_helper(r, fprintf(output, "Temp4 = (wire: %.0f)\n", (double)(o->can_0x335_PackTemperatures1Thru4.Temp4)));
+	return r;
+}
+
+static int pack_can_0x336_PackTempeartures5Thru8(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp5: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x336_PackTempeartures5Thru8.Temp5)) & 0xffff;
+	lo |= w;
+	/* Temp6: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x336_PackTempeartures5Thru8.Temp6)) & 0xffff;
+	lo |= w << 16;
+	/* Temp7: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x336_PackTempeartures5Thru8.Temp7)) & 0xffff;
+	hi |= w;
+	/* Temp8: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x336_PackTempeartures5Thru8.Temp8)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x336_PackTempeartures5Thru8_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x336_PackTempeartures5Thru8(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp5: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x336_PackTempeartures5Thru8.Temp5 = w;
+	/* Temp6: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x336_PackTempeartures5Thru8.Temp6 = w;
+	/* Temp7: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x336_PackTempeartures5Thru8.Temp7 = w;
+	/* Temp8: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x336_PackTempeartures5Thru8.Temp8 = w;
+	o->can_0x336_PackTempeartures5Thru8_rx = 1;
+	o->can_0x336_PackTempeartures5Thru8_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x336_Temp5(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x336_PackTempeartures5Thru8.Temp5);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x336_Temp5(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x336_PackTempeartures5Thru8.Temp5 = in;
+	return 0;
+}
+
+int decode_can_0x336_Temp6(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x336_PackTempeartures5Thru8.Temp6);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x336_Temp6(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x336_PackTempeartures5Thru8.Temp6 = in;
+	return 0;
+}
+
+int decode_can_0x336_Temp7(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x336_PackTempeartures5Thru8.Temp7);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x336_Temp7(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x336_PackTempeartures5Thru8.Temp7 = in;
+	return 0;
+}
+
+int decode_can_0x336_Temp8(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x336_PackTempeartures5Thru8.Temp8);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x336_Temp8(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x336_PackTempeartures5Thru8.Temp8 = in;
+	return 0;
+}
+
+int print_can_0x336_PackTempeartures5Thru8(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp5 = (wire: %.0f)\n", (double)(o->can_0x336_PackTempeartures5Thru8.Temp5)));
+	r = print_helper(r, fprintf(output, "Temp6 = (wire: %.0f)\n", (double)(o->can_0x336_PackTempeartures5Thru8.Temp6)));
+	r = print_helper(r, fprintf(output, "Temp7 = (wire: %.0f)\n", (double)(o->can_0x336_PackTempeartures5Thru8.Temp7)));
+	r = print_helper(r, fprintf(output, "Temp8 = (wire: %.0f)\n", (double)(o->can_0x336_PackTempeartures5Thru8.Temp8)));
+	return r;
+}
+
+static int pack_can_0x337_PackTemperatures9Thru14(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp9: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x337_PackTemperatures9Thru14.Temp9)) & 0xffff;
+	lo |= w;
+	/* Temp10: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x337_PackTemperatures9Thru14.Temp10)) & 0xffff;
+	lo |= w << 16;
+	/* Temp11: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x337_PackTemperatures9Thru14.Temp11)) & 0xffff;
+	hi |= w;
+	/* Temp12: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x337_PackTemperatures9Thru14.Temp12)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x337_PackTemperatures9Thru14_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x337_PackTemperatures9Thru14(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp9: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x337_PackTemperatures9Thru14.Temp9 = w;
+	/* Temp10: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x337_PackTemperatures9Thru14.Temp10 = w;
+	/* Temp11: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x337_PackTemperatures9Thru14.Temp11 = w;
+	/* Temp12: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x337_PackTemperatures9Thru14.Temp12 = w;
+	o->can_0x337_PackTemperatures9Thru14_rx = 1;
+	o->can_0x337_PackTemperatures9Thru14_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x337_Temp9(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x337_PackTemperatures9Thru14.Temp9);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x337_Temp9(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x337_PackTemperatures9Thru14.Temp9 = in;
+	return 0;
+}
+
+int decode_can_0x337_Temp10(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x337_PackTemperatures9Thru14.Temp10);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x337_Temp10(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x337_PackTemperatures9Thru14.Temp10 = in;
+	return 0;
+}
+
+int decode_can_0x337_Temp11(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x337_PackTemperatures9Thru14.Temp11);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x337_Temp11(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x337_PackTemperatures9Thru14.Temp11 = in;
+	return 0;
+}
+
+int decode_can_0x337_Temp12(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x337_PackTemperatures9Thru14.Temp12);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x337_Temp12(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x337_PackTemperatures9Thru14.Temp12 = in;
+	return 0;
+}
+
+int print_can_0x337_PackTemperatures9Thru14(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp9 = (wire: %.0f)\n", (double)(o->can_0x337_PackTemperatures9Thru14.Temp9)));
+	r = print_helper(r, fprintf(output, "Temp10 = (wire: %.0f)\n", (double)(o->can_0x337_PackTemperatures9Thru14.Temp10)));
+	r = print_helper(r, fprintf(output, "Temp11 = (wire: %.0f)\n", (double)(o->can_0x337_PackTemperatures9Thru14.Temp11)));
+	r = print_helper(r, fprintf(output, "Temp12 = (wire: %.0f)\n", (double)(o->can_0x337_PackTemperatures9Thru14.Temp12)));
+	return r;
+}
+
+static int pack_can_0x338_PackTemperatures13Thru14(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp13: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x338_PackTemperatures13Thru14.Temp13)) & 0xffff;
+	lo |= w;
+	/* Temp14: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x338_PackTemperatures13Thru14.Temp14)) & 0xffff;
+	lo |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x338_PackTemperatures13Thru14_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x338_PackTemperatures13Thru14(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 8)
+		return -1;
+	/* Temp13: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x338_PackTemperatures13Thru14.Temp13 = w;
+	/* Temp14: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x338_PackTemperatures13Thru14.Temp14 = w;
+	o->can_0x338_PackTemperatures13Thru14_rx = 1;
+	o->can_0x338_PackTemperatures13Thru14_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x338_Temp13(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x338_PackTemperatures13Thru14.Temp13);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x338_Temp13(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x338_PackTemperatures13Thru14.Temp13 = in;
+	return 0;
+}
+
+int decode_can_0x338_Temp14(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x338_PackTemperatures13Thru14.Temp14);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x338_Temp14(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x338_PackTemperatures13Thru14.Temp14 = in;
+	return 0;
+}
+
+int print_can_0x338_PackTemperatures13Thru14(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp13 = (wire: %.0f)\n", (double)(o->can_0x338_PackTemperatures13Thru14.Temp13)));
+	r = print_helper(r, fprintf(output, "Temp14 = (wire: %.0f)\n", (double)(o->can_0x338_PackTemperatures13Thru14.Temp14)));
+	return r;
+}
+
+static int pack_can_0x339_PackTemperatures15Thru18(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp15: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x339_PackTemperatures15Thru18.Temp15)) & 0xffff;
+	lo |= w;
+	/* Temp16: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x339_PackTemperatures15Thru18.Temp16)) & 0xffff;
+	lo |= w << 16;
+	/* Temp17: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x339_PackTemperatures15Thru18.Temp17)) & 0xffff;
+	hi |= w;
+	/* Temo18: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x339_PackTemperatures15Thru18.Temo18)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x339_PackTemperatures15Thru18_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x339_PackTemperatures15Thru18(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp15: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x339_PackTemperatures15Thru18.Temp15 = w;
+	/* Temp16: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x339_PackTemperatures15Thru18.Temp16 = w;
+	/* Temp17: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x339_PackTemperatures15Thru18.Temp17 = w;
+	/* Temo18: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x339_PackTemperatures15Thru18.Temo18 = w;
+	o->can_0x339_PackTemperatures15Thru18_rx = 1;
+	o->can_0x339_PackTemperatures15Thru18_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x339_Temp15(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x339_PackTemperatures15Thru18.Temp15);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x339_Temp15(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x339_PackTemperatures15Thru18.Temp15 = in;
+	return 0;
+}
+
+int decode_can_0x339_Temp16(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x339_PackTemperatures15Thru18.Temp16);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x339_Temp16(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x339_PackTemperatures15Thru18.Temp16 = in;
+	return 0;
+}
+
+int decode_can_0x339_Temp17(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x339_PackTemperatures15Thru18.Temp17);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x339_Temp17(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x339_PackTemperatures15Thru18.Temp17 = in;
+	return 0;
+}
+
+int decode_can_0x339_Temo18(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x339_PackTemperatures15Thru18.Temo18);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x339_Temo18(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x339_PackTemperatures15Thru18.Temo18 = in;
+	return 0;
+}
+
+int print_can_0x339_PackTemperatures15Thru18(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp15 = (wire: %.0f)\n", (double)(o->can_0x339_PackTemperatures15Thru18.Temp15)));
+	r = print_helper(r, fprintf(output, "Temp16 = (wire: %.0f)\n", (double)(o->can_0x339_PackTemperatures15Thru18.Temp16)));
+	r = print_helper(r, fprintf(output, "Temp17 = (wire: %.0f)\n", (double)(o->can_0x339_PackTemperatures15Thru18.Temp17)));
+	r = print_helper(r, fprintf(output, "Temo18 = (wire: %.0f)\n", (double)(o->can_0x339_PackTemperatures15Thru18.Temo18)));
+	return r;
+}
+
+static int pack_can_0x33a_PackTemperatures19Thru22(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp19: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33a_PackTemperatures19Thru22.Temp19)) & 0xffff;
+	lo |= w;
+	/* Temp20: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33a_PackTemperatures19Thru22.Temp20)) & 0xffff;
+	lo |= w << 16;
+	/* Temp21: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33a_PackTemperatures19Thru22.Temp21)) & 0xffff;
+	hi |= w;
+	/* Temo22: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33a_PackTemperatures19Thru22.Temo22)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x33a_PackTemperatures19Thru22_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x33a_PackTemperatures19Thru22(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp19: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x33a_PackTemperatures19Thru22.Temp19 = w;
+	/* Temp20: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x33a_PackTemperatures19Thru22.Temp20 = w;
+	/* Temp21: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x33a_PackTemperatures19Thru22.Temp21 = w;
+	/* Temo22: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x33a_PackTemperatures19Thru22.Temo22 = w;
+	o->can_0x33a_PackTemperatures19Thru22_rx = 1;
+	o->can_0x33a_PackTemperatures19Thru22_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x33a_Temp19(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33a_PackTemperatures19Thru22.Temp19);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33a_Temp19(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33a_PackTemperatures19Thru22.Temp19 = in;
+	return 0;
+}
+
+int decode_can_0x33a_Temp20(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33a_PackTemperatures19Thru22.Temp20);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33a_Temp20(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33a_PackTemperatures19Thru22.Temp20 = in;
+	return 0;
+}
+
+int decode_can_0x33a_Temp21(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33a_PackTemperatures19Thru22.Temp21);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33a_Temp21(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33a_PackTemperatures19Thru22.Temp21 = in;
+	return 0;
+}
+
+int decode_can_0x33a_Temo22(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33a_PackTemperatures19Thru22.Temo22);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33a_Temo22(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33a_PackTemperatures19Thru22.Temo22 = in;
+	return 0;
+}
+
+int print_can_0x33a_PackTemperatures19Thru22(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp19 = (wire: %.0f)\n", (double)(o->can_0x33a_PackTemperatures19Thru22.Temp19)));
+	r = print_helper(r, fprintf(output, "Temp20 = (wire: %.0f)\n", (double)(o->can_0x33a_PackTemperatures19Thru22.Temp20)));
+	r = print_helper(r, fprintf(output, "Temp21 = (wire: %.0f)\n", (double)(o->can_0x33a_PackTemperatures19Thru22.Temp21)));
+	r = print_helper(r, fprintf(output, "Temo22 = (wire: %.0f)\n", (double)(o->can_0x33a_PackTemperatures19Thru22.Temo22)));
+	return r;
+}
+
+static int pack_can_0x33b_PackTemperatures23Thru26(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp23: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33b_PackTemperatures23Thru26.Temp23)) & 0xffff;
+	lo |= w;
+	/* Temp24: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33b_PackTemperatures23Thru26.Temp24)) & 0xffff;
+	lo |= w << 16;
+	/* Temp25: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33b_PackTemperatures23Thru26.Temp25)) & 0xffff;
+	hi |= w;
+	/* Temo26: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33b_PackTemperatures23Thru26.Temo26)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x33b_PackTemperatures23Thru26_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x33b_PackTemperatures23Thru26(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp23: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x33b_PackTemperatures23Thru26.Temp23 = w;
+	/* Temp24: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x33b_PackTemperatures23Thru26.Temp24 = w;
+	/* Temp25: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x33b_PackTemperatures23Thru26.Temp25 = w;
+	/* Temo26: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x33b_PackTemperatures23Thru26.Temo26 = w;
+	o->can_0x33b_PackTemperatures23Thru26_rx = 1;
+	o->can_0x33b_PackTemperatures23Thru26_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x33b_Temp23(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33b_PackTemperatures23Thru26.Temp23);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33b_Temp23(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33b_PackTemperatures23Thru26.Temp23 = in;
+	return 0;
+}
+
+int decode_can_0x33b_Temp24(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33b_PackTemperatures23Thru26.Temp24);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33b_Temp24(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33b_PackTemperatures23Thru26.Temp24 = in;
+	return 0;
+}
+
+int decode_can_0x33b_Temp25(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33b_PackTemperatures23Thru26.Temp25);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33b_Temp25(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33b_PackTemperatures23Thru26.Temp25 = in;
+	return 0;
+}
+
+int decode_can_0x33b_Temo26(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33b_PackTemperatures23Thru26.Temo26);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33b_Temo26(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33b_PackTemperatures23Thru26.Temo26 = in;
+	return 0;
+}
+
+int print_can_0x33b_PackTemperatures23Thru26(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp23 = (wire: %.0f)\n", (double)(o->can_0x33b_PackTemperatures23Thru26.Temp23)));
+	r = print_helper(r, fprintf(output, "Temp24 = (wire: %.0f)\n", (double)(o->can_0x33b_PackTemperatures23Thru26.Temp24)));
+	r = print_helper(r, fprintf(output, "Temp25 = (wire: %.0f)\n", (double)(o->can_0x33b_PackTemperatures23Thru26.Temp25)));
+	r = print_helper(r, fprintf(output, "Temo26 = (wire: %.0f)\n", (double)(o->can_0x33b_PackTemperatures23Thru26.Temo26)));
+	return r;
+}
+
+static int pack_can_0x33c_PackTemperatures27Thru30(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp27: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33c_PackTemperatures27Thru30.Temp27)) & 0xffff;
+	lo |= w;
+	/* Temp28: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33c_PackTemperatures27Thru30.Temp28)) & 0xffff;
+	lo |= w << 16;
+	/* Temp29: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33c_PackTemperatures27Thru30.Temp29)) & 0xffff;
+	hi |= w;
+	/* Temo30: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33c_PackTemperatures27Thru30.Temo30)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x33c_PackTemperatures27Thru30_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x33c_PackTemperatures27Thru30(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp27: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x33c_PackTemperatures27Thru30.Temp27 = w;
+	/* Temp28: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x33c_PackTemperatures27Thru30.Temp28 = w;
+	/* Temp29: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x33c_PackTemperatures27Thru30.Temp29 = w;
+	/* Temo30: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x33c_PackTemperatures27Thru30.Temo30 = w;
+	o->can_0x33c_PackTemperatures27Thru30_rx = 1;
+	o->can_0x33c_PackTemperatures27Thru30_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x33c_Temp27(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33c_PackTemperatures27Thru30.Temp27);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33c_Temp27(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33c_PackTemperatures27Thru30.Temp27 = in;
+	return 0;
+}
+
+int decode_can_0x33c_Temp28(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33c_PackTemperatures27Thru30.Temp28);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33c_Temp28(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33c_PackTemperatures27Thru30.Temp28 = in;
+	return 0;
+}
+
+int decode_can_0x33c_Temp29(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33c_PackTemperatures27Thru30.Temp29);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33c_Temp29(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33c_PackTemperatures27Thru30.Temp29 = in;
+	return 0;
+}
+
+int decode_can_0x33c_Temo30(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33c_PackTemperatures27Thru30.Temo30);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33c_Temo30(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33c_PackTemperatures27Thru30.Temo30 = in;
+	return 0;
+}
+
+int print_can_0x33c_PackTemperatures27Thru30(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp27 = (wire: %.0f)\n", (double)(o->can_0x33c_PackTemperatures27Thru30.Temp27)));
+	r = print_helper(r, fprintf(output, "Temp28 = (wire: %.0f)\n", (double)(o->can_0x33c_PackTemperatures27Thru30.Temp28)));
+	r = print_helper(r, fprintf(output, "Temp29 = (wire: %.0f)\n", (double)(o->can_0x33c_PackTemperatures27Thru30.Temp29)));
+	r = print_helper(r, fprintf(output, "Temo30 = (wire: %.0f)\n", (double)(o->can_0x33c_PackTemperatures27Thru30.Temo30)));
+	return r;
+}
+
+static int pack_can_0x33d_PackTemperatures31Thru34(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp31: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33d_PackTemperatures31Thru34.Temp31)) & 0xffff;
+	lo |= w;
+	/* Temp32: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33d_PackTemperatures31Thru34.Temp32)) & 0xffff;
+	lo |= w << 16;
+	/* Temp33: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33d_PackTemperatures31Thru34.Temp33)) & 0xffff;
+	hi |= w;
+	/* Temo34: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33d_PackTemperatures31Thru34.Temo34)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x33d_PackTemperatures31Thru34_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x33d_PackTemperatures31Thru34(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp31: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x33d_PackTemperatures31Thru34.Temp31 = w;
+	/* Temp32: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x33d_PackTemperatures31Thru34.Temp32 = w;
+	/* Temp33: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x33d_PackTemperatures31Thru34.Temp33 = w;
+	/* Temo34: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x33d_PackTemperatures31Thru34.Temo34 = w;
+	o->can_0x33d_PackTemperatures31Thru34_rx = 1;
+	o->can_0x33d_PackTemperatures31Thru34_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x33d_Temp31(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33d_PackTemperatures31Thru34.Temp31);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33d_Temp31(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33d_PackTemperatures31Thru34.Temp31 = in;
+	return 0;
+}
+
+int decode_can_0x33d_Temp32(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33d_PackTemperatures31Thru34.Temp32);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33d_Temp32(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33d_PackTemperatures31Thru34.Temp32 = in;
+	return 0;
+}
+
+int decode_can_0x33d_Temp33(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33d_PackTemperatures31Thru34.Temp33);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33d_Temp33(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33d_PackTemperatures31Thru34.Temp33 = in;
+	return 0;
+}
+
+int decode_can_0x33d_Temo34(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33d_PackTemperatures31Thru34.Temo34);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33d_Temo34(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33d_PackTemperatures31Thru34.Temo34 = in;
+	return 0;
+}
+
+int print_can_0x33d_PackTemperatures31Thru34(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp31 = (wire: %.0f)\n", (double)(o->can_0x33d_PackTemperatures31Thru34.Temp31)));
+	r = print_helper(r, fprintf(output, "Temp32 = (wire: %.0f)\n", (double)(o->can_0x33d_PackTemperatures31Thru34.Temp32)));
+	r = print_helper(r, fprintf(output, "Temp33 = (wire: %.0f)\n", (double)(o->can_0x33d_PackTemperatures31Thru34.Temp33)));
+	r = print_helper(r, fprintf(output, "Temo34 = (wire: %.0f)\n", (double)(o->can_0x33d_PackTemperatures31Thru34.Temo34)));
+	return r;
+}
+
+static int pack_can_0x33e_PackTemperatures35Thru38(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp35: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33e_PackTemperatures35Thru38.Temp35)) & 0xffff;
+	lo |= w;
+	/* Temp36: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33e_PackTemperatures35Thru38.Temp36)) & 0xffff;
+	lo |= w << 16;
+	/* Temp37: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33e_PackTemperatures35Thru38.Temp37)) & 0xffff;
+	hi |= w;
+	/* Temo38: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33e_PackTemperatures35Thru38.Temo38)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x33e_PackTemperatures35Thru38_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x33e_PackTemperatures35Thru38(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp35: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x33e_PackTemperatures35Thru38.Temp35 = w;
+	/* Temp36: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x33e_PackTemperatures35Thru38.Temp36 = w;
+	/* Temp37: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x33e_PackTemperatures35Thru38.Temp37 = w;
+	/* Temo38: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x33e_PackTemperatures35Thru38.Temo38 = w;
+	o->can_0x33e_PackTemperatures35Thru38_rx = 1;
+	o->can_0x33e_PackTemperatures35Thru38_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x33e_Temp35(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33e_PackTemperatures35Thru38.Temp35);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33e_Temp35(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33e_PackTemperatures35Thru38.Temp35 = in;
+	return 0;
+}
+
+int decode_can_0x33e_Temp36(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33e_PackTemperatures35Thru38.Temp36);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33e_Temp36(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33e_PackTemperatures35Thru38.Temp36 = in;
+	return 0;
+}
+
+int decode_can_0x33e_Temp37(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33e_PackTemperatures35Thru38.Temp37);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33e_Temp37(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33e_PackTemperatures35Thru38.Temp37 = in;
+	return 0;
+}
+
+int decode_can_0x33e_Temo38(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33e_PackTemperatures35Thru38.Temo38);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33e_Temo38(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33e_PackTemperatures35Thru38.Temo38 = in;
+	return 0;
+}
+
+int print_can_0x33e_PackTemperatures35Thru38(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp35 = (wire: %.0f)\n", (double)(o->can_0x33e_PackTemperatures35Thru38.Temp35)));
+	r = print_helper(r, fprintf(output, "Temp36 = (wire: %.0f)\n", (double)(o->can_0x33e_PackTemperatures35Thru38.Temp36)));
+	r = print_helper(r, fprintf(output, "Temp37 = (wire: %.0f)\n", (double)(o->can_0x33e_PackTemperatures35Thru38.Temp37)));
+	r = print_helper(r, fprintf(output, "Temo38 = (wire: %.0f)\n", (double)(o->can_0x33e_PackTemperatures35Thru38.Temo38)));
+	return r;
+}
+
+static int pack_can_0x33f_PackTemperatures39Thru42(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Temp39: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33f_PackTemperatures39Thru42.Temp39)) & 0xffff;
+	lo |= w;
+	/* Temp40: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33f_PackTemperatures39Thru42.Temp40)) & 0xffff;
+	lo |= w << 16;
+	/* Temp41: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33f_PackTemperatures39Thru42.Temp41)) & 0xffff;
+	hi |= w;
+	/* Temo42: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x33f_PackTemperatures39Thru42.Temo42)) & 0xffff;
+	hi |= w << 16;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x33f_PackTemperatures39Thru42_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x33f_PackTemperatures39Thru42(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Temp39: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0x33f_PackTemperatures39Thru42.Temp39 = w;
+	/* Temp40: start-bit 16, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0xffff;
+	o->can_0x33f_PackTemperatures39Thru42.Temp40 = w;
+	/* Temp41: start-bit 32, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffff;
+	o->can_0x33f_PackTemperatures39Thru42.Temp41 = w;
+	/* Temo42: start-bit 48, length 16, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 16) & 0xffff;
+	o->can_0x33f_PackTemperatures39Thru42.Temo42 = w;
+	o->can_0x33f_PackTemperatures39Thru42_rx = 1;
+	o->can_0x33f_PackTemperatures39Thru42_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x33f_Temp39(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33f_PackTemperatures39Thru42.Temp39);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33f_Temp39(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33f_PackTemperatures39Thru42.Temp39 = in;
+	return 0;
+}
+
+int decode_can_0x33f_Temp40(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33f_PackTemperatures39Thru42.Temp40);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33f_Temp40(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33f_PackTemperatures39Thru42.Temp40 = in;
+	return 0;
+}
+
+int decode_can_0x33f_Temp41(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33f_PackTemperatures39Thru42.Temp41);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33f_Temp41(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33f_PackTemperatures39Thru42.Temp41 = in;
+	return 0;
+}
+
+int decode_can_0x33f_Temo42(const can_obj_ex1_h_t *o, int16_t *out) {
+	int16_t rval = (int16_t)(o->can_0x33f_PackTemperatures39Thru42.Temo42);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x33f_Temo42(can_obj_ex1_h_t *o, int16_t in) {
+	o->can_0x33f_PackTemperatures39Thru42.Temo42 = in;
+	return 0;
+}
+
+int print_can_0x33f_PackTemperatures39Thru42(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Temp39 = (wire: %.0f)\n", (double)(o->can_0x33f_PackTemperatures39Thru42.Temp39)));
+	r = print_helper(r, fprintf(output, "Temp40 = (wire: %.0f)\n", (double)(o->can_0x33f_PackTemperatures39Thru42.Temp40)));
+	r = print_helper(r, fprintf(output, "Temp41 = (wire: %.0f)\n", (double)(o->can_0x33f_PackTemperatures39Thru42.Temp41)));
+	r = print_helper(r, fprintf(output, "Temo42 = (wire: %.0f)\n", (double)(o->can_0x33f_PackTemperatures39Thru42.Temo42)));
+	return r;
+}
+
+static int pack_can_0x401_StatusInformation(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Reserved_Limit: start-bit 7, length 9, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0x401_StatusInformation.Reserved_Limit)) & 0x1ff;
+	lo |= w << 7;
+	/* Reserved_Error: start-bit 24, length 8, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.Reserved_Error)) & 0xff;
+	lo |= w << 24;
+	/* limit_outputvolt_pwm: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_outputvolt_pwm)) & 0x1;
+	lo |= w;
+	/* limit_motor_current: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_motor_current)) & 0x1;
+	lo |= w << 1;
+	/* limit_velocity: start-bit 2, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_velocity)) & 0x1;
+	lo |= w << 2;
+	/* limit_bus_current: start-bit 3, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_bus_current)) & 0x1;
+	lo |= w << 3;
+	/* limit_bus_volt_upper: start-bit 4, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_bus_volt_upper)) & 0x1;
+	lo |= w << 4;
+	/* limit_bus_volt_lower: start-bit 5, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_bus_volt_lower)) & 0x1;
+	lo |= w << 5;
+	/* limit_temp: start-bit 6, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.limit_temp)) & 0x1;
+	lo |= w << 6;
+	/* error_hardware_over_current: start-bit 16, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_hardware_over_current)) & 0x1;
+	lo |= w << 16;
+	/* error_software_over_current: start-bit 17, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_software_over_current)) & 0x1;
+	lo |= w << 17;
+	/* error_DC_over_volt: start-bit 18, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_DC_over_volt)) & 0x1;
+	lo |= w << 18;
+	/* error_bad_position: start-bit 19, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_bad_position)) & 0x1;
+	lo |= w << 19;
+	/* error_watchdog: start-bit 20, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_watchdog)) & 0x1;
+	lo |= w << 20;
+	/* error_configread: start-bit 21, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_configread)) & 0x1;
+	lo |= w << 21;
+	/* error_15v_under_volt: start-bit 22, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_15v_under_volt)) & 0x1;
+	lo |= w << 22;
+	/* error_desaturation: start-bit 23, length 1, endianess intel, scaling 1, offset 0 */
+	w = ((uint8_t)(o->can_0x401_StatusInformation.error_desaturation)) & 0x1;
+	lo |= w << 23;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x401_StatusInformation_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x401_StatusInformation(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 8)
+		return -1;
+	/* Reserved_Limit: start-bit 7, length 9, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 7) & 0x1ff;
+	o->can_0x401_StatusInformation.Reserved_Limit = w;
+	/* Reserved_Error: start-bit 24, length 8, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 24) & 0xff;
+	o->can_0x401_StatusInformation.Reserved_Error = w;
+	/* limit_outputvolt_pwm: start-bit 0, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0x1;
+	o->can_0x401_StatusInformation.limit_outputvolt_pwm = w;
+	/* limit_motor_current: start-bit 1, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 1) & 0x1;
+	o->can_0x401_StatusInformation.limit_motor_current = w;
+	/* limit_velocity: start-bit 2, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 2) & 0x1;
+	o->can_0x401_StatusInformation.limit_velocity = w;
+	/* limit_bus_current: start-bit 3, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 3) & 0x1;
+	o->can_0x401_StatusInformation.limit_bus_current = w;
+	/* limit_bus_volt_upper: start-bit 4, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 4) & 0x1;
+	o->can_0x401_StatusInformation.limit_bus_volt_upper = w;
+	/* limit_bus_volt_lower: start-bit 5, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 5) & 0x1;
+	o->can_0x401_StatusInformation.limit_bus_volt_lower = w;
+	/* limit_temp: start-bit 6, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 6) & 0x1;
+	o->can_0x401_StatusInformation.limit_temp = w;
+	/* error_hardware_over_current: start-bit 16, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 16) & 0x1;
+	o->can_0x401_StatusInformation.error_hardware_over_current = w;
+	/* error_software_over_current: start-bit 17, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 17) & 0x1;
+	o->can_0x401_StatusInformation.error_software_over_current = w;
+	/* error_DC_over_volt: start-bit 18, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 18) & 0x1;
+	o->can_0x401_StatusInformation.error_DC_over_volt = w;
+	/* error_bad_position: start-bit 19, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 19) & 0x1;
+	o->can_0x401_StatusInformation.error_bad_position = w;
+	/* error_watchdog: start-bit 20, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 20) & 0x1;
+	o->can_0x401_StatusInformation.error_watchdog = w;
+	/* error_configread: start-bit 21, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 21) & 0x1;
+	o->can_0x401_StatusInformation.error_configread = w;
+	/* error_15v_under_volt: start-bit 22, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 22) & 0x1;
+	o->can_0x401_StatusInformation.error_15v_under_volt = w;
+	/* error_desaturation: start-bit 23, length 1, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 23) & 0x1;
+	o->can_0x401_StatusInformation.error_desaturation = w;
+	o->can_0x401_StatusInformation_rx = 1;
+	o->can_0x401_StatusInformation_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x401_Reserved_Limit(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0x401_StatusInformation.Reserved_Limit);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_Reserved_Limit(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0x401_StatusInformation.Reserved_Limit = in;
+	return 0;
+}
+
+int decode_can_0x401_Reserved_Error(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.Reserved_Error);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_Reserved_Error(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.Reserved_Error = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_outputvolt_pwm(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_outputvolt_pwm);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_outputvolt_pwm(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_outputvolt_pwm = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_motor_current(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_motor_current);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_motor_current(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_motor_current = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_velocity(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_velocity);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_velocity(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_velocity = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_bus_current(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_bus_current);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_bus_current(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_bus_current = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_bus_volt_upper(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_bus_volt_upper);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_bus_volt_upper(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_bus_volt_upper = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_bus_volt_lower(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_bus_volt_lower);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_bus_volt_lower(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_bus_volt_lower = in;
+	return 0;
+}
+
+int decode_can_0x401_limit_temp(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.limit_temp);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_limit_temp(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.limit_temp = in;
+	return 0;
+}
+
+int decode_can_0x401_error_hardware_over_current(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_hardware_over_current);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_hardware_over_current(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_hardware_over_current = in;
+	return 0;
+}
+
+int decode_can_0x401_error_software_over_current(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_software_over_current);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_software_over_current(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_software_over_current = in;
+	return 0;
+}
+
+int decode_can_0x401_error_DC_over_volt(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_DC_over_volt);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_DC_over_volt(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_DC_over_volt = in;
+	return 0;
+}
+
+int decode_can_0x401_error_bad_position(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_bad_position);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_bad_position(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_bad_position = in;
+	return 0;
+}
+
+int decode_can_0x401_error_watchdog(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_watchdog);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_watchdog(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_watchdog = in;
+	return 0;
+}
+
+int decode_can_0x401_error_configread(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_configread);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_configread(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_configread = in;
+	return 0;
+}
+
+int decode_can_0x401_error_15v_under_volt(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_15v_under_volt);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_15v_under_volt(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_15v_under_volt = in;
+	return 0;
+}
+
+int decode_can_0x401_error_desaturation(const can_obj_ex1_h_t *o, uint8_t *out) {
+	uint8_t rval = (uint8_t)(o->can_0x401_StatusInformation.error_desaturation);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x401_error_desaturation(can_obj_ex1_h_t *o, uint8_t in) {
+	o->can_0x401_StatusInformation.error_desaturation = in;
+	return 0;
+}
+
+int print_can_0x401_StatusInformation(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Reserved_Limit = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.Reserved_Limit)));
+	r = print_helper(r, fprintf(output, "Reserved_Error = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.Reserved_Error)));
+	r = print_helper(r, fprintf(output, "limit_outputvolt_pwm = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_outputvolt_pwm)));
+	r = print_helper(r, fprintf(output, "limit_motor_current = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_motor_current)));
+	r = print_helper(r, fprintf(output, "limit_velocity = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_velocity)));
+	r = print_helper(r, fprintf(output, "limit_bus_current = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_bus_current)));
+	r = print_helper(r, fprintf(output, "limit_bus_volt_upper = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_bus_volt_upper)));
+	r = print_helper(r, fprintf(output, "limit_bus_volt_lower = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_bus_volt_lower)));
+	r = print_helper(r, fprintf(output, "limit_temp = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.limit_temp)));
+	r = print_helper(r, fprintf(output, "error_hardware_over_current = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_hardware_over_current)));
+	r = print_helper(r, fprintf(output, "error_software_over_current = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_software_over_current)));
+	r = print_helper(r, fprintf(output, "error_DC_over_volt = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_DC_over_volt)));
+	r = print_helper(r, fprintf(output, "error_bad_position = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_bad_position)));
+	r = print_helper(r, fprintf(output, "error_watchdog = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_watchdog)));
+	r = print_helper(r, fprintf(output, "error_configread = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_configread)));
+	r = print_helper(r, fprintf(output, "error_15v_under_volt = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_15v_under_volt)));
+	r = print_helper(r, fprintf(output, "error_desaturation = (wire: %.0f)\n", (double)(o->can_0x401_StatusInformation.error_desaturation)));
+	return r;
+}
+
+static int pack_can_0x402_BusMeasurement(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BusVoltage: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x402_BusMeasurement.BusVoltage) & 0xffffffff;
+	lo |= w;
+	/* BusCurrent: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x402_BusMeasurement.BusCurrent) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x402_BusMeasurement_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x402_BusMeasurement(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BusVoltage: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x402_BusMeasurement.BusVoltage = unpack754_32(w);
+	/* BusCurrent: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x402_BusMeasurement.BusCurrent = unpack754_32(w);
+	o->can_0x402_BusMeasurement_rx = 1;
+	o->can_0x402_BusMeasurement_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x402_BusVoltage(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x402_BusMeasurement.BusVoltage);
+	if ((rval >= -1000) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x402_BusVoltage(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x402_BusMeasurement.BusVoltage = 0;
+	if (in < -1000)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x402_BusMeasurement.BusVoltage = in;
+	return 0;
+}
+
+int decode_can_0x402_BusCurrent(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x402_BusMeasurement.BusCurrent);
+	if ((rval >= -1000) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x402_BusCurrent(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x402_BusMeasurement.BusCurrent = 0;
+	if (in < -1000)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x402_BusMeasurement.BusCurrent = in;
+	return 0;
+}
+
+int print_can_0x402_BusMeasurement(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BusVoltage = (wire: %g)\n", (double)(o->can_0x402_BusMeasurement.BusVoltage)));
+	r = print_helper(r, fprintf(output, "BusCurrent = (wire: %g)\n", (double)(o->can_0x402_BusMeasurement.BusCurrent)));
+	return r;
+}
+
+static int pack_can_0x403_VelocityMeasurment(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorVelocity: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x403_VelocityMeasurment.MotorVelocity) & 0xffffffff;
+	lo |= w;
+	/* VehicleVelocity: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x403_VelocityMeasurment.VehicleVelocity) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x403_VelocityMeasurment_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x403_VelocityMeasurment(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MotorVelocity: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x403_VelocityMeasurment.MotorVelocity = unpack754_32(w);
+	/* VehicleVelocity: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x403_VelocityMeasurment.VehicleVelocity = unpack754_32(w);
+	o->can_0x403_VelocityMeasurment_rx = 1;
+	o->can_0x403_VelocityMeasurment_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x403_MotorVelocity(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x403_VelocityMeasurment.MotorVelocity);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x403_MotorVelocity(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x403_VelocityMeasurment.MotorVelocity = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x403_VelocityMeasurment.MotorVelocity = in;
+	return 0;
+}
+
+int decode_can_0x403_VehicleVelocity(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x403_VelocityMeasurment.VehicleVelocity);
+	if ((rval >= -1000) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x403_VehicleVelocity(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x403_VelocityMeasurment.VehicleVelocity = 0;
+	if (in < -1000)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x403_VelocityMeasurment.VehicleVelocity = in;
+	return 0;
+}
+
+int print_can_0x403_VelocityMeasurment(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorVelocity = (wire: %g)\n", (double)(o->can_0x403_VelocityMeasurment.MotorVelocity)));
+	r = print_helper(r, fprintf(output, "VehicleVelocity = (wire: %g)\n", (double)(o->can_0x403_VelocityMeasurment.VehicleVelocity)));
+	return r;
+}
+
+static int pack_can_0x404_PhaseCurrentMeasurment(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* PhaseBcurrent: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x404_PhaseCurrentMeasurment.PhaseBcurrent) & 0xffffffff;
+	lo |= w;
+	/* PhaseCcurrent: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x404_PhaseCurrentMeasurment.PhaseCcurrent) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x404_PhaseCurrentMeasurment_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x404_PhaseCurrentMeasurment(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* PhaseBcurrent: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x404_PhaseCurrentMeasurment.PhaseBcurrent = unpack754_32(w);
+	/* PhaseCcurrent: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x404_PhaseCurrentMeasurment.PhaseCcurrent = unpack754_32(w);
+	o->can_0x404_PhaseCurrentMeasurment_rx = 1;
+	o->can_0x404_PhaseCurrentMeasurment_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x404_PhaseBcurrent(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x404_PhaseCurrentMeasurment.PhaseBcurrent);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x404_PhaseBcurrent(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x404_PhaseCurrentMeasurment.PhaseBcurrent = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x404_PhaseCurrentMeasurment.PhaseBcurrent = in;
+	return 0;
+}
+
+int decode_can_0x404_PhaseCcurrent(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x404_PhaseCurrentMeasurment.PhaseCcurrent);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x404_PhaseCcurrent(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x404_PhaseCurrentMeasurment.PhaseCcurrent = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x404_PhaseCurrentMeasurment.PhaseCcurrent = in;
+	return 0;
+}
+
+int print_can_0x404_PhaseCurrentMeasurment(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "PhaseBcurrent = (wire: %g)\n", (double)(o->can_0x404_PhaseCurrentMeasurment.PhaseBcurrent)));
+	r = print_helper(r, fprintf(output, "PhaseCcurrent = (wire: %g)\n", (double)(o->can_0x404_PhaseCurrentMeasurment.PhaseCcurrent)));
+	return r;
+}
+
+static int pack_can_0x405_MotorVoltage(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorVq: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x405_MotorVoltage.MotorVq) & 0xffffffff;
+	lo |= w;
+	/* MotorVd: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x405_MotorVoltage.MotorVd) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x405_MotorVoltage_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x405_MotorVoltage(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MotorVq: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x405_MotorVoltage.MotorVq = unpack754_32(w);
+	/* MotorVd: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x405_MotorVoltage.MotorVd = unpack754_32(w);
+	o->can_0x405_MotorVoltage_rx = 1;
+	o->can_0x405_MotorVoltage_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x405_MotorVq(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x405_MotorVoltage.MotorVq);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x405_MotorVq(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x405_MotorVoltage.MotorVq = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x405_MotorVoltage.MotorVq = in;
+	return 0;
+}
+
+int decode_can_0x405_MotorVd(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x405_MotorVoltage.MotorVd);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x405_MotorVd(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x405_MotorVoltage.MotorVd = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x405_MotorVoltage.MotorVd = in;
+	return 0;
+}
+
+int print_can_0x405_MotorVoltage(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorVq = (wire: %g)\n", (double)(o->can_0x405_MotorVoltage.MotorVq)));
+	r = print_helper(r, fprintf(output, "MotorVd = (wire: %g)\n", (double)(o->can_0x405_MotorVoltage.MotorVd)));
+	return r;
+}
+
+static int pack_can_0x406_MotorCurrent(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorIq: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x406_MotorCurrent.MotorIq) & 0xffffffff;
+	lo |= w;
+	/* MotorId: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x406_MotorCurrent.MotorId) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x406_MotorCurrent_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x406_MotorCurrent(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MotorIq: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x406_MotorCurrent.MotorIq = unpack754_32(w);
+	/* MotorId: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x406_MotorCurrent.MotorId = unpack754_32(w);
+	o->can_0x406_MotorCurrent_rx = 1;
+	o->can_0x406_MotorCurrent_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x406_MotorIq(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x406_MotorCurrent.MotorIq);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x406_MotorIq(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x406_MotorCurrent.MotorIq = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x406_MotorCurrent.MotorIq = in;
+	return 0;
+}
+
+int decode_can_0x406_MotorId(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x406_MotorCurrent.MotorId);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x406_MotorId(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x406_MotorCurrent.MotorId = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x406_MotorCurrent.MotorId = in;
+	return 0;
+}
+
+int print_can_0x406_MotorCurrent(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorIq = (wire: %g)\n", (double)(o->can_0x406_MotorCurrent.MotorIq)));
+	r = print_helper(r, fprintf(output, "MotorId = (wire: %g)\n", (double)(o->can_0x406_MotorCurrent.MotorId)));
+	return r;
+}
+
+static int pack_can_0x407_BackEMF(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BEMFq: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x407_BackEMF.BEMFq) & 0xffffffff;
+	lo |= w;
+	/* BEMFd: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x407_BackEMF.BEMFd) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x407_BackEMF_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x407_BackEMF(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BEMFq: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x407_BackEMF.BEMFq = unpack754_32(w);
+	/* BEMFd: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x407_BackEMF.BEMFd = unpack754_32(w);
+	o->can_0x407_BackEMF_rx = 1;
+	o->can_0x407_BackEMF_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x407_BEMFq(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x407_BackEMF.BEMFq);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x407_BEMFq(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x407_BackEMF.BEMFq = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x407_BackEMF.BEMFq = in;
+	return 0;
+}
+
+int decode_can_0x407_BEMFd(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x407_BackEMF.BEMFd);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x407_BEMFd(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x407_BackEMF.BEMFd = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x407_BackEMF.BEMFd = in;
+	return 0;
+}
+
+int print_can_0x407_BackEMF(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BEMFq = (wire: %g)\n", (double)(o->can_0x407_BackEMF.BEMFq)));
+	r = print_helper(r, fprintf(output, "BEMFd = (wire: %g)\n", (double)(o->can_0x407_BackEMF.BEMFd)));
+	return r;
+}
+
+static int pack_can_0x408_Rail15v(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* supply15v: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x408_Rail15v.supply15v) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x408_Rail15v_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x408_Rail15v(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* supply15v: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x408_Rail15v.supply15v = unpack754_32(w);
+	o->can_0x408_Rail15v_rx = 1;
+	o->can_0x408_Rail15v_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x408_supply15v(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x408_Rail15v.supply15v);
+	if ((rval >= -100000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x408_supply15v(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x408_Rail15v.supply15v = 0;
+	if (in < -100000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x408_Rail15v.supply15v = in;
+	return 0;
+}
+
+int print_can_0x408_Rail15v(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "supply15v = (wire: %g)\n", (double)(o->can_0x408_Rail15v.supply15v)));
+	return r;
+}
+
+static int pack_can_0x409_Rail3v3_1v9(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* supply1v9: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x409_Rail3v3_1v9.supply1v9) & 0xffffffff;
+	lo |= w;
+	/* supply3v3: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x409_Rail3v3_1v9.supply3v3) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x409_Rail3v3_1v9_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x409_Rail3v3_1v9(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* supply1v9: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x409_Rail3v3_1v9.supply1v9 = unpack754_32(w);
+	/* supply3v3: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x409_Rail3v3_1v9.supply3v3 = unpack754_32(w);
+	o->can_0x409_Rail3v3_1v9_rx = 1;
+	o->can_0x409_Rail3v3_1v9_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x409_supply1v9(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x409_Rail3v3_1v9.supply1v9);
+	if ((rval >= -1000) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x409_supply1v9(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x409_Rail3v3_1v9.supply1v9 = 0;
+	if (in < -1000)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x409_Rail3v3_1v9.supply1v9 = in;
+	return 0;
+}
+
+int decode_can_0x409_supply3v3(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x409_Rail3v3_1v9.supply3v3);
+	if ((rval >= -1000) && (rval <= 1000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x409_supply3v3(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x409_Rail3v3_1v9.supply3v3 = 0;
+	if (in < -1000)
+		return -1;
+	if (in > 1000)
+		return -1;
+	o->can_0x409_Rail3v3_1v9.supply3v3 = in;
+	return 0;
+}
+
+int print_can_0x409_Rail3v3_1v9(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "supply1v9 = (wire: %g)\n", (double)(o->can_0x409_Rail3v3_1v9.supply1v9)));
+	r = print_helper(r, fprintf(output, "supply3v3 = (wire: %g)\n", (double)(o->can_0x409_Rail3v3_1v9.supply3v3)));
+	return r;
+}
+
+static int pack_can_0x40b_Motor_PhaseA_Temperature(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x40b_Motor_PhaseA_Temperature.MotorTemp) & 0xffffffff;
+	lo |= w;
+	/* PhaseAtemp: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x40b_Motor_PhaseA_Temperature.PhaseAtemp) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x40b_Motor_PhaseA_Temperature_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x40b_Motor_PhaseA_Temperature(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MotorTemp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x40b_Motor_PhaseA_Temperature.MotorTemp = unpack754_32(w);
+	/* PhaseAtemp: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x40b_Motor_PhaseA_Temperature.PhaseAtemp = unpack754_32(w);
+	o->can_0x40b_Motor_PhaseA_Temperature_rx = 1;
+	o->can_0x40b_Motor_PhaseA_Temperature_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x40b_MotorTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x40b_Motor_PhaseA_Temperature.MotorTemp);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x40b_MotorTemp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x40b_Motor_PhaseA_Temperature.MotorTemp = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x40b_Motor_PhaseA_Temperature.MotorTemp = in;
+	return 0;
+}
+
+int decode_can_0x40b_PhaseAtemp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x40b_Motor_PhaseA_Temperature.PhaseAtemp);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x40b_PhaseAtemp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x40b_Motor_PhaseA_Temperature.PhaseAtemp = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x40b_Motor_PhaseA_Temperature.PhaseAtemp = in;
+	return 0;
+}
+
+int print_can_0x40b_Motor_PhaseA_Temperature(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorTemp = (wire: %g)\n", (double)(o->can_0x40b_Motor_PhaseA_Temperature.MotorTemp)));
+	r = print_helper(r, fprintf(output, "PhaseAtemp = (wire: %g)\n", (double)(o->can_0x40b_Motor_PhaseA_Temperature.PhaseAtemp)));
+	return r;
+}
+
+static int pack_can_0x40c_Phase_B_dsp_temprature(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* DSP_temp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x40c_Phase_B_dsp_temprature.DSP_temp) & 0xffffffff;
+	lo |= w;
+	/* PhaseB_Temp: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x40c_Phase_B_dsp_temprature.PhaseB_Temp) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x40c_Phase_B_dsp_temprature_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x40c_Phase_B_dsp_temprature(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* DSP_temp: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x40c_Phase_B_dsp_temprature.DSP_temp = unpack754_32(w);
+	/* PhaseB_Temp: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x40c_Phase_B_dsp_temprature.PhaseB_Temp = unpack754_32(w);
+	o->can_0x40c_Phase_B_dsp_temprature_rx = 1;
+	o->can_0x40c_Phase_B_dsp_temprature_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x40c_DSP_temp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x40c_Phase_B_dsp_temprature.DSP_temp);
+	if ((rval >= -100000) && (rval <= 100000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x40c_DSP_temp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x40c_Phase_B_dsp_temprature.DSP_temp = 0;
+	if (in < -100000)
+		return -1;
+	if (in > 100000)
+		return -1;
+	o->can_0x40c_Phase_B_dsp_temprature.DSP_temp = in;
+	return 0;
+}
+
+int decode_can_0x40c_PhaseB_Temp(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x40c_Phase_B_dsp_temprature.PhaseB_Temp);
+	if ((rval >= -100000) && (rval <= 100000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x40c_PhaseB_Temp(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x40c_Phase_B_dsp_temprature.PhaseB_Temp = 0;
+	if (in < -100000)
+		return -1;
+	if (in > 100000)
+		return -1;
+	o->can_0x40c_Phase_B_dsp_temprature.PhaseB_Temp = in;
+	return 0;
+}
+
+int print_can_0x40c_Phase_B_dsp_temprature(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "DSP_temp = (wire: %g)\n", (double)(o->can_0x40c_Phase_B_dsp_temprature.DSP_temp)));
+	r = print_helper(r, fprintf(output, "PhaseB_Temp = (wire: %g)\n", (double)(o->can_0x40c_Phase_B_dsp_temprature.PhaseB_Temp)));
+	return r;
+}
+
+static int pack_can_0x40e_Odometer_amphours(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Odometer: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x40e_Odometer_amphours.Odometer) & 0xffffffff;
+	lo |= w;
+	/* BusAmphours: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x40e_Odometer_amphours.BusAmphours) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x40e_Odometer_amphours_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x40e_Odometer_amphours(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* Odometer: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x40e_Odometer_amphours.Odometer = unpack754_32(w);
+	/* BusAmphours: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x40e_Odometer_amphours.BusAmphours = unpack754_32(w);
+	o->can_0x40e_Odometer_amphours_rx = 1;
+	o->can_0x40e_Odometer_amphours_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x40e_Odometer(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x40e_Odometer_amphours.Odometer);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x40e_Odometer(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x40e_Odometer_amphours.Odometer = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x40e_Odometer_amphours.Odometer = in;
+	return 0;
+}
+
+int decode_can_0x40e_BusAmphours(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x40e_Odometer_amphours.BusAmphours);
+	if ((rval >= -10000) && (rval <= 10000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x40e_BusAmphours(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x40e_Odometer_amphours.BusAmphours = 0;
+	if (in < -10000)
+		return -1;
+	if (in > 10000)
+		return -1;
+	o->can_0x40e_Odometer_amphours.BusAmphours = in;
+	return 0;
+}
+
+int print_can_0x40e_Odometer_amphours(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Odometer = (wire: %g)\n", (double)(o->can_0x40e_Odometer_amphours.Odometer)));
+	r = print_helper(r, fprintf(output, "BusAmphours = (wire: %g)\n", (double)(o->can_0x40e_Odometer_amphours.BusAmphours)));
+	return r;
+}
+
+static int pack_can_0x501_MotorDriveCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MotorVelocityCommand: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x501_MotorDriveCommand.MotorVelocityCommand) & 0xffffffff;
+	lo |= w;
+	/* MotorCurrentCommand: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x501_MotorDriveCommand.MotorCurrentCommand) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x501_MotorDriveCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x501_MotorDriveCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* MotorVelocityCommand: start-bit 0, length 32, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffffffff;
+	o->can_0x501_MotorDriveCommand.MotorVelocityCommand = unpack754_32(w);
+	/* MotorCurrentCommand: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x501_MotorDriveCommand.MotorCurrentCommand = unpack754_32(w);
+	o->can_0x501_MotorDriveCommand_rx = 1;
+	o->can_0x501_MotorDriveCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x501_MotorVelocityCommand(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x501_MotorDriveCommand.MotorVelocityCommand);
+	if ((rval >= -5000) && (rval <= 5000)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x501_MotorVelocityCommand(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x501_MotorDriveCommand.MotorVelocityCommand = 0;
+	if (in < -5000)
+		return -1;
+	if (in > 5000)
+		return -1;
+	o->can_0x501_MotorDriveCommand.MotorVelocityCommand = in;
+	return 0;
+}
+
+int decode_can_0x501_MotorCurrentCommand(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x501_MotorDriveCommand.MotorCurrentCommand);
+	if ((rval >= 0) && (rval <= 1)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x501_MotorCurrentCommand(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x501_MotorDriveCommand.MotorCurrentCommand = 0;
+	if (in < 0)
+		return -1;
+	if (in > 1)
+		return -1;
+	o->can_0x501_MotorDriveCommand.MotorCurrentCommand = in;
+	return 0;
+}
+
+int print_can_0x501_MotorDriveCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MotorVelocityCommand = (wire: %g)\n", (double)(o->can_0x501_MotorDriveCommand.MotorVelocityCommand)));
+	r = print_helper(r, fprintf(output, "MotorCurrentCommand = (wire: %g)\n", (double)(o->can_0x501_MotorDriveCommand.MotorCurrentCommand)));
+	return r;
+}
+
+static int pack_can_0x502_MotorPowerCommand(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* BusCurrentCommand: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = pack754_32(o->can_0x502_MotorPowerCommand.BusCurrentCommand) & 0xffffffff;
+	hi |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x502_MotorPowerCommand_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x502_MotorPowerCommand(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t hi = data >> 32;
+	if (dlc < 8)
+		return -1;
+	/* BusCurrentCommand: start-bit 32, length 32, endianess intel, scaling 1, offset 0 */
+	w = (hi >> 0) & 0xffffffff;
+	o->can_0x502_MotorPowerCommand.BusCurrentCommand = unpack754_32(w);
+	o->can_0x502_MotorPowerCommand_rx = 1;
+	o->can_0x502_MotorPowerCommand_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x502_BusCurrentCommand(const can_obj_ex1_h_t *o, dbcc_float_t *out) {
+	dbcc_float_t rval = (dbcc_float_t)(o->can_0x502_MotorPowerCommand.BusCurrentCommand);
+	if ((rval >= 0) && (rval <= 1)) {
+		*out = rval;
+		return 0;
+	} else {
+		*out = (dbcc_float_t)0;
+		return -1;
+	}
+}
+
+int encode_can_0x502_BusCurrentCommand(can_obj_ex1_h_t *o, dbcc_float_t in) {
+	o->can_0x502_MotorPowerCommand.BusCurrentCommand = 0;
+	if (in < 0)
+		return -1;
+	if (in > 1)
+		return -1;
+	o->can_0x502_MotorPowerCommand.BusCurrentCommand = in;
+	return 0;
+}
+
+int print_can_0x502_MotorPowerCommand(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "BusCurrentCommand = (wire: %g)\n", (double)(o->can_0x502_MotorPowerCommand.BusCurrentCommand)));
+	return r;
+}
+
+static int pack_can_0x8501930_Odometer_Velocity(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* Odometer_Velocity: start-bit 7, length 32, endianess motorola, scaling 1, offset 0 */
+	w = ((uint32_t)(o->can_0x8501930_Odometer_Velocity.Odometer_Velocity)) & 0xffffffff;
+	lo |= w << 24;
+	lo |= ((w >> 8) & 0xff) << 16;
+	lo |= ((w >> 16) & 0xff) << 8;
+	lo |= (w >> 24);
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0x8501930_Odometer_Velocity_tx = 1;
+	return 6;
+}
+
+static int unpack_can_0x8501930_Odometer_Velocity(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 6)
+		return -1;
+	/* Odometer_Velocity: start-bit 7, length 32, endianess motorola, scaling 1, offset 0 */
+	w = (uint32_t)((uint32_t)(uint8_t)(lo >> 24) | ((uint32_t)(uint8_t)(lo >> 16) << 8) | ((uint32_t)(uint8_t)(lo >> 8) << 16) | ((uint32_t)(uint8_t)lo << 24)) & 0xffffffff;
+	o->can_0x8501930_Odometer_Velocity.Odometer_Velocity = w;
+	o->can_0x8501930_Odometer_Velocity_rx = 1;
+	o->can_0x8501930_Odometer_Velocity_time_stamp_rx = time_stamp;
+	return 6;
+}
+
+int decode_can_0x8501930_Odometer_Velocity(const can_obj_ex1_h_t *o, int32_t *out) {
+	int32_t rval = (int32_t)(o->can_0x8501930_Odometer_Velocity.Odometer_Velocity);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x8501930_Odometer_Velocity(can_obj_ex1_h_t *o, int32_t in) {
+	o->can_0x8501930_Odometer_Velocity.Odometer_Velocity = in;
+	return 0;
+}
+
+int print_can_0x8501930_Odometer_Velocity(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "Odometer_Velocity = (wire: %.0f)\n", (double)(o->can_0x8501930_Odometer_Velocity.Odometer_Velocity)));
+	return r;
+}
+
+static int pack_can_0xcc0016e_MagicCanNode1RHeartbeat(can_obj_ex1_h_t *o, uint64_t *data) {
+	register uint32_t w, lo = 0, hi = 0;
+	/* MagicNode1Flags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = ((uint16_t)(o->can_0xcc0016e_MagicCanNode1RHeartbeat.MagicNode1Flags)) & 0xffff;
+	lo |= w;
+	*data = (((uint64_t)hi << 32) | lo);
+	o->can_0xcc0016e_MagicCanNode1RHeartbeat_tx = 1;
+	return 2;
+}
+
+static int unpack_can_0xcc0016e_MagicCanNode1RHeartbeat(can_obj_ex1_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	register uint32_t w;
+	register const uint32_t lo = data;
+	if (dlc < 2)
+		return -1;
+	/* MagicNode1Flags: start-bit 0, length 16, endianess intel, scaling 1, offset 0 */
+	w = (lo >> 0) & 0xffff;
+	o->can_0xcc0016e_MagicCanNode1RHeartbeat.MagicNode1Flags = w;
+	o->can_0xcc0016e_MagicCanNode1RHeartbeat_rx = 1;
+	o->can_0xcc0016e_MagicCanNode1RHeartbeat_time_stamp_rx = time_stamp;
+	return 2;
+}
+
+int decode_can_0xcc0016e_MagicNode1Flags(const can_obj_ex1_h_t *o, uint16_t *out) {
+	uint16_t rval = (uint16_t)(o->can_0xcc0016e_MagicCanNode1RHeartbeat.MagicNode1Flags);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0xcc0016e_MagicNode1Flags(can_obj_ex1_h_t *o, uint16_t in) {
+	o->can_0xcc0016e_MagicCanNode1RHeartbeat.MagicNode1Flags = in;
+	return 0;
+}
+
+int print_can_0xcc0016e_MagicCanNode1RHeartbeat(const can_obj_ex1_h_t *o, FILE *output) {
+	int r = 0;
+	r = print_helper(r, fprintf(output, "MagicNode1Flags = (wire: %.0f)\n", (double)(o->can_0xcc0016e_MagicCanNode1RHeartbeat.MagicNode1Flags)));
+	return r;
+}
+
+int unpack_message(can_obj_ex1_h_t *o, const unsigned long id, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	switch (id) {
+	case 0x020: return unpack_can_0x020_MagicCanNode1RBootloaderAddress(o, data, dlc, time_stamp);
+	case 0x022: return unpack_can_0x022_MagicCanNode2MBootloaderAddress(o, data, dlc, time_stamp);
+	case 0x023: return unpack_can_0x023_MagicCanNode2Heartbeat(o, data, dlc, time_stamp);
+	case 0x024: return unpack_can_0x024_MagicCanNode3FBootloaderAddress(o, data, dlc, time_stamp);
+	case 0x025: return unpack_can_0x025_MagicCanNode3Heartbeat(o, data, dlc, time_stamp);
+	case 0x026: return unpack_can_0x026_FrameFaultBootloaderAddres(o, data, dlc, time_stamp);
+	case 0x027: return unpack_can_0x027_FrameFaultHeartbeat(o, data, dlc, time_stamp);
+	case 0x028: return unpack_can_0x028_FrameFaultCommand(o, data, dlc, time_stamp);
+	case 0x02c: return unpack_can_0x02c_DriveControlsBootloader(o, data, dlc, time_stamp);
+	case 0x02d: return unpack_can_0x02d_DriveControlsCommand(o, data, dlc, time_stamp);
+	case 0x02e: return unpack_can_0x02e_DriveControlsHeartbeat(o, data, dlc, time_stamp);
+	case 0x030: return unpack_can_0x030_CANMirrorBootloaderAddress(o, data, dlc, time_stamp);
+	case 0x031: return unpack_can_0x031_CANMirrorHeatbeart(o, data, dlc, time_stamp);
+	case 0x032: return unpack_can_0x032_CANMirrorCommand(o, data, dlc, time_stamp);
+	case 0x033: return unpack_can_0x033_RiderDisplayBootloaderAddress(o, data, dlc, time_stamp);
+	case 0x034: return unpack_can_0x034_RiderDisplayHeartbeat(o, data, dlc, time_stamp);
+	case 0x035: return unpack_can_0x035_RiderDisplayCommand(o, data, dlc, time_stamp);
+	case 0x039: return unpack_can_0x039_BIM1BootloaderAddress(o, data, dlc, time_stamp);
+	case 0x03a: return unpack_can_0x03a_BIM1Heartbeat(o, data, dlc, time_stamp);
+	case 0x03b: return unpack_can_0x03b_BIM2BootloaderAddress(o, data, dlc, time_stamp);
+	case 0x03c: return unpack_can_0x03c_BIM2Heartbeat(o, data, dlc, time_stamp);
+	case 0x03d: return unpack_can_0x03d_BIM3BootloaderAddress(o, data, dlc, time_stamp);
+	case 0x03e: return unpack_can_0x03e_BIM3Heartbeat(o, data, dlc, time_stamp);
+	case 0x03f: return unpack_can_0x03f_BIM4BootloaderAddress(o, data, dlc, time_stamp);
+	case 0x040: return unpack_can_0x040_BIM4Heartbeat(o, data, dlc, time_stamp);
+	case 0x0a0: return unpack_can_0x0a0_MagicCanNode1RCommand(o, data, dlc, time_stamp);
+	case 0x0a1: return unpack_can_0x0a1_MagicCanNode2MCommand(o, data, dlc, time_stamp);
+	case 0x0a2: return unpack_can_0x0a2_MagicCanNode3FCommand(o, data, dlc, time_stamp);
+	case 0x0aa: return unpack_can_0x0aa_CANcorderHeartbeat(o, data, dlc, time_stamp);
+	case 0x0b0: return unpack_can_0x0b0_BIM1Command(o, data, dlc, time_stamp);
+	case 0x0b1: return unpack_can_0x0b1_BIM2Command(o, data, dlc, time_stamp);
+	case 0x0b2: return unpack_can_0x0b2_BIM3Command(o, data, dlc, time_stamp);
+	case 0x0b3: return unpack_can_0x0b3_BIM4Command(o, data, dlc, time_stamp);
+	case 0x100: return unpack_can_0x100_FrameFaultDetectionStatus(o, data, dlc, time_stamp);
+	case 0x101: return unpack_can_0x101_FrontBrakePressure(o, data, dlc, time_stamp);
+	case 0x102: return unpack_can_0x102_RearBrakePressure(o, data, dlc, time_stamp);
+	case 0x103: return unpack_can_0x103_FrontSuspensionTravel(o, data, dlc, time_stamp);
+	case 0x104: return unpack_can_0x104_RearSuspensionTravel(o, data, dlc, time_stamp);
+	case 0x106: return unpack_can_0x106_BusVoltage12V(o, data, dlc, time_stamp);
+	case 0x107: return unpack_can_0x107_PostMotorCoolantTemp(o, data, dlc, time_stamp);
+	case 0x108: return unpack_can_0x108_PostControllerCoolantTemp(o, data, dlc, time_stamp);
+	case 0x109: return unpack_can_0x109_RadiatorCoolSideCoolantTemp(o, data, dlc, time_stamp);
+	case 0x10a: return unpack_can_0x10a_AmbientTemp(o, data, dlc, time_stamp);
+	case 0x10b: return unpack_can_0x10b_GPSLatAndValidityStatus(o, data, dlc, time_stamp);
+	case 0x10c: return unpack_can_0x10c_GPSLongitude(o, data, dlc, time_stamp);
+	case 0x10d: return unpack_can_0x10d_GPSAltitudeAndAccuracy(o, data, dlc, time_stamp);
+	case 0x10e: return unpack_can_0x10e_CurrentTime(o, data, dlc, time_stamp);
+	case 0x10f: return unpack_can_0x10f_IMUAccelerationMeasurement(o, data, dlc, time_stamp);
+	case 0x110: return unpack_can_0x110_IMUGyroMeasurement(o, data, dlc, time_stamp);
+	case 0x111: return unpack_can_0x111_MotorPlateTemp(o, data, dlc, time_stamp);
+	case 0x112: return unpack_can_0x112_MotorScoop(o, data, dlc, time_stamp);
+	case 0x113: return unpack_can_0x113_IMU1(o, data, dlc, time_stamp);
+	case 0x114: return unpack_can_0x114_IMU2(o, data, dlc, time_stamp);
+	case 0x115: return unpack_can_0x115_IMU3(o, data, dlc, time_stamp);
+	case 0x116: return unpack_can_0x116_IMU4(o, data, dlc, time_stamp);
+	case 0x29a: return unpack_can_0x29a_IMU5(o, data, dlc, time_stamp);
+	case 0x29b: return unpack_can_0x29b_MESSAGE_NAME(o, data, dlc, time_stamp);
+	case 0x29c: return unpack_can_0x29c_MESSAGE_NAME2(o, data, dlc, time_stamp);
+	case 0x300: return unpack_can_0x300_BIM1CellStatistics1(o, data, dlc, time_stamp);
+	case 0x301: return unpack_can_0x301_BIM1CellStatistics2(o, data, dlc, time_stamp);
+	case 0x302: return unpack_can_0x302_BIM2CellStatisitcs1(o, data, dlc, time_stamp);
+	case 0x303: return unpack_can_0x303_BIM2CellStatistics2(o, data, dlc, time_stamp);
+	case 0x304: return unpack_can_0x304_BIM3CellStatisitcs1(o, data, dlc, time_stamp);
+	case 0x305: return unpack_can_0x305_BIM3CellStatistics2(o, data, dlc, time_stamp);
+	case 0x306: return unpack_can_0x306_BIM4CellStatistics1(o, data, dlc, time_stamp);
+	case 0x307: return unpack_can_0x307_BIM4CellStatistics2(o, data, dlc, time_stamp);
+	case 0x310: return unpack_can_0x310_Cells_1_4(o, data, dlc, time_stamp);
+	case 0x311: return unpack_can_0x311_Cells_5_8(o, data, dlc, time_stamp);
+	case 0x312: return unpack_can_0x312_Cells_9_12(o, data, dlc, time_stamp);
+	case 0x313: return unpack_can_0x313_Cells_13_16(o, data, dlc, time_stamp);
+	case 0x314: return unpack_can_0x314_Cells_17_20(o, data, dlc, time_stamp);
+	case 0x315: return unpack_can_0x315_Cells_21_24(o, data, dlc, time_stamp);
+	case 0x316: return unpack_can_0x316_Cells_25_28(o, data, dlc, time_stamp);
+	case 0x317: return unpack_can_0x317_Cells_29_32(o, data, dlc, time_stamp);
+	case 0x318: return unpack_can_0x318_Cells_33_36(o, data, dlc, time_stamp);
+	case 0x319: return unpack_can_0x319_Cells_37_40(o, data, dlc, time_stamp);
+	case 0x31a: return unpack_can_0x31a_Cells_41_44(o, data, dlc, time_stamp);
+	case 0x31b: return unpack_can_0x31b_Cells_45_48(o, data, dlc, time_stamp);
+	case 0x31c: return unpack_can_0x31c_Cells_49_52(o, data, dlc, time_stamp);
+	case 0x31d: return unpack_can_0x31d_Cells_53_54(o, data, dlc, time_stamp);
+	case 0x31e: return unpack_can_0x31e_Cells_55_58(o, data, dlc, time_stamp);
+	case 0x31f: return unpack_can_0x31f_Cells_59_62(o, data, dlc, time_stamp);
+	case 0x320: return unpack_can_0x320_Cells_63_66(o, data, dlc, time_stamp);
+	case 0x321: return unpack_can_0x321_Cells_67_70(o, data, dlc, time_stamp);
+	case 0x322: return unpack_can_0x322_Cells_71_74(o, data, dlc, time_stamp);
+	case 0x323: return unpack_can_0x323_Cells_75_78(o, data, dlc, time_stamp);
+	case 0x324: return unpack_can_0x324_Cells_79_82(o, data, dlc, time_stamp);
+	case 0x325: return unpack_can_0x325_Cells_83_86(o, data, dlc, time_stamp);
+	case 0x326: return unpack_can_0x326_Cells_87_90(o, data, dlc, time_stamp);
+	case 0x327: return unpack_can_0x327_Cells_91_94(o, data, dlc, time_stamp);
+	case 0x328: return unpack_can_0x328_Cells_95_98(o, data, dlc, time_stamp);
+	case 0x329: return unpack_can_0x329_Cells_99_102(o, data, dlc, time_stamp);
+	case 0x32a: return unpack_can_0x32a_Cells_103_106(o, data, dlc, time_stamp);
+	case 0x32b: return unpack_can_0x32b_Cells_107_110(o, data, dlc, time_stamp);
+	case 0x335: return unpack_can_0x335_PackTemperatures1Thru4(o, data, dlc, time_stamp);
+	case 0x336: return unpack_can_0x336_PackTempeartures5Thru8(o, data, dlc, time_stamp);
+	case 0x337: return unpack_can_0x337_PackTemperatures9Thru14(o, data, dlc, time_stamp);
+	case 0x338: return unpack_can_0x338_PackTemperatures13Thru14(o, data, dlc, time_stamp);
+	case 0x339: return unpack_can_0x339_PackTemperatures15Thru18(o, data, dlc, time_stamp);
+	case 0x33a: return unpack_can_0x33a_PackTemperatures19Thru22(o, data, dlc, time_stamp);
+	case 0x33b: return unpack_can_0x33b_PackTemperatures23Thru26(o, data, dlc, time_stamp);
+	case 0x33c: return unpack_can_0x33c_PackTemperatures27Thru30(o, data, dlc, time_stamp);
+	case 0x33d: return unpack_can_0x33d_PackTemperatures31Thru34(o, data, dlc, time_stamp);
+	case 0x33e: return unpack_can_0x33e_PackTemperatures35Thru38(o, data, dlc, time_stamp);
+	case 0x33f: return unpack_can_0x33f_PackTemperatures39Thru42(o, data, dlc, time_stamp);
+	case 0x401: return unpack_can_0x401_StatusInformation(o, data, dlc, time_stamp);
+	case 0x402: return unpack_can_0x402_BusMeasurement(o, data, dlc, time_stamp);
+	case 0x403: return unpack_can_0x403_VelocityMeasurment(o, data, dlc, time_stamp);
+	case 0x404: return unpack_can_0x404_PhaseCurrentMeasurment(o, data, dlc, time_stamp);
+	case 0x405: return unpack_can_0x405_MotorVoltage(o, data, dlc, time_stamp);
+	case 0x406: return unpack_can_0x406_MotorCurrent(o, data, dlc, time_stamp);
+	case 0x407: return unpack_can_0x407_BackEMF(o, data, dlc, time_stamp);
+	case 0x408: return unpack_can_0x408_Rail15v(o, data, dlc, time_stamp);
+	case 0x409: return unpack_can_0x409_Rail3v3_1v9(o, data, dlc, time_stamp);
+	case 0x40b: return unpack_can_0x40b_Motor_PhaseA_Temperature(o, data, dlc, time_stamp);
+	case 0x40c: return unpack_can_0x40c_Phase_B_dsp_temprature(o, data, dlc, time_stamp);
+	case 0x40e: return unpack_can_0x40e_Odometer_amphours(o, data, dlc, time_stamp);
+	case 0x501: return unpack_can_0x501_MotorDriveCommand(o, data, dlc, time_stamp);
+	case 0x502: return unpack_can_0x502_MotorPowerCommand(o, data, dlc, time_stamp);
+	case 0x8501930: return unpack_can_0x8501930_Odometer_Velocity(o, data, dlc, time_stamp);
+	case 0xcc0016e: return unpack_can_0xcc0016e_MagicCanNode1RHeartbeat(o, data, dlc, time_stamp);
+	default: break; 
+	}
+	return -1; 
+}
+
+int pack_message(can_obj_ex1_h_t *o, const unsigned long id, uint64_t *data) {
+	switch (id) {
+	case 0x020: return pack_can_0x020_MagicCanNode1RBootloaderAddress(o, data);
+	case 0x022: return pack_can_0x022_MagicCanNode2MBootloaderAddress(o, data);
+	case 0x023: return pack_can_0x023_MagicCanNode2Heartbeat(o, data);
+	case 0x024: return pack_can_0x024_MagicCanNode3FBootloaderAddress(o, data);
+	case 0x025: return pack_can_0x025_MagicCanNode3Heartbeat(o, data);
+	case 0x026: return pack_can_0x026_FrameFaultBootloaderAddres(o, data);
+	case 0x027: return pack_can_0x027_FrameFaultHeartbeat(o, data);
+	case 0x028: return pack_can_0x028_FrameFaultCommand(o, data);
+	case 0x02c: return pack_can_0x02c_DriveControlsBootloader(o, data);
+	case 0x02d: return pack_can_0x02d_DriveControlsCommand(o, data);
+	case 0x02e: return pack_can_0x02e_DriveControlsHeartbeat(o, data);
+	case 0x030: return pack_can_0x030_CANMirrorBootloaderAddress(o, data);
+	case 0x031: return pack_can_0x031_CANMirrorHeatbeart(o, data);
+	case 0x032: return pack_can_0x032_CANMirrorCommand(o, data);
+	case 0x033: return pack_can_0x033_RiderDisplayBootloaderAddress(o, data);
+	case 0x034: return pack_can_0x034_RiderDisplayHeartbeat(o, data);
+	case 0x035: return pack_can_0x035_RiderDisplayCommand(o, data);
+	case 0x039: return pack_can_0x039_BIM1BootloaderAddress(o, data);
+	case 0x03a: return pack_can_0x03a_BIM1Heartbeat(o, data);
+	case 0x03b: return pack_can_0x03b_BIM2BootloaderAddress(o, data);
+	case 0x03c: return pack_can_0x03c_BIM2Heartbeat(o, data);
+	case 0x03d: return pack_can_0x03d_BIM3BootloaderAddress(o, data);
+	case 0x03e: return pack_can_0x03e_BIM3Heartbeat(o, data);
+	case 0x03f: return pack_can_0x03f_BIM4BootloaderAddress(o, data);
+	case 0x040: return pack_can_0x040_BIM4Heartbeat(o, data);
+	case 0x0a0: return pack_can_0x0a0_MagicCanNode1RCommand(o, data);
+	case 0x0a1: return pack_can_0x0a1_MagicCanNode2MCommand(o, data);
+	case 0x0a2: return pack_can_0x0a2_MagicCanNode3FCommand(o, data);
+	case 0x0aa: return pack_can_0x0aa_CANcorderHeartbeat(o, data);
+	case 0x0b0: return pack_can_0x0b0_BIM1Command(o, data);
+	case 0x0b1: return pack_can_0x0b1_BIM2Command(o, data);
+	case 0x0b2: return pack_can_0x0b2_BIM3Command(o, data);
+	case 0x0b3: return pack_can_0x0b3_BIM4Command(o, data);
+	case 0x100: return pack_can_0x100_FrameFaultDetectionStatus(o, data);
+	case 0x101: return pack_can_0x101_FrontBrakePressure(o, data);
+	case 0x102: return pack_can_0x102_RearBrakePressure(o, data);
+	case 0x103: return pack_can_0x103_FrontSuspensionTravel(o, data);
+	case 0x104: return pack_can_0x104_RearSuspensionTravel(o, data);
+	case 0x106: return pack_can_0x106_BusVoltage12V(o, data);
+	case 0x107: return pack_can_0x107_PostMotorCoolantTemp(o, data);
+	case 0x108: return pack_can_0x108_PostControllerCoolantTemp(o, data);
+	case 0x109: return pack_can_0x109_RadiatorCoolSideCoolantTemp(o, data);
+	case 0x10a: return pack_can_0x10a_AmbientTemp(o, data);
+	case 0x10b: return pack_can_0x10b_GPSLatAndValidityStatus(o, data);
+	case 0x10c: return pack_can_0x10c_GPSLongitude(o, data);
+	case 0x10d: return pack_can_0x10d_GPSAltitudeAndAccuracy(o, data);
+	case 0x10e: return pack_can_0x10e_CurrentTime(o, data);
+	case 0x10f: return pack_can_0x10f_IMUAccelerationMeasurement(o, data);
+	case 0x110: return pack_can_0x110_IMUGyroMeasurement(o, data);
+	case 0x111: return pack_can_0x111_MotorPlateTemp(o, data);
+	case 0x112: return pack_can_0x112_MotorScoop(o, data);
+	case 0x113: return pack_can_0x113_IMU1(o, data);
+	case 0x114: return pack_can_0x114_IMU2(o, data);
+	case 0x115: return pack_can_0x115_IMU3(o, data);
+	case 0x116: return pack_can_0x116_IMU4(o, data);
+	case 0x29a: return pack_can_0x29a_IMU5(o, data);
+	case 0x29b: return pack_can_0x29b_MESSAGE_NAME(o, data);
+	case 0x29c: return pack_can_0x29c_MESSAGE_NAME2(o, data);
+	case 0x300: return pack_can_0x300_BIM1CellStatistics1(o, data);
+	case 0x301: return pack_can_0x301_BIM1CellStatistics2(o, data);
+	case 0x302: return pack_can_0x302_BIM2CellStatisitcs1(o, data);
+	case 0x303: return pack_can_0x303_BIM2CellStatistics2(o, data);
+	case 0x304: return pack_can_0x304_BIM3CellStatisitcs1(o, data);
+	case 0x305: return pack_can_0x305_BIM3CellStatistics2(o, data);
+	case 0x306: return pack_can_0x306_BIM4CellStatistics1(o, data);
+	case 0x307: return pack_can_0x307_BIM4CellStatistics2(o, data);
+	case 0x310: return pack_can_0x310_Cells_1_4(o, data);
+	case 0x311: return pack_can_0x311_Cells_5_8(o, data);
+	case 0x312: return pack_can_0x312_Cells_9_12(o, data);
+	case 0x313: return pack_can_0x313_Cells_13_16(o, data);
+	case 0x314: return pack_can_0x314_Cells_17_20(o, data);
+	case 0x315: return pack_can_0x315_Cells_21_24(o, data);
+	case 0x316: return pack_can_0x316_Cells_25_28(o, data);
+	case 0x317: return pack_can_0x317_Cells_29_32(o, data);
+	case 0x318: return pack_can_0x318_Cells_33_36(o, data);
+	case 0x319: return pack_can_0x319_Cells_37_40(o, data);
+	case 0x31a: return pack_can_0x31a_Cells_41_44(o, data);
+	case 0x31b: return pack_can_0x31b_Cells_45_48(o, data);
+	case 0x31c: return pack_can_0x31c_Cells_49_52(o, data);
+	case 0x31d: return pack_can_0x31d_Cells_53_54(o, data);
+	case 0x31e: return pack_can_0x31e_Cells_55_58(o, data);
+	case 0x31f: return pack_can_0x31f_Cells_59_62(o, data);
+	case 0x320: return pack_can_0x320_Cells_63_66(o, data);
+	case 0x321: return pack_can_0x321_Cells_67_70(o, data);
+	case 0x322: return pack_can_0x322_Cells_71_74(o, data);
+	case 0x323: return pack_can_0x323_Cells_75_78(o, data);
+	case 0x324: return pack_can_0x324_Cells_79_82(o, data);
+	case 0x325: return pack_can_0x325_Cells_83_86(o, data);
+	case 0x326: return pack_can_0x326_Cells_87_90(o, data);
+	case 0x327: return pack_can_0x327_Cells_91_94(o, data);
+	case 0x328: return pack_can_0x328_Cells_95_98(o, data);
+	case 0x329: return pack_can_0x329_Cells_99_102(o, data);
+	case 0x32a: return pack_can_0x32a_Cells_103_106(o, data);
+	case 0x32b: return pack_can_0x32b_Cells_107_110(o, data);
+	case 0x335: return pack_can_0x335_PackTemperatures1Thru4(o, data);
+	case 0x336: return pack_can_0x336_PackTempeartures5Thru8(o, data);
+	case 0x337: return pack_can_0x337_PackTemperatures9Thru14(o, data);
+	case 0x338: return pack_can_0x338_PackTemperatures13Thru14(o, data);
+	case 0x339: return pack_can_0x339_PackTemperatures15Thru18(o, data);
+	case 0x33a: return pack_can_0x33a_PackTemperatures19Thru22(o, data);
+	case 0x33b: return pack_can_0x33b_PackTemperatures23Thru26(o, data);
+	case 0x33c: return pack_can_0x33c_PackTemperatures27Thru30(o, data);
+	case 0x33d: return pack_can_0x33d_PackTemperatures31Thru34(o, data);
+	case 0x33e: return pack_can_0x33e_PackTemperatures35Thru38(o, data);
+	case 0x33f: return pack_can_0x33f_PackTemperatures39Thru42(o, data);
+	case 0x401: return pack_can_0x401_StatusInformation(o, data);
+	case 0x402: return pack_can_0x402_BusMeasurement(o, data);
+	case 0x403: return pack_can_0x403_VelocityMeasurment(o, data);
+	case 0x404: return pack_can_0x404_PhaseCurrentMeasurment(o, data);
+	case 0x405: return pack_can_0x405_MotorVoltage(o, data);
+	case 0x406: return pack_can_0x406_MotorCurrent(o, data);
+	case 0x407: return pack_can_0x407_BackEMF(o, data);
+	case 0x408: return pack_can_0x408_Rail15v(o, data);
+	case 0x409: return pack_can_0x409_Rail3v3_1v9(o, data);
+	case 0x40b: return pack_can_0x40b_Motor_PhaseA_Temperature(o, data);
+	case 0x40c: return pack_can_0x40c_Phase_B_dsp_temprature(o, data);
+	case 0x40e: return pack_can_0x40e_Odometer_amphours(o, data);
+	case 0x501: return pack_can_0x501_MotorDriveCommand(o, data);
+	case 0x502: return pack_can_0x502_MotorPowerCommand(o, data);
+	case 0x8501930: return pack_can_0x8501930_Odometer_Velocity(o, data);
+	case 0xcc0016e: return pack_can_0xcc0016e_MagicCanNode1RHeartbeat(o, data);
+	default: break; 
+	}
+	return -1; 
+}
+
+int message_dlc(const unsigned long id) {
+	switch (id) {
+	case 0x020: return 2;
+	case 0x022: return 2;
+	case 0x023: return 2;
+	case 0x024: return 2;
+	case 0x025: return 2;
+	case 0x026: return 2;
+	case 0x027: return 2;
+	case 0x028: return 8;
+	case 0x02c: return 2;
+	case 0x02d: return 8;
+	case 0x02e: return 2;
+	case 0x030: return 2;
+	case 0x031: return 2;
+	case 0x032: return 8;
+	case 0x033: return 2;
+	case 0x034: return 2;
+	case 0x035: return 8;
+	case 0x039: return 2;
+	case 0x03a: return 2;
+	case 0x03b: return 2;
+	case 0x03c: return 2;
+	case 0x03d: return 2;
+	case 0x03e: return 2;
+	case 0x03f: return 2;
+	case 0x040: return 2;
+	case 0x0a0: return 8;
+	case 0x0a1: return 8;
+	case 0x0a2: return 8;
+	case 0x0aa: return 2;
+	case 0x0b0: return 8;
+	case 0x0b1: return 8;
+	case 0x0b2: return 8;
+	case 0x0b3: return 8;
+	case 0x100: return 6;
+	case 0x101: return 4;
+	case 0x102: return 4;
+	case 0x103: return 4;
+	case 0x104: return 4;
+	case 0x106: return 4;
+	case 0x107: return 4;
+	case 0x108: return 4;
+	case 0x109: return 4;
+	case 0x10a: return 4;
+	case 0x10b: return 5;
+	case 0x10c: return 4;
+	case 0x10d: return 8;
+	case 0x10e: return 7;
+	case 0x10f: return 6;
+	case 0x110: return 6;
+	case 0x111: return 8;
+	case 0x112: return 4;
+	case 0x113: return 8;
+	case 0x114: return 8;
+	case 0x115: return 8;
+	case 0x116: return 8;
+	case 0x29a: return 4;
+	case 0x29b: return 0;
+	case 0x29c: return 0;
+	case 0x300: return 7;
+	case 0x301: return 5;
+	case 0x302: return 7;
+	case 0x303: return 5;
+	case 0x304: return 7;
+	case 0x305: return 5;
+	case 0x306: return 6;
+	case 0x307: return 5;
+	case 0x310: return 8;
+	case 0x311: return 8;
+	case 0x312: return 8;
+	case 0x313: return 8;
+	case 0x314: return 8;
+	case 0x315: return 8;
+	case 0x316: return 8;
+	case 0x317: return 8;
+	case 0x318: return 8;
+	case 0x319: return 8;
+	case 0x31a: return 8;
+	case 0x31b: return 8;
+	case 0x31c: return 8;
+	case 0x31d: return 8;
+	case 0x31e: return 8;
+	case 0x31f: return 8;
+	case 0x320: return 8;
+	case 0x321: return 8;
+	case 0x322: return 8;
+	case 0x323: return 8;
+	case 0x324: return 8;
+	case 0x325: return 8;
+	case 0x326: return 8;
+	case 0x327: return 8;
+	case 0x328: return 8;
+	case 0x329: return 8;
+	case 0x32a: return 8;
+	case 0x32b: return 8;
+	case 0x335: return 8;
+	case 0x336: return 8;
+	case 0x337: return 8;
+	case 0x338: return 8;
+	case 0x339: return 8;
+	case 0x33a: return 8;
+	case 0x33b: return 8;
+	case 0x33c: return 8;
+	case 0x33d: return 8;
+	case 0x33e: return 8;
+	case 0x33f: return 8;
+	case 0x401: return 8;
+	case 0x402: return 8;
+	case 0x403: return 8;
+	case 0x404: return 8;
+	case 0x405: return 8;
+	case 0x406: return 8;
+	case 0x407: return 8;
+	case 0x408: return 8;
+	case 0x409: return 8;
+	case 0x40b: return 8;
+	case 0x40c: return 8;
+	case 0x40e: return 8;
+	case 0x501: return 8;
+	case 0x502: return 8;
+	case 0x8501930: return 6;
+	case 0xcc0016e: return 2;
+	default: break; 
+	}
+	return -1; 
+}
+
+int print_message(const can_obj_ex1_h_t *o, const unsigned long id, FILE *output) {
+	switch (id) {
+	case 0x020: return print_can_0x020_MagicCanNode1RBootloaderAddress(o, output);
+	case 0x022: return print_can_0x022_MagicCanNode2MBootloaderAddress(o, output);
+	case 0x023: return print_can_0x023_MagicCanNode2Heartbeat(o, output);
+	case 0x024: return print_can_0x024_MagicCanNode3FBootloaderAddress(o, output);
+	case 0x025: return print_can_0x025_MagicCanNode3Heartbeat(o, output);
+	case 0x026: return print_can_0x026_FrameFaultBootloaderAddres(o, output);
+	case 0x027: return print_can_0x027_FrameFaultHeartbeat(o, output);
+	case 0x028: return print_can_0x028_FrameFaultCommand(o, output);
+	case 0x02c: return print_can_0x02c_DriveControlsBootloader(o, output);
+	case 0x02d: return print_can_0x02d_DriveControlsCommand(o, output);
+	case 0x02e: return print_can_0x02e_DriveControlsHeartbeat(o, output);
+	case 0x030: return print_can_0x030_CANMirrorBootloaderAddress(o, output);
+	case 0x031: return print_can_0x031_CANMirrorHeatbeart(o, output);
+	case 0x032: return print_can_0x032_CANMirrorCommand(o, output);
+	case 0x033: return print_can_0x033_RiderDisplayBootloaderAddress(o, output);
+	case 0x034: return print_can_0x034_RiderDisplayHeartbeat(o, output);
+	case 0x035: return print_can_0x035_RiderDisplayCommand(o, output);
+	case 0x039: return print_can_0x039_BIM1BootloaderAddress(o, output);
+	case 0x03a: return print_can_0x03a_BIM1Heartbeat(o, output);
+	case 0x03b: return print_can_0x03b_BIM2BootloaderAddress(o, output);
+	case 0x03c: return print_can_0x03c_BIM2Heartbeat(o, output);
+	case 0x03d: return print_can_0x03d_BIM3BootloaderAddress(o, output);
+	case 0x03e: return print_can_0x03e_BIM3Heartbeat(o, output);
+	case 0x03f: return print_can_0x03f_BIM4BootloaderAddress(o, output);
+	case 0x040: return print_can_0x040_BIM4Heartbeat(o, output);
+	case 0x0a0: return print_can_0x0a0_MagicCanNode1RCommand(o, output);
+	case 0x0a1: return print_can_0x0a1_MagicCanNode2MCommand(o, output);
+	case 0x0a2: return print_can_0x0a2_MagicCanNode3FCommand(o, output);
+	case 0x0aa: return print_can_0x0aa_CANcorderHeartbeat(o, output);
+	case 0x0b0: return print_can_0x0b0_BIM1Command(o, output);
+	case 0x0b1: return print_can_0x0b1_BIM2Command(o, output);
+	case 0x0b2: return print_can_0x0b2_BIM3Command(o, output);
+	case 0x0b3: return print_can_0x0b3_BIM4Command(o, output);
+	case 0x100: return print_can_0x100_FrameFaultDetectionStatus(o, output);
+	case 0x101: return print_can_0x101_FrontBrakePressure(o, output);
+	case 0x102: return print_can_0x102_RearBrakePressure(o, output);
+	case 0x103: return print_can_0x103_FrontSuspensionTravel(o, output);
+	case 0x104: return print_can_0x104_RearSuspensionTravel(o, output);
+	case 0x106: return print_can_0x106_BusVoltage12V(o, output);
+	case 0x107: return print_can_0x107_PostMotorCoolantTemp(o, output);
+	case 0x108: return print_can_0x108_PostControllerCoolantTemp(o, output);
+	case 0x109: return print_can_0x109_RadiatorCoolSideCoolantTemp(o, output);
+	case 0x10a: return print_can_0x10a_AmbientTemp(o, output);
+	case 0x10b: return print_can_0x10b_GPSLatAndValidityStatus(o, output);
+	case 0x10c: return print_can_0x10c_GPSLongitude(o, output);
+	case 0x10d: return print_can_0x10d_GPSAltitudeAndAccuracy(o, output);
+	case 0x10e: return print_can_0x10e_CurrentTime(o, output);
+	case 0x10f: return print_can_0x10f_IMUAccelerationMeasurement(o, output);
+	case 0x110: return print_can_0x110_IMUGyroMeasurement(o, output);
+	case 0x111: return print_can_0x111_MotorPlateTemp(o, output);
+	case 0x112: return print_can_0x112_MotorScoop(o, output);
+	case 0x113: return print_can_0x113_IMU1(o, output);
+	case 0x114: return print_can_0x114_IMU2(o, output);
+	case 0x115: return print_can_0x115_IMU3(o, output);
+	case 0x116: return print_can_0x116_IMU4(o, output);
+	case 0x29a: return print_can_0x29a_IMU5(o, output);
+	case 0x29b: return print_can_0x29b_MESSAGE_NAME(o, output);
+	case 0x29c: return print_can_0x29c_MESSAGE_NAME2(o, output);
+	case 0x300: return print_can_0x300_BIM1CellStatistics1(o, output);
+	case 0x301: return print_can_0x301_BIM1CellStatistics2(o, output);
+	case 0x302: return print_can_0x302_BIM2CellStatisitcs1(o, output);
+	case 0x303: return print_can_0x303_BIM2CellStatistics2(o, output);
+	case 0x304: return print_can_0x304_BIM3CellStatisitcs1(o, output);
+	case 0x305: return print_can_0x305_BIM3CellStatistics2(o, output);
+	case 0x306: return print_can_0x306_BIM4CellStatistics1(o, output);
+	case 0x307: return print_can_0x307_BIM4CellStatistics2(o, output);
+	case 0x310: return print_can_0x310_Cells_1_4(o, output);
+	case 0x311: return print_can_0x311_Cells_5_8(o, output);
+	case 0x312: return print_can_0x312_Cells_9_12(o, output);
+	case 0x313: return print_can_0x313_Cells_13_16(o, output);
+	case 0x314: return print_can_0x314_Cells_17_20(o, output);
+	case 0x315: return print_can_0x315_Cells_21_24(o, output);
+	case 0x316: return print_can_0x316_Cells_25_28(o, output);
+	case 0x317: return print_can_0x317_Cells_29_32(o, output);
+	case 0x318: return print_can_0x318_Cells_33_36(o, output);
+	case 0x319: return print_can_0x319_Cells_37_40(o, output);
+	case 0x31a: return print_can_0x31a_Cells_41_44(o, output);
+	case 0x31b: return print_can_0x31b_Cells_45_48(o, output);
+	case 0x31c: return print_can_0x31c_Cells_49_52(o, output);
+	case 0x31d: return print_can_0x31d_Cells_53_54(o, output);
+	case 0x31e: return print_can_0x31e_Cells_55_58(o, output);
+	case 0x31f: return print_can_0x31f_Cells_59_62(o, output);
+	case 0x320: return print_can_0x320_Cells_63_66(o, output);
+	case 0x321: return print_can_0x321_Cells_67_70(o, output);
+	case 0x322: return print_can_0x322_Cells_71_74(o, output);
+	case 0x323: return print_can_0x323_Cells_75_78(o, output);
+	case 0x324: return print_can_0x324_Cells_79_82(o, output);
+	case 0x325: return print_can_0x325_Cells_83_86(o, output);
+	case 0x326: return print_can_0x326_Cells_87_90(o, output);
+	case 0x327: return print_can_0x327_Cells_91_94(o, output);
+	case 0x328: return print_can_0x328_Cells_95_98(o, output);
+	case 0x329: return print_can_0x329_Cells_99_102(o, output);
+	case 0x32a: return print_can_0x32a_Cells_103_106(o, output);
+	case 0x32b: return print_can_0x32b_Cells_107_110(o, output);
+	case 0x335: return print_can_0x335_PackTemperatures1Thru4(o, output);
+	case 0x336: return print_can_0x336_PackTempeartures5Thru8(o, output);
+	case 0x337: return print_can_0x337_PackTemperatures9Thru14(o, output);
+	case 0x338: return print_can_0x338_PackTemperatures13Thru14(o, output);
+	case 0x339: return print_can_0x339_PackTemperatures15Thru18(o, output);
+	case 0x33a: return print_can_0x33a_PackTemperatures19Thru22(o, output);
+	case 0x33b: return print_can_0x33b_PackTemperatures23Thru26(o, output);
+	case 0x33c: return print_can_0x33c_PackTemperatures27Thru30(o, output);
+	case 0x33d: return print_can_0x33d_PackTemperatures31Thru34(o, output);
+	case 0x33e: return print_can_0x33e_PackTemperatures35Thru38(o, output);
+	case 0x33f: return print_can_0x33f_PackTemperatures39Thru42(o, output);
+	case 0x401: return print_can_0x401_StatusInformation(o, output);
+	case 0x402: return print_can_0x402_BusMeasurement(o, output);
+	case 0x403: return print_can_0x403_VelocityMeasurment(o, output);
+	case 0x404: return print_can_0x404_PhaseCurrentMeasurment(o, output);
+	case 0x405: return print_can_0x405_MotorVoltage(o, output);
+	case 0x406: return print_can_0x406_MotorCurrent(o, output);
+	case 0x407: return print_can_0x407_BackEMF(o, output);
+	case 0x408: return print_can_0x408_Rail15v(o, output);
+	case 0x409: return print_can_0x409_Rail3v3_1v9(o, output);
+	case 0x40b: return print_can_0x40b_Motor_PhaseA_Temperature(o, output);
+	case 0x40c: return print_can_0x40c_Phase_B_dsp_temprature(o, output);
+	case 0x40e: return print_can_0x40e_Odometer_amphours(o, output);
+	case 0x501: return print_can_0x501_MotorDriveCommand(o, output);
+	case 0x502: return print_can_0x502_MotorPowerCommand(o, output);
+	case 0x8501930: return print_can_0x8501930_Odometer_Velocity(o, output);
+	case 0xcc0016e: return print_can_0xcc0016e_MagicCanNode1RHeartbeat(o, output);
+	default: break; 
+	}
+	return -1; 
+}
+
@@ -0,0 +1,2729 @@
+/* CAN message encoder/decoder: automatically generated - do not edit.
+
+This file was generated by dbcc: See <https://github.com/howerj/dbcc>
+
+Consider donating; see the repo for more information, this project 
+requires your support to continue.
+
+For those with paid support or to inquire about paid support
+please Email <mailto:hello.operator.co.uk@gmail.com>.
+
+*/
+
+#ifndef EX1_H
+#define EX1_H
+
+/* If the contents of this file have caused breaking changes for you, you could try using
+   an older version of the generator. You can specify this on the command line with
+   the -n option. */
+
+//DBC Version: `Version("HIPBNYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYYY/4/%%%/4/'%**4YYY///")`
+
+#define DBCC_GENERATOR_VERSION (3)
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" { 
+#endif
+
+#ifndef PREPACK
+#define PREPACK
+#endif
+
+#ifndef POSTPACK
+#define POSTPACK
+#endif
+
+#ifndef DBCC_DOUBLE_TYPE
+#define DBCC_DOUBLE_TYPE
+typedef double dbcc_double_t;
+#endif
+
+#ifndef DBCC_FLOAT_TYPE
+#define DBCC_FLOAT_TYPE
+typedef float dbcc_float_t;
+#endif
+
+#ifndef DBCC_TIME_STAMP
+#define DBCC_TIME_STAMP
+typedef uint32_t dbcc_time_stamp_t; /* Time stamp for message; you decide on units */
+#endif
+
+#ifndef DBCC_STATUS_ENUM
+#define DBCC_STATUS_ENUM
+typedef enum {
+	DBCC_SIG_STAT_UNINITIALIZED_E = 0, /* Message never sent/received */
+	DBCC_SIG_STAT_OK_E            = 1, /* Message ok */
+	DBCC_SIG_STAT_ERROR_E         = 2, /* Encode/Decode/Timestamp/Any error */
+} dbcc_signal_status_e;
+#endif
+
+#define CAN_ID_MAGICCANNODE1RBOOTLOADERADDRESS (32) /* 0x20 */
+#define CAN_ID_MAGICCANNODE2MBOOTLOADERADDRESS (34) /* 0x22 */
+#define CAN_ID_MAGICCANNODE2HEARTBEAT (35) /* 0x23 */
+#define CAN_ID_MAGICCANNODE3FBOOTLOADERADDRESS (36) /* 0x24 */
+#define CAN_ID_MAGICCANNODE3HEARTBEAT (37) /* 0x25 */
+#define CAN_ID_FRAMEFAULTBOOTLOADERADDRES (38) /* 0x26 */
+#define CAN_ID_FRAMEFAULTHEARTBEAT (39) /* 0x27 */
+#define CAN_ID_FRAMEFAULTCOMMAND (40) /* 0x28 */
+#define CAN_ID_DRIVECONTROLSBOOTLOADER (44) /* 0x2c */
+#define CAN_ID_DRIVECONTROLSCOMMAND (45) /* 0x2d */
+#define CAN_ID_DRIVECONTROLSHEARTBEAT (46) /* 0x2e */
+#define CAN_ID_CANMIRRORBOOTLOADERADDRESS (48) /* 0x30 */
+#define CAN_ID_CANMIRRORHEATBEART (49) /* 0x31 */
+#define CAN_ID_CANMIRRORCOMMAND (50) /* 0x32 */
+#define CAN_ID_RIDERDISPLAYBOOTLOADERADDRESS (51) /* 0x33 */
+#define CAN_ID_RIDERDISPLAYHEARTBEAT (52) /* 0x34 */
+#define CAN_ID_RIDERDISPLAYCOMMAND (53) /* 0x35 */
+#define CAN_ID_BIM1BOOTLOADERADDRESS (57) /* 0x39 */
+#define CAN_ID_BIM1HEARTBEAT (58) /* 0x3a */
+#define CAN_ID_BIM2BOOTLOADERADDRESS (59) /* 0x3b */
+#define CAN_ID_BIM2HEARTBEAT (60) /* 0x3c */
+#define CAN_ID_BIM3BOOTLOADERADDRESS (61) /* 0x3d */
+#define CAN_ID_BIM3HEARTBEAT (62) /* 0x3e */
+#define CAN_ID_BIM4BOOTLOADERADDRESS (63) /* 0x3f */
+#define CAN_ID_BIM4HEARTBEAT (64) /* 0x40 */
+#define CAN_ID_MAGICCANNODE1RCOMMAND (160) /* 0xa0 */
+#define CAN_ID_MAGICCANNODE2MCOMMAND (161) /* 0xa1 */
+#define CAN_ID_MAGICCANNODE3FCOMMAND (162) /* 0xa2 */
+#define CAN_ID_CANCORDERHEARTBEAT (170) /* 0xaa */
+#define CAN_ID_BIM1COMMAND (176) /* 0xb0 */
+#define CAN_ID_BIM2COMMAND (177) /* 0xb1 */
+#define CAN_ID_BIM3COMMAND (178) /* 0xb2 */
+#define CAN_ID_BIM4COMMAND (179) /* 0xb3 */
+#define CAN_ID_FRAMEFAULTDETECTIONSTATUS (256) /* 0x100 */
+#define CAN_ID_FRONTBRAKEPRESSURE (257) /* 0x101 */
+#define CAN_ID_REARBRAKEPRESSURE (258) /* 0x102 */
+#define CAN_ID_FRONTSUSPENSIONTRAVEL (259) /* 0x103 */
+#define CAN_ID_REARSUSPENSIONTRAVEL (260) /* 0x104 */
+#define CAN_ID_BUSVOLTAGE12V (262) /* 0x106 */
+#define CAN_ID_POSTMOTORCOOLANTTEMP (263) /* 0x107 */
+#define CAN_ID_POSTCONTROLLERCOOLANTTEMP (264) /* 0x108 */
+#define CAN_ID_RADIATORCOOLSIDECOOLANTTEMP (265) /* 0x109 */
+#define CAN_ID_AMBIENTTEMP (266) /* 0x10a */
+#define CAN_ID_GPSLATANDVALIDITYSTATUS (267) /* 0x10b */
+#define CAN_ID_GPSLONGITUDE (268) /* 0x10c */
+#define CAN_ID_GPSALTITUDEANDACCURACY (269) /* 0x10d */
+#define CAN_ID_CURRENTTIME (270) /* 0x10e */
+#define CAN_ID_IMUACCELERATIONMEASUREMENT (271) /* 0x10f */
+#define CAN_ID_IMUGYROMEASUREMENT (272) /* 0x110 */
+#define CAN_ID_MOTORPLATETEMP (273) /* 0x111 */
+#define CAN_ID_MOTORSCOOP (274) /* 0x112 */
+#define CAN_ID_IMU1 (275) /* 0x113 */
+#define CAN_ID_IMU2 (276) /* 0x114 */
+#define CAN_ID_IMU3 (277) /* 0x115 */
+#define CAN_ID_IMU4 (278) /* 0x116 */
+#define CAN_ID_IMU5 (666) /* 0x29a */
+#define CAN_ID_MESSAGE_NAME (667) /* 0x29b */
+#define CAN_ID_MESSAGE_NAME2 (668) /* 0x29c */
+#define CAN_ID_BIM1CELLSTATISTICS1 (768) /* 0x300 */
+#define CAN_ID_BIM1CELLSTATISTICS2 (769) /* 0x301 */
+#define CAN_ID_BIM2CELLSTATISITCS1 (770) /* 0x302 */
+#define CAN_ID_BIM2CELLSTATISTICS2 (771) /* 0x303 */
+#define CAN_ID_BIM3CELLSTATISITCS1 (772) /* 0x304 */
+#define CAN_ID_BIM3CELLSTATISTICS2 (773) /* 0x305 */
+#define CAN_ID_BIM4CELLSTATISTICS1 (774) /* 0x306 */
+#define CAN_ID_BIM4CELLSTATISTICS2 (775) /* 0x307 */
+#define CAN_ID_CELLS_1_4 (784) /* 0x310 */
+#define CAN_ID_CELLS_5_8 (785) /* 0x311 */
+#define CAN_ID_CELLS_9_12 (786) /* 0x312 */
+#define CAN_ID_CELLS_13_16 (787) /* 0x313 */
+#define CAN_ID_CELLS_17_20 (788) /* 0x314 */
+#define CAN_ID_CELLS_21_24 (789) /* 0x315 */
+#define CAN_ID_CELLS_25_28 (790) /* 0x316 */
+#define CAN_ID_CELLS_29_32 (791) /* 0x317 */
+#define CAN_ID_CELLS_33_36 (792) /* 0x318 */
+#define CAN_ID_CELLS_37_40 (793) /* 0x319 */
+#define CAN_ID_CELLS_41_44 (794) /* 0x31a */
+#define CAN_ID_CELLS_45_48 (795) /* 0x31b */
+#define CAN_ID_CELLS_49_52 (796) /* 0x31c */
+#define CAN_ID_CELLS_53_54 (797) /* 0x31d */
+#define CAN_ID_CELLS_55_58 (798) /* 0x31e */
+#define CAN_ID_CELLS_59_62 (799) /* 0x31f */
+#define CAN_ID_CELLS_63_66 (800) /* 0x320 */
+#define CAN_ID_CELLS_67_70 (801) /* 0x321 */
+#define CAN_ID_CELLS_71_74 (802) /* 0x322 */
+#define CAN_ID_CELLS_75_78 (803) /* 0x323 */
+#define CAN_ID_CELLS_79_82 (804) /* 0x324 */
+#define CAN_ID_CELLS_83_86 (805) /* 0x325 */
+#define CAN_ID_CELLS_87_90 (806) /* 0x326 */
+#define CAN_ID_CELLS_91_94 (807) /* 0x327 */
+#define CAN_ID_CELLS_95_98 (808) /* 0x328 */
+#define CAN_ID_CELLS_99_102 (809) /* 0x329 */
+#define CAN_ID_CELLS_103_106 (810) /* 0x32a */
+#define CAN_ID_CELLS_107_110 (811) /* 0x32b */
+#define CAN_ID_PACKTEMPERATURES1THRU4 (821) /* 0x335 */
+#define CAN_ID_PACKTEMPEARTURES5THRU8 (822) /* 0x336 */
+#define CAN_ID_PACKTEMPERATURES9THRU14 (823) /* 0x337 */
+#define CAN_ID_PACKTEMPERATURES13THRU14 (824) /* 0x338 */
+#define CAN_ID_PACKTEMPERATURES15THRU18 (825) /* 0x339 */
+#define CAN_ID_PACKTEMPERATURES19THRU22 (826) /* 0x33a */
+#define CAN_ID_PACKTEMPERATURES23THRU26 (827) /* 0x33b */
+#define CAN_ID_PACKTEMPERATURES27THRU30 (828) /* 0x33c */
+#define CAN_ID_PACKTEMPERATURES31THRU34 (829) /* 0x33d */
+#define CAN_ID_PACKTEMPERATURES35THRU38 (830) /* 0x33e */
+#define CAN_ID_PACKTEMPERATURES39THRU42 (831) /* 0x33f */
+#define CAN_ID_STATUSINFORMATION (1025) /* 0x401 */
+#define CAN_ID_BUSMEASUREMENT (1026) /* 0x402 */
+#define CAN_ID_VELOCITYMEASURMENT (1027) /* 0x403 */
+#define CAN_ID_PHASECURRENTMEASURMENT (1028) /* 0x404 */
+#define CAN_ID_MOTORVOLTAGE (1029) /* 0x405 */
+#define CAN_ID_MOTORCURRENT (1030) /* 0x406 */
+#define CAN_ID_BACKEMF (1031) /* 0x407 */
+#define CAN_ID_RAIL15V (1032) /* 0x408 */
+#define CAN_ID_RAIL3V3_1V9 (1033) /* 0x409 */
+#define CAN_ID_MOTOR_PHASEA_TEMPERATURE (1035) /* 0x40b */
+#define CAN_ID_PHASE_B_DSP_TEMPRATURE (1036) /* 0x40c */
+#define CAN_ID_ODOMETER_AMPHOURS (1038) /* 0x40e */
+#define CAN_ID_MOTORDRIVECOMMAND (1281) /* 0x501 */
+#define CAN_ID_MOTORPOWERCOMMAND (1282) /* 0x502 */
+#define CAN_ID_ODOMETER_VELOCITY (139467056) /* 0x8501930 */
+#define CAN_ID_MAGICCANNODE1RHEARTBEAT (213909870) /* 0xcc0016e */
+
+typedef PREPACK struct {
+	uint16_t MagicNode1R_BLAddy; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x020_MagicCanNode1RBootloaderAddress_t;
+
+typedef PREPACK struct {
+	uint16_t MagicNode2M_BLAddy; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x022_MagicCanNode2MBootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint16_t MagicNode2Flags; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x023_MagicCanNode2Heartbeat_t;
+
+typedef PREPACK struct {
+	uint16_t MagicNode3F_BLAddy; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x024_MagicCanNode3FBootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint16_t MagicNode3Flags; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x025_MagicCanNode3Heartbeat_t;
+
+typedef PREPACK struct {
+	uint16_t FrameFaultBootloaderAddress; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x026_FrameFaultBootloaderAddres_t;
+
+/* increments\"  */
+typedef PREPACK struct {
+	uint16_t FrameFaultFlags; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x027_FrameFaultHeartbeat_t;
+
+typedef PREPACK struct {
+	int32_t FrameFaultCommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t FrameFaultCommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x028_FrameFaultCommand_t;
+
+typedef PREPACK struct {
+	uint16_t DriveControlsBootloader; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x02c_DriveControlsBootloader_t;
+
+typedef PREPACK struct {
+	int32_t DriveControlCommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t DriveControlCommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x02d_DriveControlsCommand_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint8_t DriveControlTritiumError; /* scaling 1.0, offset 0.0, units none */
+	uint8_t DriveControlMaxError; /* scaling 1.0, offset 0.0, units none */
+	uint8_t DriveControlMinError; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x02e_DriveControlsHeartbeat_t;
+
+typedef PREPACK struct {
+	uint16_t CANMirrorBootloaderAddress; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x030_CANMirrorBootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint8_t CANMirrorOverflowCounter; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Timeout; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Mirror_can_error; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Mirror_CANa_Status; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x031_CANMirrorHeatbeart_t;
+
+typedef PREPACK struct {
+	int32_t CANMirrorCommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t CANMirrorCommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x032_CANMirrorCommand_t;
+
+typedef PREPACK struct {
+	uint16_t RiderDisplayBootloaderAddress; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x033_RiderDisplayBootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint16_t RiderDisplayFlags; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x034_RiderDisplayHeartbeat_t;
+
+typedef PREPACK struct {
+	int32_t RiderDisplayCommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t RiderDisplayCommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x035_RiderDisplayCommand_t;
+
+typedef PREPACK struct {
+	uint16_t BIM1BootloaderAddress; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x039_BIM1BootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint8_t BIM1BQ; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM1Init; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM1SPI; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x03a_BIM1Heartbeat_t;
+
+typedef PREPACK struct {
+	uint16_t BIM2BootloaderAddres; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x03b_BIM2BootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint8_t BIM2BQ; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM2Init; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM2SPI; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x03c_BIM2Heartbeat_t;
+
+typedef PREPACK struct {
+	uint16_t BIM3BootloaderAddress; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x03d_BIM3BootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint8_t BIM3BQ; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM3Init; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM3SPI; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x03e_BIM3Heartbeat_t;
+
+typedef PREPACK struct {
+	uint16_t BIM4BootloaderAddres; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x03f_BIM4BootloaderAddress_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint8_t BIM4BQ; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM4Init; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM4SPI; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x040_BIM4Heartbeat_t;
+
+typedef PREPACK struct {
+	int32_t MagicCanNode1CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t MagicCanNode1CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0a0_MagicCanNode1RCommand_t;
+
+typedef PREPACK struct {
+	int32_t MagicCanNode2CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t MagicCanNode2CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0a1_MagicCanNode2MCommand_t;
+
+typedef PREPACK struct {
+	uint32_t MagicCanNode3CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t MagicCanNode3CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0a2_MagicCanNode3FCommand_t;
+
+typedef PREPACK struct {
+	uint16_t CANcorderHeartbeat; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0aa_CANcorderHeartbeat_t;
+
+typedef PREPACK struct {
+	int32_t BIM1CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t BIM1CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0b0_BIM1Command_t;
+
+typedef PREPACK struct {
+	int32_t BIM2CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t BIM2CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0b1_BIM2Command_t;
+
+typedef PREPACK struct {
+	int32_t BIM3CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t BIM3CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0b2_BIM3Command_t;
+
+typedef PREPACK struct {
+	int32_t BIM4CommandValue; /* scaling 1.0, offset 0.0, units none */
+	uint32_t BIM4CommandCode; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x0b3_BIM4Command_t;
+
+typedef PREPACK struct {
+	dbcc_float_t EstimatedPackFrameResistance; /* scaling 1.0, offset 0.0, units (ohms), floating */
+	uint16_t FaultStatus; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x100_FrameFaultDetectionStatus_t;
+
+typedef PREPACK struct {
+	dbcc_float_t FrontBrakePressure; /* scaling 1.0, offset 0.0, units (psi), floating */
+} POSTPACK can_0x101_FrontBrakePressure_t;
+
+typedef PREPACK struct {
+	dbcc_float_t RearBrakePressure; /* scaling 1.0, offset 0.0, units (psi), floating */
+} POSTPACK can_0x102_RearBrakePressure_t;
+
+typedef PREPACK struct {
+	dbcc_float_t FrontSuspensionPosition; /* scaling 1.0, offset 0.0, units (%), floating */
+} POSTPACK can_0x103_FrontSuspensionTravel_t;
+
+typedef PREPACK struct {
+	dbcc_float_t RearSuspensionPosition; /* scaling 1.0, offset 0.0, units (%), floating */
+} POSTPACK can_0x104_RearSuspensionTravel_t;
+
+typedef PREPACK struct {
+	dbcc_float_t BusVoltage12V; /* scaling 1.0, offset 0.0, units (v), floating */
+} POSTPACK can_0x106_BusVoltage12V_t;
+
+typedef PREPACK struct {
+	dbcc_float_t PostMotorCoolantTemp; /* scaling 1.0, offset 0.0, units (°C), floating */
+} POSTPACK can_0x107_PostMotorCoolantTemp_t;
+
+typedef PREPACK struct {
+	dbcc_float_t PostControllerCoolantTemp; /* scaling 1.0, offset 0.0, units (°C), floating */
+} POSTPACK can_0x108_PostControllerCoolantTemp_t;
+
+typedef PREPACK struct {
+	dbcc_float_t RadiatorCoolSideCoolantTemp; /* scaling 1.0, offset 0.0, units (°C), floating */
+} POSTPACK can_0x109_RadiatorCoolSideCoolantTemp_t;
+
+typedef PREPACK struct {
+	dbcc_float_t AmbientTemp; /* scaling 1.0, offset 0.0, units (°C), floating */
+} POSTPACK can_0x10a_AmbientTemp_t;
+
+typedef PREPACK struct {
+	dbcc_float_t GPSLatitude; /* scaling 1.0, offset 0.0, units (DDD), floating */
+	uint8_t GPSValidityStatus; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x10b_GPSLatAndValidityStatus_t;
+
+typedef PREPACK struct {
+	dbcc_float_t GPSLongitude; /* scaling 1.0, offset 0.0, units none, floating */
+} POSTPACK can_0x10c_GPSLongitude_t;
+
+typedef PREPACK struct {
+	dbcc_float_t GPSAltitude; /* scaling 1.0, offset 0.0, units (meters), floating */
+	dbcc_float_t PositionDOP; /* scaling 1.0, offset 0.0, units none, floating */
+} POSTPACK can_0x10d_GPSAltitudeAndAccuracy_t;
+
+typedef PREPACK struct {
+	uint16_t Years; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Month; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Day; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Hours; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Minutes; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Seconds; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x10e_CurrentTime_t;
+
+typedef PREPACK struct {
+	int16_t XAxisAcceleration; /* scaling 1.0, offset 0.0, units (?) */
+	int16_t YAxisAcceleration; /* scaling 1.0, offset 0.0, units (?) */
+	int16_t ZAxisAcceleration; /* scaling 1.0, offset 0.0, units (?) */
+} POSTPACK can_0x10f_IMUAccelerationMeasurement_t;
+
+typedef PREPACK struct {
+	int16_t XAxisRoll; /* scaling 1.0, offset 0.0, units (?) */
+	int16_t YAxisRoll; /* scaling 1.0, offset 0.0, units (?) */
+	int16_t ZAxisRoll; /* scaling 1.0, offset 0.0, units (?) */
+} POSTPACK can_0x110_IMUGyroMeasurement_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorPlateTemp1; /* scaling 1.0, offset 0.0, units (ºC), floating */
+	dbcc_float_t MotorPlateTemp2; /* scaling 1.0, offset 0.0, units (ºC), floating */
+} POSTPACK can_0x111_MotorPlateTemp_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorScoop; /* scaling 1.0, offset 0.0, units (kpa), floating */
+} POSTPACK can_0x112_MotorScoop_t;
+
+typedef PREPACK struct {
+	int32_t IMUAccelX; /* scaling 1.0, offset 0.0, units (unit) */
+	int32_t IMUAceelY; /* scaling 1.0, offset 0.0, units (unit) */
+} POSTPACK can_0x113_IMU1_t;
+
+typedef PREPACK struct {
+	int32_t IMUAccelZ; /* scaling 1.0, offset 0.0, units (unit) */
+	dbcc_float_t GravityX; /* scaling 1.0, offset 0.0, units (%), floating */
+} POSTPACK can_0x114_IMU2_t;
+
+typedef PREPACK struct {
+	dbcc_float_t GravityY; /* scaling 1.0, offset 0.0, units (%), floating */
+	dbcc_float_t GravityZ; /* scaling 1.0, offset 0.0, units (%), floating */
+} POSTPACK can_0x115_IMU3_t;
+
+typedef PREPACK struct {
+	dbcc_float_t Yaw; /* scaling 1.0, offset 0.0, units (Rad), floating */
+	dbcc_float_t Pitch; /* scaling 1.0, offset 0.0, units (Rad), floating */
+} POSTPACK can_0x116_IMU4_t;
+
+typedef PREPACK struct {
+	int8_t normal; /* scaling 1.0, offset 0.0, units normal */
+	uint8_t multiplexor; /* scaling 1.0, offset 0.0, units multiplexor */
+	uint8_t multi1; /* scaling 1.0, offset 0.0, units multiplexed-a */
+	uint8_t multi3; /* scaling 1.0, offset 0.0, units multiplexed-c */
+	uint8_t multi4; /* scaling 1.0, offset 0.0, units multiplexed-d */
+	uint8_t multi2a; /* scaling 1.0, offset 0.0, units multiplexed-b1 */
+	uint8_t multi2b; /* scaling 1.0, offset 0.0, units multiplexed-b2 */
+} POSTPACK can_0x29a_IMU5_t;
+
+typedef PREPACK struct {
+	uint8_t NonsenseSignal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x29b_MESSAGE_NAME_t;
+
+typedef PREPACK struct {
+} POSTPACK can_0x29c_MESSAGE_NAME2_t;
+
+typedef PREPACK struct {
+	uint16_t BIM1MaxCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM1MinCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM1MaxCellNumber; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM1MinCellNumber; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x300_BIM1CellStatistics1_t;
+
+typedef PREPACK struct {
+	uint16_t BIM1AvgCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM1StdevCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM1NumberBalancingCells; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x301_BIM1CellStatistics2_t;
+
+typedef PREPACK struct {
+	uint16_t BIM2MaxCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM2MinCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM2MaxCellNumber; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM2MinCellNumber; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x302_BIM2CellStatisitcs1_t;
+
+typedef PREPACK struct {
+	uint16_t BIM2AvgCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM2StdevCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM2NumberBalancingCells; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x303_BIM2CellStatistics2_t;
+
+typedef PREPACK struct {
+	uint16_t BIM3MaxCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM3MinCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM3MaxCellNumber; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM3MinCellNumber; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x304_BIM3CellStatisitcs1_t;
+
+typedef PREPACK struct {
+	uint16_t BIM3AvgCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM3StdevCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM3NumberBalancingCells; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x305_BIM3CellStatistics2_t;
+
+typedef PREPACK struct {
+	uint16_t BIM4MaxCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM4MinCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM4MaxCellNumber; /* scaling 1.0, offset 0.0, units none */
+	uint8_t BIM4MinCellNumber; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x306_BIM4CellStatistics1_t;
+
+typedef PREPACK struct {
+	uint16_t BIM4AvgCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint16_t BIM4StdevCellVoltage; /* scaling 1.0, offset 0.0, units (mV) */
+	uint8_t BIM4NumberBalancingCells; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x307_BIM4CellStatistics2_t;
+
+typedef PREPACK struct {
+	int16_t Cell1; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell2; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell3; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell4; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell1_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell2_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell3_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell4_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x310_Cells_1_4_t;
+
+typedef PREPACK struct {
+	int16_t Cell5; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell6; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell7; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell8; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell5_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell6_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell7_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell8_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x311_Cells_5_8_t;
+
+typedef PREPACK struct {
+	int16_t Cell9; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell10; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell11; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell12; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell9_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell10_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell11_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell12_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x312_Cells_9_12_t;
+
+typedef PREPACK struct {
+	int16_t Cell13; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell14; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell15; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell16; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell13_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell14_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell15_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell16_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x313_Cells_13_16_t;
+
+typedef PREPACK struct {
+	int16_t Cell17; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell18; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell19; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell20; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell17_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell18_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell19_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell20_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x314_Cells_17_20_t;
+
+typedef PREPACK struct {
+	int16_t Cell21; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell22; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell23; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell24; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell21_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell22_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell23_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell24_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x315_Cells_21_24_t;
+
+typedef PREPACK struct {
+	int16_t Cell25; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell26; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell27; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell28; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell25_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell26_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell27_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell28_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x316_Cells_25_28_t;
+
+typedef PREPACK struct {
+	int16_t Cell29; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell30; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell31; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell32; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell29_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell30_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell31_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell32_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x317_Cells_29_32_t;
+
+typedef PREPACK struct {
+	int16_t Cell33; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell34; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell35; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell36; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell33_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell34_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell35_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell36_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x318_Cells_33_36_t;
+
+typedef PREPACK struct {
+	int16_t Cell37; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell38; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell39; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell40; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell37_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell38_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell39_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell40_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x319_Cells_37_40_t;
+
+typedef PREPACK struct {
+	int16_t Cell41; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell42; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell43; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell44; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell41_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell42_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell43_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell44_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x31a_Cells_41_44_t;
+
+typedef PREPACK struct {
+	int16_t Cell45; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell46; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell47; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell48; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell45_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell46_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell47_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell48_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x31b_Cells_45_48_t;
+
+typedef PREPACK struct {
+	int16_t Cell49; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell50; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell51; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell52; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell49_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell50_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell51_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell52_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x31c_Cells_49_52_t;
+
+typedef PREPACK struct {
+	int16_t Cell53; /* scaling 1.0, offset 0.0, units none */
+	int16_t Cell54; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell53_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell54_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x31d_Cells_53_54_t;
+
+typedef PREPACK struct {
+	int16_t Cell55; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell56; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell57; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell58; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell55_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell56_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell57_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell58_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x31e_Cells_55_58_t;
+
+typedef PREPACK struct {
+	int16_t Cell59; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell60; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell61; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell62; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell59_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell60_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell61_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell62_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x31f_Cells_59_62_t;
+
+typedef PREPACK struct {
+	int16_t Cell63; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell64; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell65; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell66; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell63_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell64_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell65_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell66_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x320_Cells_63_66_t;
+
+typedef PREPACK struct {
+	int16_t Cell67; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell68; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell69; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell70; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell67_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell68_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell69_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell70_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x321_Cells_67_70_t;
+
+typedef PREPACK struct {
+	int16_t Cell71; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell72; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell73; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell74; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell71_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell72_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell73_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell74_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x322_Cells_71_74_t;
+
+typedef PREPACK struct {
+	int16_t Cell75; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell76; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell77; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell78; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell75_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell76_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell77_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell78_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x323_Cells_75_78_t;
+
+typedef PREPACK struct {
+	int16_t Cell79; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell80; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell81; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell82; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell79_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell80_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell81_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell82_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x324_Cells_79_82_t;
+
+typedef PREPACK struct {
+	int16_t Cell83; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell84; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell85; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell86; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell83_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell84_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell85_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell86_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x325_Cells_83_86_t;
+
+typedef PREPACK struct {
+	int16_t Cell87; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell88; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell89; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell90; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell87_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell88_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell89_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell90_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x326_Cells_87_90_t;
+
+typedef PREPACK struct {
+	int16_t Cell91; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell92; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell93; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell94; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell91_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell92_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell93_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell94_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x327_Cells_91_94_t;
+
+typedef PREPACK struct {
+	int16_t Cell95; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell96; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell97; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell98; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell95_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell96_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell97_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell98_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x328_Cells_95_98_t;
+
+typedef PREPACK struct {
+	int16_t Cell99; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell100; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell101; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell102; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell99_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell100_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell101_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell102_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x329_Cells_99_102_t;
+
+typedef PREPACK struct {
+	int16_t Cell103; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell104; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell105; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell106; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell103_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell104_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell105_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell106_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x32a_Cells_103_106_t;
+
+typedef PREPACK struct {
+	int16_t Cell107; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell108; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell109; /* scaling 1.0, offset 0.0, units mV */
+	int16_t Cell110; /* scaling 1.0, offset 0.0, units mV */
+	uint8_t Cell107_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell108_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell109_bal; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Cell110_bal; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x32b_Cells_107_110_t;
+
+typedef PREPACK struct {
+	int16_t Temp1; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp2; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp3; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp4; /* scaling 1.0, offset 0.0, units (c°C) */
+} POSTPACK can_0x335_PackTemperatures1Thru4_t;
+
+typedef PREPACK struct {
+	int16_t Temp5; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp6; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp7; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp8; /* scaling 1.0, offset 0.0, units (c°C) */
+} POSTPACK can_0x336_PackTempeartures5Thru8_t;
+
+typedef PREPACK struct {
+	int16_t Temp9; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp10; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp11; /* scaling 1.0, offset 0.0, units (c°C) */
+	int16_t Temp12; /* scaling 1.0, offset 0.0, units (c°C) */
+} POSTPACK can_0x337_PackTemperatures9Thru14_t;
+
+typedef PREPACK struct {
+	int16_t Temp13; /* scaling 1.0, offset 0.0, units (cºC) */
+	int16_t Temp14; /* scaling 1.0, offset 0.0, units (cºC) */
+} POSTPACK can_0x338_PackTemperatures13Thru14_t;
+
+typedef PREPACK struct {
+	int16_t Temp15; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp16; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp17; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo18; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x339_PackTemperatures15Thru18_t;
+
+typedef PREPACK struct {
+	int16_t Temp19; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp20; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp21; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo22; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x33a_PackTemperatures19Thru22_t;
+
+typedef PREPACK struct {
+	int16_t Temp23; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp24; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp25; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo26; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x33b_PackTemperatures23Thru26_t;
+
+typedef PREPACK struct {
+	int16_t Temp27; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp28; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp29; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo30; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x33c_PackTemperatures27Thru30_t;
+
+typedef PREPACK struct {
+	int16_t Temp31; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp32; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp33; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo34; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x33d_PackTemperatures31Thru34_t;
+
+typedef PREPACK struct {
+	int16_t Temp35; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp36; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp37; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo38; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x33e_PackTemperatures35Thru38_t;
+
+typedef PREPACK struct {
+	int16_t Temp39; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp40; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temp41; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+	int16_t Temo42; /* scaling 1.0, offset 0.0, units (cÂ°C) */
+} POSTPACK can_0x33f_PackTemperatures39Thru42_t;
+
+/* increments */
+typedef PREPACK struct {
+	uint16_t Reserved_Limit; /* scaling 1.0, offset 0.0, units none */
+	uint8_t Reserved_Error; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_outputvolt_pwm; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_motor_current; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_velocity; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_bus_current; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_bus_volt_upper; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_bus_volt_lower; /* scaling 1.0, offset 0.0, units none */
+	uint8_t limit_temp; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_hardware_over_current; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_software_over_current; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_DC_over_volt; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_bad_position; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_watchdog; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_configread; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_15v_under_volt; /* scaling 1.0, offset 0.0, units none */
+	uint8_t error_desaturation; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x401_StatusInformation_t;
+
+typedef PREPACK struct {
+	dbcc_float_t BusVoltage; /* scaling 1.0, offset 0.0, units (V), floating */
+	dbcc_float_t BusCurrent; /* scaling 1.0, offset 0.0, units (A), floating */
+} POSTPACK can_0x402_BusMeasurement_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorVelocity; /* scaling 1.0, offset 0.0, units (rpm), floating */
+	dbcc_float_t VehicleVelocity; /* scaling 1.0, offset 0.0, units (m/s), floating */
+} POSTPACK can_0x403_VelocityMeasurment_t;
+
+typedef PREPACK struct {
+	dbcc_float_t PhaseBcurrent; /* scaling 1.0, offset 0.0, units (A), floating */
+	dbcc_float_t PhaseCcurrent; /* scaling 1.0, offset 0.0, units (A), floating */
+} POSTPACK can_0x404_PhaseCurrentMeasurment_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorVq; /* scaling 1.0, offset 0.0, units (VImaginary), floating */
+	dbcc_float_t MotorVd; /* scaling 1.0, offset 0.0, units (V), floating */
+} POSTPACK can_0x405_MotorVoltage_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorIq; /* scaling 1.0, offset 0.0, units (AImaginary), floating */
+	dbcc_float_t MotorId; /* scaling 1.0, offset 0.0, units (A), floating */
+} POSTPACK can_0x406_MotorCurrent_t;
+
+typedef PREPACK struct {
+	dbcc_float_t BEMFq; /* scaling 1.0, offset 0.0, units none, floating */
+	dbcc_float_t BEMFd; /* scaling 1.0, offset 0.0, units none, floating */
+} POSTPACK can_0x407_BackEMF_t;
+
+typedef PREPACK struct {
+	dbcc_float_t supply15v; /* scaling 1.0, offset 0.0, units none, floating */
+} POSTPACK can_0x408_Rail15v_t;
+
+typedef PREPACK struct {
+	dbcc_float_t supply1v9; /* scaling 1.0, offset 0.0, units none, floating */
+	dbcc_float_t supply3v3; /* scaling 1.0, offset 0.0, units none, floating */
+} POSTPACK can_0x409_Rail3v3_1v9_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorTemp; /* scaling 1.0, offset 0.0, units (C), floating */
+	dbcc_float_t PhaseAtemp; /* scaling 1.0, offset 0.0, units (C), floating */
+} POSTPACK can_0x40b_Motor_PhaseA_Temperature_t;
+
+typedef PREPACK struct {
+	dbcc_float_t DSP_temp; /* scaling 1.0, offset 0.0, units none, floating */
+	dbcc_float_t PhaseB_Temp; /* scaling 1.0, offset 0.0, units none, floating */
+} POSTPACK can_0x40c_Phase_B_dsp_temprature_t;
+
+typedef PREPACK struct {
+	dbcc_float_t Odometer; /* scaling 1.0, offset 0.0, units (m), floating */
+	dbcc_float_t BusAmphours; /* scaling 1.0, offset 0.0, units (Ah), floating */
+} POSTPACK can_0x40e_Odometer_amphours_t;
+
+typedef PREPACK struct {
+	dbcc_float_t MotorVelocityCommand; /* scaling 1.0, offset 0.0, units (rpm), floating */
+	dbcc_float_t MotorCurrentCommand; /* scaling 1.0, offset 0.0, units %, floating */
+} POSTPACK can_0x501_MotorDriveCommand_t;
+
+typedef PREPACK struct {
+	dbcc_float_t BusCurrentCommand; /* scaling 1.0, offset 0.0, units (%), floating */
+} POSTPACK can_0x502_MotorPowerCommand_t;
+
+typedef PREPACK struct {
+	int32_t Odometer_Velocity; /* scaling 1.0, offset 0.0, units m/s */
+} POSTPACK can_0x8501930_Odometer_Velocity_t;
+
+typedef PREPACK struct {
+	uint16_t MagicNode1Flags; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0xcc0016e_MagicCanNode1RHeartbeat_t;
+
+typedef PREPACK struct {
+	dbcc_time_stamp_t can_0x020_MagicCanNode1RBootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x022_MagicCanNode2MBootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x023_MagicCanNode2Heartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x024_MagicCanNode3FBootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x025_MagicCanNode3Heartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x026_FrameFaultBootloaderAddres_time_stamp_rx;
+	dbcc_time_stamp_t can_0x027_FrameFaultHeartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x028_FrameFaultCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x02c_DriveControlsBootloader_time_stamp_rx;
+	dbcc_time_stamp_t can_0x02d_DriveControlsCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x02e_DriveControlsHeartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x030_CANMirrorBootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x031_CANMirrorHeatbeart_time_stamp_rx;
+	dbcc_time_stamp_t can_0x032_CANMirrorCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x033_RiderDisplayBootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x034_RiderDisplayHeartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x035_RiderDisplayCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x039_BIM1BootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x03a_BIM1Heartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x03b_BIM2BootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x03c_BIM2Heartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x03d_BIM3BootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x03e_BIM3Heartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x03f_BIM4BootloaderAddress_time_stamp_rx;
+	dbcc_time_stamp_t can_0x040_BIM4Heartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0a0_MagicCanNode1RCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0a1_MagicCanNode2MCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0a2_MagicCanNode3FCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0aa_CANcorderHeartbeat_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0b0_BIM1Command_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0b1_BIM2Command_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0b2_BIM3Command_time_stamp_rx;
+	dbcc_time_stamp_t can_0x0b3_BIM4Command_time_stamp_rx;
+	dbcc_time_stamp_t can_0x100_FrameFaultDetectionStatus_time_stamp_rx;
+	dbcc_time_stamp_t can_0x101_FrontBrakePressure_time_stamp_rx;
+	dbcc_time_stamp_t can_0x102_RearBrakePressure_time_stamp_rx;
+	dbcc_time_stamp_t can_0x103_FrontSuspensionTravel_time_stamp_rx;
+	dbcc_time_stamp_t can_0x104_RearSuspensionTravel_time_stamp_rx;
+	dbcc_time_stamp_t can_0x106_BusVoltage12V_time_stamp_rx;
+	dbcc_time_stamp_t can_0x107_PostMotorCoolantTemp_time_stamp_rx;
+	dbcc_time_stamp_t can_0x108_PostControllerCoolantTemp_time_stamp_rx;
+	dbcc_time_stamp_t can_0x109_RadiatorCoolSideCoolantTemp_time_stamp_rx;
+	dbcc_time_stamp_t can_0x10a_AmbientTemp_time_stamp_rx;
+	dbcc_time_stamp_t can_0x10b_GPSLatAndValidityStatus_time_stamp_rx;
+	dbcc_time_stamp_t can_0x10c_GPSLongitude_time_stamp_rx;
+	dbcc_time_stamp_t can_0x10d_GPSAltitudeAndAccuracy_time_stamp_rx;
+	dbcc_time_stamp_t can_0x10e_CurrentTime_time_stamp_rx;
+	dbcc_time_stamp_t can_0x10f_IMUAccelerationMeasurement_time_stamp_rx;
+	dbcc_time_stamp_t can_0x110_IMUGyroMeasurement_time_stamp_rx;
+	dbcc_time_stamp_t can_0x111_MotorPlateTemp_time_stamp_rx;
+	dbcc_time_stamp_t can_0x112_MotorScoop_time_stamp_rx;
+	dbcc_time_stamp_t can_0x113_IMU1_time_stamp_rx;
+	dbcc_time_stamp_t can_0x114_IMU2_time_stamp_rx;
+	dbcc_time_stamp_t can_0x115_IMU3_time_stamp_rx;
+	dbcc_time_stamp_t can_0x116_IMU4_time_stamp_rx;
+	dbcc_time_stamp_t can_0x29a_IMU5_time_stamp_rx;
+	dbcc_time_stamp_t can_0x29b_MESSAGE_NAME_time_stamp_rx;
+	dbcc_time_stamp_t can_0x29c_MESSAGE_NAME2_time_stamp_rx;
+	dbcc_time_stamp_t can_0x300_BIM1CellStatistics1_time_stamp_rx;
+	dbcc_time_stamp_t can_0x301_BIM1CellStatistics2_time_stamp_rx;
+	dbcc_time_stamp_t can_0x302_BIM2CellStatisitcs1_time_stamp_rx;
+	dbcc_time_stamp_t can_0x303_BIM2CellStatistics2_time_stamp_rx;
+	dbcc_time_stamp_t can_0x304_BIM3CellStatisitcs1_time_stamp_rx;
+	dbcc_time_stamp_t can_0x305_BIM3CellStatistics2_time_stamp_rx;
+	dbcc_time_stamp_t can_0x306_BIM4CellStatistics1_time_stamp_rx;
+	dbcc_time_stamp_t can_0x307_BIM4CellStatistics2_time_stamp_rx;
+	dbcc_time_stamp_t can_0x310_Cells_1_4_time_stamp_rx;
+	dbcc_time_stamp_t can_0x311_Cells_5_8_time_stamp_rx;
+	dbcc_time_stamp_t can_0x312_Cells_9_12_time_stamp_rx;
+	dbcc_time_stamp_t can_0x313_Cells_13_16_time_stamp_rx;
+	dbcc_time_stamp_t can_0x314_Cells_17_20_time_stamp_rx;
+	dbcc_time_stamp_t can_0x315_Cells_21_24_time_stamp_rx;
+	dbcc_time_stamp_t can_0x316_Cells_25_28_time_stamp_rx;
+	dbcc_time_stamp_t can_0x317_Cells_29_32_time_stamp_rx;
+	dbcc_time_stamp_t can_0x318_Cells_33_36_time_stamp_rx;
+	dbcc_time_stamp_t can_0x319_Cells_37_40_time_stamp_rx;
+	dbcc_time_stamp_t can_0x31a_Cells_41_44_time_stamp_rx;
+	dbcc_time_stamp_t can_0x31b_Cells_45_48_time_stamp_rx;
+	dbcc_time_stamp_t can_0x31c_Cells_49_52_time_stamp_rx;
+	dbcc_time_stamp_t can_0x31d_Cells_53_54_time_stamp_rx;
+	dbcc_time_stamp_t can_0x31e_Cells_55_58_time_stamp_rx;
+	dbcc_time_stamp_t can_0x31f_Cells_59_62_time_stamp_rx;
+	dbcc_time_stamp_t can_0x320_Cells_63_66_time_stamp_rx;
+	dbcc_time_stamp_t can_0x321_Cells_67_70_time_stamp_rx;
+	dbcc_time_stamp_t can_0x322_Cells_71_74_time_stamp_rx;
+	dbcc_time_stamp_t can_0x323_Cells_75_78_time_stamp_rx;
+	dbcc_time_stamp_t can_0x324_Cells_79_82_time_stamp_rx;
+	dbcc_time_stamp_t can_0x325_Cells_83_86_time_stamp_rx;
+	dbcc_time_stamp_t can_0x326_Cells_87_90_time_stamp_rx;
+	dbcc_time_stamp_t can_0x327_Cells_91_94_time_stamp_rx;
+	dbcc_time_stamp_t can_0x328_Cells_95_98_time_stamp_rx;
+	dbcc_time_stamp_t can_0x329_Cells_99_102_time_stamp_rx;
+	dbcc_time_stamp_t can_0x32a_Cells_103_106_time_stamp_rx;
+	dbcc_time_stamp_t can_0x32b_Cells_107_110_time_stamp_rx;
+	dbcc_time_stamp_t can_0x335_PackTemperatures1Thru4_time_stamp_rx;
+	dbcc_time_stamp_t can_0x336_PackTempeartures5Thru8_time_stamp_rx;
+	dbcc_time_stamp_t can_0x337_PackTemperatures9Thru14_time_stamp_rx;
+	dbcc_time_stamp_t can_0x338_PackTemperatures13Thru14_time_stamp_rx;
+	dbcc_time_stamp_t can_0x339_PackTemperatures15Thru18_time_stamp_rx;
+	dbcc_time_stamp_t can_0x33a_PackTemperatures19Thru22_time_stamp_rx;
+	dbcc_time_stamp_t can_0x33b_PackTemperatures23Thru26_time_stamp_rx;
+	dbcc_time_stamp_t can_0x33c_PackTemperatures27Thru30_time_stamp_rx;
+	dbcc_time_stamp_t can_0x33d_PackTemperatures31Thru34_time_stamp_rx;
+	dbcc_time_stamp_t can_0x33e_PackTemperatures35Thru38_time_stamp_rx;
+	dbcc_time_stamp_t can_0x33f_PackTemperatures39Thru42_time_stamp_rx;
+	dbcc_time_stamp_t can_0x401_StatusInformation_time_stamp_rx;
+	dbcc_time_stamp_t can_0x402_BusMeasurement_time_stamp_rx;
+	dbcc_time_stamp_t can_0x403_VelocityMeasurment_time_stamp_rx;
+	dbcc_time_stamp_t can_0x404_PhaseCurrentMeasurment_time_stamp_rx;
+	dbcc_time_stamp_t can_0x405_MotorVoltage_time_stamp_rx;
+	dbcc_time_stamp_t can_0x406_MotorCurrent_time_stamp_rx;
+	dbcc_time_stamp_t can_0x407_BackEMF_time_stamp_rx;
+	dbcc_time_stamp_t can_0x408_Rail15v_time_stamp_rx;
+	dbcc_time_stamp_t can_0x409_Rail3v3_1v9_time_stamp_rx;
+	dbcc_time_stamp_t can_0x40b_Motor_PhaseA_Temperature_time_stamp_rx;
+	dbcc_time_stamp_t can_0x40c_Phase_B_dsp_temprature_time_stamp_rx;
+	dbcc_time_stamp_t can_0x40e_Odometer_amphours_time_stamp_rx;
+	dbcc_time_stamp_t can_0x501_MotorDriveCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x502_MotorPowerCommand_time_stamp_rx;
+	dbcc_time_stamp_t can_0x8501930_Odometer_Velocity_time_stamp_rx;
+	dbcc_time_stamp_t can_0xcc0016e_MagicCanNode1RHeartbeat_time_stamp_rx;
+	unsigned can_0x020_MagicCanNode1RBootloaderAddress_status : 2;
+	unsigned can_0x020_MagicCanNode1RBootloaderAddress_tx : 1;
+	unsigned can_0x020_MagicCanNode1RBootloaderAddress_rx : 1;
+	unsigned can_0x022_MagicCanNode2MBootloaderAddress_status : 2;
+	unsigned can_0x022_MagicCanNode2MBootloaderAddress_tx : 1;
+	unsigned can_0x022_MagicCanNode2MBootloaderAddress_rx : 1;
+	unsigned can_0x023_MagicCanNode2Heartbeat_status : 2;
+	unsigned can_0x023_MagicCanNode2Heartbeat_tx : 1;
+	unsigned can_0x023_MagicCanNode2Heartbeat_rx : 1;
+	unsigned can_0x024_MagicCanNode3FBootloaderAddress_status : 2;
+	unsigned can_0x024_MagicCanNode3FBootloaderAddress_tx : 1;
+	unsigned can_0x024_MagicCanNode3FBootloaderAddress_rx : 1;
+	unsigned can_0x025_MagicCanNode3Heartbeat_status : 2;
+	unsigned can_0x025_MagicCanNode3Heartbeat_tx : 1;
+	unsigned can_0x025_MagicCanNode3Heartbeat_rx : 1;
+	unsigned can_0x026_FrameFaultBootloaderAddres_status : 2;
+	unsigned can_0x026_FrameFaultBootloaderAddres_tx : 1;
+	unsigned can_0x026_FrameFaultBootloaderAddres_rx : 1;
+	unsigned can_0x027_FrameFaultHeartbeat_status : 2;
+	unsigned can_0x027_FrameFaultHeartbeat_tx : 1;
+	unsigned can_0x027_FrameFaultHeartbeat_rx : 1;
+	unsigned can_0x028_FrameFaultCommand_status : 2;
+	unsigned can_0x028_FrameFaultCommand_tx : 1;
+	unsigned can_0x028_FrameFaultCommand_rx : 1;
+	unsigned can_0x02c_DriveControlsBootloader_status : 2;
+	unsigned can_0x02c_DriveControlsBootloader_tx : 1;
+	unsigned can_0x02c_DriveControlsBootloader_rx : 1;
+	unsigned can_0x02d_DriveControlsCommand_status : 2;
+	unsigned can_0x02d_DriveControlsCommand_tx : 1;
+	unsigned can_0x02d_DriveControlsCommand_rx : 1;
+	unsigned can_0x02e_DriveControlsHeartbeat_status : 2;
+	unsigned can_0x02e_DriveControlsHeartbeat_tx : 1;
+	unsigned can_0x02e_DriveControlsHeartbeat_rx : 1;
+	unsigned can_0x030_CANMirrorBootloaderAddress_status : 2;
+	unsigned can_0x030_CANMirrorBootloaderAddress_tx : 1;
+	unsigned can_0x030_CANMirrorBootloaderAddress_rx : 1;
+	unsigned can_0x031_CANMirrorHeatbeart_status : 2;
+	unsigned can_0x031_CANMirrorHeatbeart_tx : 1;
+	unsigned can_0x031_CANMirrorHeatbeart_rx : 1;
+	unsigned can_0x032_CANMirrorCommand_status : 2;
+	unsigned can_0x032_CANMirrorCommand_tx : 1;
+	unsigned can_0x032_CANMirrorCommand_rx : 1;
+	unsigned can_0x033_RiderDisplayBootloaderAddress_status : 2;
+	unsigned can_0x033_RiderDisplayBootloaderAddress_tx : 1;
+	unsigned can_0x033_RiderDisplayBootloaderAddress_rx : 1;
+	unsigned can_0x034_RiderDisplayHeartbeat_status : 2;
+	unsigned can_0x034_RiderDisplayHeartbeat_tx : 1;
+	unsigned can_0x034_RiderDisplayHeartbeat_rx : 1;
+	unsigned can_0x035_RiderDisplayCommand_status : 2;
+	unsigned can_0x035_RiderDisplayCommand_tx : 1;
+	unsigned can_0x035_RiderDisplayCommand_rx : 1;
+	unsigned can_0x039_BIM1BootloaderAddress_status : 2;
+	unsigned can_0x039_BIM1BootloaderAddress_tx : 1;
+	unsigned can_0x039_BIM1BootloaderAddress_rx : 1;
+	unsigned can_0x03a_BIM1Heartbeat_status : 2;
+	unsigned can_0x03a_BIM1Heartbeat_tx : 1;
+	unsigned can_0x03a_BIM1Heartbeat_rx : 1;
+	unsigned can_0x03b_BIM2BootloaderAddress_status : 2;
+	unsigned can_0x03b_BIM2BootloaderAddress_tx : 1;
+	unsigned can_0x03b_BIM2BootloaderAddress_rx : 1;
+	unsigned can_0x03c_BIM2Heartbeat_status : 2;
+	unsigned can_0x03c_BIM2Heartbeat_tx : 1;
+	unsigned can_0x03c_BIM2Heartbeat_rx : 1;
+	unsigned can_0x03d_BIM3BootloaderAddress_status : 2;
+	unsigned can_0x03d_BIM3BootloaderAddress_tx : 1;
+	unsigned can_0x03d_BIM3BootloaderAddress_rx : 1;
+	unsigned can_0x03e_BIM3Heartbeat_status : 2;
+	unsigned can_0x03e_BIM3Heartbeat_tx : 1;
+	unsigned can_0x03e_BIM3Heartbeat_rx : 1;
+	unsigned can_0x03f_BIM4BootloaderAddress_status : 2;
+	unsigned can_0x03f_BIM4BootloaderAddress_tx : 1;
+	unsigned can_0x03f_BIM4BootloaderAddress_rx : 1;
+	unsigned can_0x040_BIM4Heartbeat_status : 2;
+	unsigned can_0x040_BIM4Heartbeat_tx : 1;
+	unsigned can_0x040_BIM4Heartbeat_rx : 1;
+	unsigned can_0x0a0_MagicCanNode1RCommand_status : 2;
+	unsigned can_0x0a0_MagicCanNode1RCommand_tx : 1;
+	unsigned can_0x0a0_MagicCanNode1RCommand_rx : 1;
+	unsigned can_0x0a1_MagicCanNode2MCommand_status : 2;
+	unsigned can_0x0a1_MagicCanNode2MCommand_tx : 1;
+	unsigned can_0x0a1_MagicCanNode2MCommand_rx : 1;
+	unsigned can_0x0a2_MagicCanNode3FCommand_status : 2;
+	unsigned can_0x0a2_MagicCanNode3FCommand_tx : 1;
+	unsigned can_0x0a2_MagicCanNode3FCommand_rx : 1;
+	unsigned can_0x0aa_CANcorderHeartbeat_status : 2;
+	unsigned can_0x0aa_CANcorderHeartbeat_tx : 1;
+	unsigned can_0x0aa_CANcorderHeartbeat_rx : 1;
+	unsigned can_0x0b0_BIM1Command_status : 2;
+	unsigned can_0x0b0_BIM1Command_tx : 1;
+	unsigned can_0x0b0_BIM1Command_rx : 1;
+	unsigned can_0x0b1_BIM2Command_status : 2;
+	unsigned can_0x0b1_BIM2Command_tx : 1;
+	unsigned can_0x0b1_BIM2Command_rx : 1;
+	unsigned can_0x0b2_BIM3Command_status : 2;
+	unsigned can_0x0b2_BIM3Command_tx : 1;
+	unsigned can_0x0b2_BIM3Command_rx : 1;
+	unsigned can_0x0b3_BIM4Command_status : 2;
+	unsigned can_0x0b3_BIM4Command_tx : 1;
+	unsigned can_0x0b3_BIM4Command_rx : 1;
+	unsigned can_0x100_FrameFaultDetectionStatus_status : 2;
+	unsigned can_0x100_FrameFaultDetectionStatus_tx : 1;
+	unsigned can_0x100_FrameFaultDetectionStatus_rx : 1;
+	unsigned can_0x101_FrontBrakePressure_status : 2;
+	unsigned can_0x101_FrontBrakePressure_tx : 1;
+	unsigned can_0x101_FrontBrakePressure_rx : 1;
+	unsigned can_0x102_RearBrakePressure_status : 2;
+	unsigned can_0x102_RearBrakePressure_tx : 1;
+	unsigned can_0x102_RearBrakePressure_rx : 1;
+	unsigned can_0x103_FrontSuspensionTravel_status : 2;
+	unsigned can_0x103_FrontSuspensionTravel_tx : 1;
+	unsigned can_0x103_FrontSuspensionTravel_rx : 1;
+	unsigned can_0x104_RearSuspensionTravel_status : 2;
+	unsigned can_0x104_RearSuspensionTravel_tx : 1;
+	unsigned can_0x104_RearSuspensionTravel_rx : 1;
+	unsigned can_0x106_BusVoltage12V_status : 2;
+	unsigned can_0x106_BusVoltage12V_tx : 1;
+	unsigned can_0x106_BusVoltage12V_rx : 1;
+	unsigned can_0x107_PostMotorCoolantTemp_status : 2;
+	unsigned can_0x107_PostMotorCoolantTemp_tx : 1;
+	unsigned can_0x107_PostMotorCoolantTemp_rx : 1;
+	unsigned can_0x108_PostControllerCoolantTemp_status : 2;
+	unsigned can_0x108_PostControllerCoolantTemp_tx : 1;
+	unsigned can_0x108_PostControllerCoolantTemp_rx : 1;
+	unsigned can_0x109_RadiatorCoolSideCoolantTemp_status : 2;
+	unsigned can_0x109_RadiatorCoolSideCoolantTemp_tx : 1;
+	unsigned can_0x109_RadiatorCoolSideCoolantTemp_rx : 1;
+	unsigned can_0x10a_AmbientTemp_status : 2;
+	unsigned can_0x10a_AmbientTemp_tx : 1;
+	unsigned can_0x10a_AmbientTemp_rx : 1;
+	unsigned can_0x10b_GPSLatAndValidityStatus_status : 2;
+	unsigned can_0x10b_GPSLatAndValidityStatus_tx : 1;
+	unsigned can_0x10b_GPSLatAndValidityStatus_rx : 1;
+	unsigned can_0x10c_GPSLongitude_status : 2;
+	unsigned can_0x10c_GPSLongitude_tx : 1;
+	unsigned can_0x10c_GPSLongitude_rx : 1;
+	unsigned can_0x10d_GPSAltitudeAndAccuracy_status : 2;
+	unsigned can_0x10d_GPSAltitudeAndAccuracy_tx : 1;
+	unsigned can_0x10d_GPSAltitudeAndAccuracy_rx : 1;
+	unsigned can_0x10e_CurrentTime_status : 2;
+	unsigned can_0x10e_CurrentTime_tx : 1;
+	unsigned can_0x10e_CurrentTime_rx : 1;
+	unsigned can_0x10f_IMUAccelerationMeasurement_status : 2;
+	unsigned can_0x10f_IMUAccelerationMeasurement_tx : 1;
+	unsigned can_0x10f_IMUAccelerationMeasurement_rx : 1;
+	unsigned can_0x110_IMUGyroMeasurement_status : 2;
+	unsigned can_0x110_IMUGyroMeasurement_tx : 1;
+	unsigned can_0x110_IMUGyroMeasurement_rx : 1;
+	unsigned can_0x111_MotorPlateTemp_status : 2;
+	unsigned can_0x111_MotorPlateTemp_tx : 1;
+	unsigned can_0x111_MotorPlateTemp_rx : 1;
+	unsigned can_0x112_MotorScoop_status : 2;
+	unsigned can_0x112_MotorScoop_tx : 1;
+	unsigned can_0x112_MotorScoop_rx : 1;
+	unsigned can_0x113_IMU1_status : 2;
+	unsigned can_0x113_IMU1_tx : 1;
+	unsigned can_0x113_IMU1_rx : 1;
+	unsigned can_0x114_IMU2_status : 2;
+	unsigned can_0x114_IMU2_tx : 1;
+	unsigned can_0x114_IMU2_rx : 1;
+	unsigned can_0x115_IMU3_status : 2;
+	unsigned can_0x115_IMU3_tx : 1;
+	unsigned can_0x115_IMU3_rx : 1;
+	unsigned can_0x116_IMU4_status : 2;
+	unsigned can_0x116_IMU4_tx : 1;
+	unsigned can_0x116_IMU4_rx : 1;
+	unsigned can_0x29a_IMU5_status : 2;
+	unsigned can_0x29a_IMU5_tx : 1;
+	unsigned can_0x29a_IMU5_rx : 1;
+	unsigned can_0x29b_MESSAGE_NAME_status : 2;
+	unsigned can_0x29b_MESSAGE_NAME_tx : 1;
+	unsigned can_0x29b_MESSAGE_NAME_rx : 1;
+	unsigned can_0x29c_MESSAGE_NAME2_status : 2;
+	unsigned can_0x29c_MESSAGE_NAME2_tx : 1;
+	unsigned can_0x29c_MESSAGE_NAME2_rx : 1;
+	unsigned can_0x300_BIM1CellStatistics1_status : 2;
+	unsigned can_0x300_BIM1CellStatistics1_tx : 1;
+	unsigned can_0x300_BIM1CellStatistics1_rx : 1;
+	unsigned can_0x301_BIM1CellStatistics2_status : 2;
+	unsigned can_0x301_BIM1CellStatistics2_tx : 1;
+	unsigned can_0x301_BIM1CellStatistics2_rx : 1;
+	unsigned can_0x302_BIM2CellStatisitcs1_status : 2;
+	unsigned can_0x302_BIM2CellStatisitcs1_tx : 1;
+	unsigned can_0x302_BIM2CellStatisitcs1_rx : 1;
+	unsigned can_0x303_BIM2CellStatistics2_status : 2;
+	unsigned can_0x303_BIM2CellStatistics2_tx : 1;
+	unsigned can_0x303_BIM2CellStatistics2_rx : 1;
+	unsigned can_0x304_BIM3CellStatisitcs1_status : 2;
+	unsigned can_0x304_BIM3CellStatisitcs1_tx : 1;
+	unsigned can_0x304_BIM3CellStatisitcs1_rx : 1;
+	unsigned can_0x305_BIM3CellStatistics2_status : 2;
+	unsigned can_0x305_BIM3CellStatistics2_tx : 1;
+	unsigned can_0x305_BIM3CellStatistics2_rx : 1;
+	unsigned can_0x306_BIM4CellStatistics1_status : 2;
+	unsigned can_0x306_BIM4CellStatistics1_tx : 1;
+	unsigned can_0x306_BIM4CellStatistics1_rx : 1;
+	unsigned can_0x307_BIM4CellStatistics2_status : 2;
+	unsigned can_0x307_BIM4CellStatistics2_tx : 1;
+	unsigned can_0x307_BIM4CellStatistics2_rx : 1;
+	unsigned can_0x310_Cells_1_4_status : 2;
+	unsigned can_0x310_Cells_1_4_tx : 1;
+	unsigned can_0x310_Cells_1_4_rx : 1;
+	unsigned can_0x311_Cells_5_8_status : 2;
+	unsigned can_0x311_Cells_5_8_tx : 1;
+	unsigned can_0x311_Cells_5_8_rx : 1;
+	unsigned can_0x312_Cells_9_12_status : 2;
+	unsigned can_0x312_Cells_9_12_tx : 1;
+	unsigned can_0x312_Cells_9_12_rx : 1;
+	unsigned can_0x313_Cells_13_16_status : 2;
+	unsigned can_0x313_Cells_13_16_tx : 1;
+	unsigned can_0x313_Cells_13_16_rx : 1;
+	unsigned can_0x314_Cells_17_20_status : 2;
+	unsigned can_0x314_Cells_17_20_tx : 1;
+	unsigned can_0x314_Cells_17_20_rx : 1;
+	unsigned can_0x315_Cells_21_24_status : 2;
+	unsigned can_0x315_Cells_21_24_tx : 1;
+	unsigned can_0x315_Cells_21_24_rx : 1;
+	unsigned can_0x316_Cells_25_28_status : 2;
+	unsigned can_0x316_Cells_25_28_tx : 1;
+	unsigned can_0x316_Cells_25_28_rx : 1;
+	unsigned can_0x317_Cells_29_32_status : 2;
+	unsigned can_0x317_Cells_29_32_tx : 1;
+	unsigned can_0x317_Cells_29_32_rx : 1;
+	unsigned can_0x318_Cells_33_36_status : 2;
+	unsigned can_0x318_Cells_33_36_tx : 1;
+	unsigned can_0x318_Cells_33_36_rx : 1;
+	unsigned can_0x319_Cells_37_40_status : 2;
+	unsigned can_0x319_Cells_37_40_tx : 1;
+	unsigned can_0x319_Cells_37_40_rx : 1;
+	unsigned can_0x31a_Cells_41_44_status : 2;
+	unsigned can_0x31a_Cells_41_44_tx : 1;
+	unsigned can_0x31a_Cells_41_44_rx : 1;
+	unsigned can_0x31b_Cells_45_48_status : 2;
+	unsigned can_0x31b_Cells_45_48_tx : 1;
+	unsigned can_0x31b_Cells_45_48_rx : 1;
+	unsigned can_0x31c_Cells_49_52_status : 2;
+	unsigned can_0x31c_Cells_49_52_tx : 1;
+	unsigned can_0x31c_Cells_49_52_rx : 1;
+	unsigned can_0x31d_Cells_53_54_status : 2;
+	unsigned can_0x31d_Cells_53_54_tx : 1;
+	unsigned can_0x31d_Cells_53_54_rx : 1;
+	unsigned can_0x31e_Cells_55_58_status : 2;
+	unsigned can_0x31e_Cells_55_58_tx : 1;
+	unsigned can_0x31e_Cells_55_58_rx : 1;
+	unsigned can_0x31f_Cells_59_62_status : 2;
+	unsigned can_0x31f_Cells_59_62_tx : 1;
+	unsigned can_0x31f_Cells_59_62_rx : 1;
+	unsigned can_0x320_Cells_63_66_status : 2;
+	unsigned can_0x320_Cells_63_66_tx : 1;
+	unsigned can_0x320_Cells_63_66_rx : 1;
+	unsigned can_0x321_Cells_67_70_status : 2;
+	unsigned can_0x321_Cells_67_70_tx : 1;
+	unsigned can_0x321_Cells_67_70_rx : 1;
+	unsigned can_0x322_Cells_71_74_status : 2;
+	unsigned can_0x322_Cells_71_74_tx : 1;
+	unsigned can_0x322_Cells_71_74_rx : 1;
+	unsigned can_0x323_Cells_75_78_status : 2;
+	unsigned can_0x323_Cells_75_78_tx : 1;
+	unsigned can_0x323_Cells_75_78_rx : 1;
+	unsigned can_0x324_Cells_79_82_status : 2;
+	unsigned can_0x324_Cells_79_82_tx : 1;
+	unsigned can_0x324_Cells_79_82_rx : 1;
+	unsigned can_0x325_Cells_83_86_status : 2;
+	unsigned can_0x325_Cells_83_86_tx : 1;
+	unsigned can_0x325_Cells_83_86_rx : 1;
+	unsigned can_0x326_Cells_87_90_status : 2;
+	unsigned can_0x326_Cells_87_90_tx : 1;
+	unsigned can_0x326_Cells_87_90_rx : 1;
+	unsigned can_0x327_Cells_91_94_status : 2;
+	unsigned can_0x327_Cells_91_94_tx : 1;
+	unsigned can_0x327_Cells_91_94_rx : 1;
+	unsigned can_0x328_Cells_95_98_status : 2;
+	unsigned can_0x328_Cells_95_98_tx : 1;
+	unsigned can_0x328_Cells_95_98_rx : 1;
+	unsigned can_0x329_Cells_99_102_status : 2;
+	unsigned can_0x329_Cells_99_102_tx : 1;
+	unsigned can_0x329_Cells_99_102_rx : 1;
+	unsigned can_0x32a_Cells_103_106_status : 2;
+	unsigned can_0x32a_Cells_103_106_tx : 1;
+	unsigned can_0x32a_Cells_103_106_rx : 1;
+	unsigned can_0x32b_Cells_107_110_status : 2;
+	unsigned can_0x32b_Cells_107_110_tx : 1;
+	unsigned can_0x32b_Cells_107_110_rx : 1;
+	unsigned can_0x335_PackTemperatures1Thru4_status : 2;
+	unsigned can_0x335_PackTemperatures1Thru4_tx : 1;
+	unsigned can_0x335_PackTemperatures1Thru4_rx : 1;
+	unsigned can_0x336_PackTempeartures5Thru8_status : 2;
+	unsigned can_0x336_PackTempeartures5Thru8_tx : 1;
+	unsigned can_0x336_PackTempeartures5Thru8_rx : 1;
+	unsigned can_0x337_PackTemperatures9Thru14_status : 2;
+	unsigned can_0x337_PackTemperatures9Thru14_tx : 1;
+	unsigned can_0x337_PackTemperatures9Thru14_rx : 1;
+	unsigned can_0x338_PackTemperatures13Thru14_status : 2;
+	unsigned can_0x338_PackTemperatures13Thru14_tx : 1;
+	unsigned can_0x338_PackTemperatures13Thru14_rx : 1;
+	unsigned can_0x339_PackTemperatures15Thru18_status : 2;
+	unsigned can_0x339_PackTemperatures15Thru18_tx : 1;
+	unsigned can_0x339_PackTemperatures15Thru18_rx : 1;
+	unsigned can_0x33a_PackTemperatures19Thru22_status : 2;
+	unsigned can_0x33a_PackTemperatures19Thru22_tx : 1;
+	unsigned can_0x33a_PackTemperatures19Thru22_rx : 1;
+	unsigned can_0x33b_PackTemperatures23Thru26_status : 2;
+	unsigned can_0x33b_PackTemperatures23Thru26_tx : 1;
+	unsigned can_0x33b_PackTemperatures23Thru26_rx : 1;
+	unsigned can_0x33c_PackTemperatures27Thru30_status : 2;
+	unsigned can_0x33c_PackTemperatures27Thru30_tx : 1;
+	unsigned can_0x33c_PackTemperatures27Thru30_rx : 1;
+	unsigned can_0x33d_PackTemperatures31Thru34_status : 2;
+	unsigned can_0x33d_PackTemperatures31Thru34_tx : 1;
+	unsigned can_0x33d_PackTemperatures31Thru34_rx : 1;
+	unsigned can_0x33e_PackTemperatures35Thru38_status : 2;
+	unsigned can_0x33e_PackTemperatures35Thru38_tx : 1;
+	unsigned can_0x33e_PackTemperatures35Thru38_rx : 1;
+	unsigned can_0x33f_PackTemperatures39Thru42_status : 2;
+	unsigned can_0x33f_PackTemperatures39Thru42_tx : 1;
+	unsigned can_0x33f_PackTemperatures39Thru42_rx : 1;
+	unsigned can_0x401_StatusInformation_status : 2;
+	unsigned can_0x401_StatusInformation_tx : 1;
+	unsigned can_0x401_StatusInformation_rx : 1;
+	unsigned can_0x402_BusMeasurement_status : 2;
+	unsigned can_0x402_BusMeasurement_tx : 1;
+	unsigned can_0x402_BusMeasurement_rx : 1;
+	unsigned can_0x403_VelocityMeasurment_status : 2;
+	unsigned can_0x403_VelocityMeasurment_tx : 1;
+	unsigned can_0x403_VelocityMeasurment_rx : 1;
+	unsigned can_0x404_PhaseCurrentMeasurment_status : 2;
+	unsigned can_0x404_PhaseCurrentMeasurment_tx : 1;
+	unsigned can_0x404_PhaseCurrentMeasurment_rx : 1;
+	unsigned can_0x405_MotorVoltage_status : 2;
+	unsigned can_0x405_MotorVoltage_tx : 1;
+	unsigned can_0x405_MotorVoltage_rx : 1;
+	unsigned can_0x406_MotorCurrent_status : 2;
+	unsigned can_0x406_MotorCurrent_tx : 1;
+	unsigned can_0x406_MotorCurrent_rx : 1;
+	unsigned can_0x407_BackEMF_status : 2;
+	unsigned can_0x407_BackEMF_tx : 1;
+	unsigned can_0x407_BackEMF_rx : 1;
+	unsigned can_0x408_Rail15v_status : 2;
+	unsigned can_0x408_Rail15v_tx : 1;
+	unsigned can_0x408_Rail15v_rx : 1;
+	unsigned can_0x409_Rail3v3_1v9_status : 2;
+	unsigned can_0x409_Rail3v3_1v9_tx : 1;
+	unsigned can_0x409_Rail3v3_1v9_rx : 1;
+	unsigned can_0x40b_Motor_PhaseA_Temperature_status : 2;
+	unsigned can_0x40b_Motor_PhaseA_Temperature_tx : 1;
+	unsigned can_0x40b_Motor_PhaseA_Temperature_rx : 1;
+	unsigned can_0x40c_Phase_B_dsp_temprature_status : 2;
+	unsigned can_0x40c_Phase_B_dsp_temprature_tx : 1;
+	unsigned can_0x40c_Phase_B_dsp_temprature_rx : 1;
+	unsigned can_0x40e_Odometer_amphours_status : 2;
+	unsigned can_0x40e_Odometer_amphours_tx : 1;
+	unsigned can_0x40e_Odometer_amphours_rx : 1;
+	unsigned can_0x501_MotorDriveCommand_status : 2;
+	unsigned can_0x501_MotorDriveCommand_tx : 1;
+	unsigned can_0x501_MotorDriveCommand_rx : 1;
+	unsigned can_0x502_MotorPowerCommand_status : 2;
+	unsigned can_0x502_MotorPowerCommand_tx : 1;
+	unsigned can_0x502_MotorPowerCommand_rx : 1;
+	unsigned can_0x8501930_Odometer_Velocity_status : 2;
+	unsigned can_0x8501930_Odometer_Velocity_tx : 1;
+	unsigned can_0x8501930_Odometer_Velocity_rx : 1;
+	unsigned can_0xcc0016e_MagicCanNode1RHeartbeat_status : 2;
+	unsigned can_0xcc0016e_MagicCanNode1RHeartbeat_tx : 1;
+	unsigned can_0xcc0016e_MagicCanNode1RHeartbeat_rx : 1;
+	can_0x020_MagicCanNode1RBootloaderAddress_t can_0x020_MagicCanNode1RBootloaderAddress;
+	can_0x022_MagicCanNode2MBootloaderAddress_t can_0x022_MagicCanNode2MBootloaderAddress;
+	can_0x023_MagicCanNode2Heartbeat_t can_0x023_MagicCanNode2Heartbeat;
+	can_0x024_MagicCanNode3FBootloaderAddress_t can_0x024_MagicCanNode3FBootloaderAddress;
+	can_0x025_MagicCanNode3Heartbeat_t can_0x025_MagicCanNode3Heartbeat;
+	can_0x026_FrameFaultBootloaderAddres_t can_0x026_FrameFaultBootloaderAddres;
+	can_0x027_FrameFaultHeartbeat_t can_0x027_FrameFaultHeartbeat;
+	can_0x028_FrameFaultCommand_t can_0x028_FrameFaultCommand;
+	can_0x02c_DriveControlsBootloader_t can_0x02c_DriveControlsBootloader;
+	can_0x02d_DriveControlsCommand_t can_0x02d_DriveControlsCommand;
+	can_0x02e_DriveControlsHeartbeat_t can_0x02e_DriveControlsHeartbeat;
+	can_0x030_CANMirrorBootloaderAddress_t can_0x030_CANMirrorBootloaderAddress;
+	can_0x031_CANMirrorHeatbeart_t can_0x031_CANMirrorHeatbeart;
+	can_0x032_CANMirrorCommand_t can_0x032_CANMirrorCommand;
+	can_0x033_RiderDisplayBootloaderAddress_t can_0x033_RiderDisplayBootloaderAddress;
+	can_0x034_RiderDisplayHeartbeat_t can_0x034_RiderDisplayHeartbeat;
+	can_0x035_RiderDisplayCommand_t can_0x035_RiderDisplayCommand;
+	can_0x039_BIM1BootloaderAddress_t can_0x039_BIM1BootloaderAddress;
+	can_0x03a_BIM1Heartbeat_t can_0x03a_BIM1Heartbeat;
+	can_0x03b_BIM2BootloaderAddress_t can_0x03b_BIM2BootloaderAddress;
+	can_0x03c_BIM2Heartbeat_t can_0x03c_BIM2Heartbeat;
+	can_0x03d_BIM3BootloaderAddress_t can_0x03d_BIM3BootloaderAddress;
+	can_0x03e_BIM3Heartbeat_t can_0x03e_BIM3Heartbeat;
+	can_0x03f_BIM4BootloaderAddress_t can_0x03f_BIM4BootloaderAddress;
+	can_0x040_BIM4Heartbeat_t can_0x040_BIM4Heartbeat;
+	can_0x0a0_MagicCanNode1RCommand_t can_0x0a0_MagicCanNode1RCommand;
+	can_0x0a1_MagicCanNode2MCommand_t can_0x0a1_MagicCanNode2MCommand;
+	can_0x0a2_MagicCanNode3FCommand_t can_0x0a2_MagicCanNode3FCommand;
+	can_0x0aa_CANcorderHeartbeat_t can_0x0aa_CANcorderHeartbeat;
+	can_0x0b0_BIM1Command_t can_0x0b0_BIM1Command;
+	can_0x0b1_BIM2Command_t can_0x0b1_BIM2Command;
+	can_0x0b2_BIM3Command_t can_0x0b2_BIM3Command;
+	can_0x0b3_BIM4Command_t can_0x0b3_BIM4Command;
+	can_0x100_FrameFaultDetectionStatus_t can_0x100_FrameFaultDetectionStatus;
+	can_0x101_FrontBrakePressure_t can_0x101_FrontBrakePressure;
+	can_0x102_RearBrakePressure_t can_0x102_RearBrakePressure;
+	can_0x103_FrontSuspensionTravel_t can_0x103_FrontSuspensionTravel;
+	can_0x104_RearSuspensionTravel_t can_0x104_RearSuspensionTravel;
+	can_0x106_BusVoltage12V_t can_0x106_BusVoltage12V;
+	can_0x107_PostMotorCoolantTemp_t can_0x107_PostMotorCoolantTemp;
+	can_0x108_PostControllerCoolantTemp_t can_0x108_PostControllerCoolantTemp;
+	can_0x109_RadiatorCoolSideCoolantTemp_t can_0x109_RadiatorCoolSideCoolantTemp;
+	can_0x10a_AmbientTemp_t can_0x10a_AmbientTemp;
+	can_0x10b_GPSLatAndValidityStatus_t can_0x10b_GPSLatAndValidityStatus;
+	can_0x10c_GPSLongitude_t can_0x10c_GPSLongitude;
+	can_0x10d_GPSAltitudeAndAccuracy_t can_0x10d_GPSAltitudeAndAccuracy;
+	can_0x10e_CurrentTime_t can_0x10e_CurrentTime;
+	can_0x10f_IMUAccelerationMeasurement_t can_0x10f_IMUAccelerationMeasurement;
+	can_0x110_IMUGyroMeasurement_t can_0x110_IMUGyroMeasurement;
+	can_0x111_MotorPlateTemp_t can_0x111_MotorPlateTemp;
+	can_0x112_MotorScoop_t can_0x112_MotorScoop;
+	can_0x113_IMU1_t can_0x113_IMU1;
+	can_0x114_IMU2_t can_0x114_IMU2;
+	can_0x115_IMU3_t can_0x115_IMU3;
+	can_0x116_IMU4_t can_0x116_IMU4;
+	can_0x29a_IMU5_t can_0x29a_IMU5;
+	can_0x29b_MESSAGE_NAME_t can_0x29b_MESSAGE_NAME;
+	can_0x29c_MESSAGE_NAME2_t can_0x29c_MESSAGE_NAME2;
+	can_0x300_BIM1CellStatistics1_t can_0x300_BIM1CellStatistics1;
+	can_0x301_BIM1CellStatistics2_t can_0x301_BIM1CellStatistics2;
+	can_0x302_BIM2CellStatisitcs1_t can_0x302_BIM2CellStatisitcs1;
+	can_0x303_BIM2CellStatistics2_t can_0x303_BIM2CellStatistics2;
+	can_0x304_BIM3CellStatisitcs1_t can_0x304_BIM3CellStatisitcs1;
+	can_0x305_BIM3CellStatistics2_t can_0x305_BIM3CellStatistics2;
+	can_0x306_BIM4CellStatistics1_t can_0x306_BIM4CellStatistics1;
+	can_0x307_BIM4CellStatistics2_t can_0x307_BIM4CellStatistics2;
+	can_0x310_Cells_1_4_t can_0x310_Cells_1_4;
+	can_0x311_Cells_5_8_t can_0x311_Cells_5_8;
+	can_0x312_Cells_9_12_t can_0x312_Cells_9_12;
+	can_0x313_Cells_13_16_t can_0x313_Cells_13_16;
+	can_0x314_Cells_17_20_t can_0x314_Cells_17_20;
+	can_0x315_Cells_21_24_t can_0x315_Cells_21_24;
+	can_0x316_Cells_25_28_t can_0x316_Cells_25_28;
+	can_0x317_Cells_29_32_t can_0x317_Cells_29_32;
+	can_0x318_Cells_33_36_t can_0x318_Cells_33_36;
+	can_0x319_Cells_37_40_t can_0x319_Cells_37_40;
+	can_0x31a_Cells_41_44_t can_0x31a_Cells_41_44;
+	can_0x31b_Cells_45_48_t can_0x31b_Cells_45_48;
+	can_0x31c_Cells_49_52_t can_0x31c_Cells_49_52;
+	can_0x31d_Cells_53_54_t can_0x31d_Cells_53_54;
+	can_0x31e_Cells_55_58_t can_0x31e_Cells_55_58;
+	can_0x31f_Cells_59_62_t can_0x31f_Cells_59_62;
+	can_0x320_Cells_63_66_t can_0x320_Cells_63_66;
+	can_0x321_Cells_67_70_t can_0x321_Cells_67_70;
+	can_0x322_Cells_71_74_t can_0x322_Cells_71_74;
+	can_0x323_Cells_75_78_t can_0x323_Cells_75_78;
+	can_0x324_Cells_79_82_t can_0x324_Cells_79_82;
+	can_0x325_Cells_83_86_t can_0x325_Cells_83_86;
+	can_0x326_Cells_87_90_t can_0x326_Cells_87_90;
+	can_0x327_Cells_91_94_t can_0x327_Cells_91_94;
+	can_0x328_Cells_95_98_t can_0x328_Cells_95_98;
+	can_0x329_Cells_99_102_t can_0x329_Cells_99_102;
+	can_0x32a_Cells_103_106_t can_0x32a_Cells_103_106;
+	can_0x32b_Cells_107_110_t can_0x32b_Cells_107_110;
+	can_0x335_PackTemperatures1Thru4_t can_0x335_PackTemperatures1Thru4;
+	can_0x336_PackTempeartures5Thru8_t can_0x336_PackTempeartures5Thru8;
+	can_0x337_PackTemperatures9Thru14_t can_0x337_PackTemperatures9Thru14;
+	can_0x338_PackTemperatures13Thru14_t can_0x338_PackTemperatures13Thru14;
+	can_0x339_PackTemperatures15Thru18_t can_0x339_PackTemperatures15Thru18;
+	can_0x33a_PackTemperatures19Thru22_t can_0x33a_PackTemperatures19Thru22;
+	can_0x33b_PackTemperatures23Thru26_t can_0x33b_PackTemperatures23Thru26;
+	can_0x33c_PackTemperatures27Thru30_t can_0x33c_PackTemperatures27Thru30;
+	can_0x33d_PackTemperatures31Thru34_t can_0x33d_PackTemperatures31Thru34;
+	can_0x33e_PackTemperatures35Thru38_t can_0x33e_PackTemperatures35Thru38;
+	can_0x33f_PackTemperatures39Thru42_t can_0x33f_PackTemperatures39Thru42;
+	can_0x401_StatusInformation_t can_0x401_StatusInformation;
+	can_0x402_BusMeasurement_t can_0x402_BusMeasurement;
+	can_0x403_VelocityMeasurment_t can_0x403_VelocityMeasurment;
+	can_0x404_PhaseCurrentMeasurment_t can_0x404_PhaseCurrentMeasurment;
+	can_0x405_MotorVoltage_t can_0x405_MotorVoltage;
+	can_0x406_MotorCurrent_t can_0x406_MotorCurrent;
+	can_0x407_BackEMF_t can_0x407_BackEMF;
+	can_0x408_Rail15v_t can_0x408_Rail15v;
+	can_0x409_Rail3v3_1v9_t can_0x409_Rail3v3_1v9;
+	can_0x40b_Motor_PhaseA_Temperature_t can_0x40b_Motor_PhaseA_Temperature;
+	can_0x40c_Phase_B_dsp_temprature_t can_0x40c_Phase_B_dsp_temprature;
+	can_0x40e_Odometer_amphours_t can_0x40e_Odometer_amphours;
+	can_0x501_MotorDriveCommand_t can_0x501_MotorDriveCommand;
+	can_0x502_MotorPowerCommand_t can_0x502_MotorPowerCommand;
+	can_0x8501930_Odometer_Velocity_t can_0x8501930_Odometer_Velocity;
+	can_0xcc0016e_MagicCanNode1RHeartbeat_t can_0xcc0016e_MagicCanNode1RHeartbeat;
+} POSTPACK can_obj_ex1_h_t;
+
+int unpack_message(can_obj_ex1_h_t *o, const unsigned long id, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp);
+int pack_message(can_obj_ex1_h_t *o, const unsigned long id, uint64_t *data);
+int message_dlc(const unsigned long id);
+int print_message(const can_obj_ex1_h_t *o, const unsigned long id, FILE *output);
+
+int decode_can_0x020_MagicNode1R_BLAddy(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x020_MagicNode1R_BLAddy(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x022_MagicNode2M_BLAddy(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x022_MagicNode2M_BLAddy(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x023_MagicNode2Flags(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x023_MagicNode2Flags(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x024_MagicNode3F_BLAddy(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x024_MagicNode3F_BLAddy(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x025_MagicNode3Flags(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x025_MagicNode3Flags(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x026_FrameFaultBootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x026_FrameFaultBootloaderAddress(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x027_FrameFaultFlags(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x027_FrameFaultFlags(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x028_FrameFaultCommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x028_FrameFaultCommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x028_FrameFaultCommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x028_FrameFaultCommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x02c_DriveControlsBootloader(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x02c_DriveControlsBootloader(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x02d_DriveControlCommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x02d_DriveControlCommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x02d_DriveControlCommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x02d_DriveControlCommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x02e_DriveControlTritiumError(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x02e_DriveControlTritiumError(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x02e_DriveControlMaxError(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x02e_DriveControlMaxError(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x02e_DriveControlMinError(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x02e_DriveControlMinError(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x030_CANMirrorBootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x030_CANMirrorBootloaderAddress(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x031_CANMirrorOverflowCounter(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x031_CANMirrorOverflowCounter(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x031_Timeout(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x031_Timeout(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x031_Mirror_can_error(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x031_Mirror_can_error(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x031_Mirror_CANa_Status(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x031_Mirror_CANa_Status(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x032_CANMirrorCommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x032_CANMirrorCommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x032_CANMirrorCommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x032_CANMirrorCommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x033_RiderDisplayBootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x033_RiderDisplayBootloaderAddress(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x034_RiderDisplayFlags(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x034_RiderDisplayFlags(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x035_RiderDisplayCommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x035_RiderDisplayCommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x035_RiderDisplayCommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x035_RiderDisplayCommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x039_BIM1BootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x039_BIM1BootloaderAddress(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x03a_BIM1BQ(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03a_BIM1BQ(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x03a_BIM1Init(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03a_BIM1Init(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x03a_BIM1SPI(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03a_BIM1SPI(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x03b_BIM2BootloaderAddres(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x03b_BIM2BootloaderAddres(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x03c_BIM2BQ(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03c_BIM2BQ(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x03c_BIM2Init(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03c_BIM2Init(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x03c_BIM2SPI(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03c_BIM2SPI(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x03d_BIM3BootloaderAddress(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x03d_BIM3BootloaderAddress(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x03e_BIM3BQ(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03e_BIM3BQ(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x03e_BIM3Init(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03e_BIM3Init(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x03e_BIM3SPI(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x03e_BIM3SPI(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x03f_BIM4BootloaderAddres(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x03f_BIM4BootloaderAddres(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x040_BIM4BQ(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x040_BIM4BQ(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x040_BIM4Init(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x040_BIM4Init(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x040_BIM4SPI(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x040_BIM4SPI(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x0a0_MagicCanNode1CommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x0a0_MagicCanNode1CommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x0a0_MagicCanNode1CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0a0_MagicCanNode1CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x0a1_MagicCanNode2CommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x0a1_MagicCanNode2CommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x0a1_MagicCanNode2CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0a1_MagicCanNode2CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x0a2_MagicCanNode3CommandValue(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0a2_MagicCanNode3CommandValue(can_obj_ex1_h_t *o, uint32_t in);
+int decode_can_0x0a2_MagicCanNode3CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0a2_MagicCanNode3CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x0aa_CANcorderHeartbeat(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x0aa_CANcorderHeartbeat(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x0b0_BIM1CommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x0b0_BIM1CommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x0b0_BIM1CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0b0_BIM1CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x0b1_BIM2CommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x0b1_BIM2CommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x0b1_BIM2CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0b1_BIM2CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x0b2_BIM3CommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x0b2_BIM3CommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x0b2_BIM3CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0b2_BIM3CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x0b3_BIM4CommandValue(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x0b3_BIM4CommandValue(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x0b3_BIM4CommandCode(const can_obj_ex1_h_t *o, uint32_t *out);
+int encode_can_0x0b3_BIM4CommandCode(can_obj_ex1_h_t *o, uint32_t in);
+
+
+int decode_can_0x100_EstimatedPackFrameResistance(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x100_EstimatedPackFrameResistance(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x100_FaultStatus(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x100_FaultStatus(can_obj_ex1_h_t *o, uint16_t in);
+
+
+int decode_can_0x101_FrontBrakePressure(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x101_FrontBrakePressure(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x102_RearBrakePressure(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x102_RearBrakePressure(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x103_FrontSuspensionPosition(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x103_FrontSuspensionPosition(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x104_RearSuspensionPosition(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x104_RearSuspensionPosition(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x106_BusVoltage12V(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x106_BusVoltage12V(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x107_PostMotorCoolantTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x107_PostMotorCoolantTemp(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x108_PostControllerCoolantTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x108_PostControllerCoolantTemp(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x109_RadiatorCoolSideCoolantTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x109_RadiatorCoolSideCoolantTemp(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x10a_AmbientTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x10a_AmbientTemp(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x10b_GPSLatitude(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x10b_GPSLatitude(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x10b_GPSValidityStatus(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x10b_GPSValidityStatus(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x10c_GPSLongitude(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x10c_GPSLongitude(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x10d_GPSAltitude(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x10d_GPSAltitude(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x10d_PositionDOP(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x10d_PositionDOP(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x10e_Years(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x10e_Years(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x10e_Month(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x10e_Month(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x10e_Day(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x10e_Day(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x10e_Hours(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x10e_Hours(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x10e_Minutes(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x10e_Minutes(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x10e_Seconds(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x10e_Seconds(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x10f_XAxisAcceleration(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x10f_XAxisAcceleration(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x10f_YAxisAcceleration(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x10f_YAxisAcceleration(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x10f_ZAxisAcceleration(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x10f_ZAxisAcceleration(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x110_XAxisRoll(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x110_XAxisRoll(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x110_YAxisRoll(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x110_YAxisRoll(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x110_ZAxisRoll(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x110_ZAxisRoll(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x111_MotorPlateTemp1(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x111_MotorPlateTemp1(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x111_MotorPlateTemp2(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x111_MotorPlateTemp2(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x112_MotorScoop(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x112_MotorScoop(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x113_IMUAccelX(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x113_IMUAccelX(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x113_IMUAceelY(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x113_IMUAceelY(can_obj_ex1_h_t *o, int32_t in);
+
+
+int decode_can_0x114_IMUAccelZ(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x114_IMUAccelZ(can_obj_ex1_h_t *o, int32_t in);
+int decode_can_0x114_GravityX(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x114_GravityX(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x115_GravityY(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x115_GravityY(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x115_GravityZ(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x115_GravityZ(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x116_Yaw(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x116_Yaw(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x116_Pitch(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x116_Pitch(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x29a_normal(const can_obj_ex1_h_t *o, int8_t *out);
+int encode_can_0x29a_normal(can_obj_ex1_h_t *o, int8_t in);
+int decode_can_0x29a_multiplexor(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29a_multiplexor(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x29a_multi1(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29a_multi1(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x29a_multi3(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29a_multi3(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x29a_multi4(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29a_multi4(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x29a_multi2a(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29a_multi2a(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x29a_multi2b(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29a_multi2b(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x29b_NonsenseSignal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x29b_NonsenseSignal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+
+
+int decode_can_0x300_BIM1MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x300_BIM1MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x300_BIM1MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x300_BIM1MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x300_BIM1MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x300_BIM1MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x300_BIM1MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x300_BIM1MinCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x301_BIM1AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x301_BIM1AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x301_BIM1StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x301_BIM1StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x301_BIM1NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x301_BIM1NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x302_BIM2MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x302_BIM2MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x302_BIM2MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x302_BIM2MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x302_BIM2MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x302_BIM2MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x302_BIM2MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x302_BIM2MinCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x303_BIM2AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x303_BIM2AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x303_BIM2StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x303_BIM2StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x303_BIM2NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x303_BIM2NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x304_BIM3MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x304_BIM3MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x304_BIM3MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x304_BIM3MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x304_BIM3MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x304_BIM3MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x304_BIM3MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x304_BIM3MinCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x305_BIM3AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x305_BIM3AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x305_BIM3StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x305_BIM3StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x305_BIM3NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x305_BIM3NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x306_BIM4MaxCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x306_BIM4MaxCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x306_BIM4MinCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x306_BIM4MinCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x306_BIM4MaxCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x306_BIM4MaxCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x306_BIM4MinCellNumber(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x306_BIM4MinCellNumber(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x307_BIM4AvgCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x307_BIM4AvgCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x307_BIM4StdevCellVoltage(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x307_BIM4StdevCellVoltage(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x307_BIM4NumberBalancingCells(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x307_BIM4NumberBalancingCells(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x310_Cell1(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x310_Cell1(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x310_Cell2(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x310_Cell2(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x310_Cell3(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x310_Cell3(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x310_Cell4(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x310_Cell4(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x310_Cell1_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x310_Cell1_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x310_Cell2_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x310_Cell2_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x310_Cell3_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x310_Cell3_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x310_Cell4_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x310_Cell4_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x311_Cell5(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x311_Cell5(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x311_Cell6(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x311_Cell6(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x311_Cell7(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x311_Cell7(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x311_Cell8(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x311_Cell8(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x311_Cell5_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x311_Cell5_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x311_Cell6_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x311_Cell6_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x311_Cell7_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x311_Cell7_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x311_Cell8_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x311_Cell8_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x312_Cell9(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x312_Cell9(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x312_Cell10(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x312_Cell10(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x312_Cell11(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x312_Cell11(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x312_Cell12(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x312_Cell12(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x312_Cell9_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x312_Cell9_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x312_Cell10_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x312_Cell10_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x312_Cell11_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x312_Cell11_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x312_Cell12_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x312_Cell12_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x313_Cell13(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x313_Cell13(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x313_Cell14(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x313_Cell14(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x313_Cell15(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x313_Cell15(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x313_Cell16(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x313_Cell16(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x313_Cell13_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x313_Cell13_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x313_Cell14_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x313_Cell14_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x313_Cell15_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x313_Cell15_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x313_Cell16_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x313_Cell16_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x314_Cell17(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x314_Cell17(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x314_Cell18(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x314_Cell18(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x314_Cell19(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x314_Cell19(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x314_Cell20(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x314_Cell20(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x314_Cell17_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x314_Cell17_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x314_Cell18_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x314_Cell18_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x314_Cell19_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x314_Cell19_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x314_Cell20_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x314_Cell20_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x315_Cell21(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x315_Cell21(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x315_Cell22(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x315_Cell22(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x315_Cell23(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x315_Cell23(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x315_Cell24(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x315_Cell24(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x315_Cell21_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x315_Cell21_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x315_Cell22_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x315_Cell22_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x315_Cell23_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x315_Cell23_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x315_Cell24_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x315_Cell24_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x316_Cell25(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x316_Cell25(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x316_Cell26(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x316_Cell26(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x316_Cell27(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x316_Cell27(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x316_Cell28(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x316_Cell28(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x316_Cell25_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x316_Cell25_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x316_Cell26_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x316_Cell26_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x316_Cell27_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x316_Cell27_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x316_Cell28_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x316_Cell28_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x317_Cell29(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x317_Cell29(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x317_Cell30(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x317_Cell30(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x317_Cell31(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x317_Cell31(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x317_Cell32(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x317_Cell32(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x317_Cell29_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x317_Cell29_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x317_Cell30_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x317_Cell30_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x317_Cell31_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x317_Cell31_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x317_Cell32_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x317_Cell32_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x318_Cell33(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x318_Cell33(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x318_Cell34(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x318_Cell34(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x318_Cell35(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x318_Cell35(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x318_Cell36(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x318_Cell36(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x318_Cell33_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x318_Cell33_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x318_Cell34_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x318_Cell34_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x318_Cell35_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x318_Cell35_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x318_Cell36_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x318_Cell36_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x319_Cell37(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x319_Cell37(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x319_Cell38(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x319_Cell38(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x319_Cell39(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x319_Cell39(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x319_Cell40(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x319_Cell40(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x319_Cell37_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x319_Cell37_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x319_Cell38_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x319_Cell38_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x319_Cell39_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x319_Cell39_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x319_Cell40_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x319_Cell40_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x31a_Cell41(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31a_Cell41(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31a_Cell42(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31a_Cell42(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31a_Cell43(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31a_Cell43(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31a_Cell44(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31a_Cell44(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31a_Cell41_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31a_Cell41_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31a_Cell42_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31a_Cell42_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31a_Cell43_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31a_Cell43_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31a_Cell44_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31a_Cell44_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x31b_Cell45(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31b_Cell45(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31b_Cell46(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31b_Cell46(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31b_Cell47(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31b_Cell47(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31b_Cell48(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31b_Cell48(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31b_Cell45_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31b_Cell45_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31b_Cell46_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31b_Cell46_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31b_Cell47_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31b_Cell47_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31b_Cell48_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31b_Cell48_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x31c_Cell49(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31c_Cell49(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31c_Cell50(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31c_Cell50(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31c_Cell51(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31c_Cell51(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31c_Cell52(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31c_Cell52(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31c_Cell49_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31c_Cell49_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31c_Cell50_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31c_Cell50_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31c_Cell51_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31c_Cell51_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31c_Cell52_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31c_Cell52_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x31d_Cell53(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31d_Cell53(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31d_Cell54(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31d_Cell54(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31d_Cell53_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31d_Cell53_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31d_Cell54_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31d_Cell54_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x31e_Cell55(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31e_Cell55(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31e_Cell56(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31e_Cell56(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31e_Cell57(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31e_Cell57(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31e_Cell58(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31e_Cell58(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31e_Cell55_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31e_Cell55_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31e_Cell56_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31e_Cell56_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31e_Cell57_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31e_Cell57_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31e_Cell58_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31e_Cell58_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x31f_Cell59(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31f_Cell59(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31f_Cell60(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31f_Cell60(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31f_Cell61(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31f_Cell61(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31f_Cell62(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x31f_Cell62(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x31f_Cell59_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31f_Cell59_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31f_Cell60_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31f_Cell60_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31f_Cell61_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31f_Cell61_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x31f_Cell62_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x31f_Cell62_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x320_Cell63(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x320_Cell63(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x320_Cell64(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x320_Cell64(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x320_Cell65(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x320_Cell65(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x320_Cell66(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x320_Cell66(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x320_Cell63_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x320_Cell63_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x320_Cell64_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x320_Cell64_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x320_Cell65_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x320_Cell65_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x320_Cell66_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x320_Cell66_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x321_Cell67(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x321_Cell67(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x321_Cell68(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x321_Cell68(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x321_Cell69(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x321_Cell69(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x321_Cell70(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x321_Cell70(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x321_Cell67_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x321_Cell67_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x321_Cell68_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x321_Cell68_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x321_Cell69_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x321_Cell69_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x321_Cell70_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x321_Cell70_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x322_Cell71(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x322_Cell71(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x322_Cell72(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x322_Cell72(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x322_Cell73(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x322_Cell73(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x322_Cell74(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x322_Cell74(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x322_Cell71_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x322_Cell71_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x322_Cell72_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x322_Cell72_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x322_Cell73_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x322_Cell73_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x322_Cell74_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x322_Cell74_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x323_Cell75(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x323_Cell75(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x323_Cell76(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x323_Cell76(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x323_Cell77(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x323_Cell77(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x323_Cell78(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x323_Cell78(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x323_Cell75_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x323_Cell75_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x323_Cell76_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x323_Cell76_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x323_Cell77_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x323_Cell77_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x323_Cell78_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x323_Cell78_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x324_Cell79(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x324_Cell79(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x324_Cell80(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x324_Cell80(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x324_Cell81(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x324_Cell81(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x324_Cell82(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x324_Cell82(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x324_Cell79_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x324_Cell79_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x324_Cell80_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x324_Cell80_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x324_Cell81_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x324_Cell81_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x324_Cell82_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x324_Cell82_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x325_Cell83(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x325_Cell83(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x325_Cell84(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x325_Cell84(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x325_Cell85(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x325_Cell85(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x325_Cell86(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x325_Cell86(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x325_Cell83_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x325_Cell83_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x325_Cell84_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x325_Cell84_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x325_Cell85_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x325_Cell85_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x325_Cell86_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x325_Cell86_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x326_Cell87(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x326_Cell87(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x326_Cell88(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x326_Cell88(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x326_Cell89(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x326_Cell89(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x326_Cell90(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x326_Cell90(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x326_Cell87_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x326_Cell87_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x326_Cell88_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x326_Cell88_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x326_Cell89_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x326_Cell89_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x326_Cell90_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x326_Cell90_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x327_Cell91(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x327_Cell91(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x327_Cell92(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x327_Cell92(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x327_Cell93(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x327_Cell93(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x327_Cell94(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x327_Cell94(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x327_Cell91_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x327_Cell91_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x327_Cell92_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x327_Cell92_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x327_Cell93_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x327_Cell93_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x327_Cell94_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x327_Cell94_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x328_Cell95(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x328_Cell95(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x328_Cell96(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x328_Cell96(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x328_Cell97(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x328_Cell97(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x328_Cell98(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x328_Cell98(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x328_Cell95_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x328_Cell95_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x328_Cell96_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x328_Cell96_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x328_Cell97_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x328_Cell97_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x328_Cell98_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x328_Cell98_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x329_Cell99(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x329_Cell99(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x329_Cell100(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x329_Cell100(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x329_Cell101(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x329_Cell101(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x329_Cell102(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x329_Cell102(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x329_Cell99_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x329_Cell99_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x329_Cell100_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x329_Cell100_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x329_Cell101_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x329_Cell101_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x329_Cell102_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x329_Cell102_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x32a_Cell103(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32a_Cell103(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32a_Cell104(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32a_Cell104(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32a_Cell105(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32a_Cell105(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32a_Cell106(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32a_Cell106(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32a_Cell103_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32a_Cell103_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x32a_Cell104_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32a_Cell104_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x32a_Cell105_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32a_Cell105_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x32a_Cell106_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32a_Cell106_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x32b_Cell107(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32b_Cell107(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32b_Cell108(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32b_Cell108(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32b_Cell109(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32b_Cell109(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32b_Cell110(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x32b_Cell110(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x32b_Cell107_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32b_Cell107_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x32b_Cell108_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32b_Cell108_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x32b_Cell109_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32b_Cell109_bal(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x32b_Cell110_bal(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x32b_Cell110_bal(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x335_Temp1(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x335_Temp1(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x335_Temp2(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x335_Temp2(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x335_Temp3(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x335_Temp3(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x335_Temp4(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x335_Temp4(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x336_Temp5(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x336_Temp5(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x336_Temp6(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x336_Temp6(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x336_Temp7(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x336_Temp7(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x336_Temp8(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x336_Temp8(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x337_Temp9(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x337_Temp9(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x337_Temp10(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x337_Temp10(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x337_Temp11(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x337_Temp11(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x337_Temp12(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x337_Temp12(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x338_Temp13(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x338_Temp13(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x338_Temp14(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x338_Temp14(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x339_Temp15(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x339_Temp15(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x339_Temp16(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x339_Temp16(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x339_Temp17(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x339_Temp17(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x339_Temo18(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x339_Temo18(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x33a_Temp19(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33a_Temp19(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33a_Temp20(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33a_Temp20(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33a_Temp21(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33a_Temp21(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33a_Temo22(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33a_Temo22(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x33b_Temp23(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33b_Temp23(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33b_Temp24(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33b_Temp24(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33b_Temp25(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33b_Temp25(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33b_Temo26(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33b_Temo26(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x33c_Temp27(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33c_Temp27(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33c_Temp28(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33c_Temp28(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33c_Temp29(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33c_Temp29(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33c_Temo30(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33c_Temo30(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x33d_Temp31(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33d_Temp31(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33d_Temp32(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33d_Temp32(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33d_Temp33(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33d_Temp33(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33d_Temo34(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33d_Temo34(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x33e_Temp35(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33e_Temp35(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33e_Temp36(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33e_Temp36(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33e_Temp37(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33e_Temp37(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33e_Temo38(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33e_Temo38(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x33f_Temp39(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33f_Temp39(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33f_Temp40(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33f_Temp40(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33f_Temp41(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33f_Temp41(can_obj_ex1_h_t *o, int16_t in);
+int decode_can_0x33f_Temo42(const can_obj_ex1_h_t *o, int16_t *out);
+int encode_can_0x33f_Temo42(can_obj_ex1_h_t *o, int16_t in);
+
+
+int decode_can_0x401_Reserved_Limit(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0x401_Reserved_Limit(can_obj_ex1_h_t *o, uint16_t in);
+int decode_can_0x401_Reserved_Error(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_Reserved_Error(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_outputvolt_pwm(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_outputvolt_pwm(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_motor_current(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_motor_current(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_velocity(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_velocity(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_bus_current(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_bus_current(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_bus_volt_upper(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_bus_volt_upper(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_bus_volt_lower(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_bus_volt_lower(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_limit_temp(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_limit_temp(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_hardware_over_current(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_hardware_over_current(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_software_over_current(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_software_over_current(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_DC_over_volt(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_DC_over_volt(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_bad_position(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_bad_position(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_watchdog(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_watchdog(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_configread(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_configread(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_15v_under_volt(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_15v_under_volt(can_obj_ex1_h_t *o, uint8_t in);
+int decode_can_0x401_error_desaturation(const can_obj_ex1_h_t *o, uint8_t *out);
+int encode_can_0x401_error_desaturation(can_obj_ex1_h_t *o, uint8_t in);
+
+
+int decode_can_0x402_BusVoltage(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x402_BusVoltage(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x402_BusCurrent(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x402_BusCurrent(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x403_MotorVelocity(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x403_MotorVelocity(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x403_VehicleVelocity(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x403_VehicleVelocity(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x404_PhaseBcurrent(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x404_PhaseBcurrent(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x404_PhaseCcurrent(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x404_PhaseCcurrent(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x405_MotorVq(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x405_MotorVq(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x405_MotorVd(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x405_MotorVd(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x406_MotorIq(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x406_MotorIq(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x406_MotorId(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x406_MotorId(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x407_BEMFq(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x407_BEMFq(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x407_BEMFd(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x407_BEMFd(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x408_supply15v(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x408_supply15v(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x409_supply1v9(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x409_supply1v9(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x409_supply3v3(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x409_supply3v3(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x40b_MotorTemp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x40b_MotorTemp(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x40b_PhaseAtemp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x40b_PhaseAtemp(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x40c_DSP_temp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x40c_DSP_temp(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x40c_PhaseB_Temp(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x40c_PhaseB_Temp(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x40e_Odometer(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x40e_Odometer(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x40e_BusAmphours(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x40e_BusAmphours(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x501_MotorVelocityCommand(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x501_MotorVelocityCommand(can_obj_ex1_h_t *o, dbcc_float_t in);
+int decode_can_0x501_MotorCurrentCommand(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x501_MotorCurrentCommand(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x502_BusCurrentCommand(const can_obj_ex1_h_t *o, dbcc_float_t *out);
+int encode_can_0x502_BusCurrentCommand(can_obj_ex1_h_t *o, dbcc_float_t in);
+
+
+int decode_can_0x8501930_Odometer_Velocity(const can_obj_ex1_h_t *o, int32_t *out);
+int encode_can_0x8501930_Odometer_Velocity(can_obj_ex1_h_t *o, int32_t in);
+
+
+int decode_can_0xcc0016e_MagicNode1Flags(const can_obj_ex1_h_t *o, uint16_t *out);
+int encode_can_0xcc0016e_MagicNode1Flags(can_obj_ex1_h_t *o, uint16_t in);
+
+
+#ifdef __cplusplus
+} 
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+/* Benchmark for the code generated by dbcc, this times how long it takes to
+ * unpack and then pack every message in a DBC file. It is built against the
+ * same DBC file generated with different options, see the makefile. */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include BENCH_HEADER
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS (2000u)
+#endif
+
+#define NELEMS(X) (sizeof(X) / sizeof((X)[0]))
+
+static const unsigned long ids[] = {
+#include "ids.inc"
+};
+
+static uint64_t frames[256];
+
+static uint64_t xorshift(uint64_t *s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 7;
+	*s ^= *s << 17;
+	return *s;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void)
+{
+	static BENCH_OBJ o;
+	uint64_t seed = 88172645463325252ull, check = 0;
+	unsigned long count = 0;
+	for (size_t i = 0; i < NELEMS(frames); i++)
+		frames[i] = xorshift(&seed);
+
+	const double start = now();
+	for (unsigned r = 0; r < BENCH_ROUNDS; r++) {
+		for (size_t i = 0; i < NELEMS(ids); i++) {
+			uint64_t data = frames[(r + i) % NELEMS(frames)];
+			if (unpack_message(&o, ids[i], data, 8, r) < 0)
+				continue;
+			if (pack_message(&o, ids[i], &data) < 0)
+				continue;
+			check ^= data;
+			count++;
+		}
+	}
+	const double ns = now() - start;
+	printf("%s: %lu frames, %.2f ns/frame (check %016llx)\n",
+		BENCH_HEADER, count, count ? ns / count : 0.0, (unsigned long long)check);
+#ifdef DBCC_FRAME_TYPE
+	/* generated with 'generate-batch', compare unpacking one frame at a
+	 * time with unpacking a batch of frames in one call */
+	static dbcc_frame_t batch[256];
+	uint32_t status[NELEMS(batch) / 32];
+	for (size_t i = 0; i < NELEMS(batch); i++) {
+		batch[i].id = ids[xorshift(&seed) % NELEMS(ids)];
+		batch[i].data = frames[i];
+		batch[i].dlc = 8;
+	}
+	unsigned long single = 0, batched = 0;
+	const double single_start = now();
+	for (unsigned r = 0; r < BENCH_ROUNDS; r++)
+		for (size_t i = 0; i < NELEMS(batch); i++)
+			single += unpack_message(&o, batch[i].id, batch[i].data, batch[i].dlc, r) >= 0;
+	const double single_ns = now() - single_start;
+	const double batch_start = now();
+	for (unsigned r = 0; r < BENCH_ROUNDS; r++)
+		batched += unpack_messages(&o, batch, NELEMS(batch), status);
+	const double batch_ns = now() - batch_start;
+	printf("%s: unpack_message %.2f ns/frame, unpack_messages %.2f ns/frame\n", BENCH_HEADER,
+		single ? single_ns / single : 0.0, batched ? batch_ns / batched : 0.0);
+#endif
+	return 0;
+}
@@ -0,0 +1,60 @@
+/* Benchmark for the header only C++ library generated by dbcc with '-c', this
+ * does the same as 'bench.c' does with the C code so the two can be compared,
+ * see the makefile. */
+#include <cstdio>
+#include <cstdint>
+#include <ctime>
+#include BENCH_HEADER
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS (2000u)
+#endif
+
+#define NELEMS(X) (sizeof(X) / sizeof((X)[0]))
+
+static const unsigned long ids[] = {
+#include "ids.inc"
+};
+
+static uint64_t frames[256];
+
+static uint64_t xorshift(uint64_t *s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 7;
+	*s ^= *s << 17;
+	return *s;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void)
+{
+	static BENCH_NAMESPACE::messages o;
+	uint64_t seed = 88172645463325252ull, check = 0;
+	unsigned long count = 0;
+	for (size_t i = 0; i < NELEMS(frames); i++)
+		frames[i] = xorshift(&seed);
+
+	const double start = now();
+	for (unsigned r = 0; r < BENCH_ROUNDS; r++) {
+		for (size_t i = 0; i < NELEMS(ids); i++) {
+			uint64_t data = frames[(r + i) % NELEMS(frames)];
+			if (!o.unpack(ids[i], data, 8))
+				continue;
+			if (!o.pack(ids[i], data))
+				continue;
+			check ^= data;
+			count++;
+		}
+	}
+	const double ns = now() - start;
+	printf("%s: %lu frames, %.2f ns/frame (check %016llx)\n",
+		BENCH_HEADER, count, count ? ns / count : 0.0, (unsigned long long)check);
+	return 0;
+}
@@ -0,0 +1,41 @@
+#!/usr/bin/perl
+#
+# Instruction count proxy for the generated pack/unpack functions, to be
+# run on the output of 'objdump -d'. As we cannot run code for a small
+# micro-controller on the build host we count the instructions in each
+# function and the number of calls to the compiler run time (which is where
+# 64-bit shifts and masks end up on most 32-bit micro-controllers). This
+# does not account for loops or branches, but the generated code has few,
+# apart from the interpreter used with 'use-tables' (the 'dbcc_table_'
+# functions) which loops over the signals of a message.
+#
+use strict;
+use warnings;
+
+my ($function, %insns, %calls);
+
+while(<>) {
+	my $line = $_;
+	if ($line =~ /^[0-9a-f]+ <((?:un)?pack_[^>]*|dbcc_table_[^>]*)>:/) {
+		$function = $1;
+		$insns{$function} = 0;
+		$calls{$function} = 0;
+		next;
+	}
+	if ($line =~ /^[0-9a-f]+ <.*>:/ or $line =~ /^\s*$/) {
+		$function = undef;
+		next;
+	}
+	next unless defined $function;
+	next unless $line =~ /^\s+[0-9a-f]+:\s+[0-9a-f]{2}/;
+	$insns{$function}++;
+	$calls{$function}++ if $line =~ /<(__aeabi_l|__ashldi3|__lshrdi3|__ashrdi3|__muldi3)/;
+}
+
+my ($total, $total_calls) = (0, 0);
+foreach my $f (sort keys %insns) {
+	printf "%-64s %6d %4d\n", $f, $insns{$f}, $calls{$f};
+	$total += $insns{$f};
+	$total_calls += $calls{$f};
+}
+printf "%-64s %6d %4d\n", "total (instructions, run time calls)", $total, $total_calls;
@@ -10,6 +10,8 @@
 #include <stdlib.h>
 #include <inttypes.h>
 #include <math.h>
+#include <string.h>
+#include <ctype.h>
 
 static signal_t *signal_new(void)
 {
@@ -139,7 +141,7 @@ static signal_t *ast2signal(mpc_ast_t *top, mpc_ast_t *ast, unsigned can_id)
 	sig->val_list = NULL;
 	r = sscanf(start->contents, "%u", &sig->start_bit);
 	/* BUG: Minor bug, an error should be returned here instead */
-	assert(r == 1 && sig->start_bit <= 64);
+	assert(r == 1 && sig->start_bit < 512); /* 64 byte CAN-FD frames */
 	r = sscanf(length->contents, "%u", &sig->bit_length);
 	assert(r == 1 && sig->bit_length <= 64);
 	char endchar = endianess->contents[0];
@@ -278,6 +280,23 @@ static mul_val_list_t *ast2mul_val(mpc_ast_t *top, mpc_ast_t *ast)
 	return mul_val;
 }
 
+/* CAN-FD frames longer than 8 bytes can only be one of a few lengths, the
+ * four bit DLC field is a code for them */
+static const unsigned char fd_lengths[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64, };
+
+unsigned can_fd_dlc_to_length(unsigned dlc)
+{
+	return fd_lengths[dlc & 15u];
+}
+
+unsigned can_fd_length_to_dlc(unsigned length)
+{
+	for (unsigned i = 0; i < 16; i++)
+		if (fd_lengths[i] >= length)
+			return i;
+	return 15;
+}
+
 static can_msg_t *ast2msg(mpc_ast_t *top, mpc_ast_t *ast, dbc_t *dbc)
 {
 	assert(top);
@@ -294,6 +313,16 @@ static can_msg_t *ast2msg(mpc_ast_t *top, mpc_ast_t *ast, dbc_t *dbc)
 	r = sscanf(id->contents,  "%lu", &c->id);
 	assert(r == 1);
 
+	if (c->dlc > 64)
+		error("message %s has a length of %u bytes, the maximum is 64 (fix your DBC file)", c->name, c->dlc);
+	if (c->dlc > 8) {
+		c->is_fd = true;
+		if (can_fd_dlc_to_length(can_fd_length_to_dlc(c->dlc)) != c->dlc) {
+			warning("message %s has a length of %u bytes, which is not a CAN-FD length, using %u", c->name, c->dlc, can_fd_dlc_to_length(can_fd_length_to_dlc(c->dlc)));
+			c->dlc = can_fd_dlc_to_length(can_fd_length_to_dlc(c->dlc));
+		}
+	}
+
 	/* Extended CAN messages use the top most bit (which should
 	 * not normally be set) to indicate that they are extended
 	 * and not normal messages. */
@@ -322,6 +351,21 @@ static can_msg_t *ast2msg(mpc_ast_t *top, mpc_ast_t *ast, dbc_t *dbc)
 	c->sigs = signal_s;
 	c->signal_count = j;
 
+	/* The generated code shifts signals out of the frame, a signal outside
+	 * of it would be an out of range shift. Classic messages are packed
+	 * into a 64-bit word whatever their length, and signals a little past
+	 * a short DLC are common, so only those outside of the word are an
+	 * error for them. */
+	const unsigned bits = c->is_fd ? c->dlc * 8 : 64;
+	for (size_t i = 0; i < c->signal_count; i++) {
+		const signal_t *sig = c->sigs[i];
+		unsigned end = sig->start_bit + sig->bit_length;
+		if (sig->endianess == endianess_motorola_e) /* MSB first, counting down in each byte */
+			end = (sig->start_bit / 8) * 8 + (7 - sig->start_bit % 8) + sig->bit_length;
+		if (sig->bit_length == 0 || end > bits)
+			error("signal %s in message %s does not fit in its %u bytes (fix your DBC file)", sig->name, c->name, bits / 8);
+	}
+
 	// assign val-s to the signals
 	for (size_t i = 0; i < c->signal_count; i++) {
 		for (size_t j = 0; j<dbc->val_count; j++) {
@@ -374,6 +418,125 @@ static can_msg_t *ast2msg(mpc_ast_t *top, mpc_ast_t *ast, dbc_t *dbc)
 	return c;
 }
 
+/* The tokens of an attribute definition or value are loosely parsed by the
+ * grammar, get the text of the 'n'th token, strings are unquoted */
+static const char *attribute_token(mpc_ast_t *ast, int n)
+{
+	assert(ast);
+	for (int i = 0; i < ast->children_num; i++) {
+		mpc_ast_t *child = ast->children[i];
+		if (!strstr(child->tag, "whatever"))
+			continue;
+		if (n--)
+			continue;
+		if (strstr(child->tag, "string"))
+			return child->children_num == 3 ? child->children[1]->contents : "";
+		return child->contents;
+	}
+	return NULL;
+}
+
+/* Look up the name of an enumerated message attribute value, for example
+ * 'BA_DEF_ BO_ "VFrameFormat" ENUM "StandardCAN","ExtendedCAN",...', returns
+ * NULL if there is no such definition. */
+static const char *attribute_enum_name(mpc_ast_t *top, const char *attribute, unsigned long value)
+{
+	assert(top);
+	assert(attribute);
+	for (int i = 0; i >= 0;) {
+		i = mpc_ast_get_index_lb(top, "attribute_definition|>", i);
+		if (i < 0)
+			break;
+		mpc_ast_t *def = mpc_ast_get_child_lb(top, "attribute_definition|>", i);
+		const char *type = attribute_token(def, 0);
+		const char *name = attribute_token(def, 1);
+		const char *kind = attribute_token(def, 2);
+		if (type && name && kind && !strcmp(type, "BO_") && !strcmp(name, attribute) && !strcmp(kind, "ENUM"))
+			return attribute_token(def, 3 + value);
+		i++;
+	}
+	return NULL;
+}
+
+/* The default for an attribute, given by 'BA_DEF_DEF_ "NAME" value;' */
+static const char *attribute_default(mpc_ast_t *top, const char *attribute)
+{
+	assert(top);
+	assert(attribute);
+	for (int i = 0; i >= 0;) {
+		i = mpc_ast_get_index_lb(top, "attribute_definition|>", i);
+		if (i < 0)
+			break;
+		mpc_ast_t *def = mpc_ast_get_child_lb(top, "attribute_definition|>", i);
+		const char *type = attribute_token(def, 0);
+		const char *name = attribute_token(def, 1);
+		if (type && name && !strcmp(type, "DEF_") && !strcmp(name, attribute))
+			return attribute_token(def, 2);
+		i++;
+	}
+	return NULL;
+}
+
+static can_msg_t *find_message(dbc_t *dbc, unsigned long id)
+{
+	assert(dbc);
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		if ((msg->id | ((unsigned long)msg->is_extended << 31)) == id)
+			return msg;
+	}
+	return NULL;
+}
+
+/* Process the message attributes we understand, which are the CAN-FD ones;
+ * 'BA_ "VFrameFormat" BO_ 123 14;' and 'BA_ "CANFD_BRS" BO_ 123 1;', the
+ * frame format is processed first as the bit rate switch has a default that
+ * only applies to CAN-FD messages, and the cycle time of a message from
+ * 'BA_ "GenMsgCycleTime" BO_ 123 10;'. */
+static void ast2attributes(mpc_ast_t *top, dbc_t *dbc)
+{
+	assert(top);
+	assert(dbc);
+	const char *brs = attribute_default(top, "CANFD_BRS");
+	const char *cycle_time = attribute_default(top, "GenMsgCycleTime");
+	static const char *passes[] = { "VFrameFormat", "CANFD_BRS", "GenMsgCycleTime", };
+
+	for (size_t i = 0; i < dbc->message_count; i++)
+		dbc->messages[i]->cycle_time = cycle_time ? strtoul(cycle_time, NULL, 10) : 0;
+
+	for (size_t pass = 0; pass < sizeof(passes) / sizeof(passes[0]); pass++) {
+		for (int i = 0; i >= 0;) {
+			i = mpc_ast_get_index_lb(top, "attribute_value|>", i);
+			if (i < 0)
+				break;
+			mpc_ast_t *ast = mpc_ast_get_child_lb(top, "attribute_value|>", i++);
+			const char *name  = attribute_token(ast, 0);
+			const char *type  = attribute_token(ast, 1);
+			const char *id    = attribute_token(ast, 2);
+			const char *value = attribute_token(ast, 3);
+			if (!name || !type || !id || !value || strcmp(type, "BO_") || strcmp(name, passes[pass]))
+				continue;
+			can_msg_t *msg = find_message(dbc, strtoul(id, NULL, 10));
+			if (!msg)
+				continue;
+			const unsigned long v = strtoul(value, NULL, 10);
+			const char *e = attribute_enum_name(top, name, v);
+			if (pass == 0)
+				msg->is_fd = msg->is_fd || (e ? strstr(e, "FD") != NULL : (v == 14 || v == 15));
+			else if (pass == 1)
+				msg->is_brs = e ? strcmp(e, "0") != 0 : v != 0;
+			else
+				msg->cycle_time = v;
+		}
+		if (pass == 0)
+			for (size_t i = 0; i < dbc->message_count; i++)
+				dbc->messages[i]->is_brs = dbc->messages[i]->is_fd && brs && strcmp(brs, "0");
+	}
+
+	for (size_t i = 0; i < dbc->message_count; i++)
+		debug("%s CAN-FD:%u BRS:%u cycle time:%u", dbc->messages[i]->name, dbc->messages[i]->is_fd, dbc->messages[i]->is_brs, dbc->messages[i]->cycle_time);
+}
+
 dbc_t *dbc_new(void)
 {
 	return allocate(sizeof(dbc_t));
@@ -397,6 +560,93 @@ void dbc_delete(dbc_t *dbc)
 	free(dbc);
 }
 
+static bool signal_is_referenced(can_msg_t *msg, signal_t *sig)
+{
+	assert(msg);
+	assert(sig);
+	for (size_t i = 0; i < msg->signal_count; i++)
+		for (size_t j = 0; j < msg->sigs[i]->mul_num; j++)
+			if (msg->sigs[i]->muxed[j] == sig)
+				return true;
+	return false;
+}
+
+/* Each line of 'list' is either "message" or "message.signal", blank lines
+ * and lines starting with '#' are ignored. Signals that are not listed are
+ * removed along with messages with none of their signals listed, apart from
+ * multiplexors and extended multiplexed signals which are needed to decode
+ * the others. */
+int dbc_subscribe(dbc_t *dbc, const char *list)
+{
+	assert(dbc);
+	assert(list);
+	char *text = duplicate(list);
+	char **entries = NULL;
+	bool *used = NULL;
+	size_t entry_count = 0;
+	for (char *line = strtok(text, "\r\n"); line; line = strtok(NULL, "\r\n")) {
+		while (isspace((unsigned char)*line))
+			line++;
+		for (size_t l = strlen(line); l && isspace((unsigned char)line[l - 1]); l--)
+			line[l - 1] = '\0';
+		if (*line == '\0' || *line == '#')
+			continue;
+		entries = reallocator(entries, sizeof(*entries) * (entry_count + 1));
+		entries[entry_count++] = line;
+	}
+	used = allocate(sizeof(*used) * (entry_count + 1));
+
+	size_t kept = 0;
+	bool use_float = false;
+	for (size_t i = 0; i < dbc->message_count; i++) {
+		can_msg_t *msg = dbc->messages[i];
+		const size_t name_length = strlen(msg->name);
+		bool whole = false, any = false;
+		for (size_t k = 0; k < entry_count; k++)
+			if (!strcmp(entries[k], msg->name))
+				whole = used[k] = true;
+		bool *keep = allocate(sizeof(*keep) * (msg->signal_count + 1));
+		for (size_t j = 0; j < msg->signal_count; j++) {
+			signal_t *sig = msg->sigs[j];
+			for (size_t k = 0; k < entry_count; k++) {
+				if (strncmp(entries[k], msg->name, name_length) || entries[k][name_length] != '.')
+					continue;
+				if (!strcmp(&entries[k][name_length + 1], sig->name))
+					keep[j] = used[k] = any = true;
+			}
+		}
+		if (!whole && !any) {
+			can_msg_delete(msg);
+			free(keep);
+			continue;
+		}
+		size_t signal_count = 0;
+		for (size_t j = 0; j < msg->signal_count; j++) {
+			signal_t *sig = msg->sigs[j];
+			if (whole || keep[j] || sig->is_multiplexor || sig->mul_num || signal_is_referenced(msg, sig)) {
+				use_float = use_float || sig->is_floating;
+				msg->sigs[signal_count++] = sig;
+			} else {
+				debug("unsubscribed from %s.%s", msg->name, sig->name);
+				signal_delete(sig);
+			}
+		}
+		msg->signal_count = signal_count;
+		dbc->messages[kept++] = msg;
+		free(keep);
+	}
+	dbc->message_count = kept;
+	dbc->use_float = dbc->use_float && use_float;
+
+	for (size_t k = 0; k < entry_count; k++)
+		if (!used[k])
+			warning("subscription to unknown message or signal: %s", entries[k]);
+	free(used);
+	free(entries);
+	free(text);
+	return 0;
+}
+
 void assign_comment_to_signal(dbc_t *dbc, const char *comment, unsigned message_id, const char * signal_name)
 {
 	for (size_t i = 0; i<dbc->message_count; i++) {
@@ -527,6 +777,8 @@ dbc_t *ast2dbc(mpc_ast_t *ast)
 	if (i >= 0)
 		d->use_float = true;
 
+	ast2attributes(ast, d);
+
 	// find and store the vals into the dbc: they will be assigned to
 	// signals later
 	mpc_ast_t *comments_ast = mpc_ast_get_child_lb(ast, "comments|>", 0);
@@ -69,17 +69,24 @@ struct signal_t {
 	char *comment;
 };
 
-typedef struct {
+typedef struct can_msg_t can_msg_t;
+
+struct can_msg_t {
 	char *name;          /**< can message name */
 	char *ecu;           /**< name of ECU */
 	signal_t **sigs;     /**< signals that can decode/encode this message*/
 	uint64_t data;       /**< data, up to eight bytes, not used for generation */
 	size_t signal_count; /**< number of signals */
-	unsigned dlc;        /**< length of CAN message 0-8 bytes */
+	unsigned dlc;        /**< length of CAN message in bytes; 0-8, or up to 64 for CAN-FD */
 	unsigned long id;    /**< identifier, 11 or 29 bit */
 	bool is_extended;    /**< is extended mode message (29bit) */
+	bool is_fd;          /**< is a CAN-FD message, from 'VFrameFormat' or a length over 8 bytes */
+	bool is_brs;         /**< CAN-FD bit rate switch is used, from 'CANFD_BRS' */
+	unsigned cycle_time; /**< in milliseconds, from 'GenMsgCycleTime', 0 if not sent cyclically */
 	char *comment;
-} can_msg_t;
+	can_msg_t *codec;    /**< first message with the same signals, sharing its codec, set by the C generator */
+	can_msg_t *table;    /**< first message with the same signal table, for 'use-tables', set by the C generator */
+};
 
 typedef struct {
 	bool use_float;       /**< true if floating point conversion routines are needed */
@@ -93,8 +100,11 @@ typedef struct {
 	char *dbc_version;    /**< Raw version string from DBC file's "VERSION" line (e.g. "1.0"), may be NULL if undefined */
 } dbc_t;
 
+unsigned can_fd_dlc_to_length(unsigned dlc);
+unsigned can_fd_length_to_dlc(unsigned length);
 dbc_t *ast2dbc(mpc_ast_t *ast);
 void dbc_delete(dbc_t *dbc);
+int dbc_subscribe(dbc_t *dbc, const char *list);
 
 #ifdef __cplusplus
 }
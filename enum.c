@@ -0,0 +1,283 @@
+/* Generated by DBCC, see <https://github.com/howerj/dbcc> 
+This file was generated by dbcc: See <https://github.com/howerj/dbcc>
+
+Consider donating; see the repo for more information, this project 
+requires your support to continue.
+
+For those with paid support or to inquire about paid support
+please Email <mailto:hello.operator.co.uk@gmail.com>.
+
+*/
+
+#include "enum.h"
+#include <inttypes.h>
+#include <assert.h>
+
+#define UNUSED(X) ((void)(X))
+
+static inline uint64_t reverse_byte_order(uint64_t x) {
+	x = (x & 0x00000000FFFFFFFF) << 32 | (x & 0xFFFFFFFF00000000) >> 32;
+	x = (x & 0x0000FFFF0000FFFF) << 16 | (x & 0xFFFF0000FFFF0000) >> 16;
+	x = (x & 0x00FF00FF00FF00FF) << 8  | (x & 0xFF00FF00FF00FF00) >> 8;
+	return x;
+}
+
+static inline int print_helper(int r, int print_return_value) {
+	return ((r >= 0) && (print_return_value >= 0)) ? r + print_return_value : -1;
+}
+
+static int pack_can_0x001_enum1(can_obj_enum_h_t *o, uint64_t *data) {
+	assert(o);
+	assert(data);
+	register uint64_t x;
+	register uint64_t i = 0;
+	/* state: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	x = ((uint8_t)(o->can_0x001_enum1.state)) & 0xf;
+	i |= x;
+	*data = (i);
+	o->can_0x001_enum1_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x001_enum1(can_obj_enum_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	assert(o);
+	assert(dlc <= 8);
+	register uint64_t x;
+	register uint64_t i = (data);
+	if (dlc < 8)
+		return -1;
+	/* state: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	x = i & 0xf;
+	o->can_0x001_enum1.state = x;
+	o->can_0x001_enum1_rx = 1;
+	o->can_0x001_enum1_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x001_state(const can_obj_enum_h_t *o, uint8_t *out) {
+	assert(o);
+	assert(out);
+	uint8_t rval = (uint8_t)(o->can_0x001_enum1.state);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x001_state(can_obj_enum_h_t *o, uint8_t in) {
+	assert(o);
+	o->can_0x001_enum1.state = in;
+	return 0;
+}
+
+int print_can_0x001_enum1(const can_obj_enum_h_t *o, FILE *output) {
+	assert(o);
+	assert(output);
+	int r = 0;
+	r = print_helper(r, fprintf(output, "state = (wire: %.0f)\n", (double)(o->can_0x001_enum1.state)));
+	return r;
+}
+
+static int pack_can_0x003_IVT_Ctrl(can_obj_enum_h_t *o, uint64_t *data) {
+	assert(o);
+	assert(data);
+	register uint64_t x;
+	register uint64_t i = 0;
+	/* IVT_Ctrl_Fuse_State: start-bit 13, length 1, endianess intel, scaling 1, offset 0 */
+	x = ((uint8_t)(o->can_0x003_IVT_Ctrl.IVT_Ctrl_Fuse_State)) & 0x1;
+	x <<= 13; 
+	i |= x;
+	*data = (i);
+	o->can_0x003_IVT_Ctrl_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x003_IVT_Ctrl(can_obj_enum_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	assert(o);
+	assert(dlc <= 8);
+	register uint64_t x;
+	register uint64_t i = (data);
+	if (dlc < 8)
+		return -1;
+	/* IVT_Ctrl_Fuse_State: start-bit 13, length 1, endianess intel, scaling 1, offset 0 */
+	x = (i >> 13) & 0x1;
+	o->can_0x003_IVT_Ctrl.IVT_Ctrl_Fuse_State = x;
+	o->can_0x003_IVT_Ctrl_rx = 1;
+	o->can_0x003_IVT_Ctrl_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x003_IVT_Ctrl_Fuse_State(const can_obj_enum_h_t *o, uint8_t *out) {
+	assert(o);
+	assert(out);
+	uint8_t rval = (uint8_t)(o->can_0x003_IVT_Ctrl.IVT_Ctrl_Fuse_State);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x003_IVT_Ctrl_Fuse_State(can_obj_enum_h_t *o, uint8_t in) {
+	assert(o);
+	o->can_0x003_IVT_Ctrl.IVT_Ctrl_Fuse_State = in;
+	return 0;
+}
+
+int print_can_0x003_IVT_Ctrl(const can_obj_enum_h_t *o, FILE *output) {
+	assert(o);
+	assert(output);
+	int r = 0;
+	r = print_helper(r, fprintf(output, "IVT_Ctrl_Fuse_State = (wire: %.0f)\n", (double)(o->can_0x003_IVT_Ctrl.IVT_Ctrl_Fuse_State)));
+	return r;
+}
+
+static int pack_can_0x004_enum2(can_obj_enum_h_t *o, uint64_t *data) {
+	assert(o);
+	assert(data);
+	register uint64_t x;
+	register uint64_t i = 0;
+	/* state: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	x = ((uint8_t)(o->can_0x004_enum2.state)) & 0xf;
+	i |= x;
+	*data = (i);
+	o->can_0x004_enum2_tx = 1;
+	return 8;
+}
+
+static int unpack_can_0x004_enum2(can_obj_enum_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	assert(o);
+	assert(dlc <= 8);
+	register uint64_t x;
+	register uint64_t i = (data);
+	if (dlc < 8)
+		return -1;
+	/* state: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	x = i & 0xf;
+	o->can_0x004_enum2.state = x;
+	o->can_0x004_enum2_rx = 1;
+	o->can_0x004_enum2_time_stamp_rx = time_stamp;
+	return 8;
+}
+
+int decode_can_0x004_state(const can_obj_enum_h_t *o, uint8_t *out) {
+	assert(o);
+	assert(out);
+	uint8_t rval = (uint8_t)(o->can_0x004_enum2.state);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x004_state(can_obj_enum_h_t *o, uint8_t in) {
+	assert(o);
+	o->can_0x004_enum2.state = in;
+	return 0;
+}
+
+int print_can_0x004_enum2(const can_obj_enum_h_t *o, FILE *output) {
+	assert(o);
+	assert(output);
+	int r = 0;
+	r = print_helper(r, fprintf(output, "state = (wire: %.0f)\n", (double)(o->can_0x004_enum2.state)));
+	return r;
+}
+
+static int pack_can_0x122_IVT_SleepAck(can_obj_enum_h_t *o, uint64_t *data) {
+	assert(o);
+	assert(data);
+	register uint64_t x;
+	register uint64_t i = 0;
+	/* IVT_SleepAck: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	x = ((uint8_t)(o->can_0x122_IVT_SleepAck.IVT_SleepAck)) & 0xf;
+	i |= x;
+	*data = (i);
+	o->can_0x122_IVT_SleepAck_tx = 1;
+	return 1;
+}
+
+static int unpack_can_0x122_IVT_SleepAck(can_obj_enum_h_t *o, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	assert(o);
+	assert(dlc <= 8);
+	register uint64_t x;
+	register uint64_t i = (data);
+	if (dlc < 1)
+		return -1;
+	/* IVT_SleepAck: start-bit 0, length 4, endianess intel, scaling 1, offset 0 */
+	x = i & 0xf;
+	x = (x & 0x8) ? (x | 0xf0) : x; 
+	o->can_0x122_IVT_SleepAck.IVT_SleepAck = x;
+	o->can_0x122_IVT_SleepAck_rx = 1;
+	o->can_0x122_IVT_SleepAck_time_stamp_rx = time_stamp;
+	return 1;
+}
+
+int decode_can_0x122_IVT_SleepAck(const can_obj_enum_h_t *o, int8_t *out) {
+	assert(o);
+	assert(out);
+	int8_t rval = (int8_t)(o->can_0x122_IVT_SleepAck.IVT_SleepAck);
+	*out = rval;
+	return 0;
+}
+
+int encode_can_0x122_IVT_SleepAck(can_obj_enum_h_t *o, int8_t in) {
+	assert(o);
+	o->can_0x122_IVT_SleepAck.IVT_SleepAck = in;
+	return 0;
+}
+
+int print_can_0x122_IVT_SleepAck(const can_obj_enum_h_t *o, FILE *output) {
+	assert(o);
+	assert(output);
+	int r = 0;
+	r = print_helper(r, fprintf(output, "IVT_SleepAck = (wire: %.0f)\n", (double)(o->can_0x122_IVT_SleepAck.IVT_SleepAck)));
+	return r;
+}
+
+int unpack_message(can_obj_enum_h_t *o, const unsigned long id, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp) {
+	assert(o);
+	assert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */
+	assert(dlc <= 8);         /* Maximum of 8 bytes in a CAN packet */
+	switch (id) {
+	case 0x001: return unpack_can_0x001_enum1(o, data, dlc, time_stamp);
+	case 0x003: return unpack_can_0x003_IVT_Ctrl(o, data, dlc, time_stamp);
+	case 0x004: return unpack_can_0x004_enum2(o, data, dlc, time_stamp);
+	case 0x122: return unpack_can_0x122_IVT_SleepAck(o, data, dlc, time_stamp);
+	default: break; 
+	}
+	return -1; 
+}
+
+int pack_message(can_obj_enum_h_t *o, const unsigned long id, uint64_t *data) {
+	assert(o);
+	assert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */
+	switch (id) {
+	case 0x001: return pack_can_0x001_enum1(o, data);
+	case 0x003: return pack_can_0x003_IVT_Ctrl(o, data);
+	case 0x004: return pack_can_0x004_enum2(o, data);
+	case 0x122: return pack_can_0x122_IVT_SleepAck(o, data);
+	default: break; 
+	}
+	return -1; 
+}
+
+int message_dlc(const unsigned long id) {
+	assert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */
+	switch (id) {
+	case 0x001: return 8;
+	case 0x003: return 8;
+	case 0x004: return 8;
+	case 0x122: return 1;
+	default: break; 
+	}
+	return -1; 
+}
+
+int print_message(const can_obj_enum_h_t *o, const unsigned long id, FILE *output) {
+	assert(o);
+	assert(id < (1ul << 29)); /* 29-bit CAN ID is largest possible */
+	assert(output);
+	switch (id) {
+	case 0x001: return print_can_0x001_enum1(o, output);
+	case 0x003: return print_can_0x003_IVT_Ctrl(o, output);
+	case 0x004: return print_can_0x004_enum2(o, output);
+	case 0x122: return print_can_0x122_IVT_SleepAck(o, output);
+	default: break; 
+	}
+	return -1; 
+}
+
@@ -0,0 +1,159 @@
+/* CAN message encoder/decoder: automatically generated - do not edit.
+
+This file was generated by dbcc: See <https://github.com/howerj/dbcc>
+
+Consider donating; see the repo for more information, this project 
+requires your support to continue.
+
+For those with paid support or to inquire about paid support
+please Email <mailto:hello.operator.co.uk@gmail.com>.
+
+*/
+
+#ifndef ENUM_H
+#define ENUM_H
+
+/* If the contents of this file have caused breaking changes for you, you could try using
+   an older version of the generator. You can specify this on the command line with
+   the -n option. */
+
+//DBC Version: `Version("")`
+
+#define DBCC_GENERATOR_VERSION (3)
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" { 
+#endif
+
+#ifndef PREPACK
+#define PREPACK
+#endif
+
+#ifndef POSTPACK
+#define POSTPACK
+#endif
+
+#ifndef DBCC_DOUBLE_TYPE
+#define DBCC_DOUBLE_TYPE
+typedef double dbcc_double_t;
+#endif
+
+#ifndef DBCC_FLOAT_TYPE
+#define DBCC_FLOAT_TYPE
+typedef float dbcc_float_t;
+#endif
+
+#ifndef DBCC_CACHE_ALIGN
+#ifdef __GNUC__
+#define DBCC_CACHE_ALIGN __attribute__((aligned(64)))
+#else
+#define DBCC_CACHE_ALIGN
+#endif
+#endif
+
+#ifndef DBCC_TIME_STAMP
+#define DBCC_TIME_STAMP
+typedef uint32_t dbcc_time_stamp_t; /* Time stamp for message; you decide on units */
+#endif
+
+#ifndef DBCC_STATUS_ENUM
+#define DBCC_STATUS_ENUM
+typedef enum {
+	DBCC_SIG_STAT_UNINITIALIZED_E = 0, /* Message never sent/received */
+	DBCC_SIG_STAT_OK_E            = 1, /* Message ok */
+	DBCC_SIG_STAT_ERROR_E         = 2, /* Encode/Decode/Timestamp/Any error */
+} dbcc_signal_status_e;
+#endif
+
+#define CAN_ID_ENUM1 (1) /* 0x1 */
+#define CAN_ID_IVT_CTRL (3) /* 0x3 */
+#define CAN_ID_ENUM2 (4) /* 0x4 */
+#define CAN_ID_IVT_SLEEPACK (290) /* 0x122 */
+
+typedef PREPACK struct {
+	uint8_t state; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x001_enum1_t;
+
+typedef enum {
+	CAN_0X001_ENUM1_STATE_INACTIVE = 0,
+	CAN_0X001_ENUM1_STATE_ACTIVE = 1,
+} can_0x001_enum1_state_e;
+
+/* Control message 2. */
+typedef PREPACK struct {
+	/* IVT_Ctrl_Fuse_State: cm 1 */
+	/* scaling 1.0, offset 0.0, units none */
+	uint8_t IVT_Ctrl_Fuse_State;
+} POSTPACK can_0x003_IVT_Ctrl_t;
+
+typedef enum {
+	CAN_0X003_IVT_CTRL_IVT_CTRL_FUSE_STATE_FUSE_2B__OR_FUSE_2D__OPEN = 0,
+	CAN_0X003_IVT_CTRL_IVT_CTRL_FUSE_STATE_FUSE_2B__AND_FUSE_2D__CLOSED = 1,
+} can_0x003_IVT_Ctrl_IVT_Ctrl_Fuse_State_e;
+
+typedef PREPACK struct {
+	uint8_t state; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x004_enum2_t;
+
+typedef PREPACK struct {
+	int8_t IVT_SleepAck; /* scaling 1.0, offset 0.0, units none */
+} POSTPACK can_0x122_IVT_SleepAck_t;
+
+/* Each message's members are grouped together, 1 message sent at least
+ * every 100 ms are aligned to a cache line. The object is about 64 bytes. */
+typedef PREPACK struct {
+	/* can_0x003_IVT_Ctrl: about 8 bytes (1 cache line), sent every 100 ms */
+	dbcc_time_stamp_t can_0x003_IVT_Ctrl_time_stamp_rx DBCC_CACHE_ALIGN;
+	unsigned can_0x003_IVT_Ctrl_status : 2;
+	unsigned can_0x003_IVT_Ctrl_tx : 1;
+	unsigned can_0x003_IVT_Ctrl_rx : 1;
+	can_0x003_IVT_Ctrl_t can_0x003_IVT_Ctrl;
+	/* can_0x001_enum1: about 8 bytes (1 cache line) */
+	dbcc_time_stamp_t can_0x001_enum1_time_stamp_rx;
+	unsigned can_0x001_enum1_status : 2;
+	unsigned can_0x001_enum1_tx : 1;
+	unsigned can_0x001_enum1_rx : 1;
+	can_0x001_enum1_t can_0x001_enum1;
+	/* can_0x004_enum2: about 8 bytes (1 cache line) */
+	dbcc_time_stamp_t can_0x004_enum2_time_stamp_rx;
+	unsigned can_0x004_enum2_status : 2;
+	unsigned can_0x004_enum2_tx : 1;
+	unsigned can_0x004_enum2_rx : 1;
+	can_0x004_enum2_t can_0x004_enum2;
+	/* can_0x122_IVT_SleepAck: about 8 bytes (1 cache line) */
+	dbcc_time_stamp_t can_0x122_IVT_SleepAck_time_stamp_rx;
+	unsigned can_0x122_IVT_SleepAck_status : 2;
+	unsigned can_0x122_IVT_SleepAck_tx : 1;
+	unsigned can_0x122_IVT_SleepAck_rx : 1;
+	can_0x122_IVT_SleepAck_t can_0x122_IVT_SleepAck;
+} POSTPACK can_obj_enum_h_t;
+
+int unpack_message(can_obj_enum_h_t *o, const unsigned long id, uint64_t data, uint8_t dlc, dbcc_time_stamp_t time_stamp);
+int pack_message(can_obj_enum_h_t *o, const unsigned long id, uint64_t *data);
+int message_dlc(const unsigned long id);
+int print_message(const can_obj_enum_h_t *o, const unsigned long id, FILE *output);
+
+int decode_can_0x001_state(const can_obj_enum_h_t *o, uint8_t *out);
+int encode_can_0x001_state(can_obj_enum_h_t *o, uint8_t in);
+
+
+int decode_can_0x003_IVT_Ctrl_Fuse_State(const can_obj_enum_h_t *o, uint8_t *out);
+int encode_can_0x003_IVT_Ctrl_Fuse_State(can_obj_enum_h_t *o, uint8_t in);
+
+
+int decode_can_0x004_state(const can_obj_enum_h_t *o, uint8_t *out);
+int encode_can_0x004_state(can_obj_enum_h_t *o, uint8_t in);
+
+
+int decode_can_0x122_IVT_SleepAck(const can_obj_enum_h_t *o, int8_t *out);
+int encode_can_0x122_IVT_SleepAck(can_obj_enum_h_t *o, int8_t in);
+
+
+#ifdef __cplusplus
+} 
+#endif
+
+#endif
@@ -3,6 +3,7 @@
  * @copyright Richard James Howe
  * @license MIT */
 #include <assert.h>
+#include <limits.h>
 #include <stdint.h>
 #include "mpc.h"
 #include "util.h"
@@ -13,6 +14,7 @@
 #include "2csv.h"
 #include "2bsm.h"
 #include "2json.h"
+#include "2cpp.h"
 #include "options.h"
 
 #ifndef NELEMS
@@ -25,12 +27,13 @@ typedef enum {
 	CONVERT_TO_CSV,
 	CONVERT_TO_BSM,
 	CONVERT_TO_JSON,
+	CONVERT_TO_CPP,
 } conversion_type_e;
 
 static void usage(const char *arg0)
 {
 	assert(arg0);
-	fprintf(stderr, "%s: [-] [-hvjgtxpkuDC] [-o dir] file*\n", arg0);
+	fprintf(stderr, "%s: [-] [-hvjgtxcpkuDC] [-o dir] file*\n", arg0);
 }
 
 static void help(void)
@@ -55,6 +58,7 @@ Options:\n\
 \t-C     convert output to CSV instead of the default C code\n\
 \t-b     convert output to BSM (beSTORM) instead of the default C code\n\
 \t-j     convert output to JSON instead of the default C code\n\
+\t-c     convert output to a header only C++ library instead of C code\n\
 \t-D     use 'double' for the encode/decode type messages\n\
 \t-o dir set the output directory\n\
 \t-p     generate only print code\n\
@@ -62,6 +66,7 @@ Options:\n\
 \t-u     generate only unpack code\n\
 \t-s     disable assert generation\n\
 \t-n [version] specify the version of the generated output. Defaults to the latest.\n\
+\t-O k=v set a C code generation option, see the manual page for a list\n\
 \tfile   process a DBC file\n\
 \n\
 Files must come after the arguments have been processed.\n\
@@ -91,6 +96,20 @@ static char *replace_file_type(const char *file, const char *suffix)
 	return name;
 }
 
+static void subscribe(dbc_t *dbc, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(copts);
+	if (!copts->subscriptions)
+		return;
+	FILE *l = fopen_or_die(copts->subscriptions, "rb");
+	char *list = slurp(l);
+	fclose(l);
+	if (!list || dbc_subscribe(dbc, list) < 0)
+		error("could not apply subscriptions from '%s'", copts->subscriptions);
+	free(list);
+}
+
 static int dbc2cWrapper(dbc_t *dbc, const char *dbc_file, const char *file_only, dbc2c_options_t *copts)
 {
 	assert(dbc);
@@ -99,11 +118,25 @@ static int dbc2cWrapper(dbc_t *dbc, const char *dbc_file, const char *file_only,
 	char *cname = replace_file_type(dbc_file,  "c");
 	char *hname = replace_file_type(dbc_file,  "h");
 	char *fname = replace_file_type(file_only, "h");
-	FILE *c = fopen_or_die(cname, "wb");
+	subscribe(dbc, copts);
+	FILE *c = copts->header_only ? NULL : fopen_or_die(cname, "wb");
 	FILE *h = fopen_or_die(hname, "wb");
-	const int r = dbc2c(dbc, c, h, fname, copts);
-	fclose(c);
+	int r = dbc2c(dbc, c, h, fname, copts);
+	if (c)
+		fclose(c);
 	fclose(h);
+	if (r >= 0 && copts->generate_def) {
+		char *stem = replace_file_type(dbc_file, "def");
+		stem[strlen(stem) - strlen(".def")] = '\0';
+		const size_t dname_size = strlen(stem) + sizeof "_signals.def";
+		char *dname = allocate(dname_size);
+		snprintf(dname, dname_size, "%s_signals.def", stem);
+		FILE *d = fopen_or_die(dname, "wb");
+		r = dbc2def(dbc, d, file_only, copts);
+		fclose(d);
+		free(dname);
+		free(stem);
+	}
 	free(cname);
 	free(hname);
 	free(fname);
@@ -158,6 +191,19 @@ static int dbc2jsonWrapper(dbc_t *dbc, const char *dbc_file, bool use_time_stamp
 	return r;
 }
 
+static int dbc2cppWrapper(dbc_t *dbc, const char *dbc_file, const char *file_only, dbc2c_options_t *copts)
+{
+	assert(dbc);
+	assert(dbc_file);
+	assert(file_only);
+	char *name = replace_file_type(dbc_file, "hpp");
+	subscribe(dbc, copts);
+	FILE *o = fopen_or_die(name, "wb");
+	const int r = dbc2cpp(dbc, o, file_only, copts);
+	fclose(o);
+	free(name);
+	return r;
+}
 
 static int flag(const char *v) { /* really should be case insensitive */
 	static char *y[] = { "yes", "on", "true", };
@@ -181,6 +227,35 @@ static int set_option(dbc2c_options_t *s, char *kv) {
 	}
 	*v++ = '\0';
 
+	if (!strcmp(k, "target")) {
+		if (!strcmp(v, "32bit"))      { s->target_32bit = true; }
+		else if (!strcmp(v, "64bit")) { s->target_32bit = false; }
+		else { return -1; }
+		return 0;
+	}
+
+	if (!strcmp(k, "layout")) {
+		if (!strcmp(v, "grouped"))    { s->group_messages = true; }
+		else if (!strcmp(v, "split")) { s->group_messages = false; }
+		else { return -1; }
+		return 0;
+	}
+
+	if (!strcmp(k, "hot-cycle-time")) {
+		char *end = NULL;
+		errno = 0;
+		const unsigned long ms = strtoul(v, &end, 10);
+		if (errno || *end || end == v || ms > UINT_MAX)
+			return -1;
+		s->hot_cycle_time = ms;
+		return 0;
+	}
+
+	if (!strcmp(k, "subscribe")) {
+		s->subscriptions = v;
+		return 0;
+	}
+
 	int r = flag(v);
 	if (r < 0) return -1;
 
@@ -191,6 +266,26 @@ static int set_option(dbc2c_options_t *s, char *kv) {
 	else if (!strcmp(k, "generate-pack"))    { s->generate_pack            = r; }
 	else if (!strcmp(k, "generate-unpack"))  { s->generate_unpack          = r; }
 	else if (!strcmp(k, "generate-asserts")) { s->generate_asserts         = r; }
+	else if (!strcmp(k, "use-byte-window"))  { s->use_byte_window          = r; }
+	else if (!strcmp(k, "generate-batch"))   { s->generate_batch           = r; }
+	else if (!strcmp(k, "generate-extract")) { s->generate_extract         = r; }
+	else if (!strcmp(k, "generate-series"))  { s->generate_series          = r; }
+	else if (!strcmp(k, "lazy-decode"))      { s->lazy_decode              = r; }
+	else if (!strcmp(k, "generate-subscriptions")) { s->generate_subscriptions = r; }
+	else if (!strcmp(k, "generate-changes")) { s->generate_changes         = r; }
+	else if (!strcmp(k, "use-fixed-point"))  { s->use_fixed_point          = r; }
+	else if (!strcmp(k, "use-tables"))       { s->use_tables               = r; }
+	else if (!strcmp(k, "generate-def"))     { s->generate_def             = r; }
+	else if (!strcmp(k, "generate-metadata")) { s->generate_metadata       = r; }
+	else if (!strcmp(k, "use-seqlock"))      { s->use_seqlock              = r; }
+	else if (!strcmp(k, "use-bitmaps"))      { s->use_bitmaps              = r; }
+	else if (!strcmp(k, "use-mux-unions"))   { s->use_mux_unions           = r; }
+	else if (!strcmp(k, "generate-phys"))    { s->generate_phys            = r; }
+	else if (!strcmp(k, "header-only"))      { s->header_only              = r; }
+	else if (!strcmp(k, "generate-format"))  { s->generate_format          = r; }
+	else if (!strcmp(k, "generate-patch"))   { s->generate_patch           = r; }
+	else if (!strcmp(k, "generate-build"))   { s->generate_build           = r; }
+	else if (!strcmp(k, "share-codecs"))     { s->share_codecs             = r; }
 	else { return -2; }
 	return 0;
 }
@@ -211,11 +306,12 @@ int main(int argc, char **argv)
 		.generate_pack             =  false,
 		.generate_unpack           =  false,
 		.generate_asserts          =  true,
+		.hot_cycle_time            =  100,
 		.version                   =  3,
 	};
 	int opt = 0;
 
-	while ((opt = dbcc_getopt(argc, argv, "hVvbjgxCNtDpukso:n:O:")) != -1) {
+	while ((opt = dbcc_getopt(argc, argv, "hVvbjgxcCNtDpukso:n:O:")) != -1) {
 		switch (opt) {
 		case 'h':
 			usage(argv[0]);
@@ -236,6 +332,9 @@ int main(int argc, char **argv)
 		case 'j':
 			convert = CONVERT_TO_JSON;
 			break;
+		case 'c':
+			convert = CONVERT_TO_CPP;
+			break;
 		case 'x':
 			convert = CONVERT_TO_XML;
 			break;
@@ -346,6 +445,9 @@ int main(int argc, char **argv)
 		case CONVERT_TO_JSON:
 			r = dbc2jsonWrapper(dbc, outpath, copts.use_time_stamps);
 			break;
+		case CONVERT_TO_CPP:
+			r = dbc2cppWrapper(dbc, outpath, dbcc_basename(argv[i]), &copts);
+			break;
 		default:
 			error("invalid conversion type: %d", convert);
 		}
@@ -0,0 +1,177 @@
+/* Check that the CAN-FD code generated for a long message packs and unpacks
+ * its first eight bytes exactly as the classic code does for a message with
+ * the same signals, see 'Classic' and 'Extended' in canfd.dbc, and that the
+ * signals past the first eight bytes, see 'Extended' and 'Boundary', are
+ * where a bit by bit reading of the frame puts them. */
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "canfd.h"
+
+#define ROUNDS (10000u)
+
+static uint64_t xorshift(uint64_t *s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 7;
+	*s ^= *s << 17;
+	return *s;
+}
+
+typedef struct {
+	const char *name;
+	unsigned long id;
+	unsigned start, length;
+	int motorola, is_signed;
+	size_t field, size; /* of the member of the message structure */
+} signal_t;
+
+#define SIGNAL(MSG, ID, NAME, START, LENGTH, MOTOROLA, SIGNED) \
+	{ #NAME, ID, START, LENGTH, MOTOROLA, SIGNED, offsetof(can_obj_canfd_h_t, MSG.NAME), sizeof(((can_obj_canfd_h_t*)0)->MSG.NAME) }
+
+static const signal_t signals[] = {
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, CellVoltage2,  77, 13, 0, 0),
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, PackCurrent,  103, 20, 1, 1),
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, Energy,       124, 64, 0, 0),
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, Temperature,  260,  9, 0, 1),
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, Status,       415, 31, 1, 0),
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, Timestamp,    448, 63, 0, 0),
+	SIGNAL(can_0x102_Extended, CAN_ID_EXTENDED, Flag,         511,  1, 0, 0),
+	SIGNAL(can_0x103_Boundary, CAN_ID_BOUNDARY, IntelSpan,     62,  4, 0, 0),
+	SIGNAL(can_0x103_Boundary, CAN_ID_BOUNDARY, MotorolaSpan,  61,  8, 1, 0),
+	SIGNAL(can_0x103_Boundary, CAN_ID_BOUNDARY, IntelWide,     76, 40, 0, 1),
+	SIGNAL(can_0x103_Boundary, CAN_ID_BOUNDARY, MotorolaWide, 131, 64, 1, 0),
+	SIGNAL(can_0x103_Boundary, CAN_ID_BOUNDARY, MotorolaLast, 495, 20, 1, 1),
+	SIGNAL(can_0x103_Boundary, CAN_ID_BOUNDARY, IntelLast,    504,  4, 0, 1),
+};
+
+/* The bit after 'bit' in a signal, Motorola signals run from the most
+ * significant bit of a byte to the least and on to the next byte */
+static unsigned next_bit(unsigned bit, int motorola)
+{
+	if (!motorola)
+		return bit + 1;
+	return bit % 8 ? bit - 1 : bit + 15;
+}
+
+static uint64_t frame_get(const uint8_t *fd, const signal_t *s)
+{
+	uint64_t x = 0;
+	unsigned bit = s->start;
+	for (unsigned i = 0; i < s->length; i++, bit = next_bit(bit, s->motorola)) {
+		const unsigned shift = s->motorola ? s->length - 1 - i : i;
+		x |= (uint64_t)((fd[bit / 8] >> (bit % 8)) & 1) << shift;
+	}
+	if (s->is_signed && s->length < 64 && ((x >> (s->length - 1)) & 1))
+		x |= ~0ull << s->length;
+	return x;
+}
+
+/* Read a member of a message structure, sign extended */
+static uint64_t member_get(const can_obj_canfd_h_t *o, const signal_t *s)
+{
+	uint64_t x = 0;
+	int64_t y = 0;
+	switch (s->size) {
+	case 1: { int8_t v; memcpy(&v, (const char*)o + s->field, 1); y = v; x = (uint8_t)v; break; }
+	case 2: { int16_t v; memcpy(&v, (const char*)o + s->field, 2); y = v; x = (uint16_t)v; break; }
+	case 4: { int32_t v; memcpy(&v, (const char*)o + s->field, 4); y = v; x = (uint32_t)v; break; }
+	default: memcpy(&x, (const char*)o + s->field, 8); y = (int64_t)x; break;
+	}
+	return s->is_signed ? (uint64_t)y : x;
+}
+
+static void member_set(can_obj_canfd_h_t *o, const signal_t *s, uint64_t x)
+{
+	if (s->is_signed && s->length < 64 && ((x >> (s->length - 1)) & 1))
+		x |= ~0ull << s->length;
+	else if (s->length < 64)
+		x &= (1ull << s->length) - 1;
+	switch (s->size) {
+	case 1: { const uint8_t v = x; memcpy((char*)o + s->field, &v, 1); break; }
+	case 2: { const uint16_t v = x; memcpy((char*)o + s->field, &v, 2); break; }
+	case 4: { const uint32_t v = x; memcpy((char*)o + s->field, &v, 4); break; }
+	default: memcpy((char*)o + s->field, &x, 8); break;
+	}
+}
+
+/* Unpack random frames and pack random values, checking each signal past
+ * the first eight bytes against the frame read a bit at a time */
+static unsigned check_signals(can_obj_canfd_h_t *o, uint64_t *seed, unsigned r)
+{
+	const size_t count = sizeof(signals) / sizeof(signals[0]);
+	unsigned failures = 0;
+	uint8_t fd[64];
+	for (size_t i = 0; i < sizeof(fd); i++)
+		fd[i] = xorshift(seed);
+	if (unpack_message_fd(o, CAN_ID_EXTENDED, fd, 64, r) < 0 || unpack_message_fd(o, CAN_ID_BOUNDARY, fd, 64, r) < 0) {
+		fprintf(stderr, "unpack failed in round %u\n", r);
+		return 1;
+	}
+	for (size_t i = 0; i < count; i++)
+		if (member_get(o, &signals[i]) != frame_get(fd, &signals[i])) {
+			fprintf(stderr, "unpacked %s differs in round %u\n", signals[i].name, r);
+			failures++;
+		}
+
+	for (size_t i = 0; i < count; i++)
+		member_set(o, &signals[i], xorshift(seed));
+	uint8_t extended[64] = { 0 }, boundary[64] = { 0 };
+	if (pack_message_fd(o, CAN_ID_EXTENDED, extended) != 64 || pack_message_fd(o, CAN_ID_BOUNDARY, boundary) != 64) {
+		fprintf(stderr, "pack failed in round %u\n", r);
+		return 1;
+	}
+	for (size_t i = 0; i < count; i++) {
+		const uint8_t *frame = signals[i].id == CAN_ID_EXTENDED ? extended : boundary;
+		if (member_get(o, &signals[i]) != frame_get(frame, &signals[i])) {
+			fprintf(stderr, "packed %s differs in round %u\n", signals[i].name, r);
+			failures++;
+		}
+	}
+	return failures;
+}
+
+int main(void)
+{
+	static can_obj_canfd_h_t o;
+	uint64_t seed = 88172645463325252ull;
+	unsigned failures = 0;
+
+	for (unsigned r = 0; r < ROUNDS; r++) {
+		uint8_t fd[64] = { 0 }, classic[8] = { 0 };
+		const uint64_t x = xorshift(&seed);
+		memset(&o.can_0x102_Extended, 0, sizeof(o.can_0x102_Extended));
+		o.can_0x100_Classic.Torque  = o.can_0x102_Extended.Torque  = (int16_t)x;
+		o.can_0x100_Classic.Speed   = o.can_0x102_Extended.Speed   = (uint16_t)(x >> 16);
+		o.can_0x100_Classic.Voltage = o.can_0x102_Extended.Voltage = (x >> 32) & 0xfff;
+		o.can_0x100_Classic.Mode    = o.can_0x102_Extended.Mode    = (x >> 44) & 0xf;
+		o.can_0x100_Classic.Counter = o.can_0x102_Extended.Counter = (uint8_t)(x >> 56);
+		if (pack_message_fd(&o, CAN_ID_CLASSIC, classic) != 8 || pack_message_fd(&o, CAN_ID_EXTENDED, fd) != 64) {
+			fprintf(stderr, "pack failed in round %u\n", r);
+			return 1;
+		}
+		if (memcmp(classic, fd, sizeof(classic))) {
+			fprintf(stderr, "packed frames differ in round %u\n", r);
+			failures++;
+		}
+
+		for (size_t i = 0; i < sizeof(fd); i++)
+			fd[i] = xorshift(&seed);
+		if (unpack_message_fd(&o, CAN_ID_CLASSIC, fd, 8, r) < 0 || unpack_message_fd(&o, CAN_ID_EXTENDED, fd, 64, r) < 0) {
+			fprintf(stderr, "unpack failed in round %u\n", r);
+			return 1;
+		}
+		if (o.can_0x100_Classic.Torque  != o.can_0x102_Extended.Torque  ||
+		    o.can_0x100_Classic.Speed   != o.can_0x102_Extended.Speed   ||
+		    o.can_0x100_Classic.Voltage != o.can_0x102_Extended.Voltage ||
+		    o.can_0x100_Classic.Mode    != o.can_0x102_Extended.Mode    ||
+		    o.can_0x100_Classic.Counter != o.can_0x102_Extended.Counter) {
+			fprintf(stderr, "unpacked signals differ in round %u\n", r);
+			failures++;
+		}
+		failures += check_signals(&o, &seed, r);
+	}
+	printf("canfd: %u rounds, %u failures\n", ROUNDS, failures);
+	return failures != 0;
+}
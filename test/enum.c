@@ -0,0 +1,29 @@
+/* Check that 'dbcc_signal_lookup' generated by 'generate-metadata' finds
+ * every signal of enum.dbc, whose names 'enum1.state' and 'enum2.state'
+ * differ in one character, and finds nothing for names that are not
+ * there. */
+#include <stdio.h>
+#include <string.h>
+#include "enum.h"
+
+int main(void)
+{
+	static const char *missing[] = { "", "state", "enum1", "enum3.state", "enum1.stat", "enum1.states", "Enum1.state", };
+	unsigned failures = 0;
+
+	for (size_t i = 0; i < DBCC_SIGNAL_COUNT; i++) {
+		const int index = dbcc_signal_lookup(dbcc_signals[i].name);
+		if (index < 0 || strcmp(dbcc_signals[index].name, dbcc_signals[i].name)) {
+			fprintf(stderr, "could not find '%s'\n", dbcc_signals[i].name);
+			failures++;
+		}
+	}
+	for (size_t i = 0; i < sizeof(missing) / sizeof(missing[0]); i++) {
+		if (dbcc_signal_lookup(missing[i]) >= 0) {
+			fprintf(stderr, "found '%s'\n", missing[i]);
+			failures++;
+		}
+	}
+	printf("enum: %u signals, %u failures\n", (unsigned)DBCC_SIGNAL_COUNT, failures);
+	return failures != 0;
+}
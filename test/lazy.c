@@ -0,0 +1,70 @@
+/* Check the lazy decoding of mux-overlap.dbc, which only stores the raw
+ * payload of a frame: a frame unpacks only if both multiplexors have a
+ * valid value, as it does when unpacked in full, and decoding a signal
+ * succeeds exactly when the multiplexors select it, giving its bits. */
+#include <stdio.h>
+#include <stdint.h>
+#include "mux-overlap.h"
+
+#define ROUNDS (10000u)
+
+static uint64_t xorshift(uint64_t *s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 7;
+	*s ^= *s << 17;
+	return *s;
+}
+
+static unsigned check(const char *name, int decoded, unsigned value, int present, uint64_t data, unsigned start, unsigned length)
+{
+	const unsigned bits = (data >> start) & ((1u << length) - 1u);
+	if ((decoded == 0) == present && (!present || value == bits))
+		return 0;
+	fprintf(stderr, "decoding %s from %016llx returned %d (%u)\n", name, (unsigned long long)data, decoded, value);
+	return 1;
+}
+
+int main(void)
+{
+	static const unsigned nested[] = { 0, 1, 2, 3, 4, 99, 100, 200, 300, 301, 65535, };
+	static can_obj_mux_overlap_h_t o;
+	uint64_t seed = 88172645463325252ull;
+	unsigned failures = 0;
+
+	for (unsigned r = 0; r < ROUNDS; r++) {
+		const uint64_t x = xorshift(&seed);
+		const unsigned top = x % 12, inner = nested[(x >> 8) % (sizeof(nested) / sizeof(nested[0]))];
+		const uint64_t data = (xorshift(&seed) & ~UINT64_C(0xffff0000ff)) | top | (uint64_t)inner << 24;
+		const int nesting = top >= 2 && top <= 7;
+		const int valid = top <= 9 && (!nesting || (inner >= 1 && (inner <= 3 || (inner >= 100 && inner <= 300))));
+
+		if ((unpack_message(&o, 0x693, data, 8, r) >= 0) != valid) {
+			fprintf(stderr, "unpack of %016llx did not return %s in round %u\n", (unsigned long long)data, valid ? "8" : "-1", r);
+			failures++;
+			continue;
+		}
+		if (!valid)
+			continue;
+		uint8_t u8 = 0;
+		uint16_t u16 = 0;
+		int d = decode_can_0x693_top_muxer(&o, &u8);
+		failures += check("top_muxer", d, u8, 1, data, 0, 8);
+		d = decode_can_0x693_low(&o, &u8);
+		failures += check("low", d, u8, top <= 3, data, 8, 8);
+		d = decode_can_0x693_middle(&o, &u8);
+		failures += check("middle", d, u8, top >= 2 && top <= 5, data, 16, 8);
+		d = decode_can_0x693_high(&o, &u8);
+		failures += check("high", d, u8, top >= 8, data, 8, 8);
+		d = decode_can_0x693_nested_muxer(&o, &u16);
+		failures += check("nested_muxer", d, u16, nesting, data, 24, 16);
+		d = decode_can_0x693_one(&o, &u8);
+		failures += check("one", d, u8, nesting && inner == 1, data, 40, 8);
+		d = decode_can_0x693_few(&o, &u8);
+		failures += check("few", d, u8, nesting && inner >= 1 && inner <= 3, data, 48, 8);
+		d = decode_can_0x693_many(&o, &u8);
+		failures += check("many", d, u8, nesting && inner >= 100 && inner <= 300, data, 56, 8);
+	}
+	printf("lazy: %u rounds, %u failures\n", ROUNDS, failures);
+	return failures != 0;
+}
@@ -0,0 +1,66 @@
+/* Check the code generated for the overlapping multiplexor ranges of
+ * mux-overlap.dbc (SG_MUL_VAL_) against the ranges themselves: a frame
+ * unpacks only if both multiplexors have a valid value, it unpacks exactly
+ * the signals whose ranges cover them, and packing the unpacked object
+ * gives back the bits of those signals. */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "mux-overlap.h"
+
+#define ROUNDS (10000u)
+
+static uint64_t xorshift(uint64_t *s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 7;
+	*s ^= *s << 17;
+	return *s;
+}
+
+int main(void)
+{
+	static const unsigned nested[] = { 0, 1, 2, 3, 4, 99, 100, 200, 300, 301, 65535, };
+	static can_obj_mux_overlap_h_t o;
+	can_0x693_overlapping_multiplex_t *m = &o.can_0x693_overlapping_multiplex;
+	uint64_t seed = 88172645463325252ull;
+	unsigned failures = 0;
+
+	for (unsigned r = 0; r < ROUNDS; r++) {
+		const uint64_t x = xorshift(&seed);
+		const unsigned top = x % 12, inner = nested[(x >> 8) % (sizeof(nested) / sizeof(nested[0]))];
+		const uint64_t data = (xorshift(&seed) & ~UINT64_C(0xffff0000ff)) | top | (uint64_t)inner << 24;
+		const int nesting = top >= 2 && top <= 7;
+		const int valid = top <= 9 && (!nesting || (inner >= 1 && (inner <= 3 || (inner >= 100 && inner <= 300))));
+		uint64_t mask = 0xff, packed = 0;
+		if (top <= 3 || top >= 8)
+			mask |= UINT64_C(0xff) << 8;
+		if (top >= 2 && top <= 5)
+			mask |= UINT64_C(0xff) << 16;
+		if (nesting) {
+			mask |= UINT64_C(0xffff) << 24;
+			if (inner == 1)
+				mask |= UINT64_C(0xff) << 40;
+			if (inner >= 1 && inner <= 3)
+				mask |= UINT64_C(0xff) << 48;
+			if (inner >= 100 && inner <= 300)
+				mask |= UINT64_C(0xff) << 56;
+		}
+
+		memset(m, 0, sizeof(*m));
+		const int unpacked = unpack_message(&o, 0x693, data, 8, r);
+		if ((unpacked >= 0) != valid) {
+			fprintf(stderr, "unpack of %016llx returned %d in round %u\n", (unsigned long long)data, unpacked, r);
+			failures++;
+			continue;
+		}
+		if (!valid)
+			continue;
+		if (pack_message(&o, 0x693, &packed) < 0 || packed != (data & mask)) {
+			fprintf(stderr, "%016llx packed as %016llx in round %u\n", (unsigned long long)data, (unsigned long long)packed, r);
+			failures++;
+		}
+	}
+	printf("mux-overlap: %u rounds, %u failures\n", ROUNDS, failures);
+	return failures != 0;
+}
@@ -0,0 +1,33 @@
+/* Check the subscriptions generated for mux-overlap.dbc: an object that is
+ * all zeros unpacks every signal, and after 'subscribe_message' only the
+ * signals subscribed to, and the multiplexors, are unpacked. */
+#include <stdio.h>
+#include <stdint.h>
+#include "mux-overlap.h"
+
+int main(void)
+{
+	static can_obj_mux_overlap_h_t o;
+	can_0x693_overlapping_multiplex_t *m = &o.can_0x693_overlapping_multiplex;
+	const uint64_t data = UINT64_C(0x0000000001332202); /* top_muxer 2, nested_muxer 1 */
+	unsigned failures = 0;
+
+	if (unpack_message(&o, 0x693, data, 8, 0) < 0 || m->top_muxer != 2 || m->low != 0x22 || m->middle != 0x33 || m->nested_muxer != 1) {
+		fprintf(stderr, "an object that is all zeros did not unpack every signal\n");
+		failures++;
+	}
+	if (subscribe_message(&o, 0x693, CAN_0X693_OVERLAPPING_MULTIPLEX_SUB_MIDDLE) < 0) {
+		fprintf(stderr, "subscribing failed\n");
+		failures++;
+	}
+	if (unpack_message(&o, 0x693, UINT64_C(0x0000000001443303), 8, 1) < 0 || m->top_muxer != 3 || m->low != 0x22 || m->middle != 0x44 || m->nested_muxer != 1) {
+		fprintf(stderr, "a signal not subscribed to was unpacked, or one subscribed to was not\n");
+		failures++;
+	}
+	if (subscribe_message(&o, 0x693, UINT64_MAX) < 0 || unpack_message(&o, 0x693, data, 8, 2) < 0 || m->low != 0x22 || m->middle != 0x33) {
+		fprintf(stderr, "subscribing to every signal did not unpack them\n");
+		failures++;
+	}
+	printf("subscribe: %u failures\n", failures);
+	return failures != 0;
+}
@@ -1,5 +1,7 @@
 #include "util.h"
+#include "can.h"
 #include <assert.h>
+#include <ctype.h>
 #include <errno.h>
 #include <stdarg.h>
 #include <stdlib.h>
@@ -154,6 +156,101 @@ fail:
 	return NULL;
 }
 
+/* The bit a signal starts at in a payload, which is byte reversed first if
+ * the signal is Motorola (big endian) */
+unsigned fix_start_bit(bool motorola, unsigned start, unsigned siglen)
+{
+	if (motorola)
+		start = (8 * (7 - (start / 8))) + (start % 8) - (siglen - 1);
+	return start;
+}
+
+const char *determine_unsigned_type(unsigned length)
+{
+	const char *type = "uint64_t";
+	if (length <= 32)
+		type = "uint32_t";
+	if (length <= 16)
+		type = "uint16_t";
+	if (length <= 8)
+		type = "uint8_t";
+	return type;
+}
+
+const char *determine_signed_type(unsigned length)
+{
+	const char *type = "int64_t";
+	if (length <= 32)
+		type = "int32_t";
+	if (length <= 16)
+		type = "int16_t";
+	if (length <= 8)
+		type = "int8_t";
+	return type;
+}
+
+/* Print a floating point constant, in hexadecimal if '%g' loses precision */
+const char *double_constant(char *buf, size_t length, double x)
+{
+	assert(buf);
+	snprintf(buf, length, "%g", x);
+	if (strtod(buf, NULL) != x)
+		snprintf(buf, length, "%a", x);
+	return buf;
+}
+
+/* Make a string into an identifier, characters that cannot be in one are
+ * replaced by their hexadecimal value, spaces by underscores and letters are
+ * put in upper case if 'upper' is positive, lower case if it is negative */
+char *escape_string(const char *s, int upper) {
+	const size_t max_char_len = 4;
+	const size_t l = strlen(s) * max_char_len + 1;
+	char *n = allocate(l);
+	int ch = 0;
+	for (size_t i = 0, j = 0; (ch = s[i]); i++) {
+		assert(j < l);
+		ch = ch == ' ' ? '_' : ch;
+		if (!isalnum(ch) && ch != '_') {
+
+			sprintf(&n[j], "_%02x_", ch);
+			j += max_char_len;
+		} else {
+			if (upper > 0)
+				ch = toupper(ch);
+			if (upper < 0)
+				ch = tolower(ch);
+			n[j++] = ch;
+		}
+	}
+	return n;
+}
+
+/* sort messages by ID, for 'qsort' */
+int message_compare_function(const void *a, const void *b)
+{
+	assert(a);
+	assert(b);
+	can_msg_t *ap = *((can_msg_t**)a);
+	can_msg_t *bp = *((can_msg_t**)b);
+	if (ap->id <  bp->id) return -1;
+	if (ap->id == bp->id) return  0;
+	if (ap->id >  bp->id) return  1;
+	return 0;
+}
+
+/* sort signals by size for better struct packing, for 'qsort' */
+int signal_compare_function(const void *a, const void *b)
+{
+	assert(a);
+	assert(b);
+	signal_t *ap = *((signal_t**)a);
+	signal_t *bp = *((signal_t**)b);
+	if (ap->bit_length <  bp->bit_length) return  1;
+	if (ap->bit_length == bp->bit_length) return  0;
+	if (ap->bit_length >  bp->bit_length) return -1;
+	return 0;
+}
+
 /* Stolen from musl-libc!
  * <https://www.musl-libc.org/download.html>
  *
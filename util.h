@@ -38,6 +38,15 @@ void *reallocator(void *p, size_t n);
 char *slurp(FILE *f);
 char *dbcc_basename(char *s);
 
+/* Shared by the code generators */
+unsigned fix_start_bit(bool motorola, unsigned start, unsigned siglen);
+const char *determine_unsigned_type(unsigned length);
+const char *determine_signed_type(unsigned length);
+const char *double_constant(char *buf, size_t length, double x);
+char *escape_string(const char *s, int upper);
+int message_compare_function(const void *a, const void *b);
+int signal_compare_function(const void *a, const void *b);
+
 #ifdef __cplusplus
 }
 #endif